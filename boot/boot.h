@@ -0,0 +1,43 @@
+#ifndef JOS_BOOT_BOOT_H
+#define JOS_BOOT_BOOT_H
+
+#ifndef __ASSEMBLER__
+#include <inc/types.h>
+#endif
+
+/*
+ * Definitions shared by the two stages of the boot loader.
+ *
+ * BOOT2 (the load and entry address of stage 2) and BOOT2_NSECT (the
+ * number of sectors reserved for it just after the MBR) come from
+ * boot/Makefrag, which also uses them to lay out kernel.img.
+ */
+
+#define SECTSIZE	512
+#define MAXSECTS	255	// most sectors one READ SECTORS command can move
+
+// The kernel image starts right after the sectors reserved for stage 2.
+#define KERNSECT	(1 + BOOT2_NSECT)
+
+// When the BIOS supports INT 13h extensions, stage 1 reads a compressed
+// kernel image into this bounce buffer before leaving real mode (see
+// boot.S), and stage 2 unpacks it from there instead of the disk.
+#define BOUNCE		0x40000
+#define BOUNCE_NSECT	512	// room up to 0x80000, below the EBDA
+
+#ifndef __ASSEMBLER__
+
+// boot/disk.c
+void waitdisk(void);
+void readsects(void *dst, uint32_t offset, uint32_t nsect);
+
+// boot/dma.c (stage 2 only)
+int dma_init(void);
+int dma_readsects(void *dst, uint32_t offset, uint32_t nsect);
+
+// boot/e820.S (stage 2 only)
+void e820_detect(void);
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !JOS_BOOT_BOOT_H */
@@ -0,0 +1,272 @@
+#include <inc/x86.h>
+#include <inc/elf.h>
+#include <inc/zimage.h>
+#include <inc/string.h>
+#include <inc/bootinfo.h>
+
+#include <boot/boot.h>
+
+/**********************************************************************
+ * Stage 2 of the boot loader.  Stage 1 (boot.S and main.c) has
+ * already switched to 32-bit protected mode, set up a stack and
+ * loaded this code at BOOT2; see main.c for the overall picture.
+ *
+ *  * boot2main() fetches the BIOS memory map (see e820.S) and
+ *    enables A20, which boot.S leaves to us, then reads in the
+ *    kernel, zeroes each segment's uninitialized tail (.bss),
+ *    records what it did in the struct Bootinfo at BOOTINFO, and
+ *    jumps to the kernel.
+ *
+ *  * Image sectors that boot.S already read into BOUNCE with BIOS
+ *    calls are taken from there.  Other disk reads use IDE bus-master
+ *    DMA when the PCI bus has a suitable controller (see dma.c), and
+ *    PIO otherwise.
+ *
+ *  * The kernel image is either a plain ELF file or, as kernel.img
+ *    is normally built, the LZ4-compressed format in inc/zimage.h,
+ *    which is decompressed into place as it is read.
+ *
+ *  * Along the way it extends the boot timeline in struct Bootinfo
+ *    that boot.S started.
+ *
+ *  * boot2main() must stay the first function in this file: stage 1
+ *    jumps to the very first byte of stage 2.
+ **********************************************************************/
+
+#define ELFHDR		((struct Elf *) 0x10000) // scratch space
+#define ZHDR		((struct Zimage *) ELFHDR)
+
+// Window of compressed image data, big enough for any block
+#define ZBUF		0x20000
+#define ZBUFSIZE	(2 * ZBLKSIZE)
+
+void readseg(uint32_t, uint32_t, uint32_t);
+static void enable_a20(void);
+static uint32_t load_elf(void);
+static uint32_t load_zimage(void);
+
+static bool usedma;		// read the disk with DMA rather than PIO
+static uint32_t bounce_nsect;	// leading image sectors already in BOUNCE
+
+void
+boot2main(int32_t nbounce)
+{
+	struct Bootinfo *bi = (struct Bootinfo *) BOOTINFO;
+	uint32_t entry;
+
+	// boot.S stamped the first two timeline entries
+	bi->bi_stamp[0].bs_stage = BT_START;
+	bi->bi_stamp[0].bs_arg = 0;
+	bi->bi_stamp[1].bs_stage = BT_PROTMODE;
+	bi->bi_stamp[1].bs_arg = nbounce;
+	bi->bi_nstamp = 2;
+	bootinfo_stamp(bi, BT_BOOT2, 0);
+
+	e820_detect();
+	bootinfo_stamp(bi, BT_E820, bi->bi_ne820);
+
+	enable_a20();
+
+	bounce_nsect = nbounce;
+	usedma = (dma_init() == 0);
+
+	// read 1st page off disk
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+
+	// is this a valid ELF or compressed image?
+	if (ELFHDR->e_magic == ELF_MAGIC)
+		entry = load_elf();
+	else if (ZHDR->z_magic == ZIMAGE_MAGIC)
+		entry = load_zimage();
+	else
+		goto bad;
+
+	bootinfo_stamp(bi, BT_LOADED, 0);
+
+	// tell the kernel it need not clear its own .bss
+	bi->bi_magic = BOOTINFO_MAGIC;
+	bi->bi_flags = BI_BSS_ZEROED;
+
+	// call the entry point from the image header
+	// note: does not return!
+	((void (*)(void)) entry)();
+
+bad:
+	outw(0x8A00, 0x8A00);
+	outw(0x8A00, 0x8E00);
+	while (1)
+		/* do nothing */;
+}
+
+// Enable A20:
+//   For backwards compatibility with the earliest PCs, physical
+//   address line 20 is tied low, so that addresses higher than
+//   1MB wrap around to zero by default.  This code undoes this.
+static void
+enable_a20(void)
+{
+	while (inb(0x64) & 0x2)		// wait for not busy
+		/* do nothing */;
+	outb(0x64, 0xd1);
+	while (inb(0x64) & 0x2)
+		/* do nothing */;
+	outb(0x60, 0xdf);
+}
+
+// Zero 'count' bytes at physical address 'pa', 4 at a time.  This may
+// clear up to 3 bytes too many, which is harmless since readseg()
+// already overshoots by up to a sector.
+static void
+zeroseg(uint32_t pa, uint32_t count)
+{
+	stosl((void *) pa, 0, (count + 3) / 4);
+}
+
+static uint32_t
+load_elf(void)
+{
+	struct Proghdr *ph, *eph;
+
+	// load each program segment (ignores ph flags)
+	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+	eph = ph + ELFHDR->e_phnum;
+	for (; ph < eph; ph++) {
+		// p_pa is the load address of this segment (as well
+		// as the physical address).  Only the first p_filesz
+		// bytes are on disk; the rest is zero, so clear it
+		// in memory rather than reading it.
+		readseg(ph->p_pa, ph->p_filesz, ph->p_offset);
+		zeroseg(ph->p_pa + ph->p_filesz, ph->p_memsz - ph->p_filesz);
+	}
+	return ELFHDR->e_entry;
+}
+
+// Decode the LZ4 block of 'zlen' bytes at 'src' to 'dst', and return
+// the end of the output.  Matches may reach back before 'dst' into
+// blocks decoded earlier.
+static uint8_t *
+lz4_block(uint8_t *dst, const uint8_t *src, uint32_t zlen)
+{
+	const uint8_t *end = src + zlen;
+	uint8_t *m;
+	uint32_t len, tok;
+
+	while (src < end) {
+		tok = *src++;
+
+		// literals
+		len = tok >> 4;
+		if (len == 15)
+			do len += *src; while (*src++ == 255);
+		memcpy(dst, src, len);
+		dst += len;
+		src += len;
+		if (src >= end)
+			break;	// the last sequence has no match
+
+		// match: copy forwards, since it may overlap its output
+		m = dst - (src[0] | src[1] << 8);
+		src += 2;
+		len = tok & 15;
+		if (len == 15)
+			do len += *src; while (*src++ == 255);
+		for (len += 4; len > 0; len--)
+			*dst++ = *m++;
+	}
+	return dst;
+}
+
+static uint32_t zbuf_off, zbuf_end;	// image bytes now in ZBUF
+
+// Return a pointer to image bytes [off, off+len), sliding the ZBUF
+// window forward over the disk if they are not already buffered.
+// Never reads past image offset 'lim'.
+static uint8_t *
+zfetch(uint32_t off, uint32_t len, uint32_t lim)
+{
+	// if boot.S prefetched these bytes, use them where they are
+	if (off + len <= bounce_nsect * SECTSIZE)
+		return (uint8_t *) BOUNCE + off;
+
+	if (off < zbuf_off || off + len > zbuf_end) {
+		zbuf_off = off & ~(SECTSIZE - 1);
+		zbuf_end = MIN(zbuf_off + ZBUFSIZE, lim);
+		readseg(ZBUF, zbuf_end - zbuf_off, zbuf_off);
+	}
+	return (uint8_t *) ZBUF + (off - zbuf_off);
+}
+
+static uint32_t
+load_zimage(void)
+{
+	struct Zseg *zs, *ezs;
+	uint32_t off, lim, hdr, zlen;
+	uint8_t *dst, *src;
+
+	zs = (struct Zseg *) (ZHDR + 1);
+	ezs = zs + ZHDR->z_nseg;
+	for (; zs < ezs; zs++) {
+		// Decompress one block at a time straight to the load
+		// address, reading the disk a window at a time.
+		dst = (uint8_t *) zs->zs_pa;
+		off = zs->zs_offset;
+		lim = off + zs->zs_zsize;
+		while (off < lim) {
+			hdr = *(uint32_t *) zfetch(off, 4, lim);
+			zlen = hdr & ~ZBLK_STORED;
+			src = zfetch(off + 4, zlen, lim);
+			if (hdr & ZBLK_STORED) {
+				memcpy(dst, src, zlen);
+				dst += zlen;
+			} else
+				dst = lz4_block(dst, src, zlen);
+			off += 4 + zlen;
+		}
+		zeroseg(zs->zs_pa + zs->zs_filesz, zs->zs_memsz - zs->zs_filesz);
+	}
+	return ZHDR->z_entry;
+}
+
+// Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
+// Might copy more than asked
+void
+readseg(uint32_t pa, uint32_t count, uint32_t offset)
+{
+	uint32_t end_pa, nsect;
+
+	end_pa = pa + count;
+
+	// round down to sector boundary
+	pa &= ~(SECTSIZE - 1);
+
+	// translate from bytes to sectors within the image
+	offset = offset / SECTSIZE;
+
+	// Read as many sectors per disk command as the controller allows.
+	// We'd write more to memory than asked, but it doesn't matter --
+	// we load in increasing order.
+	while (pa < end_pa) {
+		nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+		if (nsect > MAXSECTS)
+			nsect = MAXSECTS;
+		// Since we haven't enabled paging yet and we're using
+		// an identity segment mapping (see boot.S), we can
+		// use physical addresses directly.  This won't be the
+		// case once JOS enables the MMU.
+		if (offset + nsect <= bounce_nsect)
+			memcpy((uint8_t*) pa, (uint8_t*) BOUNCE + offset * SECTSIZE,
+			       nsect * SECTSIZE);
+		else {
+			// the kernel starts at disk sector KERNSECT.
+			// If DMA fails, use PIO from then on.
+			if (usedma && dma_readsects((uint8_t*) pa,
+						    KERNSECT + offset, nsect) < 0)
+				usedma = 0;
+			if (!usedma)
+				readsects((uint8_t*) pa, KERNSECT + offset, nsect);
+		}
+		pa += nsect * SECTSIZE;
+		offset += nsect;
+	}
+	bootinfo_stamp((struct Bootinfo *) BOOTINFO, BT_READSEG, count);
+}
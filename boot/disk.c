@@ -0,0 +1,36 @@
+#include <inc/x86.h>
+
+#include <boot/boot.h>
+
+// Programmed I/O access to the first IDE disk, shared by both stages
+// of the boot loader.  Keep this small: stage 1 has to fit in the MBR.
+
+void
+waitdisk(void)
+{
+	// wait for disk reaady
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+		/* do nothing */;
+}
+
+// Read 'nsect' (1..MAXSECTS) consecutive sectors starting at sector
+// 'offset' into 'dst' with a single READ SECTORS command.
+void
+readsects(void *dst, uint32_t offset, uint32_t nsect)
+{
+	// wait for disk to be ready
+	waitdisk();
+
+	outb(0x1F2, nsect);	// sector count
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+	outb(0x1F5, offset >> 16);
+	outb(0x1F6, (offset >> 24) | 0xE0);
+	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+	// the drive raises DRQ once per sector, so wait before each one
+	for (; nsect > 0; nsect--, dst += SECTSIZE) {
+		waitdisk();
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+}
@@ -0,0 +1,141 @@
+#include <inc/x86.h>
+
+#include <boot/boot.h>
+
+// Bus-master DMA reads from the first IDE disk, for stage 2 of the
+// boot loader.  We look for a PCI IDE controller whose primary channel
+// is in compatibility mode (so the drive is at 0x1F0, where disk.c
+// expects it) and can act as bus master, as QEMU's PIIX3 does.  The
+// caller falls back to disk.c's PIO when there is none.
+
+// PCI configuration space access, mechanism #1
+#define PCI_CONF_ADDR	0xCF8
+#define PCI_CONF_DATA	0xCFC
+
+#define PCI_ID_REG		0x00
+#define PCI_COMMAND_STATUS_REG	0x04
+#define   PCI_COMMAND_IO_ENABLE		0x1
+#define   PCI_COMMAND_MASTER_ENABLE	0x4
+#define PCI_CLASS_REG		0x08	// class, subclass, prog-if, revision
+#define   PCI_CLASS_IDE			0x0101
+#define   PCI_IDE_PRI_NATIVE		0x01	// prog-if: primary in native mode
+#define   PCI_IDE_BUS_MASTER		0x80	// prog-if: bus master capable
+#define PCI_BMBAR_REG		0x20	// BAR4: bus master I/O base
+
+// Bus master IDE registers for the primary channel
+#define BM_CMD		0
+#define   BM_CMD_START	0x01
+#define   BM_CMD_READ	0x08	// transfer from the device to memory
+#define BM_STATUS	2
+#define   BM_STATUS_ERR	0x02
+#define   BM_STATUS_INTR 0x04
+#define BM_PRDT		4
+
+// Physical region descriptor.  A region may not cross a 64KB boundary.
+struct Prd {
+	uint32_t prd_addr;
+	uint16_t prd_count;	// bytes; 0 means 64KB
+	uint16_t prd_flags;
+};
+#define PRD_EOT		0x8000	// last descriptor in the table
+
+// MAXSECTS sectors span at most three 64KB regions
+static struct Prd prdt[3] __attribute__((__aligned__(8)));
+static uint32_t bmbase;
+
+static uint32_t
+pci_conf_read(uint32_t dev, uint32_t func, uint32_t reg)
+{
+	outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+	return inl(PCI_CONF_DATA);
+}
+
+static void
+pci_conf_write(uint32_t dev, uint32_t func, uint32_t reg, uint32_t v)
+{
+	outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+	outl(PCI_CONF_DATA, v);
+}
+
+// Find a usable bus-master IDE controller on PCI bus 0 and enable it.
+// Returns 0 on success, -1 if there is none.
+int
+dma_init(void)
+{
+	uint32_t dev, func, class, progif, bar, cmd;
+
+	for (dev = 0; dev < 32; dev++)
+		for (func = 0; func < 8; func++) {
+			if ((pci_conf_read(dev, func, PCI_ID_REG) & 0xFFFF) == 0xFFFF)
+				continue;
+			class = pci_conf_read(dev, func, PCI_CLASS_REG);
+			progif = (class >> 8) & 0xFF;
+			if ((class >> 16) != PCI_CLASS_IDE
+			    || (progif & PCI_IDE_PRI_NATIVE)
+			    || !(progif & PCI_IDE_BUS_MASTER))
+				continue;
+			bar = pci_conf_read(dev, func, PCI_BMBAR_REG);
+			if (!(bar & 1) || !(bar & ~3))
+				continue;	// not an assigned I/O BAR
+
+			// Writing 0 to the status half leaves it unchanged.
+			cmd = pci_conf_read(dev, func, PCI_COMMAND_STATUS_REG);
+			pci_conf_write(dev, func, PCI_COMMAND_STATUS_REG,
+				       (cmd & 0xFFFF) | PCI_COMMAND_IO_ENABLE
+				       | PCI_COMMAND_MASTER_ENABLE);
+			bmbase = bar & ~3;
+			return 0;
+		}
+	return -1;
+}
+
+// Read 'nsect' (1..MAXSECTS) sectors starting at sector 'offset'
+// straight to physical address 'dst' with one READ DMA command.
+// Returns 0 on success, -1 on any error.
+int
+dma_readsects(void *dst, uint32_t offset, uint32_t nsect)
+{
+	uint32_t pa, end, n;
+	struct Prd *prd;
+	uint8_t st;
+
+	// Describe the buffer, split at 64KB boundaries.
+	pa = (uint32_t) dst;
+	end = pa + nsect * SECTSIZE;
+	for (prd = prdt; pa < end; pa += n, prd++) {
+		n = MIN(end, ROUNDDOWN(pa, 0x10000) + 0x10000) - pa;
+		prd->prd_addr = pa;
+		prd->prd_count = n;	// 64KB truncates to 0, as it should
+		prd->prd_flags = 0;
+	}
+	prd[-1].prd_flags = PRD_EOT;
+
+	outb(bmbase + BM_CMD, 0);
+	outb(bmbase + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INTR);
+	outl(bmbase + BM_PRDT, (uint32_t) prdt);
+	outb(bmbase + BM_CMD, BM_CMD_READ);
+
+	// wait for disk to be ready
+	waitdisk();
+
+	outb(0x1F2, nsect);	// sector count
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+	outb(0x1F5, offset >> 16);
+	outb(0x1F6, (offset >> 24) | 0xE0);
+	outb(0x1F7, 0xC8);	// cmd 0xC8 - read DMA
+
+	outb(bmbase + BM_CMD, BM_CMD_READ | BM_CMD_START);
+
+	// The drive raises its interrupt line when the transfer is over;
+	// interrupts are off, so poll for it in the bus master status.
+	while (!((st = inb(bmbase + BM_STATUS))
+		 & (BM_STATUS_INTR | BM_STATUS_ERR)))
+		/* do nothing */;
+	outb(bmbase + BM_CMD, 0);
+
+	// Reading the drive status also acknowledges its interrupt.
+	if ((inb(0x1F7) & 0x21) || (st & BM_STATUS_ERR))
+		return -1;	// ERR or DF set, or the transfer failed
+	return 0;
+}
@@ -0,0 +1,241 @@
+/*
+ * Convert the ELF kernel into the compressed image format described
+ * in inc/zimage.h, for the second-stage boot loader to load.
+ *
+ * Usage: mkzimage kernel-elf zimage
+ *
+ * This is a native program, run at build time.  The compressor is a
+ * plain greedy LZ4 matcher with a single hash table: it favors a
+ * simple, obviously-correct encoder over the last few percent of
+ * ratio, since decompression speed does not depend on it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <inc/elf.h>
+#include <inc/zimage.h>
+
+#define SECTSIZE	512
+#define MAXSEG		16
+
+// LZ4 block format limits
+#define MINMATCH	4	// shortest match worth encoding
+#define LASTLITERALS	5	// a block's last bytes are always literals
+#define MFLIMIT		12	// a match may not start closer to the end
+#define MAXDIST		65535	// furthest a match may reach back
+
+#define HASHBITS	16
+
+static uint8_t *out;
+static size_t outlen, outcap;
+
+static void
+die(const char *msg, const char *arg)
+{
+	fprintf(stderr, "mkzimage: %s%s%s\n", msg, arg ? ": " : "",
+		arg ? arg : "");
+	exit(1);
+}
+
+static void
+emit(const void *p, size_t n)
+{
+	while (outlen + n > outcap) {
+		outcap = outcap ? 2 * outcap : 65536;
+		if (!(out = realloc(out, outcap)))
+			die("out of memory", NULL);
+	}
+	memcpy(out + outlen, p, n);
+	outlen += n;
+}
+
+static void
+emitb(uint8_t b)
+{
+	emit(&b, 1);
+}
+
+static void
+emit32(uint32_t v)
+{
+	uint8_t b[4] = { v, v >> 8, v >> 16, v >> 24 };
+
+	emit(b, 4);
+}
+
+// Emit the extra length bytes for a literal or match length whose
+// token nibble is saturated at 15.
+static void
+emitlen(size_t n)
+{
+	for (; n >= 255; n -= 255)
+		emitb(255);
+	emitb(n);
+}
+
+static void
+emitseq(const uint8_t *lit, size_t litlen, size_t dist, size_t mlen)
+{
+	size_t ml = mlen ? mlen - MINMATCH : 0;
+
+	emitb((litlen < 15 ? litlen : 15) << 4 | (ml < 15 ? ml : 15));
+	if (litlen >= 15)
+		emitlen(litlen - 15);
+	emit(lit, litlen);
+	if (mlen == 0)
+		return;		// the last sequence has no match
+	emitb(dist);
+	emitb(dist >> 8);
+	if (ml >= 15)
+		emitlen(ml - 15);
+}
+
+static uint32_t
+read32(const uint8_t *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+static uint32_t
+hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - HASHBITS);
+}
+
+// Compress bytes [start, end) of 'base' as one LZ4 block.  Matches may
+// reach back before 'start' into earlier blocks of the same segment;
+// 'table' remembers positions across calls.
+static void
+compress_block(const uint8_t *base, size_t start, size_t end, int32_t *table)
+{
+	size_t ip, anchor, len;
+	int32_t ref;
+	uint32_t h;
+
+	ip = anchor = start;
+	while (ip + MFLIMIT <= end) {
+		h = hash(read32(base + ip));
+		ref = table[h];
+		table[h] = ip;
+		if (ref < 0 || ip - ref > MAXDIST
+		    || read32(base + ref) != read32(base + ip)) {
+			ip++;
+			continue;
+		}
+		len = MINMATCH;
+		while (ip + len < end - LASTLITERALS
+		       && base[ref + len] == base[ip + len])
+			len++;
+		emitseq(base + anchor, ip - anchor, ip - ref, len);
+		ip += len;
+		anchor = ip;
+	}
+	emitseq(base + anchor, end - anchor, 0, 0);
+}
+
+// Append segment 'data' of 'size' bytes to the image as a sequence of
+// blocks, falling back to a raw block whenever LZ4 does not help.
+static void
+compress_seg(const uint8_t *data, size_t size)
+{
+	static int32_t table[1 << HASHBITS];
+	size_t start, end, hdr, zlen;
+
+	memset(table, 0xFF, sizeof(table));
+	for (start = 0; start < size; start = end) {
+		end = start + ZBLKSIZE < size ? start + ZBLKSIZE : size;
+		hdr = outlen;
+		emit32(0);
+		compress_block(data, start, end, table);
+		zlen = outlen - hdr - 4;
+		if (zlen >= end - start) {
+			outlen = hdr + 4;
+			emit(data + start, end - start);
+			zlen = (end - start) | ZBLK_STORED;
+		}
+		out[hdr] = zlen;
+		out[hdr + 1] = zlen >> 8;
+		out[hdr + 2] = zlen >> 16;
+		out[hdr + 3] = zlen >> 24;
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	FILE *f;
+	uint8_t *elf;
+	long elfsize;
+	struct Elf *eh;
+	struct Proghdr *ph;
+	struct Zimage zh;
+	struct Zseg zs[MAXSEG];
+	size_t hdrsize, i;
+
+	if (argc != 3) {
+		fprintf(stderr, "Usage: mkzimage kernel-elf zimage\n");
+		exit(2);
+	}
+
+	if (!(f = fopen(argv[1], "rb")))
+		die(strerror(errno), argv[1]);
+	fseek(f, 0, SEEK_END);
+	elfsize = ftell(f);
+	rewind(f);
+	if (!(elf = malloc(elfsize)) || fread(elf, 1, elfsize, f) != elfsize)
+		die("cannot read", argv[1]);
+	fclose(f);
+
+	eh = (struct Elf *) elf;
+	if (elfsize < sizeof(*eh) || eh->e_magic != ELF_MAGIC)
+		die("not an ELF file", argv[1]);
+
+	zh.z_magic = ZIMAGE_MAGIC;
+	zh.z_entry = eh->e_entry;
+	zh.z_nseg = 0;
+	ph = (struct Proghdr *) (elf + eh->e_phoff);
+	for (i = 0; i < eh->e_phnum; i++, ph++) {
+		if (ph->p_type != ELF_PROG_LOAD || ph->p_memsz == 0)
+			continue;
+		if (zh.z_nseg == MAXSEG)
+			die("too many segments", argv[1]);
+		if (ph->p_offset + ph->p_filesz > elfsize)
+			die("truncated segment", argv[1]);
+		zs[zh.z_nseg].zs_pa = ph->p_pa;
+		zs[zh.z_nseg].zs_filesz = ph->p_filesz;
+		zs[zh.z_nseg].zs_memsz = ph->p_memsz;
+		zh.z_nseg++;
+	}
+
+	// The headers fill the first sector(s); the blocks follow.
+	hdrsize = sizeof(zh) + zh.z_nseg * sizeof(zs[0]);
+	outlen = (hdrsize + SECTSIZE - 1) / SECTSIZE * SECTSIZE;
+	emit("", 0);
+	memset(out, 0, outlen);
+
+	ph = (struct Proghdr *) (elf + eh->e_phoff);
+	for (i = 0; i < zh.z_nseg; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD || ph->p_memsz == 0)
+			continue;
+		zs[i].zs_offset = outlen;
+		compress_seg(elf + ph->p_offset, ph->p_filesz);
+		zs[i].zs_zsize = outlen - zs[i].zs_offset;
+		i++;
+	}
+	zh.z_size = outlen;
+	memcpy(out, &zh, sizeof(zh));
+	memcpy(out + sizeof(zh), zs, zh.z_nseg * sizeof(zs[0]));
+
+	if (!(f = fopen(argv[2], "wb")))
+		die(strerror(errno), argv[2]);
+	if (fwrite(out, 1, outlen, f) != outlen || fclose(f) != 0)
+		die("cannot write", argv[2]);
+
+	fprintf(stderr, "kernel image is %lu bytes compressed (ELF %ld)\n",
+		(unsigned long) outlen, elfsize);
+	return 0;
+}
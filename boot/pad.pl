@@ -0,0 +1,26 @@
+#!/usr/bin/perl
+
+# Check that the second-stage boot loader fits in the sectors reserved
+# for it, and pad it out to exactly that many sectors.
+
+open(BB, $ARGV[0]) || die "open $ARGV[0]: $!";
+$max = 512 * $ARGV[1];
+
+binmode BB;
+my $buf;
+read(BB, $buf, $max + 1);
+$n = length($buf);
+
+if($n > $max){
+	print STDERR "boot stage 2 too large: $n bytes (max $max)\n";
+	exit 1;
+}
+
+print STDERR "boot stage 2 is $n bytes (max $max)\n";
+
+$buf .= "\0" x ($max-$n);
+
+open(BB, ">$ARGV[0]") || die "open >$ARGV[0]: $!";
+binmode BB;
+print BB $buf;
+close BB;
@@ -96,6 +96,8 @@ def run_tests():
                       help="print commands")
     parser.add_option("--color", choices=["never", "always", "auto"],
                       default="auto", help="never, always, or auto")
+    parser.add_option("--disk", action="store_true",
+                      help="boot from the disk image, not with -kernel")
     (options, args) = parser.parse_args()
 
     # Start with a full build to catch build errors
@@ -382,13 +384,17 @@ class Runner():
         be called with this Runner instance once QEMU and GDB are
         started.  Typically, they should register callbacks that throw
         TerminateTest when stop events occur.  The target_base
-        argument gives the make target to run.  The make_args argument
-        should be a list of additional arguments to pass to make.  The
-        timeout argument bounds how long to run before returning."""
+        argument gives the make target to run; by default the kernel
+        is booted directly with -kernel unless --disk was given.  The
+        make_args argument should be a list of additional arguments to
+        pass to make.  The timeout argument bounds how long to run
+        before returning."""
 
-        def run_qemu_kw(target_base="qemu", make_args=[], timeout=30):
+        def run_qemu_kw(target_base=None, make_args=[], timeout=30):
             return target_base, make_args, timeout
         target_base, make_args, timeout = run_qemu_kw(**kw)
+        if target_base is None:
+            target_base = "qemu" if options.disk else "qemu-fast"
 
         # Start QEMU
         pre_make()
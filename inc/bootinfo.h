@@ -0,0 +1,101 @@
+#ifndef JOS_INC_BOOTINFO_H
+#define JOS_INC_BOOTINFO_H
+
+#ifndef __ASSEMBLER__
+#include <inc/types.h>
+#include <inc/x86.h>
+#endif
+
+/*
+ * The boot loader leaves a small struct Bootinfo at physical address
+ * BOOTINFO to tell the kernel what it has already done on its behalf.
+ * The area is the second physical page, well below the boot sector
+ * and its stack, which nothing else uses during boot.  The kernel must
+ * check bi_magic before believing anything else in the struct, since
+ * a different loader may have started it.
+ *
+ * Bootinfo also carries the boot timeline: each boot stage appends a
+ * struct Bootstamp with its stage number and the time stamp counter,
+ * and the kernel monitor's 'boottime' command prints the deltas.
+ *
+ * Finally, stage 2 copies the BIOS's E820 memory map into bi_e820,
+ * so that the kernel can see how much RAM the machine has and where.
+ */
+
+#define BOOTINFO	0x1000		// physical address of struct Bootinfo
+#define BOOTINFO_MAGIC	0x42534F4A	/* "JOSB" in little endian */
+
+// Flag bits for Bootinfo::bi_flags
+#define BI_BSS_ZEROED	0x1		// loader zeroed each segment past p_filesz
+
+// Boot stages, for Bootstamp::bs_stage
+#define BT_START	0	// boot.S start, in real mode
+#define BT_PROTMODE	1	// boot.S, in protected mode (arg: sectors
+				//   of kernel image prefetched by the BIOS)
+#define BT_BOOT2	2	// stage 2 entry
+#define BT_READSEG	3	// stage 2 readseg() done (arg: bytes)
+#define BT_LOADED	4	// stage 2 done loading the kernel
+#define BT_KERNEL	5	// kernel entry.S
+#define BT_I386_INIT	6	// i386_init()
+#define BT_CONS_INIT	7	// console ready
+#define BT_E820		8	// stage 2 has the memory map (arg: entries)
+#define BT_NSTAGE	9
+
+#define BI_MAXSTAMP	32	// size of Bootinfo::bi_stamp
+#define BI_MAXE820	32	// size of Bootinfo::bi_e820
+
+// E820 address range types, for E820ent::e_type
+#define E820_RAM	1	// usable RAM
+#define E820_RESERVED	2
+#define E820_ACPI	3	// ACPI tables, reclaimable once read
+#define E820_NVS	4	// ACPI non-volatile storage
+#define E820_UNUSABLE	5	// bad memory
+
+// Byte offsets of Bootinfo fields, for assembly code
+#define BI_NSTAMP	8
+#define BI_NE820	12
+#define BI_STAMP	16
+#define BI_E820		(BI_STAMP + 16 * BI_MAXSTAMP)
+#define E820ENT_SIZE	20	// sizeof(struct E820ent)
+
+#ifndef __ASSEMBLER__
+
+struct Bootstamp {
+	uint64_t bs_tsc;	// time stamp counter on arrival
+	uint32_t bs_stage;	// BT_*
+	uint32_t bs_arg;	// stage-specific detail
+};
+
+// One BIOS memory map entry, as INT 15h AX=E820h returns it
+struct E820ent {
+	uint64_t e_addr;	// start of the range
+	uint64_t e_len;		// length of the range in bytes
+	uint32_t e_type;	// E820_*
+} __attribute__((packed));
+
+struct Bootinfo {
+	uint32_t bi_magic;	// must equal BOOTINFO_MAGIC
+	uint32_t bi_flags;
+	uint32_t bi_nstamp;	// entries used in bi_stamp
+	uint32_t bi_ne820;	// entries used in bi_e820
+	struct Bootstamp bi_stamp[BI_MAXSTAMP];
+	struct E820ent bi_e820[BI_MAXE820];
+};
+
+// Append a boot timeline entry, unless the timeline is full.
+static inline void
+bootinfo_stamp(struct Bootinfo *bi, uint32_t stage, uint32_t arg)
+{
+	struct Bootstamp *bs;
+
+	if (bi->bi_nstamp >= BI_MAXSTAMP)
+		return;
+	bs = &bi->bi_stamp[bi->bi_nstamp++];
+	bs->bs_tsc = read_tsc();
+	bs->bs_stage = stage;
+	bs->bs_arg = arg;
+}
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !JOS_INC_BOOTINFO_H */
@@ -17,6 +17,7 @@
 #define GD_UT     0x18     // user text
 #define GD_UD     0x20     // user data
 #define GD_TSS0   0x28     // Task segment selector for CPU 0
+#define GD_KCPU0  0x68     // Per-CPU data segment for CPU 0, after NCPU TSSs
 
 /*
  * Virtual memory map:                                Permissions
@@ -83,7 +84,10 @@
  */
 
 
-// All physical memory mapped at this address
+// All physical memory mapped at this address.  Mappings at and above
+// KERNBASE are the same in every address space, so they are global
+// (PTE_G): switching CR3 leaves them in the TLB, and changing one
+// takes an invlpg or tlbflush_global.
 #define	KERNBASE	0xF0000000
 
 // At IOPHYSMEM (640K) there is a 384K hole for I/O.  From the kernel,
@@ -92,6 +96,9 @@
 #define IOPHYSMEM	0x0A0000
 #define EXTPHYSMEM	0x100000
 
+// Physical address of startup code for non-boot CPUs (APs)
+#define MPENTRY_PADDR	0x7000
+
 // Kernel stack.
 #define KSTACKTOP	KERNBASE
 #define KSTKSIZE	(8*PGSIZE)   		// size of a kernel stack
@@ -143,5 +150,39 @@
 typedef uint32_t pte_t;
 typedef uint32_t pde_t;
 
+/*
+ * Page descriptor structures, mapped at UPAGES.
+ * Read/write to the kernel, read-only to user programs.
+ *
+ * Each struct PageInfo stores metadata for one physical page.
+ * Is it NOT the physical page itself, but there is a one-to-one
+ * correspondence between physical pages and struct PageInfo's.
+ * You can map a struct PageInfo * to the corresponding physical address
+ * with page2pa() in kern/pmap.h.
+ */
+struct PageInfo {
+	// Next page on the free list.
+	struct PageInfo *pp_link;
+	// Previous page on a buddy free list, so that a block can be
+	// unlinked when it merges with its buddy.
+	struct PageInfo *pp_prev;
+
+	// pp_ref is the count of pointers (usually in page table entries)
+	// to this page, for pages allocated using page_alloc.
+	// Pages allocated at boot time using pmap.c's
+	// boot_alloc do not have valid reference count fields.
+
+	uint16_t pp_ref;
+
+	// For the first page of a buddy block: log2 of its size in pages.
+	uint8_t pp_order;
+	uint8_t pp_flags;
+};
+
+// Flag bits for PageInfo::pp_flags
+#define PP_BUDDY	0x01	// first page of a block on a buddy free list
+#define PP_SLAB		0x02	// part of a slab (kern/slab.c); pp_order
+				// gives the slab's size
+
 #endif /* !__ASSEMBLER__ */
 #endif /* !JOS_INC_MEMLAYOUT_H */
@@ -89,6 +89,7 @@
 #define CR0_PG		0x80000000	// Paging
 
 #define CR4_PCE		0x00000100	// Performance counter enable
+#define CR4_PGE		0x00000080	// Page Global Enable
 #define CR4_MCE		0x00000040	// Machine Check Enable
 #define CR4_PSE		0x00000010	// Page Size Extensions
 #define CR4_DE		0x00000008	// Debugging Extensions
@@ -96,6 +97,11 @@
 #define CR4_PVI		0x00000002	// Protected-Mode Virtual Interrupts
 #define CR4_VME		0x00000001	// V86 Mode Extensions
 
+// CPUID leaf 1 feature flags (%edx)
+#define CPUID_PSE	0x00000008	// Page Size Extensions (4MB pages)
+#define CPUID_PGE	0x00002000	// Page Global Enable
+#define CPUID_PAT	0x00010000	// Page Attribute Table
+
 // Eflags register
 #define FL_CF		0x00000001	// Carry Flag
 #define FL_PF		0x00000004	// Parity Flag
@@ -0,0 +1,45 @@
+#ifndef JOS_INC_MULTIBOOT_H
+#define JOS_INC_MULTIBOOT_H
+
+/*
+ * The parts of the Multiboot specification (version 0.6.96) that JOS
+ * uses.  A multiboot loader, such as GRUB or QEMU's -kernel, enters
+ * the kernel with MULTIBOOT_BOOTLOADER_MAGIC in %eax and the physical
+ * address of a struct Multiboot_info in %ebx.
+ */
+
+#define MULTIBOOT_BOOTLOADER_MAGIC	0x2BADB002
+
+// Flag bits for Multiboot_info::flags
+#define MULTIBOOT_INFO_MEMORY	0x001	// mem_lower/mem_upper are valid
+#define MULTIBOOT_INFO_MMAP	0x040	// mmap_length/mmap_addr are valid
+
+#ifndef __ASSEMBLER__
+
+#include <inc/types.h>
+
+struct Multiboot_info {
+	uint32_t flags;
+	uint32_t mem_lower;	// KB of memory from 0
+	uint32_t mem_upper;	// KB of memory from 1MB
+	uint32_t boot_device;
+	uint32_t cmdline;
+	uint32_t mods_count;
+	uint32_t mods_addr;
+	uint32_t syms[4];
+	uint32_t mmap_length;	// bytes of memory map at mmap_addr
+	uint32_t mmap_addr;
+};
+
+// A memory map entry.  'size' does not count itself, and the rest is
+// laid out like a struct E820ent (see inc/bootinfo.h).
+struct Multiboot_mmap {
+	uint32_t size;
+	uint64_t addr;
+	uint64_t len;
+	uint32_t type;
+} __attribute__((packed));
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !JOS_INC_MULTIBOOT_H */
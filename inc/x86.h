@@ -2,6 +2,7 @@
 #define JOS_INC_X86_H
 
 #include <inc/types.h>
+#include <inc/mmu.h>
 
 static inline void
 breakpoint(void)
@@ -75,6 +76,15 @@ outsb(int port, const void *addr, int cnt)
 		     : "cc");
 }
 
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+	asm volatile("cld\n\trep\n\tstosl"
+		     : "=D" (addr), "=c" (cnt)
+		     : "0" (addr), "1" (cnt), "a" (data)
+		     : "memory", "cc");
+}
+
 static inline void
 outw(int port, uint16_t data)
 {
@@ -111,6 +121,12 @@ invlpg(void *addr)
 	asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
 }
 
+static inline void
+wbinvd(void)
+{
+	asm volatile("wbinvd" : : : "memory");
+}
+
 static inline void
 lidt(void *p)
 {
@@ -193,6 +209,21 @@ tlbflush(void)
 	asm volatile("movl %0,%%cr3" : : "r" (cr3));
 }
 
+// Like tlbflush, but also flush global (PTE_G) entries, which survive
+// a CR3 reload.  Needed after changing a mapping above KERNBASE when
+// invlpg on each page would not do.
+static inline void
+tlbflush_global(void)
+{
+	uint32_t cr4 = rcr4();
+
+	if (cr4 & CR4_PGE) {
+		lcr4(cr4 & ~CR4_PGE);
+		lcr4(cr4);
+	} else
+		tlbflush();
+}
+
 static inline uint32_t
 read_eflags(void)
 {
@@ -248,6 +279,20 @@ read_tsc(void)
 	return tsc;
 }
 
+static inline uint64_t
+rdmsr(uint32_t msr)
+{
+	uint64_t val;
+	asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+	return val;
+}
+
+static inline void
+wrmsr(uint32_t msr, uint64_t val)
+{
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
 static inline uint32_t
 xchg(volatile uint32_t *addr, uint32_t newval)
 {
@@ -261,4 +306,36 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Atomically: if *addr == expected, set it to newval.  Returns the
+// old value of *addr, which equals 'expected' exactly when the swap
+// happened.
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t expected, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %0"
+		     : "+m" (*addr), "=a" (result)
+		     : "r" (newval), "1" (expected)
+		     : "cc", "memory");
+	return result;
+}
+
+// Atomically add 'inc' to *addr and return the old value.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %1, %0"
+		     : "+m" (*addr), "+r" (inc)
+		     : : "cc", "memory");
+	return inc;
+}
+
+// Hint to the CPU that this is a spin-wait loop.
+static inline void
+pause(void)
+{
+	asm volatile("pause" : : : "memory");
+}
+
 #endif /* !JOS_INC_X86_H */
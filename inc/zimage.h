@@ -0,0 +1,49 @@
+#ifndef JOS_INC_ZIMAGE_H
+#define JOS_INC_ZIMAGE_H
+
+/*
+ * Compressed kernel image format, written by boot/mkzimage.c from the
+ * ELF kernel and loaded by the second-stage boot loader.
+ *
+ * The image starts with a struct Zimage followed by z_nseg struct Zseg,
+ * one per ELF PT_LOAD segment.  Each segment's contents are stored at
+ * zs_offset as a sequence of blocks.  Every block starts with a 32-bit
+ * header giving the number of data bytes that follow; if ZBLK_STORED
+ * is set they are raw, otherwise they are in the LZ4 block format.
+ * Each block expands to ZBLKSIZE bytes, except for the last one of a
+ * segment, and LZ4 matches may refer back into earlier blocks of the
+ * same segment (LZ4 "linked blocks"), so a decoder needs only one
+ * block of input at a time.
+ *
+ * Like inc/elf.h, this header does not include inc/types.h, so that
+ * it can be used by native tools as well (and by boot.S).
+ */
+
+#define ZIMAGE_MAGIC	0x345A4F4A	/* "JOZ4" in little endian */
+
+#define ZBLKSIZE	65536		// bytes a block expands to
+#define ZBLK_STORED	0x80000000U	// block header flag: data is raw
+
+// Byte offset of Zimage::z_size, for boot.S
+#define Z_SIZE		12
+
+#ifndef __ASSEMBLER__
+
+struct Zimage {
+	uint32_t z_magic;	// must equal ZIMAGE_MAGIC
+	uint32_t z_entry;	// physical entry point, as in Elf::e_entry
+	uint32_t z_nseg;
+	uint32_t z_size;	// bytes in the whole image
+};
+
+struct Zseg {
+	uint32_t zs_pa;		// load address, as in Proghdr::p_pa
+	uint32_t zs_offset;	// image offset of the first block
+	uint32_t zs_zsize;	// bytes of blocks (with headers) on disk
+	uint32_t zs_filesz;	// bytes the blocks expand to
+	uint32_t zs_memsz;	// bytes in memory; the rest is zero
+};
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !JOS_INC_ZIMAGE_H */
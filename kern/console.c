@@ -5,8 +5,13 @@
 #include <inc/kbdreg.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/trap.h>
 
 #include <kern/console.h>
+#include <kern/pmap.h>
+#include <kern/picirq.h>
+#include <kern/spinlock.h>
 
 static void cons_intr(int (*proc)(void));
 static void cons_putc(int c);
@@ -31,8 +36,15 @@ delay(void)
 #define COM_DLM		1	// Out: Divisor Latch High (DLAB=1)
 #define COM_IER		1	// Out: Interrupt Enable Register
 #define   COM_IER_RDI	0x01	//   Enable receiver data interrupt
+#define   COM_IER_TXI	0x02	//   Enable transmitter empty interrupt
 #define COM_IIR		2	// In:	Interrupt ID Register
+#define   COM_IIR_NOPEND 0x01	//   No interrupt pending
+#define   COM_IIR_FIFO	0xC0	//   FIFOs enabled (16550A and later)
 #define COM_FCR		2	// Out: FIFO Control Register
+#define   COM_FCR_ENABLE 0x01	//   Enable the FIFOs
+#define   COM_FCR_RCLR	0x02	//   Clear the receive FIFO
+#define   COM_FCR_XCLR	0x04	//   Clear the transmit FIFO
+#define   COM_FCR_TRIG14 0xC0	//   Receive interrupt at 14 bytes
 #define COM_LCR		3	// Out: Line Control Register
 #define	  COM_LCR_DLAB	0x80	//   Divisor latch access bit
 #define	  COM_LCR_WLEN8	0x03	//   Wordlength: 8 bits
@@ -45,7 +57,37 @@ delay(void)
 #define   COM_LSR_TXRDY	0x20	//   Transmit buffer avail
 #define   COM_LSR_TSRE	0x40	//   Transmitter off
 
+#define COM_FIFOSIZE	16	// Depth of a 16550A transmit FIFO
+
+// Line speed, at most 115200; 'make SERIAL_BAUD=n' overrides it.
+#ifndef SERIAL_BAUD
+#define SERIAL_BAUD	9600
+#endif
+#if SERIAL_BAUD <= 0 || SERIAL_BAUD > 115200 || 115200 % SERIAL_BAUD != 0
+# error "SERIAL_BAUD must divide 115200"
+#endif
+
 static bool serial_exists;
+static int serial_txburst = 1;	// Bytes to send per transmitter-empty wait
+
+// Output waiting for the transmitter.  Once serial_irq_init has run,
+// serial_write queues bytes here and enables the transmitter empty
+// interrupt, and serial_intr refills the FIFO from the ring a burst at
+// a time.  rpos and wpos run freely and wrap modulo 2^32.  serial_lock
+// protects the ring and the UART, and is only taken with interrupts
+// off, so IRQ 4 cannot arrive on a CPU that already holds it.
+#define SERIAL_TXBUFSIZE 1024
+
+static struct {
+	uint8_t buf[SERIAL_TXBUFSIZE];
+	uint32_t rpos;
+	uint32_t wpos;
+} serial_tx;
+
+static struct spinlock serial_lock;
+static bool serial_irq;		// IRQ 4 is routed to serial_intr
+
+extern const char *panicstr;
 
 static int
 serial_proc_data(void)
@@ -55,36 +97,136 @@ serial_proc_data(void)
 	return inb(COM1+COM_RX);
 }
 
+// Wait, for a bounded time, for the transmitter to empty.
+static void
+serial_txwait(void)
+{
+	int i;
+
+	for (i = 0;
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+	     i++)
+		delay();
+}
+
+// If the transmitter is empty, refill it with a burst from the ring,
+// and stop asking for transmitter interrupts once the ring is empty.
+static void
+serial_txfill(void)
+{
+	int i;
+
+	if (!(inb(COM1 + COM_LSR) & COM_LSR_TXRDY))
+		return;
+	for (i = 0; i < serial_txburst && serial_tx.rpos != serial_tx.wpos; i++)
+		outb(COM1 + COM_TX,
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+	if (serial_tx.rpos == serial_tx.wpos)
+		outb(COM1 + COM_IER, COM_IER_RDI);
+}
+
+// Called from IRQ 4, and polled by cons_getc.  The interrupt is edge
+// triggered, so keep going until the UART has nothing left pending, or
+// it would never raise the line again.
 void
 serial_intr(void)
 {
-	if (serial_exists)
+	uint32_t eflags;
+	int i;
+
+	if (!serial_exists)
+		return;
+	if (!serial_irq) {
 		cons_intr(serial_proc_data);
+		return;
+	}
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	spin_lock(&serial_lock);
+	serial_txfill();
+	cons_intr(serial_proc_data);
+	for (i = 0; !(inb(COM1 + COM_IIR) & COM_IIR_NOPEND) && i < 16; i++) {
+		serial_txfill();
+		cons_intr(serial_proc_data);
+	}
+	spin_unlock(&serial_lock);
+	write_eflags(eflags);
 }
 
+// Once the transmitter reports its holding register (and so, with
+// FIFOs on, its whole transmit FIFO) empty, there is room for a full
+// burst, so only poll the line status once per burst.  Anything still
+// in the ring goes first, to keep output in order.
 static void
-serial_putc(int c)
+serial_write_sync(const char *s, size_t n)
 {
 	int i;
 
-	for (i = 0;
-	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
-	     i++)
-		delay();
+	while (serial_tx.rpos != serial_tx.wpos) {
+		serial_txwait();
+		serial_txfill();
+	}
 
-	outb(COM1 + COM_TX, c);
+	while (n > 0) {
+		serial_txwait();
+		for (i = 0; i < serial_txburst && n > 0; i++, n--)
+			outb(COM1 + COM_TX, *s++);
+	}
 }
 
-static void
+// Queue the span for the transmitter interrupt.  Write it out directly
+// instead if IRQ 4 is not set up yet, if the caller has interrupts off
+// (the interrupt might never come, and this CPU may not be the one
+// that takes it), or if the kernel is panicking, in which case the
+// message must get out now and without the lock.  If the ring fills
+// up, drain it by polling rather than dropping output.
+static bool
+serial_write(const char *s, size_t n)
+{
+	uint32_t eflags;
+
+	if (!serial_irq || panicstr) {
+		serial_write_sync(s, n);
+		return true;
+	}
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	spin_lock(&serial_lock);
+	if (!(eflags & FL_IF))
+		serial_write_sync(s, n);
+	else {
+		while (n > 0) {
+			while (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+				serial_txwait();
+				serial_txfill();
+			}
+			while (n > 0 && serial_tx.wpos - serial_tx.rpos < SERIAL_TXBUFSIZE) {
+				serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = *s++;
+				n--;
+			}
+		}
+		// The UART raises the interrupt as soon as this is set if
+		// the transmitter is already empty.
+		outb(COM1 + COM_IER, COM_IER_RDI | COM_IER_TXI);
+	}
+	spin_unlock(&serial_lock);
+	write_eflags(eflags);
+	return true;
+}
+
+static bool
 serial_init(void)
 {
-	// Turn off the FIFO
-	outb(COM1+COM_FCR, 0);
+	// Turn on and clear the FIFOs
+	outb(COM1+COM_FCR, COM_FCR_ENABLE | COM_FCR_RCLR | COM_FCR_XCLR
+	     | COM_FCR_TRIG14);
 
 	// Set speed; requires DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_DLAB);
-	outb(COM1+COM_DLL, (uint8_t) (115200 / 9600));
-	outb(COM1+COM_DLM, 0);
+	outb(COM1+COM_DLL, (uint8_t) (115200 / SERIAL_BAUD));
+	outb(COM1+COM_DLM, (uint8_t) ((115200 / SERIAL_BAUD) >> 8));
 
 	// 8 data bits, 1 stop bit, parity off; turn off DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_WLEN8 & ~COM_LCR_DLAB);
@@ -97,9 +239,28 @@ serial_init(void)
 	// Clear any preexisting overrun indications and interrupts
 	// Serial port doesn't exist if COM_LSR returns 0xFF
 	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
-	(void) inb(COM1+COM_IIR);
+	// Older UARTs have no FIFO and take one byte at a time
+	if ((inb(COM1+COM_IIR) & COM_IIR_FIFO) == COM_IIR_FIFO)
+		serial_txburst = COM_FIFOSIZE;
+	else
+		serial_txburst = 1;
 	(void) inb(COM1+COM_RX);
 
+	return serial_exists;
+}
+
+// Let IRQ 4 drive the serial port.  The interrupt controller and the
+// IDT must be set up; the caller turns interrupts on afterwards.
+void
+serial_irq_init(void)
+{
+	if (!serial_exists)
+		return;
+	__spin_initlock(&serial_lock, "serial");
+	serial_irq = true;
+	// OUT2 gates the UART's interrupt line onto the bus.
+	outb(COM1+COM_MCR, COM_MCR_OUT2);
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
 }
 
 
@@ -108,16 +269,51 @@ serial_init(void)
 // For information on PC parallel port programming, see the class References
 // page.
 
-static void
+#define LPT1		0x378
+
+#define LPT_DATA	0	// Data port
+#define LPT_STATUS	1	// In:	Status port
+#define   LPT_STATUS_BUSY 0x80	//   Busy complement: set when ready
+#define LPT_CTRL	2	// Out: Control port
+#define   LPT_CTRL_STROBE 0x01	//   Strobe
+#define   LPT_CTRL_INIT	0x04	//   Initialize complement
+#define   LPT_CTRL_SELECT 0x08	//   Select printer
+
+static bool
 lpt_putc(int c)
 {
 	int i;
 
-	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+	for (i = 0; !(inb(LPT1+LPT_STATUS) & LPT_STATUS_BUSY) && i < 12800; i++)
 		delay();
-	outb(0x378+0, c);
-	outb(0x378+2, 0x08|0x04|0x01);
-	outb(0x378+2, 0x08);
+	if (i == 12800)
+		return false;
+	outb(LPT1+LPT_DATA, c);
+	outb(LPT1+LPT_CTRL, LPT_CTRL_SELECT|LPT_CTRL_INIT|LPT_CTRL_STROBE);
+	outb(LPT1+LPT_CTRL, LPT_CTRL_SELECT);
+	return true;
+}
+
+// Returns false if the printer times out, so that cons_write stops
+// using it.
+static bool
+lpt_write(const char *s, size_t n)
+{
+	while (n-- > 0)
+		if (!lpt_putc(*s++))
+			return false;
+	return true;
+}
+
+// There is a port if the data register holds what we write to it.
+static bool
+lpt_init(void)
+{
+	outb(LPT1+LPT_DATA, 0xA5);
+	if (inb(LPT1+LPT_DATA) != 0xA5 || inb(LPT1+LPT_STATUS) == 0xFF)
+		return false;
+	outb(LPT1+LPT_CTRL, LPT_CTRL_SELECT);
+	return true;
 }
 
 
@@ -125,16 +321,25 @@ lpt_putc(int c)
 
 /***** Text-mode CGA/VGA display output *****/
 
+// The screen is a CRT_SIZE window into the adapter's text memory,
+// which starts at crt_base and holds crt_ncells cells.  Scrolling
+// moves the window down a row by reprogramming the CRTC's start
+// address, and only when the window reaches the end of text memory
+// are its contents copied back to the start.  crt_buf points at the
+// window's first cell, and crt_pos is the cursor's offset within it.
 static unsigned addr_6845;
+static uint16_t *crt_base;
+static unsigned crt_ncells;
 static uint16_t *crt_buf;
 static uint16_t crt_pos;
+static uint16_t *crt_shown;	// crt_buf as the CRTC last saw it
 
-static void
+static bool
 cga_init(void)
 {
 	volatile uint16_t *cp;
 	uint16_t was;
-	unsigned pos;
+	unsigned pos, start;
 
 	cp = (uint16_t*) (KERNBASE + CGA_BUF);
 	was = *cp;
@@ -142,26 +347,66 @@ cga_init(void)
 	if (*cp != 0xA55A) {
 		cp = (uint16_t*) (KERNBASE + MONO_BUF);
 		addr_6845 = MONO_BASE;
+		// A real MDA has only one screen of text memory.
+		crt_ncells = CRT_SIZE;
 	} else {
 		*cp = was;
 		addr_6845 = CGA_BASE;
+		crt_ncells = CGA_BUFSIZE / sizeof(uint16_t);
 	}
 
-	/* Extract cursor location */
+	/* Extract screen start and cursor location */
+	outb(addr_6845, 12);
+	start = inb(addr_6845 + 1) << 8;
+	outb(addr_6845, 13);
+	start |= inb(addr_6845 + 1);
 	outb(addr_6845, 14);
 	pos = inb(addr_6845 + 1) << 8;
 	outb(addr_6845, 15);
 	pos |= inb(addr_6845 + 1);
 
-	crt_buf = (uint16_t*) cp;
-	crt_pos = pos;
+	// Keep the screen and cursor the BIOS left, as long as they make
+	// sense; otherwise show the start of text memory, and put the
+	// cursor on the bottom row if it is not on the screen.
+	if (start + CRT_SIZE > crt_ncells)
+		start = 0;
+	if (pos < start || pos - start >= CRT_SIZE)
+		pos = start + CRT_SIZE - CRT_COLS;
+	outb(addr_6845, 12);
+	outb(addr_6845 + 1, start >> 8);
+	outb(addr_6845, 13);
+	outb(addr_6845 + 1, start);
+
+	crt_base = (uint16_t*) cp;
+	crt_buf = crt_shown = crt_base + start;
+	crt_pos = pos - start;
+	return true;
 }
 
+// Once the kernel's page tables are set up, write to the text buffer
+// through a write-combining mapping, so that runs of character cells
+// go out as bursts instead of one uncached store at a time.
+void
+cga_map_wc(void)
+{
+	uint16_t *wc;
 
+	wc = mmio_map_region_wc(PADDR(crt_base), crt_ncells * sizeof(uint16_t));
+	if (wc) {
+		crt_buf = wc + (crt_buf - crt_base);
+		crt_shown = wc + (crt_shown - crt_base);
+		crt_base = wc;
+	}
+}
 
+
+
+// Put one character cell, without moving the hardware cursor.
 static void
-cga_putc(int c)
+cga_putcell(int c)
 {
+	int i;
+
 	// if no attribute given, then use black on white
 	if (!(c & ~0xFF))
 		c |= 0x0700;
@@ -180,11 +425,8 @@ cga_putc(int c)
 		crt_pos -= (crt_pos % CRT_COLS);
 		break;
 	case '\t':
-		cons_putc(' ');
-		cons_putc(' ');
-		cons_putc(' ');
-		cons_putc(' ');
-		cons_putc(' ');
+		for (i = 0; i < 5; i++)
+			cga_putcell((c & ~0xff) | ' ');
 		break;
 	default:
 		crt_buf[crt_pos++] = c;		/* write the character */
@@ -193,19 +435,47 @@ cga_putc(int c)
 
 	// What is the purpose of this?
 	if (crt_pos >= CRT_SIZE) {
-		int i;
-
-		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+		if (crt_buf + CRT_SIZE + CRT_COLS > crt_base + crt_ncells) {
+			// Out of text memory: wrap around to the start.
+			memmove(crt_base, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+			crt_buf = crt_base;
+		} else
+			crt_buf += CRT_COLS;
 		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
 			crt_buf[i] = 0x0700 | ' ';
 		crt_pos -= CRT_COLS;
 	}
+}
+
+static void
+cga_setcursor(void)
+{
+	unsigned start = crt_buf - crt_base;
+
+	/* scroll the screen to where we are writing */
+	if (crt_buf != crt_shown) {
+		outb(addr_6845, 12);
+		outb(addr_6845 + 1, start >> 8);
+		outb(addr_6845, 13);
+		outb(addr_6845 + 1, start);
+		crt_shown = crt_buf;
+	}
 
 	/* move that little blinky thing */
 	outb(addr_6845, 14);
-	outb(addr_6845 + 1, crt_pos >> 8);
+	outb(addr_6845 + 1, (start + crt_pos) >> 8);
 	outb(addr_6845, 15);
-	outb(addr_6845 + 1, crt_pos);
+	outb(addr_6845 + 1, start + crt_pos);
+}
+
+// The cursor only needs to move once, after the whole span.
+static bool
+cga_write(const char *s, size_t n)
+{
+	while (n-- > 0)
+		cga_putcell((uint8_t) *s++);
+	cga_setcursor();
+	return true;
 }
 
 
@@ -410,11 +680,15 @@ cons_intr(int (*proc)(void))
 int
 cons_getc(void)
 {
-	int c;
+	uint32_t eflags;
+	int c = 0;
 
 	// poll for any pending input characters,
 	// so that this function works even when interrupts are disabled
 	// (e.g., when called from the kernel monitor).
+	// Keep IRQ 4 out while we touch the input buffer.
+	eflags = read_eflags();
+	asm volatile("cli");
 	serial_intr();
 	kbd_intr();
 
@@ -423,27 +697,109 @@ cons_getc(void)
 		c = cons.buf[cons.rpos++];
 		if (cons.rpos == CONSBUFSIZE)
 			cons.rpos = 0;
-		return c;
 	}
-	return 0;
+	write_eflags(eflags);
+	return c;
 }
 
+// The console's output devices.  cons_init probes each one, and only
+// devices that are both present and enabled see any output.
+struct ConsSink {
+	const char *name;
+	bool (*init)(void);		// Probe and set up; false if absent
+	bool (*write)(const char *s, size_t n);	// False if it timed out
+	bool present;
+	bool enabled;
+	bool failed;			// Turned off after a timeout
+};
+
+static struct ConsSink cons_sinks[] = {
+	{ "serial", serial_init, serial_write },
+	{ "lpt", lpt_init, lpt_write },
+	{ "cga", cga_init, cga_write },
+};
+#define NSINKS	(sizeof(cons_sinks) / sizeof(cons_sinks[0]))
+
 // output a character to the console
 static void
 cons_putc(int c)
 {
-	serial_putc(c);
-	lpt_putc(c);
-	cga_putc(c);
+	char ch = c;
+
+	cons_write(&ch, 1);
+}
+
+// output a span of characters to the console, one device at a time,
+// so that each device handles the whole span in a single pass
+void
+cons_write(const char *s, size_t n)
+{
+	uint32_t failed = 0;
+	int i;
+
+	if (n == 0)
+		return;
+	for (i = 0; i < NSINKS; i++)
+		if (cons_sinks[i].enabled && !cons_sinks[i].write(s, n)) {
+			// A device that times out once is taken to be
+			// offline, so it costs one timeout rather than one
+			// per span.
+			cons_sinks[i].enabled = false;
+			cons_sinks[i].failed = true;
+			failed |= 1 << i;
+		}
+
+	// Report failures only once the whole span is out, so that the
+	// message does not land in the middle of it.
+	for (i = 0; i < NSINKS; i++)
+		if (failed & (1 << i))
+			cprintf("console: %s timed out; turned it off\n",
+				cons_sinks[i].name);
+}
+
+// Turn output to the named device on or off.
+// Returns 0 on success, -E_INVAL if there is no such device, or
+// -E_NO_DEV if the device was not found at boot.
+int
+cons_sink_enable(const char *name, bool on)
+{
+	int i;
+
+	for (i = 0; i < NSINKS; i++)
+		if (strcmp(cons_sinks[i].name, name) == 0) {
+			if (!cons_sinks[i].present)
+				return -E_NO_DEV;
+			cons_sinks[i].enabled = on;
+			cons_sinks[i].failed = false;
+			return 0;
+		}
+	return -E_INVAL;
+}
+
+// List the output devices and their state.
+void
+cons_sink_print(void)
+{
+	int i;
+
+	for (i = 0; i < NSINKS; i++)
+		cprintf("  %-8s %s\n", cons_sinks[i].name,
+			!cons_sinks[i].present ? "absent"
+			: cons_sinks[i].enabled ? "on"
+			: cons_sinks[i].failed ? "off (timed out)" : "off");
 }
 
 // initialize the console devices
 void
 cons_init(void)
 {
-	cga_init();
+	int i;
+
 	kbd_init();
-	serial_init();
+	for (i = 0; i < NSINKS; i++) {
+		cons_sinks[i].present = cons_sinks[i].init();
+		cons_sinks[i].enabled = cons_sinks[i].present;
+	}
 
 	if (!serial_exists)
 		cprintf("Serial port does not exist!\n");
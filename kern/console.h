@@ -12,15 +12,21 @@
 #define MONO_BUF	0xB0000
 #define CGA_BASE	0x3D4
 #define CGA_BUF		0xB8000
+#define CGA_BUFSIZE	0x8000	// Bytes of CGA text memory
 
 #define CRT_ROWS	25
 #define CRT_COLS	80
 #define CRT_SIZE	(CRT_ROWS * CRT_COLS)
 
 void cons_init(void);
+void cons_write(const char *s, size_t n);
+int cons_sink_enable(const char *name, bool on);
+void cons_sink_print(void);
+void cga_map_wc(void);
 int cons_getc(void);
 
 void kbd_intr(void); // irq 1
 void serial_intr(void); // irq 4
+void serial_irq_init(void);
 
 #endif /* _CONSOLE_H_ */
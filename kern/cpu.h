@@ -0,0 +1,75 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_CPU_H
+#define JOS_KERN_CPU_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+
+// Maximum number of CPUs
+#define NCPU  8
+
+#define CACHELINE	64	// bytes per cache line
+
+// Model-specific registers
+#define MSR_PAT		0x277		// page attribute table
+
+// Values of status in struct Cpu
+enum {
+	CPU_UNUSED = 0,
+	CPU_STARTED,
+	CPU_HALTED,
+};
+
+// Per-CPU state.  Each CPU's %fs selects a segment whose base is its
+// own struct CpuInfo, so the this_cpu_* accessors below reach it with
+// a single %fs-relative instruction.  Each block gets its own cache
+// lines so that CPUs never share them.
+struct CpuInfo {
+	struct CpuInfo *cpu_self;       // This block's address, for thiscpu
+	uint8_t cpu_id;                 // Local APIC ID; index into cpus[] below
+	volatile unsigned cpu_status;   // The status of the CPU
+} __attribute__((aligned(CACHELINE)));
+
+// Initialized in mpconfig.c
+extern struct CpuInfo cpus[NCPU];
+extern int ncpu;                    // Total number of CPUs in the system
+extern struct CpuInfo *bootcpu;     // The boot-strap processor (BSP)
+extern physaddr_t lapicaddr;        // Physical MMIO address of the local APIC
+
+int cpunum(void);
+#define thiscpu (this_cpu_read(cpu_self))
+
+// Read, write or add to field 'f' of the current CPU's struct CpuInfo.
+// Only valid once percpu_init has run on this CPU.  The "q" constraint
+// lets byte-sized fields work too.
+#define this_cpu_read(f) ({						\
+	typeof(((struct CpuInfo *) 0)->f) __v;				\
+	asm volatile("mov %%fs:%c1, %0"					\
+		     : "=q" (__v) : "i" (offsetof(struct CpuInfo, f)));	\
+	__v;								\
+})
+#define this_cpu_write(f, v) do {					\
+	typeof(((struct CpuInfo *) 0)->f) __v = (v);			\
+	asm volatile("mov %1, %%fs:%c0"					\
+		     : : "i" (offsetof(struct CpuInfo, f)), "q" (__v)	\
+		     : "memory");					\
+} while (0)
+#define this_cpu_add(f, n) do {						\
+	typeof(((struct CpuInfo *) 0)->f) __v = (n);			\
+	asm volatile("add %1, %%fs:%c0"					\
+		     : : "i" (offsetof(struct CpuInfo, f)), "q" (__v)	\
+		     : "cc", "memory");					\
+} while (0)
+
+void percpu_init(void);
+void mp_init(void);
+void lapic_init(void);
+void lapic_startap(uint8_t apicid, uint32_t addr);
+void lapic_eoi(void);
+void lapic_ipi(int vector);
+
+#endif /* !JOS_KERN_CPU_H */
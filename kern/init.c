@@ -3,9 +3,20 @@
 #include <inc/stdio.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/memlayout.h>
+#include <inc/bootinfo.h>
+#include <inc/x86.h>
 
 #include <kern/monitor.h>
 #include <kern/console.h>
+#include <kern/ramdisk.h>
+#include <kern/pmap.h>
+#include <kern/slab.h>
+#include <kern/cpu.h>
+#include <kern/trap.h>
+#include <kern/picirq.h>
+
+static void boot_aps(void);
 
 // Test the stack backtrace function (lab 1 only)
 void
@@ -19,19 +30,61 @@ test_backtrace(int x)
 	cprintf("leaving test_backtrace %d\n", x);
 }
 
+// Add an entry to the boot loader's timeline, if it left one.
+static void
+boot_stamp(uint32_t stage)
+{
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO);
+
+	if (bi->bi_magic == BOOTINFO_MAGIC)
+		bootinfo_stamp(bi, stage, 0);
+}
+
 void
 i386_init(void)
 {
 	extern char edata[], end[];
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO);
+
+	boot_stamp(BT_I386_INIT);
 
 	// Before doing anything else, complete the ELF loading process.
 	// Clear the uninitialized global data (BSS) section of our program.
 	// This ensures that all static/global variables start out zero.
-	memset(edata, 0, end - edata);
+	// Our boot loader already does this while loading us, so only
+	// pay for it again if something else started the kernel.
+	if (bi->bi_magic != BOOTINFO_MAGIC || !(bi->bi_flags & BI_BSS_ZEROED))
+		memset(edata, 0, end - edata);
 
 	// Initialize the console.
 	// Can't call cprintf until after we do this!
 	cons_init();
+	boot_stamp(BT_CONS_INIT);
+
+	// Switch to the kernel's GDT and set up this CPU's %fs.
+	percpu_init();
+
+	// Lab 2 memory management initialization functions
+	mem_init();
+	kmem_init();
+	cga_map_wc();
+
+	// Lab 4 multiprocessor initialization functions
+	mp_init();
+	lapic_init();
+	mem_init_mp();
+
+	// Lab 4 trap handling: so far only the serial port interrupts,
+	// and only the boot CPU takes interrupts.
+	trap_init();
+	pic_init();
+	serial_irq_init();
+	asm volatile("sti");
+
+	// Starting non-boot CPUs
+	boot_aps();
+
+	ramdisk_init();
 
 	cprintf("6828 decimal is %o octal!\n", 6828);
 
@@ -43,6 +96,59 @@ i386_init(void)
 		monitor(NULL);
 }
 
+// While boot_aps is booting a given CPU, it communicates the per-core
+// stack pointer that should be loaded by mpentry.S to that CPU in
+// this variable.
+void *mpentry_kstack;
+
+// Start the non-boot (AP) processors.
+static void
+boot_aps(void)
+{
+	extern unsigned char mpentry_start[], mpentry_end[];
+	void *code;
+	struct CpuInfo *c;
+
+	// Write entry code to unused memory at MPENTRY_PADDR
+	code = KADDR(MPENTRY_PADDR);
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+
+	// Boot each AP one at a time
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == thiscpu)  // We've started already.
+			continue;
+
+		// Tell mpentry.S what stack to use 
+		mpentry_kstack = (void *) (KSTACKTOP - (c - cpus) * (KSTKSIZE + KSTKGAP));
+		// Start the CPU at mpentry_start
+		lapic_startap(c->cpu_id, PADDR(code));
+		// Wait for the CPU to finish some basic setup in mp_main()
+		while(c->cpu_status != CPU_STARTED)
+			;
+	}
+}
+
+// Setup code for APs
+void
+mp_main(void)
+{
+	// mpentry.S has already switched us to kern_pgdir.
+	// Match the boot CPU's memory types before cprintf writes to
+	// the write-combining CGA mapping.
+	pat_init();
+	percpu_init();
+	cprintf("SMP: CPU %d starting\n", cpunum());
+
+	lapic_init();
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+
+	// There is no scheduler yet, and only the boot CPU takes
+	// interrupts, so the AP just idles with interrupts off until
+	// something needs it.
+	for (;;)
+		asm volatile("hlt");
+}
+
 
 /*
  * Variable panicstr contains argument to first call to panic; used as flag
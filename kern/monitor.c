@@ -6,10 +6,15 @@
 #include <inc/memlayout.h>
 #include <inc/assert.h>
 #include <inc/x86.h>
+#include <inc/bootinfo.h>
+#include <inc/error.h>
 
 #include <kern/console.h>
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
+#include <kern/pmap.h>
+#include <kern/slab.h>
+#include <kern/spinlock.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -25,6 +30,10 @@ static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
 	{"backtrace", "Backtrace the call of functions", mon_backtrace},
+	{ "boottime", "Display the boot timeline in TSC cycles", mon_boottime },
+	{ "kmem", "Display kernel memory allocator usage", mon_kmem },
+	{ "locks", "Display lock contention statistics", mon_locks },
+	{ "console", "List console devices, or turn one on or off", mon_console },
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -52,6 +61,9 @@ mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
 	cprintf("Kernel executable memory footprint: %dKB\n",
 		ROUNDUP(end - entry, 1024) / 1024);
+	cprintf("Early boot allocations: %dKB\n",
+		ROUNDUP((char *) boot_alloc_mark()
+			- ROUNDUP((char *) end, PGSIZE), 1024) / 1024);
 	return 0;
 }
 
@@ -73,6 +85,82 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 }
 
 
+static const char * const boot_stages[BT_NSTAGE] = {
+	[BT_START] = "boot.S start",
+	[BT_PROTMODE] = "boot.S protected mode",
+	[BT_BOOT2] = "boot2main",
+	[BT_READSEG] = "readseg",
+	[BT_LOADED] = "kernel loaded",
+	[BT_KERNEL] = "kernel entry",
+	[BT_I386_INIT] = "i386_init",
+	[BT_CONS_INIT] = "cons_init done",
+	[BT_E820] = "e820_detect",
+};
+
+int
+mon_boottime(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO);
+	struct Bootstamp *bs;
+	uint64_t t0;
+	int i;
+
+	if (bi->bi_magic != BOOTINFO_MAGIC) {
+		cprintf("No boot timeline: not started by the JOS boot loader\n");
+		return 0;
+	}
+
+	cprintf("       cycles        delta  stage\n");
+	t0 = bi->bi_stamp[0].bs_tsc;
+	for (i = 0; i < bi->bi_nstamp && i < BI_MAXSTAMP; i++) {
+		bs = &bi->bi_stamp[i];
+		cprintf("%13llu %12llu  %s", bs->bs_tsc - t0,
+			i ? bs->bs_tsc - bs[-1].bs_tsc : 0ULL,
+			bs->bs_stage < BT_NSTAGE ? boot_stages[bs->bs_stage] : "?");
+		if (bs->bs_arg)
+			cprintf(" (%u)", bs->bs_arg);
+		cprintf("\n");
+	}
+	return 0;
+}
+
+
+int
+mon_kmem(int argc, char **argv, struct Trapframe *tf)
+{
+	kmem_print_stats();
+	return 0;
+}
+
+int
+mon_locks(int argc, char **argv, struct Trapframe *tf)
+{
+	lock_print_stats();
+	return 0;
+}
+
+int
+mon_console(int argc, char **argv, struct Trapframe *tf)
+{
+	int r;
+
+	if (argc == 1) {
+		cons_sink_print();
+		return 0;
+	}
+	if (argc != 3
+	    || (strcmp(argv[2], "on") != 0 && strcmp(argv[2], "off") != 0)) {
+		cprintf("Usage: console [device on|off]\n");
+		return 0;
+	}
+	r = cons_sink_enable(argv[1], strcmp(argv[2], "on") == 0);
+	if (r == -E_NO_DEV)
+		cprintf("console: device '%s' is not present\n", argv[1]);
+	else if (r < 0)
+		cprintf("console: no device '%s'\n", argv[1]);
+	return 0;
+}
+
 
 /***** Kernel monitor command interpreter *****/
 
@@ -15,5 +15,9 @@ void monitor(struct Trapframe *tf);
 int mon_help(int argc, char **argv, struct Trapframe *tf);
 int mon_kerninfo(int argc, char **argv, struct Trapframe *tf);
 int mon_backtrace(int argc, char **argv, struct Trapframe *tf);
+int mon_boottime(int argc, char **argv, struct Trapframe *tf);
+int mon_kmem(int argc, char **argv, struct Trapframe *tf);
+int mon_locks(int argc, char **argv, struct Trapframe *tf);
+int mon_console(int argc, char **argv, struct Trapframe *tf);
 
 #endif	// !JOS_KERN_MONITOR_H
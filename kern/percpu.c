@@ -0,0 +1,85 @@
+/* See COPYRIGHT for copyright information. */
+
+#include <inc/types.h>
+#include <inc/mmu.h>
+#include <inc/x86.h>
+#include <inc/assert.h>
+#include <inc/memlayout.h>
+
+#include <kern/cpu.h>
+
+// Global descriptor table.
+//
+// Set up global descriptor table (GDT) with separate segments for
+// kernel mode and user mode.  Segments serve many purposes on the x86.
+// We don't use any of their memory-mapping capabilities, but we need
+// them to switch privilege levels.
+//
+// The kernel and user segments are identical except for the DPL.
+// To load the SS register, the CPL must equal the DPL.  Thus,
+// we must duplicate the segments for the user and the kernel.
+//
+// In particular, the last argument to the SEG macro used in the
+// definition of gdt specifies the Descriptor Privilege Level (DPL)
+// of that descriptor: 0 for kernel and 3 for user.
+//
+// The NCPU slots from GD_TSS0 are left for the CPUs' task segments.
+// The NCPU slots from GD_KCPU0 are the per-CPU data segments, each
+// covering one CPU's struct CpuInfo; percpu_init fills them in.
+//
+static struct Segdesc gdt[(GD_KCPU0 >> 3) + NCPU] =
+{
+	// 0x0 - unused (always faults -- for trapping NULL far pointers)
+	SEG_NULL,
+
+	// 0x8 - kernel code segment
+	[GD_KT >> 3] = SEG(STA_X | STA_R, 0x0, 0xffffffff, 0),
+
+	// 0x10 - kernel data segment
+	[GD_KD >> 3] = SEG(STA_W, 0x0, 0xffffffff, 0),
+
+	// 0x18 - user code segment
+	[GD_UT >> 3] = SEG(STA_X | STA_R, 0x0, 0xffffffff, 3),
+
+	// 0x20 - user data segment
+	[GD_UD >> 3] = SEG(STA_W, 0x0, 0xffffffff, 3),
+};
+
+static struct Pseudodesc gdt_pd = {
+	sizeof(gdt) - 1, (unsigned long) gdt
+};
+
+//
+// Load the kernel's GDT on this CPU and point %fs at the CPU's
+// struct CpuInfo.  The boot loader's GDT lives in low memory, which
+// kern_pgdir does not map, so each CPU must call this before anything
+// reloads a segment register, and before the first this_cpu_* access.
+// The boot CPU calls it before the LAPIC is mapped, while cpunum() is
+// still 0.
+//
+void
+percpu_init(void)
+{
+	struct CpuInfo *c = &cpus[cpunum()];
+	uint16_t sel = GD_KCPU0 + ((c - cpus) << 3);
+
+	static_assert(GD_KCPU0 == GD_TSS0 + (NCPU << 3));
+
+	c->cpu_self = c;
+	// A byte-granular 32-bit data segment exactly covering 'c'.
+	gdt[sel >> 3] = SEG16(STA_W, (uint32_t) c, sizeof(*c) - 1, 0);
+	gdt[sel >> 3].sd_db = 1;
+
+	lgdt(&gdt_pd);
+	// The kernel never uses GS.
+	asm volatile("movw %%ax,%%gs" : : "a" (0));
+	// The kernel does use ES, DS, and SS.  We'll change between
+	// the kernel and user data segments as needed.
+	asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+	asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+	asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+	// Load the kernel text segment into CS.
+	asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+	// And this CPU's per-CPU segment into FS.
+	asm volatile("movw %%ax,%%fs" : : "a" (sel));
+}
@@ -0,0 +1,783 @@
+/* See COPYRIGHT for copyright information. */
+
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/memlayout.h>
+#include <inc/bootinfo.h>
+#include <inc/multiboot.h>
+
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// These variables are set by i386_detect_memory()
+size_t npages;			// Amount of physical memory (in pages)
+static size_t npages_basemem;	// Amount of base memory (in pages)
+
+// These variables are set in mem_init()
+pde_t *kern_pgdir;		// Kernel's initial page directory
+struct PageInfo *pages;		// Physical page state array
+
+// Buddy allocator: free_area[k] lists the free blocks of 2^k pages.
+static struct PageInfo *free_area[MAXORDER + 1];
+static size_t nfree_area[MAXORDER + 1];	// blocks on each list
+static struct spinlock buddy_lock;	// protects the two arrays above
+
+// Per-CPU caches of free single pages, in front of the buddy lists.
+// page_alloc and page_free work on the current CPU's cache and only
+// go to the buddy lists a batch of pages at a time.
+#define PCP_BATCH	16
+#define PCP_HIGH	(4 * PCP_BATCH)
+
+struct PageCache {
+	struct PageInfo *pc_free;	// singly linked through pp_link
+	int pc_count;
+};
+static struct PageCache page_cache[NCPU];
+#define this_page_cache	(&page_cache[this_cpu_read(cpu_id)])
+
+static void boot_map_direct(pde_t *pgdir);
+static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size,
+			    physaddr_t pa, int perm);
+static void check_page_alloc(void);
+
+// The physical memory map, as the BIOS reported it
+struct E820ent memmap[BI_MAXE820];
+int nmemmap;
+
+// --------------------------------------------------------------
+// Detect machine's physical memory setup.
+// --------------------------------------------------------------
+
+static void
+memmap_add(uint64_t addr, uint64_t len, uint32_t type)
+{
+	if (nmemmap == BI_MAXE820 || len == 0)
+		return;
+	memmap[nmemmap].e_addr = addr;
+	memmap[nmemmap].e_len = len;
+	memmap[nmemmap].e_type = type;
+	nmemmap++;
+}
+
+// Fill in memmap from whichever loader started us: our own boot
+// loader copies the BIOS's E820 map into struct Bootinfo, and a
+// multiboot loader passes an equivalent map.  Without either, assume
+// the least any PC has: base memory and the 4MB we are mapped in.
+static void
+memmap_init(void)
+{
+	extern uint32_t multiboot_info;
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO);
+	struct Multiboot_info *mbi;
+	struct Multiboot_mmap *mm;
+	uint32_t off;
+	int i;
+
+	if (bi->bi_magic == BOOTINFO_MAGIC && bi->bi_ne820 > 0) {
+		for (i = 0; i < bi->bi_ne820 && i < BI_MAXE820; i++)
+			memmap_add(bi->bi_e820[i].e_addr, bi->bi_e820[i].e_len,
+				   bi->bi_e820[i].e_type);
+		return;
+	}
+
+	// The multiboot structures are wherever the loader put them, so
+	// only trust them within the memory entry_pgdir maps.
+	mbi = (struct Multiboot_info *) (KERNBASE + multiboot_info);
+	if (multiboot_info && multiboot_info < PTSIZE - sizeof(*mbi)
+	    && (mbi->flags & MULTIBOOT_INFO_MMAP)
+	    && mbi->mmap_addr + mbi->mmap_length <= PTSIZE) {
+		for (off = 0; off + sizeof(*mm) <= mbi->mmap_length;
+		     off += mm->size + sizeof(mm->size)) {
+			mm = (struct Multiboot_mmap *)
+				(KERNBASE + mbi->mmap_addr + off);
+			memmap_add(mm->addr, mm->len, mm->type);
+		}
+		return;
+	}
+
+	cprintf("No memory map; assuming 4MB\n");
+	memmap_add(0, IOPHYSMEM, E820_RAM);
+	memmap_add(EXTPHYSMEM, PTSIZE - EXTPHYSMEM, E820_RAM);
+}
+
+void
+i386_detect_memory(void)
+{
+	uint64_t start, end, top;
+	size_t npages_extmem;
+	int i;
+
+	memmap_init();
+
+	// The kernel reaches physical memory through its direct map at
+	// KERNBASE, so RAM past 4GB - KERNBASE (256MB) is no use to us.
+	// Count whole pages only.
+	top = 0;
+	npages_basemem = npages_extmem = 0;
+	for (i = 0; i < nmemmap; i++) {
+		if (memmap[i].e_type != E820_RAM)
+			continue;
+		start = (memmap[i].e_addr + PGSIZE - 1)
+			& ~(uint64_t) (PGSIZE - 1);
+		end = memmap[i].e_addr + memmap[i].e_len;
+		if (end > 0x100000000ULL - KERNBASE)
+			end = 0x100000000ULL - KERNBASE;
+		end &= ~(uint64_t) (PGSIZE - 1);
+		if (start >= end)
+			continue;
+		if (start < IOPHYSMEM)
+			npages_basemem += ((end < IOPHYSMEM ? end : IOPHYSMEM)
+					   - start) >> PGSHIFT;
+		if (end > EXTPHYSMEM)
+			npages_extmem += (end - (start > EXTPHYSMEM ? start
+						 : EXTPHYSMEM)) >> PGSHIFT;
+		if (end > top)
+			top = end;
+	}
+	npages = top >> PGSHIFT;
+
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+		npages * (PGSIZE / 1024),
+		npages_basemem * (PGSIZE / 1024),
+		npages_extmem * (PGSIZE / 1024));
+}
+
+// --------------------------------------------------------------
+// Early boot allocator
+// --------------------------------------------------------------
+
+// Virtual address of the next byte of free memory.  The arena starts
+// at the first page boundary after the kernel's BSS ('end', from
+// kernel.ld) and ends where entry_pgdir's mapping does, so everything
+// it hands out is usable before we set up real page tables.
+static char *nextfree;
+#define BOOT_ALLOC_LIMIT	((char *) (KERNBASE + PTSIZE))
+
+static void
+boot_alloc_init(void)
+{
+	extern char end[];
+
+	if (!nextfree)
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+}
+
+// Allocate 'n' bytes aligned to 'align' (a power of two) and return
+// their kernel virtual address.  The memory is not initialized.
+// Panics if the early mapping is exhausted.
+void *
+boot_alloc_align(uint32_t n, uint32_t align)
+{
+	char *result;
+
+	assert(align != 0 && (align & (align - 1)) == 0);
+	boot_alloc_init();
+	result = ROUNDUP(nextfree, align);
+	if (n > (uint32_t) (BOOT_ALLOC_LIMIT - result))
+		panic("boot_alloc: out of memory allocating %u bytes", n);
+	nextfree = result + n;
+	return result;
+}
+
+// Allocate enough whole pages to hold 'n' bytes.  If n is 0, return
+// the address of the next free page without allocating anything: the
+// page allocator uses this to find the end of the boot arena when it
+// takes over physical memory.
+void *
+boot_alloc(uint32_t n)
+{
+	return boot_alloc_align(ROUNDUP(n, PGSIZE), PGSIZE);
+}
+
+// Return a mark that boot_alloc_release can later roll the arena
+// back to, freeing everything allocated since in one step.
+void *
+boot_alloc_mark(void)
+{
+	boot_alloc_init();
+	return nextfree;
+}
+
+void
+boot_alloc_release(void *mark)
+{
+	extern char end[];
+
+	boot_alloc_init();
+	if ((char *) mark < end || (char *) mark > nextfree)
+		panic("boot_alloc_release: bad mark %08x", mark);
+	nextfree = mark;
+}
+
+// --------------------------------------------------------------
+// Set up memory management.
+// --------------------------------------------------------------
+
+void
+mem_init(void)
+{
+	// Find out how much memory the machine has (npages & npages_basemem).
+	i386_detect_memory();
+
+	//////////////////////////////////////////////////////////////////////
+	// Allocate an array of npages 'struct PageInfo's and store it in
+	// 'pages'.  The kernel uses this array to keep track of physical
+	// pages: for each physical page, there is a corresponding struct
+	// PageInfo in this array.  'npages' is the number of physical
+	// pages in memory.
+	pages = boot_alloc(npages * sizeof(struct PageInfo));
+	memset(pages, 0, npages * sizeof(struct PageInfo));
+
+	//////////////////////////////////////////////////////////////////////
+	// Create the kernel's page directory, mapping all of physical
+	// memory at KERNBASE, and switch to it.  entry_pgdir's mappings
+	// were global, so flush those too.
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+	memset(kern_pgdir, 0, PGSIZE);
+	boot_map_direct(kern_pgdir);
+	lcr3(PADDR(kern_pgdir));
+	tlbflush_global();
+
+	//////////////////////////////////////////////////////////////////////
+	// Now that we've allocated the initial kernel data structures, we
+	// set up the buddy lists.  Once that is done, all further memory
+	// management will go through the page_* functions.
+	__spin_initlock(&buddy_lock, "buddy");
+	page_init();
+
+	check_page_alloc();
+
+	pat_init();
+}
+
+//
+// Map each CPU's kernel stack below KSTACKTOP, as the layout in
+// inc/memlayout.h shows, with an unmapped KSTKGAP below each stack so
+// an overflow faults instead of silently corrupting the next CPU's
+// stack.  CPU 0 keeps the boot stack from entry.S; the others get
+// fresh pages.  Called once mp_init has counted the CPUs.
+//
+void
+mem_init_mp(void)
+{
+	struct PageInfo *pp;
+	uintptr_t kstacktop_i;
+	size_t off;
+	int i;
+
+	for (i = 0; i < ncpu; i++) {
+		kstacktop_i = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+		if (i == 0) {
+			boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE,
+					KSTKSIZE, PADDR(bootstack),
+					PTE_W | PTE_G);
+			continue;
+		}
+		for (off = 0; off < KSTKSIZE; off += PGSIZE) {
+			if (!(pp = page_alloc(ALLOC_ZERO)))
+				panic("mem_init_mp: out of memory");
+			pp->pp_ref++;
+			boot_map_region(kern_pgdir,
+					kstacktop_i - KSTKSIZE + off, PGSIZE,
+					page2pa(pp), PTE_W | PTE_G);
+		}
+	}
+}
+
+// Has pat_init set up the write-combining memory type?
+static bool pat_wc;
+
+//
+// Program the page attribute table so that entry 1 (selected by
+// PTE_PWT alone, i.e. PTE_WC) is write-combining rather than
+// write-through.  The other entries keep their power-on types, so
+// PTE_PCD|PTE_PWT still means uncached.
+//
+// The PAT is per-CPU: each application processor calls this again
+// from mp_main, before it touches any PTE_WC mapping.  Changing a
+// memory type follows the SDM's procedure (Vol. 3A, 11.11.8): with
+// interrupts off and caching disabled, write back and invalidate the
+// caches and flush the TLB both before and after the MSR write, so
+// that no line or translation cached under the old type survives.
+//
+void
+pat_init(void)
+{
+	uint32_t edx, eflags, cr0;
+	uint64_t pat;
+
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (!(edx & CPUID_PAT))
+		return;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	cr0 = rcr0();
+	lcr0((cr0 | CR0_CD) & ~CR0_NW);
+	wbinvd();
+	tlbflush_global();
+
+	pat = rdmsr(MSR_PAT);
+	pat = (pat & ~(uint64_t) 0xFF00) | (0x01 << 8);	// PA1 = WC
+	wrmsr(MSR_PAT, pat);
+
+	wbinvd();
+	tlbflush_global();
+	lcr0(cr0);
+	write_eflags(eflags);
+	pat_wc = true;
+}
+
+//
+// Map [KERNBASE, KERNBASE + npages * PGSIZE) to [0, npages * PGSIZE)
+// in 'pgdir', writable by the kernel and global.  Whole 4MB chunks get
+// a single PTE_PS entry each, so the direct map needs no page tables
+// and few TLB entries; a partial last chunk is mapped with 4KB pages
+// from a page table taken from boot_alloc.  The first 4MB are always
+// mapped, since the kernel lives there.  The kernel requires PSE:
+// entry.S already turned it on for entry_pgdir's 4MB pages.
+//
+static void
+boot_map_direct(pde_t *pgdir)
+{
+	physaddr_t pa, top;
+	pte_t *pt;
+	int i;
+
+	top = MAX((physaddr_t) npages * PGSIZE, (physaddr_t) PTSIZE);
+	for (pa = 0; pa < top; ) {
+		if (top - pa >= PTSIZE) {
+			pgdir[PDX(KERNBASE + pa)] =
+				pa | PTE_PS | PTE_G | PTE_W | PTE_P;
+			pa += PTSIZE;
+			continue;
+		}
+		pt = boot_alloc(PGSIZE);
+		memset(pt, 0, PGSIZE);
+		pgdir[PDX(KERNBASE + pa)] = PADDR(pt) | PTE_W | PTE_P;
+		for (i = 0; i < NPTENTRIES && pa < top; i++, pa += PGSIZE)
+			pt[i] = pa | PTE_G | PTE_W | PTE_P;
+	}
+}
+
+//
+// Map [va, va+size) of virtual address space to physical [pa, pa+size)
+// in the page table rooted at pgdir, with permissions perm|PTE_P.
+// Size is a multiple of PGSIZE, and va and pa are both page-aligned.
+//
+static void
+boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa,
+		int perm)
+{
+	pte_t *pte;
+	size_t off;
+
+	for (off = 0; off < size; off += PGSIZE) {
+		if (!(pte = pgdir_walk(pgdir, (void *) (va + off), 1)))
+			panic("boot_map_region: out of memory");
+		*pte = (pa + off) | perm | PTE_P;
+	}
+}
+
+// --------------------------------------------------------------
+// Tracking of physical pages.
+// The 'pages' array has one 'struct PageInfo' entry per physical page.
+// Free pages live in power-of-two blocks on the buddy lists, or
+// singly in a per-CPU cache.
+// --------------------------------------------------------------
+
+static void
+buddy_push(struct PageInfo *pp, int order)
+{
+	pp->pp_order = order;
+	pp->pp_flags |= PP_BUDDY;
+	pp->pp_prev = NULL;
+	pp->pp_link = free_area[order];
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp;
+	free_area[order] = pp;
+	nfree_area[order]++;
+}
+
+static void
+buddy_unlink(struct PageInfo *pp, int order)
+{
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		free_area[order] = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_link = pp->pp_prev = NULL;
+	pp->pp_flags &= ~PP_BUDDY;
+	nfree_area[order]--;
+}
+
+// Take a block of 2^order pages off the buddy lists, splitting the
+// smallest larger block if there is no block of the right size.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= MAXORDER && !free_area[k]; k++)
+		/* do nothing */;
+	if (k > MAXORDER)
+		return NULL;
+	pp = free_area[k];
+	buddy_unlink(pp, k);
+	// Return the upper halves to the lists as we split.
+	while (k > order) {
+		k--;
+		buddy_push(pp + (1 << k), k);
+	}
+	pp->pp_order = order;
+	return pp;
+}
+
+// Return a block of 2^order pages to the buddy lists, merging it with
+// its buddy for as long as the buddy is free too.  A block's buddy is
+// the block it was split from, at page number pn ^ 2^order.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+	size_t pn = pp - pages, bn;
+
+	for (; order < MAXORDER; order++) {
+		bn = pn ^ (1 << order);
+		if (bn >= npages || !(pages[bn].pp_flags & PP_BUDDY)
+		    || pages[bn].pp_order != order)
+			break;
+		buddy_unlink(&pages[bn], order);
+		pn &= ~(size_t) (1 << order);
+	}
+	buddy_push(&pages[pn], order);
+}
+
+// Does any non-RAM range of the memory map overlap the page at 'pa'?
+// Such ranges win when they overlap RAM.
+static bool
+memmap_reserved(uint64_t pa)
+{
+	int i;
+
+	for (i = 0; i < nmemmap; i++)
+		if (memmap[i].e_type != E820_RAM
+		    && memmap[i].e_addr < pa + PGSIZE
+		    && memmap[i].e_addr + memmap[i].e_len > pa)
+			return true;
+	return false;
+}
+
+//
+// Initialize page structures and the buddy lists.
+// After this is done, NEVER use boot_alloc again.  ONLY use the page
+// allocator functions below to allocate and deallocate physical
+// memory.
+//
+void
+page_init(void)
+{
+	physaddr_t kern_end = PADDR(boot_alloc(0));
+	uint64_t start, end, pa;
+	int i;
+
+	// A page is free if it lies wholly within RAM, except for:
+	//  1) Physical page 0, which holds the real-mode IDT and BIOS
+	//     structures in case we ever need them.
+	//  2) The page at BOOTINFO, which holds the boot loader's report
+	//     to the kernel ('boottime' still reads it), and the page at
+	//     MPENTRY_PADDR, where boot_aps copies the AP entry code.
+	//  3) The IO hole [IOPHYSMEM, EXTPHYSMEM), which must never be
+	//     allocated.
+	//  4) Extended memory up to kern_end, which holds the kernel and
+	//     everything boot_alloc handed out.
+	for (i = 0; i < nmemmap; i++) {
+		if (memmap[i].e_type != E820_RAM)
+			continue;
+		start = (memmap[i].e_addr + PGSIZE - 1)
+			& ~(uint64_t) (PGSIZE - 1);
+		end = memmap[i].e_addr + memmap[i].e_len;
+		for (pa = start; pa + PGSIZE <= end; pa += PGSIZE) {
+			if (pa == 0 || pa == ROUNDDOWN(BOOTINFO, PGSIZE)
+			    || pa == MPENTRY_PADDR
+			    || (pa >= IOPHYSMEM && pa < kern_end)
+			    || (pa >> PGSHIFT) >= npages
+			    || memmap_reserved(pa))
+				continue;
+			// Free pages one at a time: the buddy lists merge
+			// them into the largest blocks alignment allows.
+			buddy_free(&pages[pa >> PGSHIFT], 0);
+		}
+	}
+}
+
+//
+// Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the
+// entire returned physical page with '\0' bytes.  Does NOT increment
+// the reference count of the page - the caller must do these if
+// necessary (either explicitly or via page_insert).
+//
+// Single pages come from this CPU's cache, which is refilled from
+// the buddy lists PCP_BATCH pages at a time.
+//
+// Returns NULL if out of free memory.
+//
+struct PageInfo *
+page_alloc(int alloc_flags)
+{
+	struct PageCache *pc = this_page_cache;
+	struct PageInfo *pp;
+
+	if (!pc->pc_free) {
+		spin_lock(&buddy_lock);
+		while (pc->pc_count < PCP_BATCH && (pp = buddy_alloc(0))) {
+			pp->pp_link = pc->pc_free;
+			pc->pc_free = pp;
+			pc->pc_count++;
+		}
+		spin_unlock(&buddy_lock);
+	}
+	if (!(pp = pc->pc_free))
+		return NULL;
+	pc->pc_free = pp->pp_link;
+	pc->pc_count--;
+	pp->pp_link = NULL;
+	if (alloc_flags & ALLOC_ZERO)
+		memset(page2kva(pp), 0, PGSIZE);
+	return pp;
+}
+
+//
+// Return a page to the free list.
+// (This function should only be called when pp->pp_ref reaches 0.)
+//
+void
+page_free(struct PageInfo *pp)
+{
+	struct PageCache *pc = this_page_cache;
+	struct PageInfo *p;
+
+	if (pp->pp_ref != 0 || pp->pp_link != NULL)
+		panic("page_free: page %08x is still in use", page2pa(pp));
+	pp->pp_link = pc->pc_free;
+	pc->pc_free = pp;
+	if (++pc->pc_count <= PCP_HIGH)
+		return;
+	// Give a batch back, so that the buddy lists can merge them.
+	spin_lock(&buddy_lock);
+	while (pc->pc_count > PCP_HIGH - PCP_BATCH) {
+		p = pc->pc_free;
+		pc->pc_free = p->pp_link;
+		pc->pc_count--;
+		p->pp_link = NULL;
+		buddy_free(p, 0);
+	}
+	spin_unlock(&buddy_lock);
+}
+
+//
+// Allocates 2^order physically contiguous pages, aligned to their
+// size, and returns the first one's PageInfo.  The other pages'
+// PageInfos follow it in 'pages'.  Flags and reference counts are as
+// for page_alloc.  Returns NULL if no block that large is free.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+
+	assert(order >= 0 && order <= MAXORDER);
+	if (order == 0)
+		return page_alloc(alloc_flags);
+	spin_lock(&buddy_lock);
+	pp = buddy_alloc(order);
+	spin_unlock(&buddy_lock);
+	if (!pp)
+		return NULL;
+	if (alloc_flags & ALLOC_ZERO)
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+//
+// Free a block from page_alloc_order(order, ...).
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+	if (order == 0) {
+		page_free(pp);
+		return;
+	}
+	if (pp->pp_ref != 0 || pp->pp_link != NULL || pp->pp_order != order
+	    || ((pp - pages) & ((1 << order) - 1)))
+		panic("page_free_order: bad block %08x, order %d",
+		      page2pa(pp), order);
+	spin_lock(&buddy_lock);
+	buddy_free(pp, order);
+	spin_unlock(&buddy_lock);
+}
+
+//
+// Decrement the reference count on a page,
+// freeing it if there are no more refs.
+//
+void
+page_decref(struct PageInfo* pp)
+{
+	if (--pp->pp_ref == 0)
+		page_free(pp);
+}
+
+// Number of free pages, on the buddy lists and in the CPU caches.
+// This is a snapshot: other CPUs may be allocating as it counts.
+size_t
+page_nfree(void)
+{
+	size_t n = 0;
+	int i;
+
+	for (i = 0; i <= MAXORDER; i++)
+		n += nfree_area[i] << i;
+	for (i = 0; i < NCPU; i++)
+		n += page_cache[i].pc_count;
+	return n;
+}
+
+
+// Given 'pgdir', a pointer to a page directory, pgdir_walk returns
+// a pointer to the page table entry (PTE) for linear address 'va'.
+// This requires walking the two-level page table structure.
+//
+// If the relevant page table doesn't exist and 'create' is true, a
+// new page table page is allocated with page_alloc, zeroed, and its
+// reference count incremented.  Otherwise pgdir_walk returns NULL,
+// as it also does for a 'va' within a 4MB (PTE_PS) mapping.
+//
+pte_t *
+pgdir_walk(pde_t *pgdir, const void *va, int create)
+{
+	pde_t *pde = &pgdir[PDX(va)];
+	struct PageInfo *pp;
+
+	if (!(*pde & PTE_P)) {
+		if (!create || !(pp = page_alloc(ALLOC_ZERO)))
+			return NULL;
+		pp->pp_ref++;
+		// Leave the page table permissive; PTEs restrict access.
+		*pde = page2pa(pp) | PTE_U | PTE_W | PTE_P;
+	} else if (*pde & PTE_PS)
+		return NULL;
+	return (pte_t *) KADDR(PTE_ADDR(*pde)) + PTX(va);
+}
+
+//
+// Reserve size bytes in the MMIO region and map [pa,pa+size) at this
+// location with memory type given by 'perm'.  Return the base of the
+// reserved region.  size does *not* have to be multiple of PGSIZE.
+//
+static void *
+mmio_map(physaddr_t pa, size_t size, int perm)
+{
+	// Where to start the next region.  Initially, this is the
+	// beginning of the MMIO region.  Because this is static, its
+	// value will be preserved between calls to mmio_map.
+	static uintptr_t base = MMIOBASE;
+	uintptr_t va = base;
+
+	size = ROUNDUP(size + PGOFF(pa), PGSIZE);
+	if (size > MMIOLIM - base)
+		panic("mmio_map: %u bytes overflow MMIOLIM", size);
+	boot_map_region(kern_pgdir, va, size, ROUNDDOWN(pa, PGSIZE),
+			perm | PTE_G | PTE_W);
+	base += size;
+	return (void *) (va + PGOFF(pa));
+}
+
+// Map device memory uncached, as device registers need.
+void *
+mmio_map_region(physaddr_t pa, size_t size)
+{
+	return mmio_map(pa, size, PTE_PCD | PTE_PWT);
+}
+
+// Map device memory write-combining, for frame buffers: the CPU may
+// merge and delay writes, but reads are uncached.  Returns NULL if
+// the CPU has no PAT, in which case the caller should keep using the
+// memory through the direct map.
+//
+// The direct map covers the same memory as cacheable.  Nothing may
+// touch it through both mappings; the MTRRs make the legacy VGA range
+// uncached in the direct map anyway.
+void *
+mmio_map_region_wc(physaddr_t pa, size_t size)
+{
+	if (!pat_wc)
+		return NULL;
+	return mmio_map(pa, size, PTE_WC);
+}
+
+
+// --------------------------------------------------------------
+// Checking functions.
+// --------------------------------------------------------------
+
+//
+// Check the physical page allocator (page_alloc(), page_free(),
+// page_alloc_order() and page_free_order()).
+//
+static void
+check_page_alloc(void)
+{
+	struct PageInfo *pp0, *pp1, *pp2, *big;
+	size_t nfree;
+	char *c;
+	int i;
+
+	if (!pages)
+		panic("'pages' is a null pointer!");
+	nfree = page_nfree();
+	assert(nfree > 0);
+
+	// should be able to allocate three pages
+	assert((pp0 = page_alloc(0)));
+	assert((pp1 = page_alloc(0)));
+	assert((pp2 = page_alloc(0)));
+	assert(pp0 != pp1 && pp1 != pp2 && pp2 != pp0);
+	assert(page2pa(pp0) < npages*PGSIZE);
+	assert(page2pa(pp1) < npages*PGSIZE);
+	assert(page2pa(pp2) < npages*PGSIZE);
+	assert(page_nfree() == nfree - 3);
+
+	// test ALLOC_ZERO on a dirtied page
+	memset(page2kva(pp0), 1, PGSIZE);
+	page_free(pp0);
+	assert((pp0 = page_alloc(ALLOC_ZERO)));
+	c = page2kva(pp0);
+	for (i = 0; i < PGSIZE; i++)
+		assert(c[i] == 0);
+
+	page_free(pp0);
+	page_free(pp1);
+	page_free(pp2);
+
+	// contiguous blocks are aligned to their size, and their pages
+	// are not handed out again until the block is freed
+	assert((big = page_alloc_order(3, 0)));
+	assert((page2pa(big) & ((PGSIZE << 3) - 1)) == 0);
+	assert(page_nfree() == nfree - 8);
+	for (i = 0; i < 4 * PCP_HIGH; i++) {
+		assert((pp0 = page_alloc(0)));
+		assert(pp0 < big || pp0 >= big + 8);
+		page_free(pp0);
+	}
+	page_free_order(big, 3);
+	assert(page_nfree() == nfree);
+
+	cprintf("check_page_alloc() succeeded!\n");
+}
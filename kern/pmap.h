@@ -0,0 +1,108 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_PMAP_H
+#define JOS_KERN_PMAP_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/memlayout.h>
+#include <inc/assert.h>
+#include <inc/bootinfo.h>
+
+extern struct PageInfo *pages;
+extern size_t npages;
+
+extern char bootstacktop[], bootstack[];
+
+extern pde_t *kern_pgdir;
+
+// The physical memory map found by i386_detect_memory
+extern struct E820ent memmap[];
+extern int nmemmap;
+
+/* This macro takes a kernel virtual address -- an address that points above
+ * KERNBASE, where the machine's physical memory is mapped --
+ * and returns the corresponding physical address.  It panics if you pass it a
+ * non-kernel virtual address.
+ */
+#define PADDR(kva) _paddr(__FILE__, __LINE__, kva)
+
+static inline physaddr_t
+_paddr(const char *file, int line, void *kva)
+{
+	if ((uint32_t)kva < KERNBASE)
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+	return (physaddr_t)kva - KERNBASE;
+}
+
+/* This macro takes a physical address and returns the corresponding kernel
+ * virtual address.  It panics if you pass an invalid physical address. */
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+	return (void *)(pa + KERNBASE);
+}
+
+
+enum {
+	// For page_alloc, zero the returned physical page.
+	ALLOC_ZERO = 1<<0,
+};
+
+// Memory type for mmio_map_region_wc's mappings: pat_init makes the
+// PAT entry that PTE_PWT alone selects write-combining.
+#define PTE_WC		PTE_PWT
+
+// Largest buddy block: 2^MAXORDER pages, one 4MB superpage.
+#define MAXORDER	10
+
+void	mem_init(void);
+void	mem_init_mp(void);
+void	pat_init(void);
+void	i386_detect_memory(void);
+
+void	page_init(void);
+struct PageInfo *page_alloc(int alloc_flags);
+void	page_free(struct PageInfo *pp);
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+void	page_decref(struct PageInfo *pp);
+size_t	page_nfree(void);
+
+pte_t	*pgdir_walk(pde_t *pgdir, const void *va, int create);
+void	*mmio_map_region(physaddr_t pa, size_t size);
+void	*mmio_map_region_wc(physaddr_t pa, size_t size);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+}
+
+static inline void*
+page2kva(struct PageInfo *pp)
+{
+	return KADDR(page2pa(pp));
+}
+
+// Early boot allocator: hands out memory above the kernel image,
+// within the part of physical memory that entry_pgdir maps.
+void *boot_alloc(uint32_t n);
+void *boot_alloc_align(uint32_t n, uint32_t align);
+void *boot_alloc_mark(void);
+void boot_alloc_release(void *mark);
+
+#endif /* !JOS_KERN_PMAP_H */
@@ -0,0 +1,76 @@
+// A read-mostly block device backed by a file-system image linked
+// into the kernel.
+//
+// Building with 'make RAMDISK=path/to/fs.img' copies the image to
+// obj/fs/ramdisk.img and links it in with '-b binary' (see
+// KERN_BINFILES in kern/Makefrag).  The linker then defines the
+// _binary_obj_fs_ramdisk_img_* symbols below; without an image they
+// are weak and resolve to 0, and the RAM disk is simply empty.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/error.h>
+#include <inc/memlayout.h>
+
+#include <kern/ramdisk.h>
+#include <kern/pmap.h>
+
+extern char _binary_obj_fs_ramdisk_img_start[] __attribute__((weak));
+extern char _binary_obj_fs_ramdisk_img_end[] __attribute__((weak));
+
+static char *rd_base;
+static size_t rd_size;
+
+void
+ramdisk_init(void)
+{
+	rd_base = _binary_obj_fs_ramdisk_img_start;
+	rd_size = _binary_obj_fs_ramdisk_img_end - rd_base;
+	if (rd_size == 0)
+		return;
+
+	// The image is part of the kernel's .data, so it must lie within
+	// the physical memory that mem_init direct-maps at KERNBASE.  A
+	// partial trailing block is dropped: the file system never asks
+	// for one.
+	if (PADDR(rd_base) + rd_size > (physaddr_t) npages * PGSIZE) {
+		cprintf("ramdisk: %u-byte image is not fully mapped; "
+			"ignoring it\n", rd_size);
+		rd_size = 0;
+		return;
+	}
+	cprintf("ramdisk: %u blocks at %08x\n", ramdisk_nblocks(), rd_base);
+}
+
+uint32_t
+ramdisk_nblocks(void)
+{
+	return rd_size / RAMDISK_BLKSIZE;
+}
+
+// Set *blk to point at block 'blockno' of the image, without copying.
+// This is the backend for file_get_block when the file system runs
+// from the RAM disk.  Returns 0 on success, -E_INVAL if the block is
+// out of range.
+int
+ramdisk_get_block(uint32_t blockno, char **blk)
+{
+	if (blockno >= ramdisk_nblocks())
+		return -E_INVAL;
+	*blk = rd_base + blockno * RAMDISK_BLKSIZE;
+	return 0;
+}
+
+// Read 'nsecs' sectors starting at 'secno' into 'dst', with the same
+// interface as the IDE driver's ide_read.
+int
+ramdisk_read(uint32_t secno, void *dst, size_t nsecs)
+{
+	size_t nsect = rd_size / RAMDISK_SECTSIZE;
+
+	if (secno > nsect || nsecs > nsect - secno)
+		return -E_INVAL;
+	memcpy(dst, rd_base + secno * RAMDISK_SECTSIZE,
+	       nsecs * RAMDISK_SECTSIZE);
+	return 0;
+}
@@ -0,0 +1,22 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_RAMDISK_H
+#define JOS_KERN_RAMDISK_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/mmu.h>
+
+// The RAM disk serves file-system blocks of the same size as the
+// on-disk file system, and IDE-sized sectors for ide_read's callers.
+#define RAMDISK_BLKSIZE		PGSIZE
+#define RAMDISK_SECTSIZE	512
+
+void ramdisk_init(void);
+uint32_t ramdisk_nblocks(void);
+int ramdisk_get_block(uint32_t blockno, char **blk);
+int ramdisk_read(uint32_t secno, void *dst, size_t nsecs);
+
+#endif /* !JOS_KERN_RAMDISK_H */
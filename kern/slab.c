@@ -0,0 +1,352 @@
+// Slab allocator for kernel objects, and kmalloc on top of it.
+//
+// Each struct Kmem_cache hands out objects of one size from slabs of
+// 2^kc_order pages taken from the page allocator.  A slab starts with
+// a struct Slab, then an array of free-list links (one per object),
+// then the objects themselves.  Keeping the links outside the objects
+// means a freed object keeps the state its constructor gave it.
+//
+// Every page of a slab has PP_SLAB set in its PageInfo and the slab's
+// order in pp_order, so the slab an object belongs to can be found
+// from the object's address alone.  kmalloc uses that to tell its
+// size-class objects from the page blocks it hands out for large
+// requests.
+//
+// Each cache has its own lock, taken by kmem_cache_alloc and
+// kmem_cache_free; the list of all caches has a separate one.  Slabs
+// are created and destroyed with the cache's lock held, so the page
+// allocator's lock nests inside it.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+
+#include <kern/pmap.h>
+#include <kern/slab.h>
+
+#define SLAB_END	0xFFFF		// end of a slab's free list
+#define KMEM_MAXORDER	3		// largest slab: 8 pages
+
+struct Slab {
+	struct Slab *s_next;		// on one of the cache's lists
+	struct Slab *s_prev;
+	struct Kmem_cache *s_cache;
+	char *s_mem;			// first object
+	uint32_t s_inuse;		// objects handed out
+	uint16_t s_free;		// first free object, or SLAB_END
+	uint16_t s_link[];		// s_link[i]: free object after i
+};
+
+// The caches for struct Kmem_cache itself and for kmalloc
+static struct Kmem_cache kmem_cache_cache;
+#define KMALLOC_MINSHIFT	5	// smallest kmalloc class: 32 bytes
+#define KMALLOC_NCLASS		7	// ...up to 2048 bytes
+static struct Kmem_cache *kmalloc_caches[KMALLOC_NCLASS];
+static const char * const kmalloc_names[KMALLOC_NCLASS] = {
+	"kmalloc-32", "kmalloc-64", "kmalloc-128", "kmalloc-256",
+	"kmalloc-512", "kmalloc-1024", "kmalloc-2048"
+};
+
+// All caches, for kmem_print_stats
+static struct Kmem_cache *kmem_caches;
+static struct spinlock kmem_caches_lock;	// protects kmem_caches
+
+static void
+slab_push(struct Slab **list, struct Slab *s)
+{
+	s->s_prev = NULL;
+	s->s_next = *list;
+	if (s->s_next)
+		s->s_next->s_prev = s;
+	*list = s;
+}
+
+static void
+slab_unlink(struct Slab **list, struct Slab *s)
+{
+	if (s->s_prev)
+		s->s_prev->s_next = s->s_next;
+	else
+		*list = s->s_next;
+	if (s->s_next)
+		s->s_next->s_prev = s->s_prev;
+	s->s_next = s->s_prev = NULL;
+}
+
+// Size of a slab's header with room for 'n' free-list links, rounded
+// up so that the first object is aligned.
+static uint32_t
+slab_offset(uint32_t n, size_t align)
+{
+	return ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), align);
+}
+
+// Fill in a cache and choose its slab size: the smallest that wastes
+// no more than an eighth of itself, or failing that the largest.
+static void
+kmem_cache_setup(struct Kmem_cache *kc, const char *name, size_t size,
+		 size_t align, void (*ctor)(void *))
+{
+	uint32_t slabsize, n;
+	int order;
+
+	if (align < sizeof(uint64_t))
+		align = sizeof(uint64_t);
+	if ((align & (align - 1)) != 0 || align > PGSIZE)
+		panic("kmem_cache_create %s: bad alignment %u", name, align);
+
+	memset(kc, 0, sizeof(*kc));
+	kc->kc_name = name;
+	kc->kc_align = align;
+	kc->kc_size = ROUNDUP(size ? size : 1, align);
+	kc->kc_ctor = ctor;
+	__spin_initlock(&kc->kc_lock, name);
+
+	for (order = 0; order <= KMEM_MAXORDER; order++) {
+		slabsize = PGSIZE << order;
+		n = (slabsize - sizeof(struct Slab))
+			/ (kc->kc_size + sizeof(uint16_t));
+		while (n > 0 && slab_offset(n, align) + n * kc->kc_size
+				> slabsize)
+			n--;
+		if (n == 0)
+			continue;
+		kc->kc_order = order;
+		kc->kc_perslab = MIN(n, SLAB_END);
+		kc->kc_offset = slab_offset(kc->kc_perslab, align);
+		if ((slabsize - kc->kc_offset
+		     - kc->kc_perslab * kc->kc_size) * 8 <= slabsize)
+			break;
+	}
+	if (kc->kc_perslab == 0)
+		panic("kmem_cache_create %s: %u-byte objects are too big",
+		      name, size);
+
+	spin_lock(&kmem_caches_lock);
+	kc->kc_next = kmem_caches;
+	kmem_caches = kc;
+	spin_unlock(&kmem_caches_lock);
+}
+
+static struct Slab *
+slab_create(struct Kmem_cache *kc)
+{
+	struct PageInfo *pp;
+	struct Slab *s;
+	uint32_t i;
+
+	if (!(pp = page_alloc_order(kc->kc_order, 0)))
+		return NULL;
+	for (i = 0; i < (1 << kc->kc_order); i++) {
+		pp[i].pp_flags |= PP_SLAB;
+		pp[i].pp_order = kc->kc_order;
+	}
+
+	s = page2kva(pp);
+	s->s_next = s->s_prev = NULL;
+	s->s_cache = kc;
+	s->s_mem = (char *) s + kc->kc_offset;
+	s->s_inuse = 0;
+	s->s_free = 0;
+	for (i = 0; i < kc->kc_perslab; i++) {
+		s->s_link[i] = i + 1 < kc->kc_perslab ? i + 1 : SLAB_END;
+		if (kc->kc_ctor)
+			kc->kc_ctor(s->s_mem + i * kc->kc_size);
+	}
+	kc->kc_nslabs++;
+	return s;
+}
+
+static void
+slab_destroy(struct Kmem_cache *kc, struct Slab *s)
+{
+	struct PageInfo *pp = pa2page(PADDR(s));
+	uint32_t i;
+
+	for (i = 0; i < (1 << kc->kc_order); i++)
+		pp[i].pp_flags &= ~PP_SLAB;
+	pp->pp_order = kc->kc_order;
+	page_free_order(pp, kc->kc_order);
+	kc->kc_nslabs--;
+}
+
+// The slab holding the object at 'p', or NULL if 'p' is not in a slab.
+static struct Slab *
+obj_slab(void *p)
+{
+	struct PageInfo *pp = pa2page(PADDR(p));
+
+	if (!(pp->pp_flags & PP_SLAB))
+		return NULL;
+	return ROUNDDOWN(p, PGSIZE << pp->pp_order);
+}
+
+//
+// Set up the kmalloc caches.  The page allocator must be running.
+//
+void
+kmem_init(void)
+{
+	int i;
+
+	__spin_initlock(&kmem_caches_lock, "kmem_caches");
+	kmem_cache_setup(&kmem_cache_cache, "kmem_cache",
+			 sizeof(struct Kmem_cache), 0, NULL);
+	for (i = 0; i < KMALLOC_NCLASS; i++) {
+		kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i],
+			1 << (KMALLOC_MINSHIFT + i),
+			MIN(1 << (KMALLOC_MINSHIFT + i), KMEM_CACHELINE), NULL);
+		if (!kmalloc_caches[i])
+			panic("kmem_init: out of memory");
+	}
+}
+
+//
+// Create a cache of 'size'-byte objects aligned to 'align' bytes (a
+// power of two, at least 8; pass KMEM_CACHELINE to keep objects on
+// separate cache lines).  'ctor', if not NULL, initializes each object
+// once, when its slab is created.  Returns NULL if out of memory.
+//
+struct Kmem_cache *
+kmem_cache_create(const char *name, size_t size, size_t align,
+		  void (*ctor)(void *))
+{
+	struct Kmem_cache *kc;
+
+	if (!(kc = kmem_cache_alloc(&kmem_cache_cache)))
+		return NULL;
+	kmem_cache_setup(kc, name, size, align, ctor);
+	return kc;
+}
+
+//
+// Allocate an object from 'kc'.  Returns NULL if out of memory.
+//
+void *
+kmem_cache_alloc(struct Kmem_cache *kc)
+{
+	struct Slab *s;
+	uint16_t i;
+
+	spin_lock(&kc->kc_lock);
+	if (!(s = kc->kc_partial)) {
+		if ((s = kc->kc_empty))
+			kc->kc_empty = NULL;
+		else if (!(s = slab_create(kc))) {
+			spin_unlock(&kc->kc_lock);
+			return NULL;
+		}
+		slab_push(&kc->kc_partial, s);
+	}
+
+	i = s->s_free;
+	s->s_free = s->s_link[i];
+	s->s_inuse++;
+	if (s->s_free == SLAB_END) {
+		slab_unlink(&kc->kc_partial, s);
+		slab_push(&kc->kc_full, s);
+	}
+	kc->kc_inuse++;
+	kc->kc_nalloc++;
+	spin_unlock(&kc->kc_lock);
+	return s->s_mem + i * kc->kc_size;
+}
+
+//
+// Return an object to 'kc'.  If that leaves its slab unused, keep the
+// slab for the next allocation unless the cache already has one spare,
+// in which case give it back to the page allocator.
+//
+void
+kmem_cache_free(struct Kmem_cache *kc, void *obj)
+{
+	struct Slab *s = obj_slab(obj);
+	uint32_t off;
+
+	if (!s || s->s_cache != kc)
+		panic("kmem_cache_free %s: %08x is not from this cache",
+		      kc->kc_name, obj);
+	off = (char *) obj - s->s_mem;
+	if (off % kc->kc_size != 0 || off / kc->kc_size >= kc->kc_perslab)
+		panic("kmem_cache_free %s: bad object %08x", kc->kc_name, obj);
+
+	spin_lock(&kc->kc_lock);
+	if (s->s_free == SLAB_END) {
+		slab_unlink(&kc->kc_full, s);
+		slab_push(&kc->kc_partial, s);
+	}
+	s->s_link[off / kc->kc_size] = s->s_free;
+	s->s_free = off / kc->kc_size;
+	s->s_inuse--;
+	kc->kc_inuse--;
+
+	if (s->s_inuse == 0) {
+		slab_unlink(&kc->kc_partial, s);
+		if (!kc->kc_empty)
+			kc->kc_empty = s;
+		else
+			slab_destroy(kc, s);
+	}
+	spin_unlock(&kc->kc_lock);
+}
+
+//
+// Allocate 'n' bytes of kernel memory.  Requests up to 2048 bytes come
+// from the smallest kmalloc cache that fits; objects of 64 bytes and
+// up are cache-line aligned.  Larger requests get a whole block of
+// pages.  Returns NULL if out of memory or if n is 0.
+//
+void *
+kmalloc(size_t n)
+{
+	struct PageInfo *pp;
+	int i;
+
+	if (n == 0)
+		return NULL;
+	for (i = 0; i < KMALLOC_NCLASS; i++)
+		if (n <= (1 << (KMALLOC_MINSHIFT + i)))
+			return kmem_cache_alloc(kmalloc_caches[i]);
+
+	for (i = 0; i <= MAXORDER; i++)
+		if (n <= (PGSIZE << i))
+			break;
+	if (i > MAXORDER || !(pp = page_alloc_order(i, 0)))
+		return NULL;
+	pp->pp_order = i;
+	return page2kva(pp);
+}
+
+void
+kfree(void *p)
+{
+	struct PageInfo *pp;
+	struct Slab *s;
+
+	if (p == NULL)
+		return;
+	if ((s = obj_slab(p))) {
+		kmem_cache_free(s->s_cache, p);
+		return;
+	}
+	pp = pa2page(PADDR(p));
+	if (page2kva(pp) != p)
+		panic("kfree: bad pointer %08x", p);
+	page_free_order(pp, pp->pp_order);
+}
+
+void
+kmem_print_stats(void)
+{
+	struct Kmem_cache *kc;
+
+	cprintf("cache           objsize  inuse  total  slabs  pages/slab  allocs\n");
+	spin_lock(&kmem_caches_lock);
+	for (kc = kmem_caches; kc; kc = kc->kc_next)
+		cprintf("%-15s %7u %6u %6u %6u %11u %7u\n",
+			kc->kc_name, kc->kc_size, kc->kc_inuse,
+			kc->kc_nslabs * kc->kc_perslab, kc->kc_nslabs,
+			1 << kc->kc_order, kc->kc_nalloc);
+	spin_unlock(&kmem_caches_lock);
+	cprintf("free pages: %u\n", page_nfree());
+}
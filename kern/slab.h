@@ -0,0 +1,54 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_SLAB_H
+#define JOS_KERN_SLAB_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// Alignment for kmem_cache_create: one object per cache line at least,
+// so that objects never share a line.
+#define KMEM_CACHELINE	CACHELINE
+
+// A cache of equal-sized objects, carved out of slabs: blocks of
+// 2^kc_order pages from the page allocator.  An object's constructor,
+// if any, runs once when its slab is created, and kmem_cache_free
+// must return objects in their constructed state.  kc_lock protects
+// the slab lists and the counters; the constructor runs with it held.
+struct Kmem_cache {
+	const char *kc_name;
+	size_t kc_size;			// object size, rounded up to kc_align
+	size_t kc_align;
+	void (*kc_ctor)(void *obj);
+	int kc_order;			// log2 of pages per slab
+	uint32_t kc_perslab;		// objects per slab
+	uint32_t kc_offset;		// byte offset of the first object
+
+	struct spinlock kc_lock;
+	struct Slab *kc_partial;	// slabs with free and used objects
+	struct Slab *kc_full;		// slabs with no free objects
+	struct Slab *kc_empty;		// at most one slab with no used objects
+
+	uint32_t kc_nslabs;		// slabs allocated
+	uint32_t kc_inuse;		// objects handed out
+	uint32_t kc_nalloc;		// kmem_cache_alloc calls so far
+
+	struct Kmem_cache *kc_next;	// on the list of all caches
+};
+
+void kmem_init(void);
+struct Kmem_cache *kmem_cache_create(const char *name, size_t size,
+				     size_t align, void (*ctor)(void *));
+void *kmem_cache_alloc(struct Kmem_cache *kc);
+void kmem_cache_free(struct Kmem_cache *kc, void *obj);
+
+void *kmalloc(size_t n);
+void kfree(void *p);
+
+void kmem_print_stats(void);
+
+#endif /* !JOS_KERN_SLAB_H */
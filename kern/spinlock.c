@@ -0,0 +1,221 @@
+// Mutual exclusion spin locks.
+
+#include <inc/types.h>
+#include <inc/assert.h>
+#include <inc/x86.h>
+#include <inc/string.h>
+#include <inc/stdio.h>
+
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+#ifdef LOCK_STATS
+// Every lock's statistics.  Locks are initialized by the boot CPU
+// before the others start, so the list itself needs no lock.
+static struct LockStats *lock_list;
+
+static void
+stats_init(struct LockStats *ls, const char *name)
+{
+	memset(ls, 0, sizeof(*ls));
+	ls->ls_name = name;
+	ls->ls_next = lock_list;
+	lock_list = ls;
+}
+
+// Called with the lock just acquired, so the counts need no atomics.
+// 't0' is when the CPU started trying to acquire it.
+static void
+stats_acquired(struct LockStats *ls, uint64_t t0, bool waited)
+{
+	uint64_t now = read_tsc();
+
+	ls->ls_acquired++;
+	if (waited) {
+		ls->ls_contended++;
+		ls->ls_spin += now - t0;
+	}
+	ls->ls_start = now;
+}
+
+// Called just before the lock is released.
+static void
+stats_released(struct LockStats *ls)
+{
+	uint64_t hold = read_tsc() - ls->ls_start;
+
+	ls->ls_hold += hold;
+	if (hold > ls->ls_maxhold)
+		ls->ls_maxhold = hold;
+}
+#endif
+
+// Check whether this CPU is holding the lock.
+int
+spin_holding(struct spinlock *lk)
+{
+	return lk->owner != lk->next && lk->cpu == thiscpu;
+}
+
+void
+__spin_initlock(struct spinlock *lk, const char *name)
+{
+	lk->next = 0;
+	lk->owner = 0;
+	lk->name = name;
+	lk->cpu = NULL;
+#ifdef LOCK_STATS
+	stats_init(&lk->stats, name);
+#endif
+}
+
+// Acquire the lock.
+// Loops (spins) until our ticket comes up.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+	uint32_t ticket;
+	bool waited;
+#ifdef LOCK_STATS
+	uint64_t t0 = read_tsc();
+#endif
+
+	if (spin_holding(lk))
+		panic("CPU %d cannot acquire %s: already holding",
+		      cpunum(), lk->name);
+
+	// The lock xaddl hands out tickets atomically, and the loads of
+	// 'owner' cannot pass it, so the critical section cannot start
+	// before our turn.
+	ticket = xadd(&lk->next, 1);
+	waited = lk->owner != ticket;
+	while (lk->owner != ticket)
+		pause();
+
+	lk->cpu = thiscpu;
+#ifdef LOCK_STATS
+	stats_acquired(&lk->stats, t0, waited);
+#else
+	(void) waited;
+#endif
+}
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+	if (!spin_holding(lk))
+		panic("CPU %d cannot release %s: not holding",
+		      cpunum(), lk->name);
+#ifdef LOCK_STATS
+	stats_released(&lk->stats);
+#endif
+	lk->cpu = NULL;
+
+	// Only the holder writes 'owner', and x86 does not reorder
+	// stores, so a plain increment releases the lock once the
+	// compiler has finished the critical section's accesses.
+	asm volatile("" : : : "memory");
+	lk->owner++;
+}
+
+// Check whether this CPU is holding the MCS lock.
+int
+mcs_holding(struct mcslock *lk)
+{
+	return lk->tail != NULL && lk->cpu == thiscpu;
+}
+
+void
+__mcs_initlock(struct mcslock *lk, const char *name)
+{
+	lk->tail = NULL;
+	lk->name = name;
+	lk->cpu = NULL;
+#ifdef LOCK_STATS
+	stats_init(&lk->stats, name);
+#endif
+}
+
+// Acquire the lock, queueing 'me' behind the current tail and spinning
+// on me->locked until our predecessor hands the lock over.
+void
+mcs_lock(struct mcslock *lk, struct mcs_node *me)
+{
+	struct mcs_node *pred;
+	bool waited = false;
+#ifdef LOCK_STATS
+	uint64_t t0 = read_tsc();
+#endif
+
+	if (mcs_holding(lk))
+		panic("CPU %d cannot acquire %s: already holding",
+		      cpunum(), lk->name);
+
+	me->next = NULL;
+	me->locked = 1;
+	pred = (struct mcs_node *) xchg((volatile uint32_t *) &lk->tail,
+					(uint32_t) me);
+	if (pred) {
+		waited = true;
+		pred->next = me;
+		while (me->locked)
+			pause();
+	}
+
+	lk->cpu = thiscpu;
+#ifdef LOCK_STATS
+	stats_acquired(&lk->stats, t0, waited);
+#else
+	(void) waited;
+#endif
+}
+
+// Release the lock, passing it to the next queued node if there is one.
+void
+mcs_unlock(struct mcslock *lk, struct mcs_node *me)
+{
+	if (!mcs_holding(lk))
+		panic("CPU %d cannot release %s: not holding",
+		      cpunum(), lk->name);
+#ifdef LOCK_STATS
+	stats_released(&lk->stats);
+#endif
+	lk->cpu = NULL;
+
+	if (!me->next) {
+		// No one queued behind us that we know of: try to mark the
+		// lock free.  If that fails, a new waiter has swapped itself
+		// in as the tail but not yet linked itself to us.
+		if (cmpxchg((volatile uint32_t *) &lk->tail,
+			    (uint32_t) me, 0) == (uint32_t) me)
+			return;
+		while (!me->next)
+			pause();
+	}
+	asm volatile("" : : : "memory");
+	me->next->locked = 0;
+}
+
+// Print every lock's statistics, for the monitor's 'locks' command.
+// Spin time is averaged over the acquisitions that had to wait.
+void
+lock_print_stats(void)
+{
+#ifdef LOCK_STATS
+	struct LockStats *ls;
+
+	cprintf("%-16s %10s %10s %12s %12s %12s\n", "lock", "acquired",
+		"contended", "spin/wait", "avg hold", "max hold");
+	for (ls = lock_list; ls; ls = ls->ls_next)
+		cprintf("%-16s %10llu %10llu %12llu %12llu %12llu\n",
+			ls->ls_name, ls->ls_acquired, ls->ls_contended,
+			ls->ls_contended ? ls->ls_spin / ls->ls_contended : 0,
+			ls->ls_acquired ? ls->ls_hold / ls->ls_acquired : 0,
+			ls->ls_maxhold);
+#else
+	cprintf("Lock statistics are off; rebuild with 'make LOCKSTATS=1'.\n");
+#endif
+}
@@ -0,0 +1,77 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_SPINLOCK_H
+#define JOS_KERN_SPINLOCK_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <kern/cpu.h>
+
+// Building with 'make LOCKSTATS=1' defines LOCK_STATS, which makes
+// every lock count its acquisitions and the cycles spent waiting for
+// and holding it.  The monitor's 'locks' command prints the counts.
+
+#ifdef LOCK_STATS
+struct LockStats {
+	const char *ls_name;
+	uint64_t ls_acquired;		// Times the lock was taken
+	uint64_t ls_contended;		// ... of which had to wait
+	uint64_t ls_spin;		// Cycles spent waiting
+	uint64_t ls_hold;		// Cycles spent holding
+	uint64_t ls_maxhold;		// Longest single hold
+	uint64_t ls_start;		// When the current hold began
+	struct LockStats *ls_next;	// Every lock, for 'locks'
+};
+#endif
+
+// Ticket lock, for short critical sections: each acquirer takes the
+// next ticket and waits for 'owner' to reach it, so the lock is handed
+// out in FIFO order.  All waiters spin on the same cache line, though,
+// so use an MCS lock where many CPUs contend.
+struct spinlock {
+	volatile uint32_t next;		// Next ticket to hand out
+	volatile uint32_t owner;	// Ticket now being served
+	const char *name;		// Name of lock
+	struct CpuInfo *cpu;		// The CPU holding the lock
+#ifdef LOCK_STATS
+	struct LockStats stats;
+#endif
+};
+
+// MCS queue lock: each waiter spins on its own mcs_node, and the
+// holder hands the lock directly to the next node in the queue.  The
+// caller supplies the node and passes the same one to mcs_unlock;
+// it may live on the caller's stack.
+struct mcs_node {
+	struct mcs_node *volatile next;
+	volatile uint32_t locked;
+} __attribute__((aligned(CACHELINE)));
+
+struct mcslock {
+	struct mcs_node *volatile tail;	// Last waiter, or NULL if free
+	const char *name;		// Name of lock
+	struct CpuInfo *cpu;		// The CPU holding the lock
+#ifdef LOCK_STATS
+	struct LockStats stats;
+#endif
+};
+
+void __spin_initlock(struct spinlock *lk, const char *name);
+void spin_lock(struct spinlock *lk);
+void spin_unlock(struct spinlock *lk);
+int spin_holding(struct spinlock *lk);
+
+#define spin_initlock(lock)   __spin_initlock(lock, #lock)
+
+void __mcs_initlock(struct mcslock *lk, const char *name);
+void mcs_lock(struct mcslock *lk, struct mcs_node *me);
+void mcs_unlock(struct mcslock *lk, struct mcs_node *me);
+int mcs_holding(struct mcslock *lk);
+
+#define mcs_initlock(lock)   __mcs_initlock(lock, #lock)
+
+void lock_print_stats(void);
+
+#endif /* !JOS_KERN_SPINLOCK_H */
@@ -0,0 +1,51 @@
+#include <inc/mmu.h>
+#include <inc/memlayout.h>
+#include <inc/x86.h>
+#include <inc/assert.h>
+
+#include <kern/trap.h>
+#include <kern/console.h>
+
+// Interrupt descriptor table.  (Must be built at run time because
+// shifted function addresses can't be represented in relocation records.)
+static struct Gatedesc idt[256] = { { 0 } };
+static struct Pseudodesc idt_pd = {
+	sizeof(idt) - 1, (uint32_t) idt
+};
+
+
+void
+trap_init(void)
+{
+	extern void irq_serial(void);
+	extern void irq_spurious(void);
+
+	// Interrupt gates, so that handlers run with interrupts off.
+	SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, irq_serial, 0);
+	SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, irq_spurious, 0);
+
+	lidt(&idt_pd);
+}
+
+void
+trap(struct Trapframe *tf)
+{
+	// The 8259A runs in automatic EOI mode, and its interrupts reach
+	// the boot CPU through LINT0 as ExtINT, which needs no local APIC
+	// EOI either.
+	switch (tf->tf_trapno) {
+	case IRQ_OFFSET + IRQ_SERIAL:
+		serial_intr();
+		return;
+
+	case IRQ_OFFSET + IRQ_SPURIOUS:
+		// Handle spurious interrupts
+		// The hardware sometimes raises these because of noise on the
+		// IRQ line or other reasons. We don't care.
+		// The local APIC's spurious vector is this one too.
+		cprintf("Spurious interrupt on irq 7\n");
+		return;
+	}
+
+	panic("unexpected trap %d at eip %08x", tf->tf_trapno, tf->tf_eip);
+}
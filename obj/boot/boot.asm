@@ -0,0 +1,421 @@
+
+obj/boot/boot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+.set CR0_PE_ON,      0x1         # protected mode enable flag
+
+.globl start
+start:
+  .code16                     # Assemble for 16-bit mode
+  cli                         # Disable interrupts
+    7c00:	fa                   	cli
+  cld                         # String operations increment
+    7c01:	fc                   	cld
+
+  # Set up the important data segment registers (DS, ES, SS).
+  xorw    %ax,%ax             # Segment number zero
+    7c02:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c04:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c06:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c08:	8e d0                	mov    %eax,%ss
+  movw    $start,%sp          # Stack grows down from here, as below
+    7c0a:	bc 00 7c 0f 31       	mov    $0x310f7c00,%esp
+
+  # Start the boot timeline.  Stage 2 fills in the rest of this
+  # first struct Bootstamp; see inc/bootinfo.h.
+  rdtsc
+  movl    %eax,BOOTINFO+BI_STAMP
+    7c0f:	66 a3 10 10 66 89    	mov    %ax,0x89661010
+  movl    %edx,BOOTINFO+BI_STAMP+4
+    7c15:	16                   	push   %ss
+    7c16:	14 10                	adc    $0x10,%al
+  # to load stage 2 and, if the kernel is a compressed image, the whole
+  # image into the BOUNCE buffer, many sectors per call.  This works
+  # for any boot device the BIOS can read.  edd_nsect tells bootmain()
+  # how far we got: -1 if stage 2 still needs loading, otherwise the
+  # number of image sectors already in BOUNCE.
+  movb    %dl,dap_drive       # BIOS passes the boot drive in DL
+    7c18:	88 16                	mov    %dl,(%esi)
+    7c1a:	28 7d fb             	sub    %bh,-0x5(%ebp)
+  sti                         # The BIOS may need interrupts here
+  movb    $0x41,%ah           # Are the extensions installed?
+    7c1d:	b4 41                	mov    $0x41,%ah
+  movw    $0x55AA,%bx
+    7c1f:	bb aa 55 cd 13       	mov    $0x13cd55aa,%ebx
+  int     $0x13
+  jc      edd_done
+    7c24:	72 7e                	jb     7ca4 <edd_done>
+  cmpw    $0xAA55,%bx
+    7c26:	81 fb 55 aa 75 78    	cmp    $0x7875aa55,%ebx
+  jne     edd_done
+  testb   $1,%cl              # Is AH=42h (extended read) supported?
+    7c2c:	f6 c1 01             	test   $0x1,%cl
+  jz      edd_done
+    7c2f:	74 73                	je     7ca4 <edd_done>
+
+  call    edd_read            # Stage 2, as dap is initialized
+    7c31:	e8 d6 00 72 6e       	call   6e727d0c <__bss_start+0x6e71fe80>
+  jc      edd_done
+  incl    edd_nsect           # -1 -> 0: stage 2 is in place
+    7c36:	66 ff 06             	incw   (%esi)
+    7c39:	06                   	push   %es
+    7c3a:	7d c7                	jge    7c03 <start+0x3>
+
+  movw    $1,dap_count        # First sector of the kernel image
+    7c3c:	06                   	push   %es
+    7c3d:	1a 7d 01             	sbb    0x1(%ebp),%bh
+    7c40:	00 c7                	add    %al,%bh
+  movw    $(BOUNCE >> 4),dap_seg
+    7c42:	06                   	push   %es
+    7c43:	1e                   	push   %ds
+    7c44:	7d 00                	jge    7c46 <start+0x46>
+    7c46:	40                   	inc    %eax
+  movw    $KERNSECT,dap_lba
+    7c47:	c7 06 20 7d 21 00    	movl   $0x217d20,(%esi)
+  call    edd_read
+    7c4d:	e8 ba 00 72 52       	call   52727d0c <__bss_start+0x5271fe80>
+  jc      edd_done
+  movw    $(BOUNCE >> 4),%ax
+    7c52:	b8 00 40 8e c0       	mov    $0xc08e4000,%eax
+  movw    %ax,%es
+  cmpl    $ZIMAGE_MAGIC,%es:0 # Only a compressed image says its size
+    7c57:	26 66 81 3e 00 00    	cmpw   $0x0,%es:(%esi)
+    7c5d:	4a                   	dec    %edx
+    7c5e:	4f                   	dec    %edi
+    7c5f:	5a                   	pop    %edx
+    7c60:	34 75                	xor    $0x75,%al
+  jne     edd_done
+    7c62:	41                   	inc    %ecx
+  movl    %es:Z_SIZE,%edi     # DI = image size in sectors
+    7c63:	26 66 8b 3e          	mov    %es:(%esi),%di
+    7c67:	0c 00                	or     $0x0,%al
+  addl    $(SECTSIZE - 1),%edi
+    7c69:	66 81 c7 ff 01       	add    $0x1ff,%di
+    7c6e:	00 00                	add    %al,(%eax)
+  shrl    $9,%edi
+    7c70:	66 c1 ef 09          	shr    $0x9,%di
+  cmpl    $BOUNCE_NSECT,%edi
+    7c74:	66 81 ff 00 02       	cmp    $0x200,%di
+    7c79:	00 00                	add    %al,(%eax)
+  ja      edd_done
+    7c7b:	77 27                	ja     7ca4 <edd_done>
+
+00007c7d <edd_next>:
+
+edd_next:
+  movw    dap_count,%ax       # Account for the sectors just read
+    7c7d:	a1 1a 7d 01 06       	mov    0x6017d1a,%eax
+  addw    %ax,edd_nsect
+    7c82:	06                   	push   %es
+    7c83:	7d 01                	jge    7c86 <edd_next+0x9>
+  addw    %ax,dap_lba
+    7c85:	06                   	push   %es
+    7c86:	20 7d 29             	and    %bh,0x29(%ebp)
+  subw    %ax,%di
+    7c89:	c7                   	(bad)
+  jz      edd_done
+    7c8a:	74 18                	je     7ca4 <edd_done>
+  shlw    $5,%ax              # Sectors -> 16-byte paragraphs
+    7c8c:	c1 e0 05             	shl    $0x5,%eax
+  addw    %ax,dap_seg
+    7c8f:	01 06                	add    %eax,(%esi)
+    7c91:	1e                   	push   %ds
+    7c92:	7d b8                	jge    7c4c <start+0x4c>
+  movw    $127,%ax            # Many BIOSes read at most 127 per call
+    7c94:	7f 00                	jg     7c96 <edd_next+0x19>
+  cmpw    %ax,%di
+    7c96:	39 c7                	cmp    %eax,%edi
+  ja      1f
+    7c98:	77 02                	ja     7c9c <edd_next+0x1f>
+  movw    %di,%ax
+    7c9a:	89 f8                	mov    %edi,%eax
+1:
+  movw    %ax,dap_count
+    7c9c:	a3 1a 7d e8 68       	mov    %eax,0x68e87d1a
+  call    edd_read
+    7ca1:	00 73 d9             	add    %dh,-0x27(%ebx)
+
+00007ca4 <edd_done>:
+  jnc     edd_next
+
+edd_done:
+  cli
+    7ca4:	fa                   	cli
+
+  # Switch from real to protected mode, using a bootstrap GDT
+  # and segment translation that makes virtual addresses 
+  # identical to their physical addresses, so that the 
+  # effective memory map does not change during the switch.
+  lgdt    gdtdesc
+    7ca5:	0f 01 16             	lgdtl  (%esi)
+    7ca8:	00 7d 0f             	add    %bh,0xf(%ebp)
+  movl    %cr0, %eax
+    7cab:	20 c0                	and    %al,%al
+  orl     $CR0_PE_ON, %eax
+    7cad:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7cb1:	0f 22 c0             	mov    %eax,%cr0
+  
+  # Jump to next instruction, but in 32-bit code segment.
+  # Switches processor into 32-bit mode.
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    7cb4:	ea                   	.byte 0xea
+    7cb5:	b9                   	.byte 0xb9
+    7cb6:	7c 08                	jl     7cc0 <protcseg+0x7>
+	...
+
+00007cb9 <protcseg>:
+
+  .code32                     # Assemble for 32-bit mode
+protcseg:
+  # Set up the protected-mode data segment registers
+  movw    $PROT_MODE_DSEG, %ax    # Our data segment selector
+    7cb9:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7cbd:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7cbf:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    7cc1:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7cc3:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7cc5:	8e d0                	mov    %eax,%ss
+  
+  # Stamp the second timeline entry (see above).
+  rdtsc
+    7cc7:	0f 31                	rdtsc
+  movl    %eax, BOOTINFO+BI_STAMP+16
+    7cc9:	a3 20 10 00 00       	mov    %eax,0x1020
+  movl    %edx, BOOTINFO+BI_STAMP+20
+    7cce:	89 15 24 10 00 00    	mov    %edx,0x1024
+
+  # Set up the stack pointer and call into C.
+  movl    $start, %esp
+    7cd4:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  pushl   edd_nsect
+    7cd9:	ff 35 06 7d 00 00    	push   0x7d06
+  call bootmain
+    7cdf:	e8 45 00 00 00       	call   7d29 <bootmain>
+
+00007ce4 <spin>:
+
+  # If bootmain returns (it shouldn't), loop.
+spin:
+  jmp spin
+    7ce4:	eb fe                	jmp    7ce4 <spin>
+    7ce6:	66 90                	xchg   %ax,%ax
+
+00007ce8 <gdt>:
+	...
+    7cf0:	ff                   	(bad)
+    7cf1:	ff 00                	incl   (%eax)
+    7cf3:	00 00                	add    %al,(%eax)
+    7cf5:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7cfc:	00                   	.byte 0x0
+    7cfd:	92                   	xchg   %eax,%edx
+    7cfe:	cf                   	iret
+	...
+
+00007d00 <gdtdesc>:
+    7d00:	17                   	pop    %ss
+    7d01:	00 e8                	add    %ch,%al
+    7d03:	7c 00                	jl     7d05 <gdtdesc+0x5>
+	...
+
+00007d06 <edd_nsect>:
+    7d06:	ff                   	(bad)
+    7d07:	ff                   	(bad)
+    7d08:	ff                   	(bad)
+    7d09:	ff                   	.byte 0xff
+
+00007d0a <edd_read>:
+
+#if BOOT_EDD
+  .code16
+# Issue the extended read described by dap; sets CF on failure.
+edd_read:
+  movb    $0x42,%ah
+    7d0a:	b4 42                	mov    $0x42,%ah
+  movb    dap_drive,%dl
+    7d0c:	8a 16                	mov    (%esi),%dl
+    7d0e:	28 7d be             	sub    %bh,-0x42(%ebp)
+  movw    $dap,%si
+    7d11:	18 7d cd             	sbb    %bh,-0x33(%ebp)
+  int     $0x13
+    7d14:	13 c3                	adc    %ebx,%eax
+  ret
+    7d16:	66 90                	xchg   %ax,%ax
+
+00007d18 <dap>:
+    7d18:	10 00                	adc    %al,(%eax)
+
+00007d1a <dap_count>:
+    7d1a:	20 00                	and    %al,(%eax)
+	...
+
+00007d1e <dap_seg>:
+    7d1e:	e0 07                	loopne 7d27 <dap_lba+0x7>
+
+00007d20 <dap_lba>:
+    7d20:	01 00                	add    %eax,(%eax)
+    7d22:	00 00                	add    %al,(%eax)
+    7d24:	00 00                	add    %al,(%eax)
+	...
+
+00007d28 <dap_drive>:
+	...
+
+00007d29 <bootmain>:
+
+// 'nbounce' is the number of kernel image sectors boot.S has put in
+// BOUNCE, or -1 if it could not load stage 2 either.
+void
+bootmain(int32_t nbounce)
+{
+    7d29:	55                   	push   %ebp
+    7d2a:	89 e5                	mov    %esp,%ebp
+    7d2c:	53                   	push   %ebx
+    7d2d:	e8 30 00 00 00       	call   7d62 <__x86.get_pc_thunk.bx>
+    7d32:	81 c3 4e 01 00 00    	add    $0x14e,%ebx
+    7d38:	52                   	push   %edx
+    7d39:	8b 45 08             	mov    0x8(%ebp),%eax
+	// stage 2 is small enough to fetch with one disk command
+	if (nbounce < 0) {
+    7d3c:	85 c0                	test   %eax,%eax
+    7d3e:	79 14                	jns    7d54 <bootmain+0x2b>
+		readsects((void *) BOOT2, 1, BOOT2_NSECT);
+    7d40:	50                   	push   %eax
+    7d41:	6a 20                	push   $0x20
+    7d43:	6a 01                	push   $0x1
+    7d45:	68 00 7e 00 00       	push   $0x7e00
+    7d4a:	e8 25 00 00 00       	call   7d74 <readsects>
+    7d4f:	83 c4 10             	add    $0x10,%esp
+		nbounce = 0;
+    7d52:	31 c0                	xor    %eax,%eax
+	}
+
+	// note: does not return!
+	((void (*)(int32_t)) BOOT2)(nbounce);
+    7d54:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    7d57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+	((void (*)(int32_t)) BOOT2)(nbounce);
+    7d5a:	b8 00 7e 00 00       	mov    $0x7e00,%eax
+}
+    7d5f:	c9                   	leave
+	((void (*)(int32_t)) BOOT2)(nbounce);
+    7d60:	ff e0                	jmp    *%eax
+
+00007d62 <__x86.get_pc_thunk.bx>:
+    7d62:	8b 1c 24             	mov    (%esp),%ebx
+    7d65:	c3                   	ret
+
+00007d66 <waitdisk>:
+
+static inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7d66:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d6b:	ec                   	in     (%dx),%al
+
+void
+waitdisk(void)
+{
+	// wait for disk reaady
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7d6c:	83 e0 c0             	and    $0xffffffc0,%eax
+    7d6f:	3c 40                	cmp    $0x40,%al
+    7d71:	75 f8                	jne    7d6b <waitdisk+0x5>
+		/* do nothing */;
+}
+    7d73:	c3                   	ret
+
+00007d74 <readsects>:
+
+// Read 'nsect' (1..MAXSECTS) consecutive sectors starting at sector
+// 'offset' into 'dst' with a single READ SECTORS command.
+void
+readsects(void *dst, uint32_t offset, uint32_t nsect)
+{
+    7d74:	55                   	push   %ebp
+    7d75:	89 e5                	mov    %esp,%ebp
+    7d77:	57                   	push   %edi
+    7d78:	56                   	push   %esi
+    7d79:	53                   	push   %ebx
+    7d7a:	83 ec 0c             	sub    $0xc,%esp
+    7d7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    7d80:	8b 75 08             	mov    0x8(%ebp),%esi
+    7d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	// wait for disk to be ready
+	waitdisk();
+    7d86:	e8 db ff ff ff       	call   7d66 <waitdisk>
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7d8b:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7d90:	89 d8                	mov    %ebx,%eax
+    7d92:	ee                   	out    %al,(%dx)
+    7d93:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7d98:	89 c8                	mov    %ecx,%eax
+    7d9a:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsect);	// sector count
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+    7d9b:	89 c8                	mov    %ecx,%eax
+    7d9d:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7da2:	c1 e8 08             	shr    $0x8,%eax
+    7da5:	ee                   	out    %al,(%dx)
+	outb(0x1F5, offset >> 16);
+    7da6:	89 c8                	mov    %ecx,%eax
+    7da8:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7dad:	c1 e8 10             	shr    $0x10,%eax
+    7db0:	ee                   	out    %al,(%dx)
+	outb(0x1F6, (offset >> 24) | 0xE0);
+    7db1:	89 c8                	mov    %ecx,%eax
+    7db3:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7db8:	c1 e8 18             	shr    $0x18,%eax
+    7dbb:	83 c8 e0             	or     $0xffffffe0,%eax
+    7dbe:	ee                   	out    %al,(%dx)
+    7dbf:	b0 20                	mov    $0x20,%al
+    7dc1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7dc6:	ee                   	out    %al,(%dx)
+	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+	// the drive raises DRQ once per sector, so wait before each one
+	for (; nsect > 0; nsect--, dst += SECTSIZE) {
+    7dc7:	85 db                	test   %ebx,%ebx
+    7dc9:	74 1d                	je     7de8 <readsects+0x74>
+		waitdisk();
+    7dcb:	e8 96 ff ff ff       	call   7d66 <waitdisk>
+	asm volatile("cld\n\trepne\n\tinsl"
+    7dd0:	89 f7                	mov    %esi,%edi
+    7dd2:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7dd7:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7ddc:	fc                   	cld
+    7ddd:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsect > 0; nsect--, dst += SECTSIZE) {
+    7ddf:	4b                   	dec    %ebx
+    7de0:	81 c6 00 02 00 00    	add    $0x200,%esi
+    7de6:	eb df                	jmp    7dc7 <readsects+0x53>
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+}
+    7de8:	83 c4 0c             	add    $0xc,%esp
+    7deb:	5b                   	pop    %ebx
+    7dec:	5e                   	pop    %esi
+    7ded:	5f                   	pop    %edi
+    7dee:	5d                   	pop    %ebp
+    7def:	c3                   	ret
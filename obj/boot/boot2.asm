@@ -0,0 +1,1932 @@
+
+obj/boot/boot2.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007e00 <boot2main>:
+static bool usedma;		// read the disk with DMA rather than PIO
+static uint32_t bounce_nsect;	// leading image sectors already in BOUNCE
+
+void
+boot2main(int32_t nbounce)
+{
+    7e00:	55                   	push   %ebp
+	struct Bootinfo *bi = (struct Bootinfo *) BOOTINFO;
+	uint32_t entry;
+
+	// boot.S stamped the first two timeline entries
+	bi->bi_stamp[0].bs_stage = BT_START;
+	bi->bi_stamp[0].bs_arg = 0;
+    7e01:	31 c0                	xor    %eax,%eax
+	bi->bi_stamp[1].bs_stage = BT_PROTMODE;
+	bi->bi_stamp[1].bs_arg = nbounce;
+	bi->bi_nstamp = 2;
+	bootinfo_stamp(bi, BT_BOOT2, 0);
+    7e03:	31 d2                	xor    %edx,%edx
+{
+    7e05:	89 e5                	mov    %esp,%ebp
+    7e07:	56                   	push   %esi
+    7e08:	53                   	push   %ebx
+    7e09:	8b 75 08             	mov    0x8(%ebp),%esi
+    7e0c:	e8 8e 04 00 00       	call   829f <__x86.get_pc_thunk.bx>
+    7e11:	81 c3 43 0f 00 00    	add    $0xf43,%ebx
+	bi->bi_stamp[0].bs_arg = 0;
+    7e17:	a3 18 10 00 00       	mov    %eax,0x1018
+    7e1c:	a3 1c 10 00 00       	mov    %eax,0x101c
+	bootinfo_stamp(bi, BT_BOOT2, 0);
+    7e21:	b8 02 00 00 00       	mov    $0x2,%eax
+	bi->bi_stamp[1].bs_stage = BT_PROTMODE;
+    7e26:	c7 05 28 10 00 00 01 	movl   $0x1,0x1028
+    7e2d:	00 00 00 
+	bi->bi_stamp[1].bs_arg = nbounce;
+    7e30:	89 35 2c 10 00 00    	mov    %esi,0x102c
+	bi->bi_nstamp = 2;
+    7e36:	c7 05 08 10 00 00 02 	movl   $0x2,0x1008
+    7e3d:	00 00 00 
+	bootinfo_stamp(bi, BT_BOOT2, 0);
+    7e40:	e8 18 04 00 00       	call   825d <bootinfo_stamp.constprop.0>
+
+	e820_detect();
+    7e45:	e8 ce 06 00 00       	call   8518 <e820_detect>
+	bootinfo_stamp(bi, BT_E820, bi->bi_ne820);
+    7e4a:	8b 15 0c 10 00 00    	mov    0x100c,%edx
+    7e50:	b8 08 00 00 00       	mov    $0x8,%eax
+    7e55:	e8 03 04 00 00       	call   825d <bootinfo_stamp.constprop.0>
+
+	enable_a20();
+    7e5a:	e8 81 00 00 00       	call   7ee0 <enable_a20>
+
+	bounce_nsect = nbounce;
+    7e5f:	89 b3 10 00 00 00    	mov    %esi,0x10(%ebx)
+	usedma = (dma_init() == 0);
+    7e65:	e8 c7 04 00 00       	call   8331 <dma_init>
+
+	// read 1st page off disk
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7e6a:	52                   	push   %edx
+	usedma = (dma_init() == 0);
+    7e6b:	85 c0                	test   %eax,%eax
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7e6d:	6a 00                	push   $0x0
+    7e6f:	68 00 10 00 00       	push   $0x1000
+    7e74:	68 00 00 01 00       	push   $0x10000
+	usedma = (dma_init() == 0);
+    7e79:	0f 94 83 0c 00 00 00 	sete   0xc(%ebx)
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7e80:	e8 f3 02 00 00       	call   8178 <readseg>
+
+	// is this a valid ELF or compressed image?
+	if (ELFHDR->e_magic == ELF_MAGIC)
+    7e85:	a1 00 00 01 00       	mov    0x10000,%eax
+    7e8a:	83 c4 10             	add    $0x10,%esp
+    7e8d:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+    7e92:	75 07                	jne    7e9b <boot2main+0x9b>
+		entry = load_elf();
+    7e94:	e8 7f 00 00 00       	call   7f18 <load_elf>
+    7e99:	eb 0c                	jmp    7ea7 <boot2main+0xa7>
+	else if (ZHDR->z_magic == ZIMAGE_MAGIC)
+    7e9b:	3d 4a 4f 5a 34       	cmp    $0x345a4f4a,%eax
+    7ea0:	75 29                	jne    7ecb <boot2main+0xcb>
+		entry = load_zimage();
+    7ea2:	e8 f6 01 00 00       	call   809d <load_zimage>
+    7ea7:	89 c3                	mov    %eax,%ebx
+	else
+		goto bad;
+
+	bootinfo_stamp(bi, BT_LOADED, 0);
+    7ea9:	31 d2                	xor    %edx,%edx
+    7eab:	b8 04 00 00 00       	mov    $0x4,%eax
+    7eb0:	e8 a8 03 00 00       	call   825d <bootinfo_stamp.constprop.0>
+
+	// tell the kernel it need not clear its own .bss
+	bi->bi_magic = BOOTINFO_MAGIC;
+    7eb5:	c7 05 00 10 00 00 4a 	movl   $0x42534f4a,0x1000
+    7ebc:	4f 53 42 
+	bi->bi_flags = BI_BSS_ZEROED;
+    7ebf:	c7 05 04 10 00 00 01 	movl   $0x1,0x1004
+    7ec6:	00 00 00 
+
+	// call the entry point from the image header
+	// note: does not return!
+	((void (*)(void)) entry)();
+    7ec9:	ff d3                	call   *%ebx
+}
+
+static inline void
+outw(int port, uint16_t data)
+{
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+    7ecb:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+    7ed0:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+    7ed5:	66 ef                	out    %ax,(%dx)
+    7ed7:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+    7edc:	66 ef                	out    %ax,(%dx)
+    7ede:	eb fe                	jmp    7ede <boot2main+0xde>
+
+00007ee0 <enable_a20>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7ee0:	ba 64 00 00 00       	mov    $0x64,%edx
+    7ee5:	ec                   	in     (%dx),%al
+//   address line 20 is tied low, so that addresses higher than
+//   1MB wrap around to zero by default.  This code undoes this.
+static void
+enable_a20(void)
+{
+	while (inb(0x64) & 0x2)		// wait for not busy
+    7ee6:	a8 02                	test   $0x2,%al
+    7ee8:	75 fb                	jne    7ee5 <enable_a20+0x5>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7eea:	b0 d1                	mov    $0xd1,%al
+    7eec:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7eed:	ba 64 00 00 00       	mov    $0x64,%edx
+    7ef2:	ec                   	in     (%dx),%al
+		/* do nothing */;
+	outb(0x64, 0xd1);
+	while (inb(0x64) & 0x2)
+    7ef3:	a8 02                	test   $0x2,%al
+    7ef5:	75 fb                	jne    7ef2 <enable_a20+0x12>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7ef7:	b0 df                	mov    $0xdf,%al
+    7ef9:	ba 60 00 00 00       	mov    $0x60,%edx
+    7efe:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+	outb(0x60, 0xdf);
+}
+    7eff:	c3                   	ret
+
+00007f00 <zeroseg>:
+// Zero 'count' bytes at physical address 'pa', 4 at a time.  This may
+// clear up to 3 bytes too many, which is harmless since readseg()
+// already overshoots by up to a sector.
+static void
+zeroseg(uint32_t pa, uint32_t count)
+{
+    7f00:	55                   	push   %ebp
+    7f01:	89 e5                	mov    %esp,%ebp
+    7f03:	57                   	push   %edi
+	stosl((void *) pa, 0, (count + 3) / 4);
+    7f04:	8b 45 0c             	mov    0xc(%ebp),%eax
+	asm volatile("cld\n\trep\n\tstosl"
+    7f07:	8b 7d 08             	mov    0x8(%ebp),%edi
+    7f0a:	8d 48 03             	lea    0x3(%eax),%ecx
+    7f0d:	31 c0                	xor    %eax,%eax
+    7f0f:	c1 e9 02             	shr    $0x2,%ecx
+    7f12:	fc                   	cld
+    7f13:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+    7f15:	5f                   	pop    %edi
+    7f16:	5d                   	pop    %ebp
+    7f17:	c3                   	ret
+
+00007f18 <load_elf>:
+
+static uint32_t
+load_elf(void)
+{
+    7f18:	55                   	push   %ebp
+    7f19:	89 e5                	mov    %esp,%ebp
+    7f1b:	56                   	push   %esi
+    7f1c:	53                   	push   %ebx
+	struct Proghdr *ph, *eph;
+
+	// load each program segment (ignores ph flags)
+	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7f1d:	a1 1c 00 01 00       	mov    0x1001c,%eax
+	eph = ph + ELFHDR->e_phnum;
+    7f22:	0f b7 35 2c 00 01 00 	movzwl 0x1002c,%esi
+	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7f29:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+	eph = ph + ELFHDR->e_phnum;
+    7f2f:	c1 e6 05             	shl    $0x5,%esi
+    7f32:	01 de                	add    %ebx,%esi
+	for (; ph < eph; ph++) {
+    7f34:	39 f3                	cmp    %esi,%ebx
+    7f36:	73 2b                	jae    7f63 <load_elf+0x4b>
+		// p_pa is the load address of this segment (as well
+		// as the physical address).  Only the first p_filesz
+		// bytes are on disk; the rest is zero, so clear it
+		// in memory rather than reading it.
+		readseg(ph->p_pa, ph->p_filesz, ph->p_offset);
+    7f38:	50                   	push   %eax
+	for (; ph < eph; ph++) {
+    7f39:	83 c3 20             	add    $0x20,%ebx
+		readseg(ph->p_pa, ph->p_filesz, ph->p_offset);
+    7f3c:	ff 73 e4             	push   -0x1c(%ebx)
+    7f3f:	ff 73 f0             	push   -0x10(%ebx)
+    7f42:	ff 73 ec             	push   -0x14(%ebx)
+    7f45:	e8 2e 02 00 00       	call   8178 <readseg>
+		zeroseg(ph->p_pa + ph->p_filesz, ph->p_memsz - ph->p_filesz);
+    7f4a:	5a                   	pop    %edx
+    7f4b:	8b 43 f0             	mov    -0x10(%ebx),%eax
+    7f4e:	8b 53 f4             	mov    -0xc(%ebx),%edx
+    7f51:	59                   	pop    %ecx
+    7f52:	29 c2                	sub    %eax,%edx
+    7f54:	52                   	push   %edx
+    7f55:	03 43 ec             	add    -0x14(%ebx),%eax
+    7f58:	50                   	push   %eax
+    7f59:	e8 a2 ff ff ff       	call   7f00 <zeroseg>
+	for (; ph < eph; ph++) {
+    7f5e:	83 c4 10             	add    $0x10,%esp
+    7f61:	eb d1                	jmp    7f34 <load_elf+0x1c>
+	}
+	return ELFHDR->e_entry;
+}
+    7f63:	a1 18 00 01 00       	mov    0x10018,%eax
+    7f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    7f6b:	5b                   	pop    %ebx
+    7f6c:	5e                   	pop    %esi
+    7f6d:	5d                   	pop    %ebp
+    7f6e:	c3                   	ret
+
+00007f6f <lz4_block>:
+// Decode the LZ4 block of 'zlen' bytes at 'src' to 'dst', and return
+// the end of the output.  Matches may reach back before 'dst' into
+// blocks decoded earlier.
+static uint8_t *
+lz4_block(uint8_t *dst, const uint8_t *src, uint32_t zlen)
+{
+    7f6f:	e8 27 03 00 00       	call   829b <__x86.get_pc_thunk.ax>
+    7f74:	05 e0 0d 00 00       	add    $0xde0,%eax
+    7f79:	55                   	push   %ebp
+    7f7a:	89 e5                	mov    %esp,%ebp
+    7f7c:	57                   	push   %edi
+    7f7d:	56                   	push   %esi
+    7f7e:	53                   	push   %ebx
+    7f7f:	83 ec 1c             	sub    $0x1c,%esp
+	const uint8_t *end = src + zlen;
+    7f82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	uint8_t *m;
+	uint32_t len, tok;
+
+	while (src < end) {
+    7f85:	8b 7d 08             	mov    0x8(%ebp),%edi
+    7f88:	89 45 dc             	mov    %eax,-0x24(%ebp)
+{
+    7f8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	const uint8_t *end = src + zlen;
+    7f8e:	01 c3                	add    %eax,%ebx
+    7f90:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+	while (src < end) {
+    7f93:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    7f96:	39 d8                	cmp    %ebx,%eax
+    7f98:	73 75                	jae    800f <lz4_block+0xa0>
+		tok = *src++;
+    7f9a:	0f b6 10             	movzbl (%eax),%edx
+    7f9d:	8d 70 01             	lea    0x1(%eax),%esi
+    7fa0:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+
+		// literals
+		len = tok >> 4;
+    7fa3:	c1 ea 04             	shr    $0x4,%edx
+		if (len == 15)
+    7fa6:	83 fa 0f             	cmp    $0xf,%edx
+    7fa9:	75 0c                	jne    7fb7 <lz4_block+0x48>
+			do len += *src; while (*src++ == 255);
+    7fab:	0f b6 0e             	movzbl (%esi),%ecx
+    7fae:	46                   	inc    %esi
+    7faf:	89 c8                	mov    %ecx,%eax
+    7fb1:	01 ca                	add    %ecx,%edx
+    7fb3:	fe c0                	inc    %al
+    7fb5:	eb f2                	jmp    7fa9 <lz4_block+0x3a>
+		memcpy(dst, src, len);
+    7fb7:	50                   	push   %eax
+    7fb8:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    7fbb:	52                   	push   %edx
+    7fbc:	89 55 d8             	mov    %edx,-0x28(%ebp)
+    7fbf:	56                   	push   %esi
+    7fc0:	57                   	push   %edi
+    7fc1:	e8 f3 07 00 00       	call   87b9 <memcpy>
+		dst += len;
+    7fc6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+		src += len;
+		if (src >= end)
+    7fc9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    7fcc:	83 c4 10             	add    $0x10,%esp
+		src += len;
+    7fcf:	8d 04 16             	lea    (%esi,%edx,1),%eax
+		dst += len;
+    7fd2:	01 d7                	add    %edx,%edi
+		if (src >= end)
+    7fd4:	39 d8                	cmp    %ebx,%eax
+    7fd6:	73 37                	jae    800f <lz4_block+0xa0>
+			break;	// the last sequence has no match
+
+		// match: copy forwards, since it may overlap its output
+		m = dst - (src[0] | src[1] << 8);
+    7fd8:	0f b7 10             	movzwl (%eax),%edx
+    7fdb:	8a 4d e4             	mov    -0x1c(%ebp),%cl
+    7fde:	89 fe                	mov    %edi,%esi
+		src += 2;
+    7fe0:	83 c0 02             	add    $0x2,%eax
+		m = dst - (src[0] | src[1] << 8);
+    7fe3:	29 d6                	sub    %edx,%esi
+		len = tok & 15;
+    7fe5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    7fe8:	83 e1 0f             	and    $0xf,%ecx
+    7feb:	83 e2 0f             	and    $0xf,%edx
+		if (len == 15)
+    7fee:	80 f9 0f             	cmp    $0xf,%cl
+    7ff1:	75 11                	jne    8004 <lz4_block+0x95>
+    7ff3:	ba 0f 00 00 00       	mov    $0xf,%edx
+			do len += *src; while (*src++ == 255);
+    7ff8:	0f b6 18             	movzbl (%eax),%ebx
+    7ffb:	40                   	inc    %eax
+    7ffc:	89 d9                	mov    %ebx,%ecx
+    7ffe:	01 da                	add    %ebx,%edx
+    8000:	fe c1                	inc    %cl
+    8002:	74 f4                	je     7ff8 <lz4_block+0x89>
+    8004:	8d 54 17 04          	lea    0x4(%edi,%edx,1),%edx
+		for (len += 4; len > 0; len--)
+    8008:	39 d7                	cmp    %edx,%edi
+    800a:	74 87                	je     7f93 <lz4_block+0x24>
+			*dst++ = *m++;
+    800c:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    800d:	eb f9                	jmp    8008 <lz4_block+0x99>
+	}
+	return dst;
+}
+    800f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    8012:	89 f8                	mov    %edi,%eax
+    8014:	5b                   	pop    %ebx
+    8015:	5e                   	pop    %esi
+    8016:	5f                   	pop    %edi
+    8017:	5d                   	pop    %ebp
+    8018:	c3                   	ret
+
+00008019 <zfetch>:
+// Return a pointer to image bytes [off, off+len), sliding the ZBUF
+// window forward over the disk if they are not already buffered.
+// Never reads past image offset 'lim'.
+static uint8_t *
+zfetch(uint32_t off, uint32_t len, uint32_t lim)
+{
+    8019:	55                   	push   %ebp
+    801a:	89 e5                	mov    %esp,%ebp
+    801c:	56                   	push   %esi
+    801d:	e8 81 02 00 00       	call   82a3 <__x86.get_pc_thunk.si>
+    8022:	81 c6 32 0d 00 00    	add    $0xd32,%esi
+    8028:	53                   	push   %ebx
+    8029:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// if boot.S prefetched these bytes, use them where they are
+	if (off + len <= bounce_nsect * SECTSIZE)
+    802c:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    802f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	if (off + len <= bounce_nsect * SECTSIZE)
+    8032:	01 da                	add    %ebx,%edx
+    8034:	8b 86 10 00 00 00    	mov    0x10(%esi),%eax
+    803a:	c1 e0 09             	shl    $0x9,%eax
+    803d:	39 d0                	cmp    %edx,%eax
+    803f:	72 08                	jb     8049 <zfetch+0x30>
+		return (uint8_t *) BOUNCE + off;
+    8041:	8d 83 00 00 04 00    	lea    0x40000(%ebx),%eax
+    8047:	eb 4d                	jmp    8096 <zfetch+0x7d>
+
+	if (off < zbuf_off || off + len > zbuf_end) {
+    8049:	3b 9e 14 00 00 00    	cmp    0x14(%esi),%ebx
+    804f:	72 08                	jb     8059 <zfetch+0x40>
+    8051:	39 96 18 00 00 00    	cmp    %edx,0x18(%esi)
+    8057:	73 31                	jae    808a <zfetch+0x71>
+		zbuf_off = off & ~(SECTSIZE - 1);
+    8059:	89 da                	mov    %ebx,%edx
+    805b:	81 e2 00 fe ff ff    	and    $0xfffffe00,%edx
+		zbuf_end = MIN(zbuf_off + ZBUFSIZE, lim);
+    8061:	8d 82 00 00 02 00    	lea    0x20000(%edx),%eax
+		zbuf_off = off & ~(SECTSIZE - 1);
+    8067:	89 96 14 00 00 00    	mov    %edx,0x14(%esi)
+		zbuf_end = MIN(zbuf_off + ZBUFSIZE, lim);
+    806d:	39 c8                	cmp    %ecx,%eax
+    806f:	0f 47 c1             	cmova  %ecx,%eax
+    8072:	89 86 18 00 00 00    	mov    %eax,0x18(%esi)
+		readseg(ZBUF, zbuf_end - zbuf_off, zbuf_off);
+    8078:	29 d0                	sub    %edx,%eax
+    807a:	51                   	push   %ecx
+    807b:	52                   	push   %edx
+    807c:	50                   	push   %eax
+    807d:	68 00 00 02 00       	push   $0x20000
+    8082:	e8 f1 00 00 00       	call   8178 <readseg>
+    8087:	83 c4 10             	add    $0x10,%esp
+	}
+	return (uint8_t *) ZBUF + (off - zbuf_off);
+    808a:	2b 9e 14 00 00 00    	sub    0x14(%esi),%ebx
+    8090:	8d 83 00 00 02 00    	lea    0x20000(%ebx),%eax
+}
+    8096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    8099:	5b                   	pop    %ebx
+    809a:	5e                   	pop    %esi
+    809b:	5d                   	pop    %ebp
+    809c:	c3                   	ret
+
+0000809d <load_zimage>:
+
+static uint32_t
+load_zimage(void)
+{
+    809d:	e8 f9 01 00 00       	call   829b <__x86.get_pc_thunk.ax>
+    80a2:	05 b2 0c 00 00       	add    $0xcb2,%eax
+    80a7:	55                   	push   %ebp
+    80a8:	89 e5                	mov    %esp,%ebp
+    80aa:	57                   	push   %edi
+	struct Zseg *zs, *ezs;
+	uint32_t off, lim, hdr, zlen;
+	uint8_t *dst, *src;
+
+	zs = (struct Zseg *) (ZHDR + 1);
+    80ab:	bf 10 00 01 00       	mov    $0x10010,%edi
+{
+    80b0:	56                   	push   %esi
+    80b1:	53                   	push   %ebx
+    80b2:	83 ec 2c             	sub    $0x2c,%esp
+    80b5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	ezs = zs + ZHDR->z_nseg;
+    80b8:	6b 05 08 00 01 00 14 	imul   $0x14,0x10008,%eax
+    80bf:	05 10 00 01 00       	add    $0x10010,%eax
+    80c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (; zs < ezs; zs++) {
+    80c7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    80ca:	39 c7                	cmp    %eax,%edi
+    80cc:	0f 83 99 00 00 00    	jae    816b <load_zimage+0xce>
+		// Decompress one block at a time straight to the load
+		// address, reading the disk a window at a time.
+		dst = (uint8_t *) zs->zs_pa;
+		off = zs->zs_offset;
+    80d2:	8b 77 04             	mov    0x4(%edi),%esi
+		lim = off + zs->zs_zsize;
+    80d5:	8b 47 08             	mov    0x8(%edi),%eax
+		dst = (uint8_t *) zs->zs_pa;
+    80d8:	8b 0f                	mov    (%edi),%ecx
+		lim = off + zs->zs_zsize;
+    80da:	01 f0                	add    %esi,%eax
+    80dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		while (off < lim) {
+    80df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    80e2:	39 c6                	cmp    %eax,%esi
+    80e4:	73 66                	jae    814c <load_zimage+0xaf>
+    80e6:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			hdr = *(uint32_t *) zfetch(off, 4, lim);
+    80e9:	51                   	push   %ecx
+    80ea:	ff 75 e0             	push   -0x20(%ebp)
+    80ed:	6a 04                	push   $0x4
+    80ef:	56                   	push   %esi
+    80f0:	e8 24 ff ff ff       	call   8019 <zfetch>
+			zlen = hdr & ~ZBLK_STORED;
+			src = zfetch(off + 4, zlen, lim);
+    80f5:	83 c4 0c             	add    $0xc,%esp
+			hdr = *(uint32_t *) zfetch(off, 4, lim);
+    80f8:	8b 18                	mov    (%eax),%ebx
+			zlen = hdr & ~ZBLK_STORED;
+    80fa:	89 d8                	mov    %ebx,%eax
+    80fc:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+    8101:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			src = zfetch(off + 4, zlen, lim);
+    8104:	ff 75 e0             	push   -0x20(%ebp)
+    8107:	50                   	push   %eax
+    8108:	8d 46 04             	lea    0x4(%esi),%eax
+    810b:	50                   	push   %eax
+    810c:	e8 08 ff ff ff       	call   8019 <zfetch>
+			if (hdr & ZBLK_STORED) {
+    8111:	83 c4 10             	add    $0x10,%esp
+    8114:	85 db                	test   %ebx,%ebx
+    8116:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    8119:	79 18                	jns    8133 <load_zimage+0x96>
+				memcpy(dst, src, zlen);
+    811b:	52                   	push   %edx
+    811c:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    811f:	ff 75 e4             	push   -0x1c(%ebp)
+    8122:	50                   	push   %eax
+    8123:	51                   	push   %ecx
+    8124:	e8 90 06 00 00       	call   87b9 <memcpy>
+				dst += zlen;
+    8129:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    812c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    812f:	01 c1                	add    %eax,%ecx
+    8131:	eb 0d                	jmp    8140 <load_zimage+0xa3>
+			} else
+				dst = lz4_block(dst, src, zlen);
+    8133:	53                   	push   %ebx
+    8134:	ff 75 e4             	push   -0x1c(%ebp)
+    8137:	50                   	push   %eax
+    8138:	51                   	push   %ecx
+    8139:	e8 31 fe ff ff       	call   7f6f <lz4_block>
+    813e:	89 c1                	mov    %eax,%ecx
+			off += 4 + zlen;
+    8140:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+				dst = lz4_block(dst, src, zlen);
+    8143:	83 c4 10             	add    $0x10,%esp
+			off += 4 + zlen;
+    8146:	8d 74 06 04          	lea    0x4(%esi,%eax,1),%esi
+    814a:	eb 93                	jmp    80df <load_zimage+0x42>
+		}
+		zeroseg(zs->zs_pa + zs->zs_filesz, zs->zs_memsz - zs->zs_filesz);
+    814c:	8b 47 0c             	mov    0xc(%edi),%eax
+    814f:	52                   	push   %edx
+	for (; zs < ezs; zs++) {
+    8150:	83 c7 14             	add    $0x14,%edi
+		zeroseg(zs->zs_pa + zs->zs_filesz, zs->zs_memsz - zs->zs_filesz);
+    8153:	52                   	push   %edx
+    8154:	8b 4f fc             	mov    -0x4(%edi),%ecx
+    8157:	29 c1                	sub    %eax,%ecx
+    8159:	51                   	push   %ecx
+    815a:	03 47 ec             	add    -0x14(%edi),%eax
+    815d:	50                   	push   %eax
+    815e:	e8 9d fd ff ff       	call   7f00 <zeroseg>
+	for (; zs < ezs; zs++) {
+    8163:	83 c4 10             	add    $0x10,%esp
+    8166:	e9 5c ff ff ff       	jmp    80c7 <load_zimage+0x2a>
+	}
+	return ZHDR->z_entry;
+}
+    816b:	a1 04 00 01 00       	mov    0x10004,%eax
+    8170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    8173:	5b                   	pop    %ebx
+    8174:	5e                   	pop    %esi
+    8175:	5f                   	pop    %edi
+    8176:	5d                   	pop    %ebp
+    8177:	c3                   	ret
+
+00008178 <readseg>:
+
+// Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
+// Might copy more than asked
+void
+readseg(uint32_t pa, uint32_t count, uint32_t offset)
+{
+    8178:	55                   	push   %ebp
+    8179:	89 e5                	mov    %esp,%ebp
+    817b:	57                   	push   %edi
+    817c:	56                   	push   %esi
+    817d:	53                   	push   %ebx
+    817e:	e8 1c 01 00 00       	call   829f <__x86.get_pc_thunk.bx>
+    8183:	81 c3 d1 0b 00 00    	add    $0xbd1,%ebx
+    8189:	83 ec 2c             	sub    $0x2c,%esp
+    818c:	8b 55 08             	mov    0x8(%ebp),%edx
+    818f:	8b 45 0c             	mov    0xc(%ebp),%eax
+
+	// round down to sector boundary
+	pa &= ~(SECTSIZE - 1);
+
+	// translate from bytes to sectors within the image
+	offset = offset / SECTSIZE;
+    8192:	8b 75 10             	mov    0x10(%ebp),%esi
+{
+    8195:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	end_pa = pa + count;
+    8198:	01 d0                	add    %edx,%eax
+	pa &= ~(SECTSIZE - 1);
+    819a:	81 e2 00 fe ff ff    	and    $0xfffffe00,%edx
+	end_pa = pa + count;
+    81a0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	pa &= ~(SECTSIZE - 1);
+    81a3:	89 d7                	mov    %edx,%edi
+	offset = offset / SECTSIZE;
+    81a5:	c1 ee 09             	shr    $0x9,%esi
+
+	// Read as many sectors per disk command as the controller allows.
+	// We'd write more to memory than asked, but it doesn't matter --
+	// we load in increasing order.
+	while (pa < end_pa) {
+    81a8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    81ab:	39 c7                	cmp    %eax,%edi
+    81ad:	0f 83 8b 00 00 00    	jae    823e <readseg+0xc6>
+		nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+    81b3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+		if (nsect > MAXSECTS)
+			nsect = MAXSECTS;
+    81b6:	b9 ff 00 00 00       	mov    $0xff,%ecx
+		nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+    81bb:	05 ff 01 00 00       	add    $0x1ff,%eax
+    81c0:	29 f8                	sub    %edi,%eax
+		if (nsect > MAXSECTS)
+    81c2:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    81c7:	77 05                	ja     81ce <readseg+0x56>
+		nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+    81c9:	c1 e8 09             	shr    $0x9,%eax
+    81cc:	89 c1                	mov    %eax,%ecx
+		// Since we haven't enabled paging yet and we're using
+		// an identity segment mapping (see boot.S), we can
+		// use physical addresses directly.  This won't be the
+		// case once JOS enables the MMU.
+		if (offset + nsect <= bounce_nsect)
+    81ce:	8d 04 0e             	lea    (%esi,%ecx,1),%eax
+    81d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			memcpy((uint8_t*) pa, (uint8_t*) BOUNCE + offset * SECTSIZE,
+    81d4:	89 c8                	mov    %ecx,%eax
+    81d6:	c1 e0 09             	shl    $0x9,%eax
+    81d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if (offset + nsect <= bounce_nsect)
+    81dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    81df:	39 83 10 00 00 00    	cmp    %eax,0x10(%ebx)
+    81e5:	72 16                	jb     81fd <readseg+0x85>
+			memcpy((uint8_t*) pa, (uint8_t*) BOUNCE + offset * SECTSIZE,
+    81e7:	c1 e6 09             	shl    $0x9,%esi
+    81ea:	51                   	push   %ecx
+    81eb:	81 c6 00 00 04 00    	add    $0x40000,%esi
+    81f1:	ff 75 e4             	push   -0x1c(%ebp)
+    81f4:	56                   	push   %esi
+    81f5:	57                   	push   %edi
+    81f6:	e8 be 05 00 00       	call   87b9 <memcpy>
+    81fb:	eb 5b                	jmp    8258 <readseg+0xe0>
+			       nsect * SECTSIZE);
+		else {
+			// the kernel starts at disk sector KERNSECT.
+			// If DMA fails, use PIO from then on.
+			if (usedma && dma_readsects((uint8_t*) pa,
+    81fd:	83 c6 21             	add    $0x21,%esi
+    8200:	80 bb 0c 00 00 00 00 	cmpb   $0x0,0xc(%ebx)
+    8207:	74 46                	je     824f <readseg+0xd7>
+    8209:	52                   	push   %edx
+    820a:	51                   	push   %ecx
+    820b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+    820e:	56                   	push   %esi
+    820f:	57                   	push   %edi
+    8210:	e8 0e 02 00 00       	call   8423 <dma_readsects>
+    8215:	83 c4 10             	add    $0x10,%esp
+    8218:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    821b:	85 c0                	test   %eax,%eax
+    821d:	79 09                	jns    8228 <readseg+0xb0>
+						    KERNSECT + offset, nsect) < 0)
+				usedma = 0;
+    821f:	c6 83 0c 00 00 00 00 	movb   $0x0,0xc(%ebx)
+    8226:	eb 27                	jmp    824f <readseg+0xd7>
+			if (!usedma)
+    8228:	80 bb 0c 00 00 00 00 	cmpb   $0x0,0xc(%ebx)
+    822f:	74 1e                	je     824f <readseg+0xd7>
+				readsects((uint8_t*) pa, KERNSECT + offset, nsect);
+		}
+		pa += nsect * SECTSIZE;
+    8231:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+		if (offset + nsect <= bounce_nsect)
+    8234:	8b 75 e0             	mov    -0x20(%ebp),%esi
+		pa += nsect * SECTSIZE;
+    8237:	01 c7                	add    %eax,%edi
+    8239:	e9 6a ff ff ff       	jmp    81a8 <readseg+0x30>
+		offset += nsect;
+	}
+	bootinfo_stamp((struct Bootinfo *) BOOTINFO, BT_READSEG, count);
+    823e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+}
+    8241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+	bootinfo_stamp((struct Bootinfo *) BOOTINFO, BT_READSEG, count);
+    8244:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+    8249:	5b                   	pop    %ebx
+    824a:	5e                   	pop    %esi
+    824b:	5f                   	pop    %edi
+    824c:	5d                   	pop    %ebp
+	bootinfo_stamp((struct Bootinfo *) BOOTINFO, BT_READSEG, count);
+    824d:	eb 0e                	jmp    825d <bootinfo_stamp.constprop.0>
+				readsects((uint8_t*) pa, KERNSECT + offset, nsect);
+    824f:	50                   	push   %eax
+    8250:	51                   	push   %ecx
+    8251:	56                   	push   %esi
+    8252:	57                   	push   %edi
+    8253:	e8 5d 00 00 00       	call   82b5 <readsects>
+    8258:	83 c4 10             	add    $0x10,%esp
+    825b:	eb d4                	jmp    8231 <readseg+0xb9>
+
+0000825d <bootinfo_stamp.constprop.0>:
+static inline void
+bootinfo_stamp(struct Bootinfo *bi, uint32_t stage, uint32_t arg)
+{
+	struct Bootstamp *bs;
+
+	if (bi->bi_nstamp >= BI_MAXSTAMP)
+    825d:	8b 0d 08 10 00 00    	mov    0x1008,%ecx
+    8263:	83 f9 1f             	cmp    $0x1f,%ecx
+    8266:	77 32                	ja     829a <bootinfo_stamp.constprop.0+0x3d>
+bootinfo_stamp(struct Bootinfo *bi, uint32_t stage, uint32_t arg)
+    8268:	55                   	push   %ebp
+    8269:	89 e5                	mov    %esp,%ebp
+    826b:	56                   	push   %esi
+    826c:	89 c6                	mov    %eax,%esi
+		return;
+	bs = &bi->bi_stamp[bi->bi_nstamp++];
+    826e:	8d 41 01             	lea    0x1(%ecx),%eax
+bootinfo_stamp(struct Bootinfo *bi, uint32_t stage, uint32_t arg)
+    8271:	53                   	push   %ebx
+    8272:	89 d3                	mov    %edx,%ebx
+	bs = &bi->bi_stamp[bi->bi_nstamp++];
+    8274:	a3 08 10 00 00       	mov    %eax,0x1008
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+    8279:	0f 31                	rdtsc
+    827b:	c1 e1 04             	shl    $0x4,%ecx
+	bs->bs_tsc = read_tsc();
+    827e:	89 81 10 10 00 00    	mov    %eax,0x1010(%ecx)
+    8284:	89 91 14 10 00 00    	mov    %edx,0x1014(%ecx)
+	bs->bs_stage = stage;
+    828a:	89 b1 18 10 00 00    	mov    %esi,0x1018(%ecx)
+	bs->bs_arg = arg;
+    8290:	89 99 1c 10 00 00    	mov    %ebx,0x101c(%ecx)
+}
+    8296:	5b                   	pop    %ebx
+    8297:	5e                   	pop    %esi
+    8298:	5d                   	pop    %ebp
+    8299:	c3                   	ret
+    829a:	c3                   	ret
+
+0000829b <__x86.get_pc_thunk.ax>:
+    829b:	8b 04 24             	mov    (%esp),%eax
+    829e:	c3                   	ret
+
+0000829f <__x86.get_pc_thunk.bx>:
+    829f:	8b 1c 24             	mov    (%esp),%ebx
+    82a2:	c3                   	ret
+
+000082a3 <__x86.get_pc_thunk.si>:
+    82a3:	8b 34 24             	mov    (%esp),%esi
+    82a6:	c3                   	ret
+
+000082a7 <waitdisk>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    82a7:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    82ac:	ec                   	in     (%dx),%al
+
+void
+waitdisk(void)
+{
+	// wait for disk reaady
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    82ad:	83 e0 c0             	and    $0xffffffc0,%eax
+    82b0:	3c 40                	cmp    $0x40,%al
+    82b2:	75 f8                	jne    82ac <waitdisk+0x5>
+		/* do nothing */;
+}
+    82b4:	c3                   	ret
+
+000082b5 <readsects>:
+
+// Read 'nsect' (1..MAXSECTS) consecutive sectors starting at sector
+// 'offset' into 'dst' with a single READ SECTORS command.
+void
+readsects(void *dst, uint32_t offset, uint32_t nsect)
+{
+    82b5:	55                   	push   %ebp
+    82b6:	89 e5                	mov    %esp,%ebp
+    82b8:	57                   	push   %edi
+    82b9:	56                   	push   %esi
+    82ba:	53                   	push   %ebx
+    82bb:	83 ec 0c             	sub    $0xc,%esp
+    82be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    82c1:	8b 75 08             	mov    0x8(%ebp),%esi
+    82c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	// wait for disk to be ready
+	waitdisk();
+    82c7:	e8 db ff ff ff       	call   82a7 <waitdisk>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    82cc:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    82d1:	89 d8                	mov    %ebx,%eax
+    82d3:	ee                   	out    %al,(%dx)
+    82d4:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    82d9:	89 c8                	mov    %ecx,%eax
+    82db:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsect);	// sector count
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+    82dc:	89 c8                	mov    %ecx,%eax
+    82de:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    82e3:	c1 e8 08             	shr    $0x8,%eax
+    82e6:	ee                   	out    %al,(%dx)
+	outb(0x1F5, offset >> 16);
+    82e7:	89 c8                	mov    %ecx,%eax
+    82e9:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    82ee:	c1 e8 10             	shr    $0x10,%eax
+    82f1:	ee                   	out    %al,(%dx)
+	outb(0x1F6, (offset >> 24) | 0xE0);
+    82f2:	89 c8                	mov    %ecx,%eax
+    82f4:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    82f9:	c1 e8 18             	shr    $0x18,%eax
+    82fc:	83 c8 e0             	or     $0xffffffe0,%eax
+    82ff:	ee                   	out    %al,(%dx)
+    8300:	b0 20                	mov    $0x20,%al
+    8302:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    8307:	ee                   	out    %al,(%dx)
+	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+	// the drive raises DRQ once per sector, so wait before each one
+	for (; nsect > 0; nsect--, dst += SECTSIZE) {
+    8308:	85 db                	test   %ebx,%ebx
+    830a:	74 1d                	je     8329 <readsects+0x74>
+		waitdisk();
+    830c:	e8 96 ff ff ff       	call   82a7 <waitdisk>
+	asm volatile("cld\n\trepne\n\tinsl"
+    8311:	89 f7                	mov    %esi,%edi
+    8313:	b9 80 00 00 00       	mov    $0x80,%ecx
+    8318:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    831d:	fc                   	cld
+    831e:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsect > 0; nsect--, dst += SECTSIZE) {
+    8320:	4b                   	dec    %ebx
+    8321:	81 c6 00 02 00 00    	add    $0x200,%esi
+    8327:	eb df                	jmp    8308 <readsects+0x53>
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+}
+    8329:	83 c4 0c             	add    $0xc,%esp
+    832c:	5b                   	pop    %ebx
+    832d:	5e                   	pop    %esi
+    832e:	5f                   	pop    %edi
+    832f:	5d                   	pop    %ebp
+    8330:	c3                   	ret
+
+00008331 <dma_init>:
+
+// Find a usable bus-master IDE controller on PCI bus 0 and enable it.
+// Returns 0 on success, -1 if there is none.
+int
+dma_init(void)
+{
+    8331:	55                   	push   %ebp
+    8332:	89 e5                	mov    %esp,%ebp
+    8334:	57                   	push   %edi
+    8335:	56                   	push   %esi
+				       (cmd & 0xFFFF) | PCI_COMMAND_IO_ENABLE
+				       | PCI_COMMAND_MASTER_ENABLE);
+			bmbase = bar & ~3;
+			return 0;
+		}
+	return -1;
+    8336:	31 f6                	xor    %esi,%esi
+{
+    8338:	53                   	push   %ebx
+    8339:	e8 61 ff ff ff       	call   829f <__x86.get_pc_thunk.bx>
+    833e:	81 c3 16 0a 00 00    	add    $0xa16,%ebx
+    8344:	51                   	push   %ecx
+	return -1;
+    8345:	89 75 f0             	mov    %esi,-0x10(%ebp)
+{
+    8348:	31 ff                	xor    %edi,%edi
+	outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+    834a:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    834d:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+    8352:	09 f9                	or     %edi,%ecx
+    8354:	89 c8                	mov    %ecx,%eax
+    8356:	0d 00 00 00 80       	or     $0x80000000,%eax
+    835b:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    835c:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    8361:	ed                   	in     (%dx),%eax
+			if ((pci_conf_read(dev, func, PCI_ID_REG) & 0xFFFF) == 0xFFFF)
+    8362:	0f b7 c0             	movzwl %ax,%eax
+    8365:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    836a:	0f 84 84 00 00 00    	je     83f4 <dma_init+0xc3>
+	outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+    8370:	89 c8                	mov    %ecx,%eax
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    8372:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+    8377:	0d 08 00 00 80       	or     $0x80000008,%eax
+    837c:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    837d:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    8382:	ed                   	in     (%dx),%eax
+			if ((class >> 16) != PCI_CLASS_IDE
+    8383:	89 c2                	mov    %eax,%edx
+    8385:	c1 ea 10             	shr    $0x10,%edx
+    8388:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+    838e:	75 64                	jne    83f4 <dma_init+0xc3>
+			progif = (class >> 8) & 0xFF;
+    8390:	c1 e8 08             	shr    $0x8,%eax
+			    || !(progif & PCI_IDE_BUS_MASTER))
+    8393:	25 81 00 00 00       	and    $0x81,%eax
+    8398:	3d 80 00 00 00       	cmp    $0x80,%eax
+    839d:	75 55                	jne    83f4 <dma_init+0xc3>
+	outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+    839f:	89 c8                	mov    %ecx,%eax
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    83a1:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+    83a6:	0d 20 00 00 80       	or     $0x80000020,%eax
+    83ab:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    83ac:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    83b1:	ed                   	in     (%dx),%eax
+    83b2:	89 c6                	mov    %eax,%esi
+			if (!(bar & 1) || !(bar & ~3))
+    83b4:	83 f8 03             	cmp    $0x3,%eax
+    83b7:	76 3b                	jbe    83f4 <dma_init+0xc3>
+    83b9:	a8 01                	test   $0x1,%al
+    83bb:	74 37                	je     83f4 <dma_init+0xc3>
+	outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+    83bd:	81 c9 04 00 00 80    	or     $0x80000004,%ecx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    83c3:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+    83c8:	89 c8                	mov    %ecx,%eax
+    83ca:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    83cb:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    83d0:	ed                   	in     (%dx),%eax
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    83d1:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    83d6:	89 c7                	mov    %eax,%edi
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    83d8:	89 c8                	mov    %ecx,%eax
+    83da:	ef                   	out    %eax,(%dx)
+				       (cmd & 0xFFFF) | PCI_COMMAND_IO_ENABLE
+    83db:	0f b7 c7             	movzwl %di,%eax
+    83de:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+			pci_conf_write(dev, func, PCI_COMMAND_STATUS_REG,
+    83e3:	83 c8 05             	or     $0x5,%eax
+    83e6:	ef                   	out    %eax,(%dx)
+			bmbase = bar & ~3;
+    83e7:	83 e6 fc             	and    $0xfffffffc,%esi
+			return 0;
+    83ea:	31 c0                	xor    %eax,%eax
+			bmbase = bar & ~3;
+    83ec:	89 b3 1c 00 00 00    	mov    %esi,0x1c(%ebx)
+			return 0;
+    83f2:	eb 29                	jmp    841d <dma_init+0xec>
+    83f4:	81 c7 00 01 00 00    	add    $0x100,%edi
+		for (func = 0; func < 8; func++) {
+    83fa:	81 ff 00 08 00 00    	cmp    $0x800,%edi
+    8400:	0f 85 44 ff ff ff    	jne    834a <dma_init+0x19>
+    8406:	81 45 f0 00 08 00 00 	addl   $0x800,-0x10(%ebp)
+	for (dev = 0; dev < 32; dev++)
+    840d:	81 7d f0 00 00 01 00 	cmpl   $0x10000,-0x10(%ebp)
+    8414:	0f 85 2e ff ff ff    	jne    8348 <dma_init+0x17>
+	return -1;
+    841a:	83 c8 ff             	or     $0xffffffff,%eax
+}
+    841d:	5a                   	pop    %edx
+    841e:	5b                   	pop    %ebx
+    841f:	5e                   	pop    %esi
+    8420:	5f                   	pop    %edi
+    8421:	5d                   	pop    %ebp
+    8422:	c3                   	ret
+
+00008423 <dma_readsects>:
+// Read 'nsect' (1..MAXSECTS) sectors starting at sector 'offset'
+// straight to physical address 'dst' with one READ DMA command.
+// Returns 0 on success, -1 on any error.
+int
+dma_readsects(void *dst, uint32_t offset, uint32_t nsect)
+{
+    8423:	55                   	push   %ebp
+    8424:	89 e5                	mov    %esp,%ebp
+    8426:	57                   	push   %edi
+    8427:	56                   	push   %esi
+    8428:	53                   	push   %ebx
+    8429:	e8 71 fe ff ff       	call   829f <__x86.get_pc_thunk.bx>
+    842e:	81 c3 26 09 00 00    	add    $0x926,%ebx
+    8434:	83 ec 0c             	sub    $0xc,%esp
+	struct Prd *prd;
+	uint8_t st;
+
+	// Describe the buffer, split at 64KB boundaries.
+	pa = (uint32_t) dst;
+	end = pa + nsect * SECTSIZE;
+    8437:	8b 75 10             	mov    0x10(%ebp),%esi
+	pa = (uint32_t) dst;
+    843a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	end = pa + nsect * SECTSIZE;
+    843d:	c1 e6 09             	shl    $0x9,%esi
+    8440:	01 ce                	add    %ecx,%esi
+	for (prd = prdt; pa < end; pa += n, prd++) {
+    8442:	8d 93 24 00 00 00    	lea    0x24(%ebx),%edx
+    8448:	39 f1                	cmp    %esi,%ecx
+    844a:	73 26                	jae    8472 <dma_readsects+0x4f>
+		n = MIN(end, ROUNDDOWN(pa, 0x10000) + 0x10000) - pa;
+    844c:	89 c8                	mov    %ecx,%eax
+		prd->prd_addr = pa;
+    844e:	89 0a                	mov    %ecx,(%edx)
+		n = MIN(end, ROUNDDOWN(pa, 0x10000) + 0x10000) - pa;
+    8450:	66 31 c0             	xor    %ax,%ax
+		prd->prd_count = n;	// 64KB truncates to 0, as it should
+		prd->prd_flags = 0;
+    8453:	66 c7 42 06 00 00    	movw   $0x0,0x6(%edx)
+		n = MIN(end, ROUNDDOWN(pa, 0x10000) + 0x10000) - pa;
+    8459:	05 00 00 01 00       	add    $0x10000,%eax
+    845e:	39 f0                	cmp    %esi,%eax
+    8460:	0f 47 c6             	cmova  %esi,%eax
+	for (prd = prdt; pa < end; pa += n, prd++) {
+    8463:	83 c2 08             	add    $0x8,%edx
+		n = MIN(end, ROUNDDOWN(pa, 0x10000) + 0x10000) - pa;
+    8466:	89 c7                	mov    %eax,%edi
+    8468:	29 cf                	sub    %ecx,%edi
+	for (prd = prdt; pa < end; pa += n, prd++) {
+    846a:	89 c1                	mov    %eax,%ecx
+		prd->prd_count = n;	// 64KB truncates to 0, as it should
+    846c:	66 89 7a fc          	mov    %di,-0x4(%edx)
+    8470:	eb d6                	jmp    8448 <dma_readsects+0x25>
+	}
+	prd[-1].prd_flags = PRD_EOT;
+
+	outb(bmbase + BM_CMD, 0);
+    8472:	8b 8b 1c 00 00 00    	mov    0x1c(%ebx),%ecx
+	prd[-1].prd_flags = PRD_EOT;
+    8478:	66 c7 42 fe 00 80    	movw   $0x8000,-0x2(%edx)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    847e:	31 c0                	xor    %eax,%eax
+    8480:	89 ca                	mov    %ecx,%edx
+    8482:	ee                   	out    %al,(%dx)
+    8483:	b0 06                	mov    $0x6,%al
+	outb(bmbase + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INTR);
+    8485:	8d 51 02             	lea    0x2(%ecx),%edx
+    8488:	ee                   	out    %al,(%dx)
+	outl(bmbase + BM_PRDT, (uint32_t) prdt);
+    8489:	8d 51 04             	lea    0x4(%ecx),%edx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    848c:	8d 83 24 00 00 00    	lea    0x24(%ebx),%eax
+    8492:	ef                   	out    %eax,(%dx)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    8493:	b0 08                	mov    $0x8,%al
+    8495:	89 ca                	mov    %ecx,%edx
+    8497:	ee                   	out    %al,(%dx)
+	outb(bmbase + BM_CMD, BM_CMD_READ);
+
+	// wait for disk to be ready
+	waitdisk();
+    8498:	e8 0a fe ff ff       	call   82a7 <waitdisk>
+    849d:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    84a2:	8a 45 10             	mov    0x10(%ebp),%al
+    84a5:	ee                   	out    %al,(%dx)
+    84a6:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    84ab:	8a 45 0c             	mov    0xc(%ebp),%al
+    84ae:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsect);	// sector count
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+    84af:	8b 45 0c             	mov    0xc(%ebp),%eax
+    84b2:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    84b7:	c1 e8 08             	shr    $0x8,%eax
+    84ba:	ee                   	out    %al,(%dx)
+	outb(0x1F5, offset >> 16);
+    84bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+    84be:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    84c3:	c1 e8 10             	shr    $0x10,%eax
+    84c6:	ee                   	out    %al,(%dx)
+	outb(0x1F6, (offset >> 24) | 0xE0);
+    84c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    84ca:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    84cf:	c1 e8 18             	shr    $0x18,%eax
+    84d2:	83 c8 e0             	or     $0xffffffe0,%eax
+    84d5:	ee                   	out    %al,(%dx)
+    84d6:	b0 c8                	mov    $0xc8,%al
+    84d8:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    84dd:	ee                   	out    %al,(%dx)
+	outb(0x1F7, 0xC8);	// cmd 0xC8 - read DMA
+
+	outb(bmbase + BM_CMD, BM_CMD_READ | BM_CMD_START);
+    84de:	8b 9b 1c 00 00 00    	mov    0x1c(%ebx),%ebx
+    84e4:	b0 09                	mov    $0x9,%al
+    84e6:	89 da                	mov    %ebx,%edx
+    84e8:	ee                   	out    %al,(%dx)
+
+	// The drive raises its interrupt line when the transfer is over;
+	// interrupts are off, so poll for it in the bus master status.
+	while (!((st = inb(bmbase + BM_STATUS))
+    84e9:	8d 53 02             	lea    0x2(%ebx),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    84ec:	ec                   	in     (%dx),%al
+    84ed:	89 c1                	mov    %eax,%ecx
+    84ef:	a8 06                	test   $0x6,%al
+    84f1:	74 f9                	je     84ec <dma_readsects+0xc9>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    84f3:	31 c0                	xor    %eax,%eax
+    84f5:	89 da                	mov    %ebx,%edx
+    84f7:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    84f8:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    84fd:	ec                   	in     (%dx),%al
+		/* do nothing */;
+	outb(bmbase + BM_CMD, 0);
+
+	// Reading the drive status also acknowledges its interrupt.
+	if ((inb(0x1F7) & 0x21) || (st & BM_STATUS_ERR))
+		return -1;	// ERR or DF set, or the transfer failed
+    84fe:	83 ca ff             	or     $0xffffffff,%edx
+	if ((inb(0x1F7) & 0x21) || (st & BM_STATUS_ERR))
+    8501:	a8 21                	test   $0x21,%al
+    8503:	75 09                	jne    850e <dma_readsects+0xeb>
+    8505:	d0 e9                	shr    %cl
+    8507:	83 e1 01             	and    $0x1,%ecx
+    850a:	f7 d9                	neg    %ecx
+    850c:	89 ca                	mov    %ecx,%edx
+	return 0;
+}
+    850e:	83 c4 0c             	add    $0xc,%esp
+    8511:	89 d0                	mov    %edx,%eax
+    8513:	5b                   	pop    %ebx
+    8514:	5e                   	pop    %esi
+    8515:	5f                   	pop    %edi
+    8516:	5d                   	pop    %ebp
+    8517:	c3                   	ret
+
+00008518 <e820_detect>:
+.set SMAP,           0x534D4150  # "SMAP", the E820 signature
+
+.globl e820_detect
+e820_detect:
+  .code32
+  pushal
+    8518:	60                   	pusha
+  lgdt    gdtdesc
+    8519:	0f 01 15 d4 85 00 00 	lgdtl  0x85d4
+  movl    $0, BOOTINFO+BI_NE820
+    8520:	c7 05 0c 10 00 00 00 	movl   $0x0,0x100c
+    8527:	00 00 00 
+
+  # Step down to 16-bit protected mode, then to real mode.
+  ljmp    $REAL_MODE_CSEG, $1f
+    852a:	ea 31 85 00 00 18 00 	ljmp   $0x18,$0x8531
+  .code16
+1:
+  movw    $REAL_MODE_DSEG, %ax
+    8531:	b8 20 00 8e d8       	mov    $0xd88e0020,%eax
+  movw    %ax, %ds
+  movw    %ax, %es
+    8536:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss
+    8538:	8e d0                	mov    %eax,%ss
+  movl    %cr0, %eax
+    853a:	0f 20 c0             	mov    %cr0,%eax
+  andl    $~CR0_PE, %eax
+    853d:	66 83 e0 fe          	and    $0xfffe,%ax
+  movl    %eax, %cr0
+    8541:	0f 22 c0             	mov    %eax,%cr0
+  ljmp    $0, $2f
+    8544:	ea 49 85 00 00 31 c0 	ljmp   $0xc031,$0x8549
+2:
+  xorw    %ax, %ax
+  movw    %ax, %ds
+    854b:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es
+    854d:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss
+    854f:	8e d0                	mov    %eax,%ss
+  sti
+    8551:	fb                   	sti
+
+  # Each call returns one entry in ES:DI and the continuation value
+  # for the next call in EBX, which is 0 after the last entry.
+  xorl    %ebx, %ebx
+    8552:	66 31 db             	xor    %bx,%bx
+  movw    $BOOTINFO+BI_E820, %di
+    8555:	bf 10 12 66 b8       	mov    $0xb8661210,%edi
+3:
+  movl    $0xE820, %eax
+    855a:	20 e8                	and    %ch,%al
+    855c:	00 00                	add    %al,(%eax)
+  movl    $E820ENT_SIZE, %ecx
+    855e:	66 b9 14 00          	mov    $0x14,%cx
+    8562:	00 00                	add    %al,(%eax)
+  movl    $SMAP, %edx
+    8564:	66 ba 50 41          	mov    $0x4150,%dx
+    8568:	4d                   	dec    %ebp
+    8569:	53                   	push   %ebx
+  int     $0x15
+    856a:	cd 15                	int    $0x15
+  jc      4f
+    856c:	72 1d                	jb     858b <e820_detect+0x73>
+  cmpl    $SMAP, %eax
+    856e:	66 3d 50 41          	cmp    $0x4150,%ax
+    8572:	4d                   	dec    %ebp
+    8573:	53                   	push   %ebx
+  jne     4f
+    8574:	75 15                	jne    858b <e820_detect+0x73>
+  addw    $E820ENT_SIZE, %di
+    8576:	83 c7 14             	add    $0x14,%edi
+  incl    BOOTINFO+BI_NE820
+    8579:	66 ff 06             	incw   (%esi)
+    857c:	0c 10                	or     $0x10,%al
+  cmpl    $BI_MAXE820, BOOTINFO+BI_NE820
+    857e:	66 83 3e 0c          	cmpw   $0xc,(%esi)
+    8582:	10 20                	adc    %ah,(%eax)
+  jae     4f
+    8584:	73 05                	jae    858b <e820_detect+0x73>
+  testl   %ebx, %ebx
+    8586:	66 85 db             	test   %bx,%bx
+  jnz     3b
+    8589:	75 cd                	jne    8558 <e820_detect+0x40>
+4:
+
+  # Back to 32-bit protected mode.
+  cli
+    858b:	fa                   	cli
+  movl    %cr0, %eax
+    858c:	0f 20 c0             	mov    %cr0,%eax
+  orl     $CR0_PE, %eax
+    858f:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    8593:	0f 22 c0             	mov    %eax,%cr0
+  ljmp    $PROT_MODE_CSEG, $5f
+    8596:	ea 9b 85 08 00 66 b8 	ljmp   $0xb866,$0x8859b
+  .code32
+5:
+  movw    $PROT_MODE_DSEG, %ax
+    859d:	10 00                	adc    %al,(%eax)
+  movw    %ax, %ds
+    859f:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es
+    85a1:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs
+    85a3:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs
+    85a5:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss
+    85a7:	8e d0                	mov    %eax,%ss
+  popal
+    85a9:	61                   	popa
+  ret
+    85aa:	c3                   	ret
+    85ab:	90                   	nop
+
+000085ac <gdt>:
+	...
+    85b4:	ff                   	(bad)
+    85b5:	ff 00                	incl   (%eax)
+    85b7:	00 00                	add    %al,(%eax)
+    85b9:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    85c0:	00 92 cf 00 ff ff    	add    %dl,-0xff31(%edx)
+    85c6:	00 00                	add    %al,(%eax)
+    85c8:	00 9a 00 00 ff ff    	add    %bl,-0x10000(%edx)
+    85ce:	00 00                	add    %al,(%eax)
+    85d0:	00                   	.byte 0x0
+    85d1:	92                   	xchg   %eax,%edx
+	...
+
+000085d4 <gdtdesc>:
+    85d4:	27                   	daa
+    85d5:	00                   	.byte 0x0
+    85d6:	ac                   	lods   %ds:(%esi),%al
+    85d7:	85 00                	test   %eax,(%eax)
+	...
+
+000085da <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+    85da:	55                   	push   %ebp
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+    85db:	31 c0                	xor    %eax,%eax
+{
+    85dd:	89 e5                	mov    %esp,%ebp
+    85df:	8b 55 08             	mov    0x8(%ebp),%edx
+	for (n = 0; *s != '\0'; s++)
+    85e2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    85e6:	74 03                	je     85eb <strlen+0x11>
+		n++;
+    85e8:	40                   	inc    %eax
+    85e9:	eb f7                	jmp    85e2 <strlen+0x8>
+	return n;
+}
+    85eb:	5d                   	pop    %ebp
+    85ec:	c3                   	ret
+
+000085ed <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+    85ed:	55                   	push   %ebp
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+    85ee:	31 c0                	xor    %eax,%eax
+{
+    85f0:	89 e5                	mov    %esp,%ebp
+    85f2:	8b 55 08             	mov    0x8(%ebp),%edx
+    85f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+    85f8:	39 c8                	cmp    %ecx,%eax
+    85fa:	74 09                	je     8605 <strnlen+0x18>
+    85fc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    8600:	74 03                	je     8605 <strnlen+0x18>
+		n++;
+    8602:	40                   	inc    %eax
+    8603:	eb f3                	jmp    85f8 <strnlen+0xb>
+	return n;
+}
+    8605:	5d                   	pop    %ebp
+    8606:	c3                   	ret
+
+00008607 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+    8607:	55                   	push   %ebp
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+    8608:	31 c0                	xor    %eax,%eax
+{
+    860a:	89 e5                	mov    %esp,%ebp
+    860c:	8b 55 08             	mov    0x8(%ebp),%edx
+	while ((*dst++ = *src++) != '\0')
+    860f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    8612:	8a 0c 01             	mov    (%ecx,%eax,1),%cl
+    8615:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    8618:	40                   	inc    %eax
+    8619:	84 c9                	test   %cl,%cl
+    861b:	75 f2                	jne    860f <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+    861d:	89 d0                	mov    %edx,%eax
+    861f:	5d                   	pop    %ebp
+    8620:	c3                   	ret
+
+00008621 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+    8621:	55                   	push   %ebp
+    8622:	89 e5                	mov    %esp,%ebp
+    8624:	53                   	push   %ebx
+    8625:	83 ec 10             	sub    $0x10,%esp
+    8628:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+    862b:	53                   	push   %ebx
+    862c:	e8 a9 ff ff ff       	call   85da <strlen>
+    8631:	5a                   	pop    %edx
+    8632:	59                   	pop    %ecx
+	strcpy(dst + len, src);
+    8633:	ff 75 0c             	push   0xc(%ebp)
+    8636:	01 d8                	add    %ebx,%eax
+    8638:	50                   	push   %eax
+    8639:	e8 c9 ff ff ff       	call   8607 <strcpy>
+	return dst;
+}
+    863e:	89 d8                	mov    %ebx,%eax
+    8640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    8643:	c9                   	leave
+    8644:	c3                   	ret
+
+00008645 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+    8645:	55                   	push   %ebp
+    8646:	89 e5                	mov    %esp,%ebp
+    8648:	56                   	push   %esi
+    8649:	53                   	push   %ebx
+    864a:	8b 55 08             	mov    0x8(%ebp),%edx
+    864d:	8b 75 10             	mov    0x10(%ebp),%esi
+    8650:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+    8653:	89 d0                	mov    %edx,%eax
+    8655:	01 d6                	add    %edx,%esi
+    8657:	39 f0                	cmp    %esi,%eax
+    8659:	74 0e                	je     8669 <strncpy+0x24>
+		*dst++ = *src;
+    865b:	8a 19                	mov    (%ecx),%bl
+    865d:	40                   	inc    %eax
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+    865e:	80 fb 01             	cmp    $0x1,%bl
+		*dst++ = *src;
+    8661:	88 58 ff             	mov    %bl,-0x1(%eax)
+			src++;
+    8664:	83 d9 ff             	sbb    $0xffffffff,%ecx
+    8667:	eb ee                	jmp    8657 <strncpy+0x12>
+	}
+	return ret;
+}
+    8669:	5b                   	pop    %ebx
+    866a:	89 d0                	mov    %edx,%eax
+    866c:	5e                   	pop    %esi
+    866d:	5d                   	pop    %ebp
+    866e:	c3                   	ret
+
+0000866f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+    866f:	55                   	push   %ebp
+    8670:	89 e5                	mov    %esp,%ebp
+    8672:	57                   	push   %edi
+    8673:	56                   	push   %esi
+    8674:	53                   	push   %ebx
+    8675:	8b 7d 08             	mov    0x8(%ebp),%edi
+    8678:	8b 75 10             	mov    0x10(%ebp),%esi
+    867b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    867e:	89 f8                	mov    %edi,%eax
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+    8680:	85 f6                	test   %esi,%esi
+    8682:	74 1c                	je     86a0 <strlcpy+0x31>
+    8684:	8d 51 01             	lea    0x1(%ecx),%edx
+    8687:	01 f1                	add    %esi,%ecx
+		while (--size > 0 && *src != '\0')
+    8689:	39 ca                	cmp    %ecx,%edx
+    868b:	75 05                	jne    8692 <strlcpy+0x23>
+			*dst++ = *src++;
+		*dst = '\0';
+    868d:	c6 00 00             	movb   $0x0,(%eax)
+    8690:	eb 0e                	jmp    86a0 <strlcpy+0x31>
+		while (--size > 0 && *src != '\0')
+    8692:	8a 5a ff             	mov    -0x1(%edx),%bl
+    8695:	42                   	inc    %edx
+    8696:	84 db                	test   %bl,%bl
+    8698:	74 f3                	je     868d <strlcpy+0x1e>
+			*dst++ = *src++;
+    869a:	40                   	inc    %eax
+    869b:	88 58 ff             	mov    %bl,-0x1(%eax)
+    869e:	eb e9                	jmp    8689 <strlcpy+0x1a>
+	}
+	return dst - dst_in;
+}
+    86a0:	5b                   	pop    %ebx
+	return dst - dst_in;
+    86a1:	29 f8                	sub    %edi,%eax
+}
+    86a3:	5e                   	pop    %esi
+    86a4:	5f                   	pop    %edi
+    86a5:	5d                   	pop    %ebp
+    86a6:	c3                   	ret
+
+000086a7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    86a7:	55                   	push   %ebp
+	while (*p && *p == *q)
+    86a8:	31 c9                	xor    %ecx,%ecx
+{
+    86aa:	89 e5                	mov    %esp,%ebp
+	while (*p && *p == *q)
+    86ac:	8b 45 08             	mov    0x8(%ebp),%eax
+    86af:	8b 55 0c             	mov    0xc(%ebp),%edx
+    86b2:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+    86b6:	0f b6 14 0a          	movzbl (%edx,%ecx,1),%edx
+    86ba:	84 c0                	test   %al,%al
+    86bc:	74 05                	je     86c3 <strcmp+0x1c>
+    86be:	41                   	inc    %ecx
+    86bf:	38 d0                	cmp    %dl,%al
+    86c1:	74 e9                	je     86ac <strcmp+0x5>
+		p++, q++;
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+    86c3:	29 d0                	sub    %edx,%eax
+}
+    86c5:	5d                   	pop    %ebp
+    86c6:	c3                   	ret
+
+000086c7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+    86c7:	55                   	push   %ebp
+    86c8:	89 e5                	mov    %esp,%ebp
+    86ca:	53                   	push   %ebx
+    86cb:	8b 45 08             	mov    0x8(%ebp),%eax
+    86ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+    86d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	while (n > 0 && *p && *p == *q)
+    86d4:	85 c9                	test   %ecx,%ecx
+    86d6:	74 0f                	je     86e7 <strncmp+0x20>
+    86d8:	8a 18                	mov    (%eax),%bl
+    86da:	84 db                	test   %bl,%bl
+    86dc:	74 0d                	je     86eb <strncmp+0x24>
+    86de:	3a 1a                	cmp    (%edx),%bl
+    86e0:	75 09                	jne    86eb <strncmp+0x24>
+		n--, p++, q++;
+    86e2:	49                   	dec    %ecx
+    86e3:	40                   	inc    %eax
+    86e4:	42                   	inc    %edx
+    86e5:	eb ed                	jmp    86d4 <strncmp+0xd>
+	if (n == 0)
+		return 0;
+    86e7:	31 c0                	xor    %eax,%eax
+    86e9:	eb 08                	jmp    86f3 <strncmp+0x2c>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+    86eb:	0f b6 00             	movzbl (%eax),%eax
+    86ee:	0f b6 12             	movzbl (%edx),%edx
+    86f1:	29 d0                	sub    %edx,%eax
+}
+    86f3:	5b                   	pop    %ebx
+    86f4:	5d                   	pop    %ebp
+    86f5:	c3                   	ret
+
+000086f6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+    86f6:	55                   	push   %ebp
+    86f7:	89 e5                	mov    %esp,%ebp
+    86f9:	8a 4d 0c             	mov    0xc(%ebp),%cl
+	for (; *s; s++)
+    86fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    86ff:	8a 10                	mov    (%eax),%dl
+    8701:	84 d2                	test   %dl,%dl
+    8703:	74 07                	je     870c <strchr+0x16>
+		if (*s == c)
+    8705:	38 ca                	cmp    %cl,%dl
+    8707:	74 05                	je     870e <strchr+0x18>
+	for (; *s; s++)
+    8709:	40                   	inc    %eax
+    870a:	eb f3                	jmp    86ff <strchr+0x9>
+			return (char *) s;
+	return 0;
+    870c:	31 c0                	xor    %eax,%eax
+}
+    870e:	5d                   	pop    %ebp
+    870f:	c3                   	ret
+
+00008710 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+    8710:	55                   	push   %ebp
+    8711:	89 e5                	mov    %esp,%ebp
+    8713:	8a 4d 0c             	mov    0xc(%ebp),%cl
+	for (; *s; s++)
+    8716:	8b 45 08             	mov    0x8(%ebp),%eax
+    8719:	8a 10                	mov    (%eax),%dl
+		if (*s == c)
+    871b:	38 ca                	cmp    %cl,%dl
+    871d:	74 07                	je     8726 <strfind+0x16>
+    871f:	84 d2                	test   %dl,%dl
+    8721:	74 03                	je     8726 <strfind+0x16>
+	for (; *s; s++)
+    8723:	40                   	inc    %eax
+    8724:	eb f3                	jmp    8719 <strfind+0x9>
+			break;
+	return (char *) s;
+}
+    8726:	5d                   	pop    %ebp
+    8727:	c3                   	ret
+
+00008728 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+    8728:	55                   	push   %ebp
+    8729:	89 e5                	mov    %esp,%ebp
+    872b:	57                   	push   %edi
+    872c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    872f:	8b 7d 08             	mov    0x8(%ebp),%edi
+    8732:	8b 45 0c             	mov    0xc(%ebp),%eax
+	char *p;
+
+	if (n == 0)
+    8735:	85 c9                	test   %ecx,%ecx
+    8737:	74 1d                	je     8756 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+    8739:	89 fa                	mov    %edi,%edx
+    873b:	09 ca                	or     %ecx,%edx
+    873d:	80 e2 03             	and    $0x3,%dl
+    8740:	75 11                	jne    8753 <memset+0x2b>
+		c &= 0xFF;
+    8742:	0f b6 c0             	movzbl %al,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+    8745:	c1 e9 02             	shr    $0x2,%ecx
+    8748:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		asm volatile("cld; rep stosl\n"
+    874e:	fc                   	cld
+    874f:	f3 ab                	rep stos %eax,%es:(%edi)
+    8751:	eb 03                	jmp    8756 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+    8753:	fc                   	cld
+    8754:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+    8756:	89 f8                	mov    %edi,%eax
+    8758:	5f                   	pop    %edi
+    8759:	5d                   	pop    %ebp
+    875a:	c3                   	ret
+
+0000875b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+    875b:	55                   	push   %ebp
+    875c:	89 e5                	mov    %esp,%ebp
+    875e:	57                   	push   %edi
+    875f:	56                   	push   %esi
+    8760:	8b 55 08             	mov    0x8(%ebp),%edx
+    8763:	8b 75 0c             	mov    0xc(%ebp),%esi
+    8766:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+    8769:	39 d6                	cmp    %edx,%esi
+    876b:	73 2d                	jae    879a <memmove+0x3f>
+    876d:	8d 04 0e             	lea    (%esi,%ecx,1),%eax
+    8770:	39 c2                	cmp    %eax,%edx
+    8772:	73 26                	jae    879a <memmove+0x3f>
+		s += n;
+		d += n;
+    8774:	8d 3c 0a             	lea    (%edx,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+    8777:	89 c6                	mov    %eax,%esi
+    8779:	09 fe                	or     %edi,%esi
+    877b:	09 ce                	or     %ecx,%esi
+    877d:	83 e6 03             	and    $0x3,%esi
+    8780:	75 0e                	jne    8790 <memmove+0x35>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+    8782:	83 ef 04             	sub    $0x4,%edi
+    8785:	8d 70 fc             	lea    -0x4(%eax),%esi
+    8788:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+    878b:	fd                   	std
+    878c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    878e:	eb 07                	jmp    8797 <memmove+0x3c>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+    8790:	4f                   	dec    %edi
+    8791:	8d 70 ff             	lea    -0x1(%eax),%esi
+			asm volatile("std; rep movsb\n"
+    8794:	fd                   	std
+    8795:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+    8797:	fc                   	cld
+    8798:	eb 19                	jmp    87b3 <memmove+0x58>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+    879a:	89 f0                	mov    %esi,%eax
+    879c:	09 d0                	or     %edx,%eax
+    879e:	09 c8                	or     %ecx,%eax
+    87a0:	a8 03                	test   $0x3,%al
+    87a2:	75 0a                	jne    87ae <memmove+0x53>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+    87a4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+    87a7:	89 d7                	mov    %edx,%edi
+    87a9:	fc                   	cld
+    87aa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    87ac:	eb 05                	jmp    87b3 <memmove+0x58>
+		else
+			asm volatile("cld; rep movsb\n"
+    87ae:	89 d7                	mov    %edx,%edi
+    87b0:	fc                   	cld
+    87b1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+    87b3:	5e                   	pop    %esi
+    87b4:	89 d0                	mov    %edx,%eax
+    87b6:	5f                   	pop    %edi
+    87b7:	5d                   	pop    %ebp
+    87b8:	c3                   	ret
+
+000087b9 <memcpy>:
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+	return memmove(dst, src, n);
+    87b9:	eb a0                	jmp    875b <memmove>
+
+000087bb <memcmp>:
+}
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+    87bb:	55                   	push   %ebp
+    87bc:	89 e5                	mov    %esp,%ebp
+    87be:	56                   	push   %esi
+    87bf:	53                   	push   %ebx
+    87c0:	8b 55 08             	mov    0x8(%ebp),%edx
+    87c3:	8b 75 10             	mov    0x10(%ebp),%esi
+    87c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    87c9:	01 d6                	add    %edx,%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+    87cb:	39 f2                	cmp    %esi,%edx
+    87cd:	74 12                	je     87e1 <memcmp+0x26>
+		if (*s1 != *s2)
+    87cf:	0f b6 02             	movzbl (%edx),%eax
+    87d2:	0f b6 0b             	movzbl (%ebx),%ecx
+    87d5:	38 c8                	cmp    %cl,%al
+    87d7:	74 04                	je     87dd <memcmp+0x22>
+			return (int) *s1 - (int) *s2;
+    87d9:	29 c8                	sub    %ecx,%eax
+    87db:	eb 06                	jmp    87e3 <memcmp+0x28>
+		s1++, s2++;
+    87dd:	42                   	inc    %edx
+    87de:	43                   	inc    %ebx
+    87df:	eb ea                	jmp    87cb <memcmp+0x10>
+	}
+
+	return 0;
+    87e1:	31 c0                	xor    %eax,%eax
+}
+    87e3:	5b                   	pop    %ebx
+    87e4:	5e                   	pop    %esi
+    87e5:	5d                   	pop    %ebp
+    87e6:	c3                   	ret
+
+000087e7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+    87e7:	55                   	push   %ebp
+    87e8:	89 e5                	mov    %esp,%ebp
+    87ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	const void *ends = (const char *) s + n;
+    87ed:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    87f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+    87f3:	01 c2                	add    %eax,%edx
+	for (; s < ends; s++)
+    87f5:	39 d0                	cmp    %edx,%eax
+    87f7:	73 07                	jae    8800 <memfind+0x19>
+		if (*(const unsigned char *) s == (unsigned char) c)
+    87f9:	38 08                	cmp    %cl,(%eax)
+    87fb:	74 03                	je     8800 <memfind+0x19>
+	for (; s < ends; s++)
+    87fd:	40                   	inc    %eax
+    87fe:	eb f5                	jmp    87f5 <memfind+0xe>
+			break;
+	return (void *) s;
+}
+    8800:	5d                   	pop    %ebp
+    8801:	c3                   	ret
+
+00008802 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+    8802:	55                   	push   %ebp
+    8803:	89 e5                	mov    %esp,%ebp
+    8805:	57                   	push   %edi
+    8806:	56                   	push   %esi
+    8807:	53                   	push   %ebx
+    8808:	56                   	push   %esi
+    8809:	8b 45 08             	mov    0x8(%ebp),%eax
+    880c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+    880f:	8a 10                	mov    (%eax),%dl
+    8811:	80 fa 20             	cmp    $0x20,%dl
+    8814:	75 03                	jne    8819 <strtol+0x17>
+		s++;
+    8816:	40                   	inc    %eax
+    8817:	eb f6                	jmp    880f <strtol+0xd>
+	while (*s == ' ' || *s == '\t')
+    8819:	80 fa 09             	cmp    $0x9,%dl
+    881c:	74 f8                	je     8816 <strtol+0x14>
+
+	// plus/minus sign
+	if (*s == '+')
+    881e:	80 fa 2b             	cmp    $0x2b,%dl
+    8821:	75 05                	jne    8828 <strtol+0x26>
+		s++;
+    8823:	40                   	inc    %eax
+	int neg = 0;
+    8824:	31 f6                	xor    %esi,%esi
+    8826:	eb 0d                	jmp    8835 <strtol+0x33>
+    8828:	31 f6                	xor    %esi,%esi
+	else if (*s == '-')
+    882a:	80 fa 2d             	cmp    $0x2d,%dl
+    882d:	75 06                	jne    8835 <strtol+0x33>
+		s++, neg = 1;
+    882f:	40                   	inc    %eax
+    8830:	be 01 00 00 00       	mov    $0x1,%esi
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+    8835:	8a 10                	mov    (%eax),%dl
+    8837:	f7 c1 ef ff ff ff    	test   $0xffffffef,%ecx
+    883d:	75 2c                	jne    886b <strtol+0x69>
+    883f:	80 fa 30             	cmp    $0x30,%dl
+    8842:	75 17                	jne    885b <strtol+0x59>
+    8844:	80 78 01 78          	cmpb   $0x78,0x1(%eax)
+    8848:	75 05                	jne    884f <strtol+0x4d>
+		s += 2, base = 16;
+    884a:	83 c0 02             	add    $0x2,%eax
+    884d:	eb 17                	jmp    8866 <strtol+0x64>
+	else if (base == 0 && s[0] == '0')
+    884f:	85 c9                	test   %ecx,%ecx
+    8851:	75 13                	jne    8866 <strtol+0x64>
+		s++, base = 8;
+    8853:	40                   	inc    %eax
+    8854:	b9 08 00 00 00       	mov    $0x8,%ecx
+    8859:	eb 10                	jmp    886b <strtol+0x69>
+	else if (base == 0 && s[0] == '0')
+    885b:	85 c9                	test   %ecx,%ecx
+    885d:	75 07                	jne    8866 <strtol+0x64>
+	else if (base == 0)
+		base = 10;
+    885f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    8864:	eb 05                	jmp    886b <strtol+0x69>
+	else if (base == 0 && s[0] == '0')
+    8866:	b9 10 00 00 00       	mov    $0x10,%ecx
+    886b:	31 db                	xor    %ebx,%ebx
+    886d:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+    8870:	8a 10                	mov    (%eax),%dl
+    8872:	8d 7a d0             	lea    -0x30(%edx),%edi
+    8875:	89 fb                	mov    %edi,%ebx
+    8877:	80 fb 09             	cmp    $0x9,%bl
+    887a:	77 05                	ja     8881 <strtol+0x7f>
+			dig = *s - '0';
+    887c:	0f be d3             	movsbl %bl,%edx
+    887f:	eb 1f                	jmp    88a0 <strtol+0x9e>
+		else if (*s >= 'a' && *s <= 'z')
+    8881:	8d 7a 9f             	lea    -0x61(%edx),%edi
+    8884:	89 fb                	mov    %edi,%ebx
+    8886:	80 fb 19             	cmp    $0x19,%bl
+    8889:	77 05                	ja     8890 <strtol+0x8e>
+			dig = *s - 'a' + 10;
+    888b:	83 ea 57             	sub    $0x57,%edx
+    888e:	eb 0d                	jmp    889d <strtol+0x9b>
+		else if (*s >= 'A' && *s <= 'Z')
+    8890:	8d 7a bf             	lea    -0x41(%edx),%edi
+    8893:	89 fb                	mov    %edi,%ebx
+    8895:	80 fb 19             	cmp    $0x19,%bl
+    8898:	77 19                	ja     88b3 <strtol+0xb1>
+			dig = *s - 'A' + 10;
+    889a:	83 ea 37             	sub    $0x37,%edx
+    889d:	0f be d2             	movsbl %dl,%edx
+		else
+			break;
+		if (dig >= base)
+    88a0:	39 ca                	cmp    %ecx,%edx
+    88a2:	7d 0f                	jge    88b3 <strtol+0xb1>
+			break;
+		s++, val = (val * base) + dig;
+    88a4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+    88a7:	40                   	inc    %eax
+    88a8:	0f af d9             	imul   %ecx,%ebx
+    88ab:	8d 3c 13             	lea    (%ebx,%edx,1),%edi
+    88ae:	89 7d f0             	mov    %edi,-0x10(%ebp)
+	while (1) {
+    88b1:	eb bd                	jmp    8870 <strtol+0x6e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+    88b3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    88b7:	74 05                	je     88be <strtol+0xbc>
+		*endptr = (char *) s;
+    88b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    88bc:	89 07                	mov    %eax,(%edi)
+	return (neg ? -val : val);
+    88be:	85 f6                	test   %esi,%esi
+    88c0:	74 03                	je     88c5 <strtol+0xc3>
+    88c2:	f7 5d f0             	negl   -0x10(%ebp)
+}
+    88c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    88c8:	5a                   	pop    %edx
+    88c9:	5b                   	pop    %ebx
+    88ca:	5e                   	pop    %esi
+    88cb:	5f                   	pop    %edi
+    88cc:	5d                   	pop    %ebp
+    88cd:	c3                   	ret
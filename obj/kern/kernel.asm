@@ -0,0 +1,10560 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+entry:
+	# A multiboot loader knows nothing of inc/bootinfo.h, so whatever
+	# lies at BOOTINFO is stale: invalidate it, which also makes
+	# i386_init clear the BSS itself.  Keep the loader's own info
+	# instead, for i386_detect_memory.
+	cmpl	$MULTIBOOT_BOOTLOADER_MAGIC, %eax
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+f010000c:	3d 02 b0 ad 2b       	cmp    $0x2badb002,%eax
+	jne	1f
+f0100011:	75 10                	jne    f0100023 <entry+0x17>
+	movl	$0, BOOTINFO
+f0100013:	c7 05 00 10 00 00 00 	movl   $0x0,0x1000
+f010001a:	00 00 00 
+	movl	%ebx, RELOC(multiboot_info)
+f010001d:	89 1d 00 e0 11 00    	mov    %ebx,0x11e000
+1:
+	# If our boot loader started us, add our arrival to its boot
+	# timeline (see inc/bootinfo.h).  Paging is still off, so
+	# BOOTINFO is addressed physically.
+	cmpl	$BOOTINFO_MAGIC, BOOTINFO
+f0100023:	81 3d 00 10 00 00 4a 	cmpl   $0x42534f4a,0x1000
+f010002a:	4f 53 42 
+	jne	2f
+f010002d:	75 36                	jne    f0100065 <entry+0x59>
+	movl	BOOTINFO+BI_NSTAMP, %ecx
+f010002f:	8b 0d 08 10 00 00    	mov    0x1008,%ecx
+	cmpl	$BI_MAXSTAMP, %ecx
+f0100035:	83 f9 20             	cmp    $0x20,%ecx
+	jae	2f
+f0100038:	73 2b                	jae    f0100065 <entry+0x59>
+	shll	$4, %ecx			# sizeof(struct Bootstamp)
+f010003a:	c1 e1 04             	shl    $0x4,%ecx
+	rdtsc
+f010003d:	0f 31                	rdtsc
+	movl	%eax, BOOTINFO+BI_STAMP(%ecx)
+f010003f:	89 81 10 10 00 00    	mov    %eax,0x1010(%ecx)
+	movl	%edx, BOOTINFO+BI_STAMP+4(%ecx)
+f0100045:	89 91 14 10 00 00    	mov    %edx,0x1014(%ecx)
+	movl	$BT_KERNEL, BOOTINFO+BI_STAMP+8(%ecx)
+f010004b:	c7 81 18 10 00 00 05 	movl   $0x5,0x1018(%ecx)
+f0100052:	00 00 00 
+	movl	$0, BOOTINFO+BI_STAMP+12(%ecx)
+f0100055:	c7 81 1c 10 00 00 00 	movl   $0x0,0x101c(%ecx)
+f010005c:	00 00 00 
+	incl	BOOTINFO+BI_NSTAMP
+f010005f:	ff 05 08 10 00 00    	incl   0x1008
+2:
+	movw	$0x1234,0x472			# warm boot
+f0100065:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f010006c:	34 12 
+	# 4MB region will be sufficient until we set up our real page
+	# table in mem_init in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f010006e:	b8 00 f0 11 00       	mov    $0x11f000,%eax
+	movl	%eax, %cr3
+f0100073:	0f 22 d8             	mov    %eax,%cr3
+	# entry_pgdir maps 4MB pages, which the kernel requires: turn on
+	# page size extensions.  Its kernel mapping is also global, which
+	# only matters if the CPU has global pages.
+	movl	$1, %eax
+f0100076:	b8 01 00 00 00       	mov    $0x1,%eax
+	cpuid
+f010007b:	0f a2                	cpuid
+	movl	%cr4, %eax
+f010007d:	0f 20 e0             	mov    %cr4,%eax
+	orl	$CR4_PSE, %eax
+f0100080:	83 c8 10             	or     $0x10,%eax
+	testl	$CPUID_PGE, %edx
+f0100083:	f7 c2 00 20 00 00    	test   $0x2000,%edx
+	jz	3f
+f0100089:	74 05                	je     f0100090 <entry+0x84>
+	orl	$CR4_PGE, %eax
+f010008b:	0d 80 00 00 00       	or     $0x80,%eax
+3:
+	movl	%eax, %cr4
+f0100090:	0f 22 e0             	mov    %eax,%cr4
+	# Turn on paging.
+	movl	%cr0, %eax
+f0100093:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100096:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f010009b:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f010009e:	b8 a5 00 10 f0       	mov    $0xf01000a5,%eax
+	jmp	*%eax
+f01000a3:	ff e0                	jmp    *%eax
+
+f01000a5 <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f01000a5:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f01000aa:	bc 00 e0 11 f0       	mov    $0xf011e000,%esp
+
+	# now to C code
+	call	i386_init
+f01000af:	e8 68 01 00 00       	call   f010021c <i386_init>
+
+f01000b4 <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f01000b4:	eb fe                	jmp    f01000b4 <spin>
+
+f01000b6 <boot_stamp>:
+static void
+boot_stamp(uint32_t stage)
+{
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO);
+
+	if (bi->bi_magic == BOOTINFO_MAGIC)
+f01000b6:	81 3d 00 10 00 f0 4a 	cmpl   $0x42534f4a,0xf0001000
+f01000bd:	4f 53 42 
+f01000c0:	74 01                	je     f01000c3 <boot_stamp+0xd>
+f01000c2:	c3                   	ret
+{
+f01000c3:	55                   	push   %ebp
+f01000c4:	89 e5                	mov    %esp,%ebp
+f01000c6:	53                   	push   %ebx
+f01000c7:	89 c1                	mov    %eax,%ecx
+static inline void
+bootinfo_stamp(struct Bootinfo *bi, uint32_t stage, uint32_t arg)
+{
+	struct Bootstamp *bs;
+
+	if (bi->bi_nstamp >= BI_MAXSTAMP)
+f01000c9:	8b 1d 08 10 00 f0    	mov    0xf0001008,%ebx
+f01000cf:	83 fb 1f             	cmp    $0x1f,%ebx
+f01000d2:	77 29                	ja     f01000fd <boot_stamp+0x47>
+		return;
+	bs = &bi->bi_stamp[bi->bi_nstamp++];
+f01000d4:	8d 43 01             	lea    0x1(%ebx),%eax
+f01000d7:	a3 08 10 00 f0       	mov    %eax,0xf0001008
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+f01000dc:	0f 31                	rdtsc
+f01000de:	c1 e3 04             	shl    $0x4,%ebx
+	bs->bs_tsc = read_tsc();
+f01000e1:	89 83 10 10 00 f0    	mov    %eax,-0xfffeff0(%ebx)
+f01000e7:	89 93 14 10 00 f0    	mov    %edx,-0xfffefec(%ebx)
+	bs->bs_stage = stage;
+f01000ed:	89 8b 18 10 00 f0    	mov    %ecx,-0xfffefe8(%ebx)
+	bs->bs_arg = arg;
+f01000f3:	c7 83 1c 10 00 f0 00 	movl   $0x0,-0xfffefe4(%ebx)
+f01000fa:	00 00 00 
+		bootinfo_stamp(bi, stage, 0);
+}
+f01000fd:	5b                   	pop    %ebx
+f01000fe:	5d                   	pop    %ebp
+f01000ff:	c3                   	ret
+
+f0100100 <test_backtrace>:
+{
+f0100100:	55                   	push   %ebp
+f0100101:	89 e5                	mov    %esp,%ebp
+f0100103:	56                   	push   %esi
+f0100104:	53                   	push   %ebx
+f0100105:	e8 cf 02 00 00       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010010a:	81 c3 ce 02 02 00    	add    $0x202ce,%ebx
+f0100110:	8b 75 08             	mov    0x8(%ebp),%esi
+	cprintf("entering test_backtrace %d\n", x);
+f0100113:	83 ec 08             	sub    $0x8,%esp
+f0100116:	56                   	push   %esi
+f0100117:	8d 83 88 52 fe ff    	lea    -0x1ad78(%ebx),%eax
+f010011d:	50                   	push   %eax
+f010011e:	e8 c1 38 00 00       	call   f01039e4 <cprintf>
+	if (x > 0)
+f0100123:	83 c4 10             	add    $0x10,%esp
+f0100126:	85 f6                	test   %esi,%esi
+f0100128:	7e 29                	jle    f0100153 <test_backtrace+0x53>
+		test_backtrace(x-1);
+f010012a:	83 ec 0c             	sub    $0xc,%esp
+f010012d:	8d 46 ff             	lea    -0x1(%esi),%eax
+f0100130:	50                   	push   %eax
+f0100131:	e8 ca ff ff ff       	call   f0100100 <test_backtrace>
+f0100136:	83 c4 10             	add    $0x10,%esp
+	cprintf("leaving test_backtrace %d\n", x);
+f0100139:	83 ec 08             	sub    $0x8,%esp
+f010013c:	56                   	push   %esi
+f010013d:	8d 83 a4 52 fe ff    	lea    -0x1ad5c(%ebx),%eax
+f0100143:	50                   	push   %eax
+f0100144:	e8 9b 38 00 00       	call   f01039e4 <cprintf>
+}
+f0100149:	83 c4 10             	add    $0x10,%esp
+f010014c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010014f:	5b                   	pop    %ebx
+f0100150:	5e                   	pop    %esi
+f0100151:	5d                   	pop    %ebp
+f0100152:	c3                   	ret
+		mon_backtrace(0, 0, 0);
+f0100153:	83 ec 04             	sub    $0x4,%esp
+f0100156:	6a 00                	push   $0x0
+f0100158:	6a 00                	push   $0x0
+f010015a:	6a 00                	push   $0x0
+f010015c:	e8 54 12 00 00       	call   f01013b5 <mon_backtrace>
+f0100161:	83 c4 10             	add    $0x10,%esp
+f0100164:	eb d3                	jmp    f0100139 <test_backtrace+0x39>
+
+f0100166 <mp_main>:
+}
+
+// Setup code for APs
+void
+mp_main(void)
+{
+f0100166:	55                   	push   %ebp
+f0100167:	89 e5                	mov    %esp,%ebp
+f0100169:	53                   	push   %ebx
+f010016a:	83 ec 04             	sub    $0x4,%esp
+f010016d:	e8 67 02 00 00       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100172:	81 c3 66 02 02 00    	add    $0x20266,%ebx
+	// mpentry.S has already switched us to kern_pgdir.
+	// Match the boot CPU's memory types before cprintf writes to
+	// the write-combining CGA mapping.
+	pat_init();
+f0100178:	e8 c9 1b 00 00       	call   f0101d46 <pat_init>
+	percpu_init();
+f010017d:	e8 a4 45 00 00       	call   f0104726 <percpu_init>
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f0100182:	e8 45 44 00 00       	call   f01045cc <cpunum>
+f0100187:	83 ec 08             	sub    $0x8,%esp
+f010018a:	50                   	push   %eax
+f010018b:	8d 83 bf 52 fe ff    	lea    -0x1ad41(%ebx),%eax
+f0100191:	50                   	push   %eax
+f0100192:	e8 4d 38 00 00       	call   f01039e4 <cprintf>
+
+	lapic_init();
+f0100197:	e8 f4 42 00 00       	call   f0104490 <lapic_init>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f010019c:	64 8b 15 00 00 00 00 	mov    %fs:0x0,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+f01001a3:	b8 01 00 00 00       	mov    $0x1,%eax
+f01001a8:	f0 87 42 08          	lock xchg %eax,0x8(%edx)
+		     : "+m" (*addr), "=a" (result)
+		     : "1" (newval)
+		     : "cc");
+	return result;
+f01001ac:	83 c4 10             	add    $0x10,%esp
+
+	// There is no scheduler yet, and only the boot CPU takes
+	// interrupts, so the AP just idles with interrupts off until
+	// something needs it.
+	for (;;)
+		asm volatile("hlt");
+f01001af:	f4                   	hlt
+f01001b0:	eb fd                	jmp    f01001af <mp_main+0x49>
+
+f01001b2 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f01001b2:	55                   	push   %ebp
+f01001b3:	89 e5                	mov    %esp,%ebp
+f01001b5:	56                   	push   %esi
+f01001b6:	53                   	push   %ebx
+f01001b7:	e8 1d 02 00 00       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01001bc:	81 c3 1c 02 02 00    	add    $0x2021c,%ebx
+	va_list ap;
+
+	if (panicstr)
+f01001c2:	83 bb 68 01 00 00 00 	cmpl   $0x0,0x168(%ebx)
+f01001c9:	74 0f                	je     f01001da <_panic+0x28>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f01001cb:	83 ec 0c             	sub    $0xc,%esp
+f01001ce:	6a 00                	push   $0x0
+f01001d0:	e8 91 13 00 00       	call   f0101566 <monitor>
+f01001d5:	83 c4 10             	add    $0x10,%esp
+f01001d8:	eb f1                	jmp    f01001cb <_panic+0x19>
+	panicstr = fmt;
+f01001da:	8b 45 10             	mov    0x10(%ebp),%eax
+f01001dd:	89 83 68 01 00 00    	mov    %eax,0x168(%ebx)
+	asm volatile("cli; cld");
+f01001e3:	fa                   	cli
+f01001e4:	fc                   	cld
+	va_start(ap, fmt);
+f01001e5:	8d 75 14             	lea    0x14(%ebp),%esi
+	cprintf("kernel panic at %s:%d: ", file, line);
+f01001e8:	83 ec 04             	sub    $0x4,%esp
+f01001eb:	ff 75 0c             	push   0xc(%ebp)
+f01001ee:	ff 75 08             	push   0x8(%ebp)
+f01001f1:	8d 83 d5 52 fe ff    	lea    -0x1ad2b(%ebx),%eax
+f01001f7:	50                   	push   %eax
+f01001f8:	e8 e7 37 00 00       	call   f01039e4 <cprintf>
+	vcprintf(fmt, ap);
+f01001fd:	83 c4 08             	add    $0x8,%esp
+f0100200:	56                   	push   %esi
+f0100201:	ff 75 10             	push   0x10(%ebp)
+f0100204:	e8 79 37 00 00       	call   f0103982 <vcprintf>
+	cprintf("\n");
+f0100209:	8d 83 5d 53 fe ff    	lea    -0x1aca3(%ebx),%eax
+f010020f:	89 04 24             	mov    %eax,(%esp)
+f0100212:	e8 cd 37 00 00       	call   f01039e4 <cprintf>
+f0100217:	83 c4 10             	add    $0x10,%esp
+f010021a:	eb af                	jmp    f01001cb <_panic+0x19>
+
+f010021c <i386_init>:
+{
+f010021c:	55                   	push   %ebp
+f010021d:	89 e5                	mov    %esp,%ebp
+f010021f:	57                   	push   %edi
+f0100220:	56                   	push   %esi
+f0100221:	53                   	push   %ebx
+f0100222:	83 ec 1c             	sub    $0x1c,%esp
+f0100225:	e8 af 01 00 00       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010022a:	81 c3 ae 01 02 00    	add    $0x201ae,%ebx
+	boot_stamp(BT_I386_INIT);
+f0100230:	b8 06 00 00 00       	mov    $0x6,%eax
+f0100235:	e8 7c fe ff ff       	call   f01000b6 <boot_stamp>
+	if (bi->bi_magic != BOOTINFO_MAGIC || !(bi->bi_flags & BI_BSS_ZEROED))
+f010023a:	81 3d 00 10 00 f0 4a 	cmpl   $0x42534f4a,0xf0001000
+f0100241:	4f 53 42 
+f0100244:	75 09                	jne    f010024f <i386_init+0x33>
+f0100246:	f6 05 04 10 00 f0 01 	testb  $0x1,0xf0001004
+f010024d:	75 1d                	jne    f010026c <i386_init+0x50>
+		memset(edata, 0, end - edata);
+f010024f:	83 ec 04             	sub    $0x4,%esp
+f0100252:	c7 c2 40 05 12 f0    	mov    $0xf0120540,%edx
+f0100258:	c7 c0 a0 1e 12 f0    	mov    $0xf0121ea0,%eax
+f010025e:	29 d0                	sub    %edx,%eax
+f0100260:	50                   	push   %eax
+f0100261:	6a 00                	push   $0x0
+f0100263:	52                   	push   %edx
+f0100264:	e8 ab 50 00 00       	call   f0105314 <memset>
+f0100269:	83 c4 10             	add    $0x10,%esp
+	cons_init();
+f010026c:	e8 2b 0e 00 00       	call   f010109c <cons_init>
+	boot_stamp(BT_CONS_INIT);
+f0100271:	b8 07 00 00 00       	mov    $0x7,%eax
+f0100276:	e8 3b fe ff ff       	call   f01000b6 <boot_stamp>
+	percpu_init();
+f010027b:	e8 a6 44 00 00       	call   f0104726 <percpu_init>
+	mem_init();
+f0100280:	e8 65 21 00 00       	call   f01023ea <mem_init>
+	kmem_init();
+f0100285:	e8 1a 30 00 00       	call   f01032a4 <kmem_init>
+	cga_map_wc();
+f010028a:	e8 69 0b 00 00       	call   f0100df8 <cga_map_wc>
+	mp_init();
+f010028f:	e8 73 3e 00 00       	call   f0104107 <mp_init>
+	lapic_init();
+f0100294:	e8 f7 41 00 00       	call   f0104490 <lapic_init>
+	mem_init_mp();
+f0100299:	e8 38 29 00 00       	call   f0102bd6 <mem_init_mp>
+	trap_init();
+f010029e:	e8 55 37 00 00       	call   f01039f8 <trap_init>
+	pic_init();
+f01002a3:	e8 d9 35 00 00       	call   f0103881 <pic_init>
+	serial_irq_init();
+f01002a8:	e8 e8 0a 00 00       	call   f0100d95 <serial_irq_init>
+	asm volatile("sti");
+f01002ad:	fb                   	sti
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f01002ae:	c7 c0 88 0e 12 f0    	mov    $0xf0120e88,%eax
+f01002b4:	83 38 07             	cmpl   $0x7,(%eax)
+f01002b7:	76 31                	jbe    f01002ea <i386_init+0xce>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f01002b9:	83 ec 04             	sub    $0x4,%esp
+f01002bc:	c7 c2 98 3f 10 f0    	mov    $0xf0103f98,%edx
+f01002c2:	c7 c0 42 40 10 f0    	mov    $0xf0104042,%eax
+f01002c8:	29 d0                	sub    %edx,%eax
+f01002ca:	50                   	push   %eax
+f01002cb:	52                   	push   %edx
+f01002cc:	68 00 70 00 f0       	push   $0xf0007000
+f01002d1:	e8 73 50 00 00       	call   f0105349 <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f01002d6:	83 c4 10             	add    $0x10,%esp
+f01002d9:	c7 c6 80 18 12 f0    	mov    $0xf0121880,%esi
+f01002df:	c7 c7 40 18 12 f0    	mov    $0xf0121840,%edi
+f01002e5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f01002e8:	eb 1d                	jmp    f0100307 <i386_init+0xeb>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01002ea:	68 00 70 00 00       	push   $0x7000
+f01002ef:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01002f5:	50                   	push   %eax
+f01002f6:	6a 71                	push   $0x71
+f01002f8:	8d 83 ed 52 fe ff    	lea    -0x1ad13(%ebx),%eax
+f01002fe:	50                   	push   %eax
+f01002ff:	e8 ae fe ff ff       	call   f01001b2 <_panic>
+f0100304:	83 c6 40             	add    $0x40,%esi
+f0100307:	8b 07                	mov    (%edi),%eax
+f0100309:	c1 e0 06             	shl    $0x6,%eax
+f010030c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010030f:	01 c8                	add    %ecx,%eax
+f0100311:	39 c6                	cmp    %eax,%esi
+f0100313:	73 41                	jae    f0100356 <i386_init+0x13a>
+		if (c == thiscpu)  // We've started already.
+f0100315:	64 a1 00 00 00 00    	mov    %fs:0x0,%eax
+f010031b:	39 f0                	cmp    %esi,%eax
+f010031d:	74 e5                	je     f0100304 <i386_init+0xe8>
+		mpentry_kstack = (void *) (KSTACKTOP - (c - cpus) * (KSTKSIZE + KSTKGAP));
+f010031f:	89 f2                	mov    %esi,%edx
+f0100321:	81 ea 80 18 12 f0    	sub    $0xf0121880,%edx
+f0100327:	c1 e2 0a             	shl    $0xa,%edx
+f010032a:	b8 00 00 00 f0       	mov    $0xf0000000,%eax
+f010032f:	29 d0                	sub    %edx,%eax
+f0100331:	89 83 6c 01 00 00    	mov    %eax,0x16c(%ebx)
+		lapic_startap(c->cpu_id, PADDR(code));
+f0100337:	83 ec 08             	sub    $0x8,%esp
+f010033a:	68 00 70 00 00       	push   $0x7000
+f010033f:	0f b6 46 04          	movzbl 0x4(%esi),%eax
+f0100343:	50                   	push   %eax
+f0100344:	e8 ce 42 00 00       	call   f0104617 <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f0100349:	83 c4 10             	add    $0x10,%esp
+f010034c:	8b 46 08             	mov    0x8(%esi),%eax
+f010034f:	83 f8 01             	cmp    $0x1,%eax
+f0100352:	75 f8                	jne    f010034c <i386_init+0x130>
+f0100354:	eb ae                	jmp    f0100304 <i386_init+0xe8>
+	ramdisk_init();
+f0100356:	e8 ec 3a 00 00       	call   f0103e47 <ramdisk_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f010035b:	83 ec 08             	sub    $0x8,%esp
+f010035e:	68 ac 1a 00 00       	push   $0x1aac
+f0100363:	8d 83 f9 52 fe ff    	lea    -0x1ad07(%ebx),%eax
+f0100369:	50                   	push   %eax
+f010036a:	e8 75 36 00 00       	call   f01039e4 <cprintf>
+	test_backtrace(5);
+f010036f:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+f0100376:	e8 85 fd ff ff       	call   f0100100 <test_backtrace>
+f010037b:	83 c4 10             	add    $0x10,%esp
+		monitor(NULL);
+f010037e:	83 ec 0c             	sub    $0xc,%esp
+f0100381:	6a 00                	push   $0x0
+f0100383:	e8 de 11 00 00       	call   f0101566 <monitor>
+f0100388:	83 c4 10             	add    $0x10,%esp
+f010038b:	eb f1                	jmp    f010037e <i386_init+0x162>
+
+f010038d <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f010038d:	55                   	push   %ebp
+f010038e:	89 e5                	mov    %esp,%ebp
+f0100390:	56                   	push   %esi
+f0100391:	53                   	push   %ebx
+f0100392:	e8 42 00 00 00       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100397:	81 c3 41 00 02 00    	add    $0x20041,%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+f010039d:	8d 75 14             	lea    0x14(%ebp),%esi
+	cprintf("kernel warning at %s:%d: ", file, line);
+f01003a0:	83 ec 04             	sub    $0x4,%esp
+f01003a3:	ff 75 0c             	push   0xc(%ebp)
+f01003a6:	ff 75 08             	push   0x8(%ebp)
+f01003a9:	8d 83 14 53 fe ff    	lea    -0x1acec(%ebx),%eax
+f01003af:	50                   	push   %eax
+f01003b0:	e8 2f 36 00 00       	call   f01039e4 <cprintf>
+	vcprintf(fmt, ap);
+f01003b5:	83 c4 08             	add    $0x8,%esp
+f01003b8:	56                   	push   %esi
+f01003b9:	ff 75 10             	push   0x10(%ebp)
+f01003bc:	e8 c1 35 00 00       	call   f0103982 <vcprintf>
+	cprintf("\n");
+f01003c1:	8d 83 5d 53 fe ff    	lea    -0x1aca3(%ebx),%eax
+f01003c7:	89 04 24             	mov    %eax,(%esp)
+f01003ca:	e8 15 36 00 00       	call   f01039e4 <cprintf>
+	va_end(ap);
+}
+f01003cf:	83 c4 10             	add    $0x10,%esp
+f01003d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01003d5:	5b                   	pop    %ebx
+f01003d6:	5e                   	pop    %esi
+f01003d7:	5d                   	pop    %ebp
+f01003d8:	c3                   	ret
+
+f01003d9 <__x86.get_pc_thunk.bx>:
+f01003d9:	8b 1c 24             	mov    (%esp),%ebx
+f01003dc:	c3                   	ret
+
+f01003dd <serial_proc_data>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01003dd:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01003e2:	ec                   	in     (%dx),%al
+extern const char *panicstr;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f01003e3:	a8 01                	test   $0x1,%al
+f01003e5:	74 0a                	je     f01003f1 <serial_proc_data+0x14>
+f01003e7:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01003ec:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f01003ed:	0f b6 c0             	movzbl %al,%eax
+f01003f0:	c3                   	ret
+		return -1;
+f01003f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f01003f6:	c3                   	ret
+
+f01003f7 <serial_txwait>:
+
+// Wait, for a bounded time, for the transmitter to empty.
+static void
+serial_txwait(void)
+{
+f01003f7:	55                   	push   %ebp
+f01003f8:	89 e5                	mov    %esp,%ebp
+f01003fa:	56                   	push   %esi
+f01003fb:	53                   	push   %ebx
+	int i;
+
+	for (i = 0;
+f01003fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100401:	be fd 03 00 00       	mov    $0x3fd,%esi
+f0100406:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010040b:	89 f2                	mov    %esi,%edx
+f010040d:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f010040e:	a8 20                	test   $0x20,%al
+f0100410:	75 13                	jne    f0100425 <serial_txwait+0x2e>
+f0100412:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100418:	7f 0b                	jg     f0100425 <serial_txwait+0x2e>
+f010041a:	89 ca                	mov    %ecx,%edx
+f010041c:	ec                   	in     (%dx),%al
+f010041d:	ec                   	in     (%dx),%al
+f010041e:	ec                   	in     (%dx),%al
+f010041f:	ec                   	in     (%dx),%al
+	     i++)
+f0100420:	83 c3 01             	add    $0x1,%ebx
+f0100423:	eb e6                	jmp    f010040b <serial_txwait+0x14>
+		delay();
+}
+f0100425:	5b                   	pop    %ebx
+f0100426:	5e                   	pop    %esi
+f0100427:	5d                   	pop    %ebp
+f0100428:	c3                   	ret
+
+f0100429 <serial_txfill>:
+
+// If the transmitter is empty, refill it with a burst from the ring,
+// and stop asking for transmitter interrupts once the ring is empty.
+static void
+serial_txfill(void)
+{
+f0100429:	55                   	push   %ebp
+f010042a:	89 e5                	mov    %esp,%ebp
+f010042c:	57                   	push   %edi
+f010042d:	56                   	push   %esi
+f010042e:	53                   	push   %ebx
+f010042f:	83 ec 0c             	sub    $0xc,%esp
+f0100432:	e8 f6 0c 00 00       	call   f010112d <__x86.get_pc_thunk.si>
+f0100437:	81 c6 a1 ff 01 00    	add    $0x1ffa1,%esi
+f010043d:	89 75 ec             	mov    %esi,-0x14(%ebp)
+f0100440:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100445:	ec                   	in     (%dx),%al
+	int i;
+
+	if (!(inb(COM1 + COM_LSR) & COM_LSR_TXRDY))
+f0100446:	a8 20                	test   $0x20,%al
+f0100448:	74 6a                	je     f01004b4 <serial_txfill+0x8b>
+		return;
+	for (i = 0; i < serial_txburst && serial_tx.rpos != serial_tx.wpos; i++)
+f010044a:	8b be 28 ff ff ff    	mov    -0xd8(%esi),%edi
+f0100450:	89 7d f0             	mov    %edi,-0x10(%ebp)
+f0100453:	8b 9e ec 07 00 00    	mov    0x7ec(%esi),%ebx
+f0100459:	89 5d e8             	mov    %ebx,-0x18(%ebp)
+f010045c:	8b be e8 07 00 00    	mov    0x7e8(%esi),%edi
+f0100462:	29 fb                	sub    %edi,%ebx
+f0100464:	ba 00 00 00 00       	mov    $0x0,%edx
+f0100469:	b9 00 00 00 00       	mov    $0x0,%ecx
+		outb(COM1 + COM_TX,
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+f010046e:	8d b6 e8 03 00 00    	lea    0x3e8(%esi),%esi
+f0100474:	8d 04 39             	lea    (%ecx,%edi,1),%eax
+	for (i = 0; i < serial_txburst && serial_tx.rpos != serial_tx.wpos; i++)
+f0100477:	39 4d f0             	cmp    %ecx,-0x10(%ebp)
+f010047a:	7e 1d                	jle    f0100499 <serial_txfill+0x70>
+f010047c:	39 d9                	cmp    %ebx,%ecx
+f010047e:	74 3c                	je     f01004bc <serial_txfill+0x93>
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+f0100480:	25 ff 03 00 00       	and    $0x3ff,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100485:	0f b6 04 06          	movzbl (%esi,%eax,1),%eax
+f0100489:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010048e:	ee                   	out    %al,(%dx)
+	for (i = 0; i < serial_txburst && serial_tx.rpos != serial_tx.wpos; i++)
+f010048f:	83 c1 01             	add    $0x1,%ecx
+f0100492:	ba 01 00 00 00       	mov    $0x1,%edx
+f0100497:	eb db                	jmp    f0100474 <serial_txfill+0x4b>
+f0100499:	84 d2                	test   %dl,%dl
+f010049b:	74 09                	je     f01004a6 <serial_txfill+0x7d>
+f010049d:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f01004a0:	89 87 e8 07 00 00    	mov    %eax,0x7e8(%edi)
+	if (serial_tx.rpos == serial_tx.wpos)
+f01004a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f01004a9:	8b 7d e8             	mov    -0x18(%ebp),%edi
+f01004ac:	3b b8 e8 07 00 00    	cmp    0x7e8(%eax),%edi
+f01004b2:	74 17                	je     f01004cb <serial_txfill+0xa2>
+		outb(COM1 + COM_IER, COM_IER_RDI);
+}
+f01004b4:	83 c4 0c             	add    $0xc,%esp
+f01004b7:	5b                   	pop    %ebx
+f01004b8:	5e                   	pop    %esi
+f01004b9:	5f                   	pop    %edi
+f01004ba:	5d                   	pop    %ebp
+f01004bb:	c3                   	ret
+f01004bc:	84 d2                	test   %dl,%dl
+f01004be:	74 e6                	je     f01004a6 <serial_txfill+0x7d>
+f01004c0:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f01004c3:	89 87 e8 07 00 00    	mov    %eax,0x7e8(%edi)
+f01004c9:	eb db                	jmp    f01004a6 <serial_txfill+0x7d>
+f01004cb:	b8 01 00 00 00       	mov    $0x1,%eax
+f01004d0:	ba f9 03 00 00       	mov    $0x3f9,%edx
+f01004d5:	ee                   	out    %al,(%dx)
+}
+f01004d6:	eb dc                	jmp    f01004b4 <serial_txfill+0x8b>
+
+f01004d8 <serial_write_sync>:
+// FIFOs on, its whole transmit FIFO) empty, there is room for a full
+// burst, so only poll the line status once per burst.  Anything still
+// in the ring goes first, to keep output in order.
+static void
+serial_write_sync(const char *s, size_t n)
+{
+f01004d8:	55                   	push   %ebp
+f01004d9:	89 e5                	mov    %esp,%ebp
+f01004db:	57                   	push   %edi
+f01004dc:	56                   	push   %esi
+f01004dd:	53                   	push   %ebx
+f01004de:	83 ec 1c             	sub    $0x1c,%esp
+f01004e1:	e8 4b 0c 00 00       	call   f0101131 <__x86.get_pc_thunk.di>
+f01004e6:	81 c7 f2 fe 01 00    	add    $0x1fef2,%edi
+f01004ec:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f01004ef:	89 c3                	mov    %eax,%ebx
+f01004f1:	89 d6                	mov    %edx,%esi
+	int i;
+
+	while (serial_tx.rpos != serial_tx.wpos) {
+f01004f3:	8d 3d e8 03 00 00    	lea    0x3e8,%edi
+f01004f9:	eb 0a                	jmp    f0100505 <serial_write_sync+0x2d>
+		serial_txwait();
+f01004fb:	e8 f7 fe ff ff       	call   f01003f7 <serial_txwait>
+		serial_txfill();
+f0100500:	e8 24 ff ff ff       	call   f0100429 <serial_txfill>
+	while (serial_tx.rpos != serial_tx.wpos) {
+f0100505:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100508:	8b 94 07 04 04 00 00 	mov    0x404(%edi,%eax,1),%edx
+f010050f:	39 94 07 00 04 00 00 	cmp    %edx,0x400(%edi,%eax,1)
+f0100516:	75 e3                	jne    f01004fb <serial_write_sync+0x23>
+f0100518:	eb 02                	jmp    f010051c <serial_write_sync+0x44>
+f010051a:	89 ce                	mov    %ecx,%esi
+	}
+
+	while (n > 0) {
+f010051c:	85 f6                	test   %esi,%esi
+f010051e:	74 2e                	je     f010054e <serial_write_sync+0x76>
+		serial_txwait();
+f0100520:	e8 d2 fe ff ff       	call   f01003f7 <serial_txwait>
+		for (i = 0; i < serial_txburst && n > 0; i++, n--)
+f0100525:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100528:	8b b8 28 ff ff ff    	mov    -0xd8(%eax),%edi
+f010052e:	89 f1                	mov    %esi,%ecx
+f0100530:	89 f0                	mov    %esi,%eax
+f0100532:	29 c8                	sub    %ecx,%eax
+f0100534:	39 c7                	cmp    %eax,%edi
+f0100536:	7e e2                	jle    f010051a <serial_write_sync+0x42>
+f0100538:	85 c9                	test   %ecx,%ecx
+f010053a:	74 de                	je     f010051a <serial_write_sync+0x42>
+			outb(COM1 + COM_TX, *s++);
+f010053c:	83 c3 01             	add    $0x1,%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010053f:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+f0100543:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100548:	ee                   	out    %al,(%dx)
+		for (i = 0; i < serial_txburst && n > 0; i++, n--)
+f0100549:	83 e9 01             	sub    $0x1,%ecx
+f010054c:	eb e2                	jmp    f0100530 <serial_write_sync+0x58>
+	}
+}
+f010054e:	83 c4 1c             	add    $0x1c,%esp
+f0100551:	5b                   	pop    %ebx
+f0100552:	5e                   	pop    %esi
+f0100553:	5f                   	pop    %edi
+f0100554:	5d                   	pop    %ebp
+f0100555:	c3                   	ret
+
+f0100556 <serial_init>:
+	return true;
+}
+
+static bool
+serial_init(void)
+{
+f0100556:	55                   	push   %ebp
+f0100557:	89 e5                	mov    %esp,%ebp
+f0100559:	57                   	push   %edi
+f010055a:	56                   	push   %esi
+f010055b:	53                   	push   %ebx
+f010055c:	e8 c8 0b 00 00       	call   f0101129 <__x86.get_pc_thunk.cx>
+f0100561:	81 c1 77 fe 01 00    	add    $0x1fe77,%ecx
+f0100567:	b8 c7 ff ff ff       	mov    $0xffffffc7,%eax
+f010056c:	ba fa 03 00 00       	mov    $0x3fa,%edx
+f0100571:	ee                   	out    %al,(%dx)
+f0100572:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100577:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f010057c:	89 fa                	mov    %edi,%edx
+f010057e:	ee                   	out    %al,(%dx)
+f010057f:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100584:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100589:	ee                   	out    %al,(%dx)
+f010058a:	be 00 00 00 00       	mov    $0x0,%esi
+f010058f:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+f0100594:	89 f0                	mov    %esi,%eax
+f0100596:	89 da                	mov    %ebx,%edx
+f0100598:	ee                   	out    %al,(%dx)
+f0100599:	b8 03 00 00 00       	mov    $0x3,%eax
+f010059e:	89 fa                	mov    %edi,%edx
+f01005a0:	ee                   	out    %al,(%dx)
+f01005a1:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f01005a6:	89 f0                	mov    %esi,%eax
+f01005a8:	ee                   	out    %al,(%dx)
+f01005a9:	b8 01 00 00 00       	mov    $0x1,%eax
+f01005ae:	89 da                	mov    %ebx,%edx
+f01005b0:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01005b1:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01005b6:	ec                   	in     (%dx),%al
+	// Enable rcv interrupts
+	outb(COM1+COM_IER, COM_IER_RDI);
+
+	// Clear any preexisting overrun indications and interrupts
+	// Serial port doesn't exist if COM_LSR returns 0xFF
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f01005b7:	3c ff                	cmp    $0xff,%al
+f01005b9:	0f 95 c3             	setne  %bl
+f01005bc:	88 99 f0 07 00 00    	mov    %bl,0x7f0(%ecx)
+f01005c2:	ba fa 03 00 00       	mov    $0x3fa,%edx
+f01005c7:	ec                   	in     (%dx),%al
+	// Older UARTs have no FIFO and take one byte at a time
+	if ((inb(COM1+COM_IIR) & COM_IIR_FIFO) == COM_IIR_FIFO)
+f01005c8:	83 e0 c0             	and    $0xffffffc0,%eax
+		serial_txburst = COM_FIFOSIZE;
+f01005cb:	3c c0                	cmp    $0xc0,%al
+f01005cd:	b8 01 00 00 00       	mov    $0x1,%eax
+f01005d2:	ba 10 00 00 00       	mov    $0x10,%edx
+f01005d7:	0f 44 c2             	cmove  %edx,%eax
+f01005da:	89 81 28 ff ff ff    	mov    %eax,-0xd8(%ecx)
+f01005e0:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01005e5:	ec                   	in     (%dx),%al
+	else
+		serial_txburst = 1;
+	(void) inb(COM1+COM_RX);
+
+	return serial_exists;
+}
+f01005e6:	89 d8                	mov    %ebx,%eax
+f01005e8:	5b                   	pop    %ebx
+f01005e9:	5e                   	pop    %esi
+f01005ea:	5f                   	pop    %edi
+f01005eb:	5d                   	pop    %ebp
+f01005ec:	c3                   	ret
+
+f01005ed <lpt_init>:
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01005ed:	ba 78 03 00 00       	mov    $0x378,%edx
+f01005f2:	b8 a5 ff ff ff       	mov    $0xffffffa5,%eax
+f01005f7:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01005f8:	ec                   	in     (%dx),%al
+static bool
+lpt_init(void)
+{
+	outb(LPT1+LPT_DATA, 0xA5);
+	if (inb(LPT1+LPT_DATA) != 0xA5 || inb(LPT1+LPT_STATUS) == 0xFF)
+		return false;
+f01005f9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (inb(LPT1+LPT_DATA) != 0xA5 || inb(LPT1+LPT_STATUS) == 0xFF)
+f01005fe:	3c a5                	cmp    $0xa5,%al
+f0100600:	75 1f                	jne    f0100621 <lpt_init+0x34>
+f0100602:	ba 79 03 00 00       	mov    $0x379,%edx
+f0100607:	ec                   	in     (%dx),%al
+		return false;
+f0100608:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (inb(LPT1+LPT_DATA) != 0xA5 || inb(LPT1+LPT_STATUS) == 0xFF)
+f010060d:	3c ff                	cmp    $0xff,%al
+f010060f:	74 10                	je     f0100621 <lpt_init+0x34>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100611:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100616:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f010061b:	ee                   	out    %al,(%dx)
+	outb(LPT1+LPT_CTRL, LPT_CTRL_SELECT);
+	return true;
+f010061c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+f0100621:	89 d0                	mov    %edx,%eax
+f0100623:	c3                   	ret
+
+f0100624 <cga_init>:
+static uint16_t crt_pos;
+static uint16_t *crt_shown;	// crt_buf as the CRTC last saw it
+
+static bool
+cga_init(void)
+{
+f0100624:	55                   	push   %ebp
+f0100625:	89 e5                	mov    %esp,%ebp
+f0100627:	57                   	push   %edi
+f0100628:	56                   	push   %esi
+f0100629:	53                   	push   %ebx
+f010062a:	83 ec 0c             	sub    $0xc,%esp
+f010062d:	e8 ff 0a 00 00       	call   f0101131 <__x86.get_pc_thunk.di>
+f0100632:	81 c7 a6 fd 01 00    	add    $0x1fda6,%edi
+	volatile uint16_t *cp;
+	uint16_t was;
+	unsigned pos, start;
+
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+	was = *cp;
+f0100638:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f010063f:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f0100646:	5a a5 
+	if (*cp != 0xA55A) {
+f0100648:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f010064f:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f0100653:	0f 84 81 00 00 00    	je     f01006da <cga_init+0xb6>
+f0100659:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+f010065e:	c7 45 ec d0 07 00 00 	movl   $0x7d0,-0x14(%ebp)
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f0100665:	c7 45 e8 00 00 0b f0 	movl   $0xf00b0000,-0x18(%ebp)
+		addr_6845 = MONO_BASE;
+f010066c:	89 9f c4 03 00 00    	mov    %ebx,0x3c4(%edi)
+		// A real MDA has only one screen of text memory.
+		crt_ncells = CRT_SIZE;
+f0100672:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0100675:	89 87 bc 03 00 00    	mov    %eax,0x3bc(%edi)
+		addr_6845 = CGA_BASE;
+		crt_ncells = CGA_BUFSIZE / sizeof(uint16_t);
+	}
+
+	/* Extract screen start and cursor location */
+	outb(addr_6845, 12);
+f010067b:	89 d9                	mov    %ebx,%ecx
+f010067d:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100682:	89 da                	mov    %ebx,%edx
+f0100684:	ee                   	out    %al,(%dx)
+	start = inb(addr_6845 + 1) << 8;
+f0100685:	83 c3 01             	add    $0x1,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100688:	89 da                	mov    %ebx,%edx
+f010068a:	ec                   	in     (%dx),%al
+f010068b:	0f b6 f0             	movzbl %al,%esi
+f010068e:	c1 e6 08             	shl    $0x8,%esi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100691:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100696:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0100699:	89 ca                	mov    %ecx,%edx
+f010069b:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010069c:	89 da                	mov    %ebx,%edx
+f010069e:	ec                   	in     (%dx),%al
+	outb(addr_6845, 13);
+	start |= inb(addr_6845 + 1);
+f010069f:	0f b6 c8             	movzbl %al,%ecx
+f01006a2:	09 f1                	or     %esi,%ecx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01006a9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f01006ac:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006ad:	89 da                	mov    %ebx,%edx
+f01006af:	ec                   	in     (%dx),%al
+	outb(addr_6845, 14);
+	pos = inb(addr_6845 + 1) << 8;
+f01006b0:	0f b6 c0             	movzbl %al,%eax
+f01006b3:	89 c6                	mov    %eax,%esi
+f01006b5:	c1 e6 08             	shl    $0x8,%esi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01006bd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f01006c0:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006c1:	89 da                	mov    %ebx,%edx
+f01006c3:	ec                   	in     (%dx),%al
+	outb(addr_6845, 15);
+	pos |= inb(addr_6845 + 1);
+f01006c4:	0f b6 c0             	movzbl %al,%eax
+f01006c7:	09 c6                	or     %eax,%esi
+
+	// Keep the screen and cursor the BIOS left, as long as they make
+	// sense; otherwise show the start of text memory, and put the
+	// cursor on the bottom row if it is not on the screen.
+	if (start + CRT_SIZE > crt_ncells)
+f01006c9:	8d 81 d0 07 00 00    	lea    0x7d0(%ecx),%eax
+f01006cf:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+f01006d2:	72 25                	jb     f01006f9 <cga_init+0xd5>
+		start = 0;
+	if (pos < start || pos - start >= CRT_SIZE)
+f01006d4:	39 ce                	cmp    %ecx,%esi
+f01006d6:	72 31                	jb     f0100709 <cga_init+0xe5>
+f01006d8:	eb 24                	jmp    f01006fe <cga_init+0xda>
+		*cp = was;
+f01006da:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f01006e1:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+f01006e6:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f01006ed:	c7 45 e8 00 80 0b f0 	movl   $0xf00b8000,-0x18(%ebp)
+f01006f4:	e9 73 ff ff ff       	jmp    f010066c <cga_init+0x48>
+		start = 0;
+f01006f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (pos < start || pos - start >= CRT_SIZE)
+f01006fe:	89 f0                	mov    %esi,%eax
+f0100700:	29 c8                	sub    %ecx,%eax
+f0100702:	3d cf 07 00 00       	cmp    $0x7cf,%eax
+f0100707:	76 06                	jbe    f010070f <cga_init+0xeb>
+		pos = start + CRT_SIZE - CRT_COLS;
+f0100709:	8d b1 80 07 00 00    	lea    0x780(%ecx),%esi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010070f:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100714:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0100717:	ee                   	out    %al,(%dx)
+	outb(addr_6845, 12);
+	outb(addr_6845 + 1, start >> 8);
+f0100718:	89 c8                	mov    %ecx,%eax
+f010071a:	c1 e8 08             	shr    $0x8,%eax
+f010071d:	89 da                	mov    %ebx,%edx
+f010071f:	ee                   	out    %al,(%dx)
+f0100720:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100725:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0100728:	ee                   	out    %al,(%dx)
+f0100729:	89 c8                	mov    %ecx,%eax
+f010072b:	89 da                	mov    %ebx,%edx
+f010072d:	ee                   	out    %al,(%dx)
+	outb(addr_6845, 13);
+	outb(addr_6845 + 1, start);
+
+	crt_base = (uint16_t*) cp;
+f010072e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+f0100731:	89 87 c0 03 00 00    	mov    %eax,0x3c0(%edi)
+	crt_buf = crt_shown = crt_base + start;
+f0100737:	8d 04 48             	lea    (%eax,%ecx,2),%eax
+f010073a:	89 87 b0 03 00 00    	mov    %eax,0x3b0(%edi)
+f0100740:	89 87 b8 03 00 00    	mov    %eax,0x3b8(%edi)
+	crt_pos = pos - start;
+f0100746:	29 ce                	sub    %ecx,%esi
+f0100748:	66 89 b7 b4 03 00 00 	mov    %si,0x3b4(%edi)
+	return true;
+}
+f010074f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100754:	83 c4 0c             	add    $0xc,%esp
+f0100757:	5b                   	pop    %ebx
+f0100758:	5e                   	pop    %esi
+f0100759:	5f                   	pop    %edi
+f010075a:	5d                   	pop    %ebp
+f010075b:	c3                   	ret
+
+f010075c <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f010075c:	55                   	push   %ebp
+f010075d:	89 e5                	mov    %esp,%ebp
+f010075f:	57                   	push   %edi
+f0100760:	56                   	push   %esi
+f0100761:	53                   	push   %ebx
+f0100762:	83 ec 1c             	sub    $0x1c,%esp
+f0100765:	e8 c3 09 00 00       	call   f010112d <__x86.get_pc_thunk.si>
+f010076a:	81 c6 6e fc 01 00    	add    $0x1fc6e,%esi
+f0100770:	89 c7                	mov    %eax,%edi
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f0100772:	8d 1d a8 01 00 00    	lea    0x1a8,%ebx
+f0100778:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+f010077b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010077e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+	while ((c = (*proc)()) != -1) {
+f0100781:	eb 25                	jmp    f01007a8 <cons_intr+0x4c>
+		cons.buf[cons.wpos++] = c;
+f0100783:	8b 8c 1e 04 02 00 00 	mov    0x204(%esi,%ebx,1),%ecx
+f010078a:	8d 51 01             	lea    0x1(%ecx),%edx
+f010078d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0100790:	88 04 0f             	mov    %al,(%edi,%ecx,1)
+		if (cons.wpos == CONSBUFSIZE)
+f0100793:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f0100799:	b8 00 00 00 00       	mov    $0x0,%eax
+f010079e:	0f 44 d0             	cmove  %eax,%edx
+f01007a1:	89 94 1e 04 02 00 00 	mov    %edx,0x204(%esi,%ebx,1)
+	while ((c = (*proc)()) != -1) {
+f01007a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01007ab:	ff d0                	call   *%eax
+f01007ad:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01007b0:	74 06                	je     f01007b8 <cons_intr+0x5c>
+		if (c == 0)
+f01007b2:	85 c0                	test   %eax,%eax
+f01007b4:	75 cd                	jne    f0100783 <cons_intr+0x27>
+f01007b6:	eb f0                	jmp    f01007a8 <cons_intr+0x4c>
+	}
+}
+f01007b8:	83 c4 1c             	add    $0x1c,%esp
+f01007bb:	5b                   	pop    %ebx
+f01007bc:	5e                   	pop    %esi
+f01007bd:	5f                   	pop    %edi
+f01007be:	5d                   	pop    %ebp
+f01007bf:	c3                   	ret
+
+f01007c0 <serial_write>:
+{
+f01007c0:	55                   	push   %ebp
+f01007c1:	89 e5                	mov    %esp,%ebp
+f01007c3:	57                   	push   %edi
+f01007c4:	56                   	push   %esi
+f01007c5:	53                   	push   %ebx
+f01007c6:	83 ec 2c             	sub    $0x2c,%esp
+f01007c9:	e8 5f 09 00 00       	call   f010112d <__x86.get_pc_thunk.si>
+f01007ce:	81 c6 0a fc 01 00    	add    $0x1fc0a,%esi
+f01007d4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f01007d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (!serial_irq || panicstr) {
+f01007da:	0f b6 86 c8 03 00 00 	movzbl 0x3c8(%esi),%eax
+f01007e1:	88 45 e2             	mov    %al,-0x1e(%ebp)
+f01007e4:	84 c0                	test   %al,%al
+f01007e6:	74 0b                	je     f01007f3 <serial_write+0x33>
+f01007e8:	c7 c0 40 05 12 f0    	mov    $0xf0120540,%eax
+f01007ee:	83 38 00             	cmpl   $0x0,(%eax)
+f01007f1:	74 17                	je     f010080a <serial_write+0x4a>
+		serial_write_sync(s, n);
+f01007f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01007f6:	89 f8                	mov    %edi,%eax
+f01007f8:	e8 db fc ff ff       	call   f01004d8 <serial_write_sync>
+}
+f01007fd:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100805:	5b                   	pop    %ebx
+f0100806:	5e                   	pop    %esi
+f0100807:	5f                   	pop    %edi
+f0100808:	5d                   	pop    %ebp
+f0100809:	c3                   	ret
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f010080a:	9c                   	pushf
+f010080b:	5e                   	pop    %esi
+f010080c:	89 75 cc             	mov    %esi,-0x34(%ebp)
+	asm volatile("cli");
+f010080f:	fa                   	cli
+	spin_lock(&serial_lock);
+f0100810:	83 ec 0c             	sub    $0xc,%esp
+f0100813:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0100816:	8d 83 cc 03 00 00    	lea    0x3cc(%ebx),%eax
+f010081c:	50                   	push   %eax
+f010081d:	e8 fc 3f 00 00       	call   f010481e <spin_lock>
+	if (!(eflags & FL_IF))
+f0100822:	83 c4 10             	add    $0x10,%esp
+			while (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+f0100825:	8d 15 e8 03 00 00    	lea    0x3e8,%edx
+f010082b:	89 55 d0             	mov    %edx,-0x30(%ebp)
+				serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = *s++;
+f010082e:	89 d8                	mov    %ebx,%eax
+f0100830:	01 d0                	add    %edx,%eax
+f0100832:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if (!(eflags & FL_IF))
+f0100835:	f7 c6 00 02 00 00    	test   $0x200,%esi
+f010083b:	74 05                	je     f0100842 <serial_write+0x82>
+f010083d:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0100840:	eb 7d                	jmp    f01008bf <serial_write+0xff>
+		serial_write_sync(s, n);
+f0100842:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0100845:	89 f8                	mov    %edi,%eax
+f0100847:	e8 8c fc ff ff       	call   f01004d8 <serial_write_sync>
+f010084c:	e9 ab 00 00 00       	jmp    f01008fc <serial_write+0x13c>
+f0100851:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f0100854:	89 fa                	mov    %edi,%edx
+f0100856:	c6 45 e3 00          	movb   $0x0,-0x1d(%ebp)
+f010085a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010085d:	eb 1c                	jmp    f010087b <serial_write+0xbb>
+				serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = *s++;
+f010085f:	83 c2 01             	add    $0x1,%edx
+f0100862:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0100867:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+f010086b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f010086e:	88 0c 03             	mov    %cl,(%ebx,%eax,1)
+				n--;
+f0100871:	83 ee 01             	sub    $0x1,%esi
+f0100874:	0f b6 45 e2          	movzbl -0x1e(%ebp),%eax
+f0100878:	88 45 e3             	mov    %al,-0x1d(%ebp)
+f010087b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010087e:	29 f8                	sub    %edi,%eax
+f0100880:	01 d0                	add    %edx,%eax
+			while (n > 0 && serial_tx.wpos - serial_tx.rpos < SERIAL_TXBUFSIZE) {
+f0100882:	85 f6                	test   %esi,%esi
+f0100884:	74 24                	je     f01008aa <serial_write+0xea>
+f0100886:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0100889:	29 f9                	sub    %edi,%ecx
+f010088b:	01 d1                	add    %edx,%ecx
+f010088d:	81 f9 ff 03 00 00    	cmp    $0x3ff,%ecx
+f0100893:	76 ca                	jbe    f010085f <serial_write+0x9f>
+f0100895:	80 7d e3 00          	cmpb   $0x0,-0x1d(%ebp)
+f0100899:	74 22                	je     f01008bd <serial_write+0xfd>
+f010089b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010089e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01008a1:	89 84 3b 04 04 00 00 	mov    %eax,0x404(%ebx,%edi,1)
+f01008a8:	eb 13                	jmp    f01008bd <serial_write+0xfd>
+f01008aa:	80 7d e3 00          	cmpb   $0x0,-0x1d(%ebp)
+f01008ae:	74 0d                	je     f01008bd <serial_write+0xfd>
+f01008b0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01008b3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01008b6:	89 84 3b 04 04 00 00 	mov    %eax,0x404(%ebx,%edi,1)
+				n--;
+f01008bd:	89 d7                	mov    %edx,%edi
+		while (n > 0) {
+f01008bf:	85 f6                	test   %esi,%esi
+f01008c1:	74 2e                	je     f01008f1 <serial_write+0x131>
+f01008c3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+			while (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+f01008c6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01008c9:	8b 84 19 04 04 00 00 	mov    0x404(%ecx,%ebx,1),%eax
+f01008d0:	89 c2                	mov    %eax,%edx
+f01008d2:	2b 94 19 00 04 00 00 	sub    0x400(%ecx,%ebx,1),%edx
+f01008d9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+f01008df:	0f 85 6c ff ff ff    	jne    f0100851 <serial_write+0x91>
+				serial_txwait();
+f01008e5:	e8 0d fb ff ff       	call   f01003f7 <serial_txwait>
+				serial_txfill();
+f01008ea:	e8 3a fb ff ff       	call   f0100429 <serial_txfill>
+f01008ef:	eb d5                	jmp    f01008c6 <serial_write+0x106>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01008f1:	b8 03 00 00 00       	mov    $0x3,%eax
+f01008f6:	ba f9 03 00 00       	mov    $0x3f9,%edx
+f01008fb:	ee                   	out    %al,(%dx)
+	spin_unlock(&serial_lock);
+f01008fc:	83 ec 0c             	sub    $0xc,%esp
+f01008ff:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0100902:	8d 83 cc 03 00 00    	lea    0x3cc(%ebx),%eax
+f0100908:	50                   	push   %eax
+f0100909:	e8 80 3f 00 00       	call   f010488e <spin_unlock>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f010090e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0100911:	50                   	push   %eax
+f0100912:	9d                   	popf
+	return true;
+f0100913:	83 c4 10             	add    $0x10,%esp
+f0100916:	e9 e2 fe ff ff       	jmp    f01007fd <serial_write+0x3d>
+
+f010091b <kbd_proc_data>:
+{
+f010091b:	55                   	push   %ebp
+f010091c:	89 e5                	mov    %esp,%ebp
+f010091e:	56                   	push   %esi
+f010091f:	53                   	push   %ebx
+f0100920:	e8 b4 fa ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100925:	81 c3 b3 fa 01 00    	add    $0x1fab3,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010092b:	ba 64 00 00 00       	mov    $0x64,%edx
+f0100930:	ec                   	in     (%dx),%al
+	if ((stat & KBS_DIB) == 0)
+f0100931:	a8 01                	test   $0x1,%al
+f0100933:	0f 84 f7 00 00 00    	je     f0100a30 <kbd_proc_data+0x115>
+	if (stat & KBS_TERR)
+f0100939:	a8 20                	test   $0x20,%al
+f010093b:	0f 85 f6 00 00 00    	jne    f0100a37 <kbd_proc_data+0x11c>
+f0100941:	ba 60 00 00 00       	mov    $0x60,%edx
+f0100946:	ec                   	in     (%dx),%al
+f0100947:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f0100949:	3c e0                	cmp    $0xe0,%al
+f010094b:	74 64                	je     f01009b1 <kbd_proc_data+0x96>
+	} else if (data & 0x80) {
+f010094d:	84 c0                	test   %al,%al
+f010094f:	78 75                	js     f01009c6 <kbd_proc_data+0xab>
+	} else if (shift & E0ESC) {
+f0100951:	8b 8b 88 01 00 00    	mov    0x188(%ebx),%ecx
+f0100957:	f6 c1 40             	test   $0x40,%cl
+f010095a:	74 0e                	je     f010096a <kbd_proc_data+0x4f>
+		data |= 0x80;
+f010095c:	83 c8 80             	or     $0xffffff80,%eax
+f010095f:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f0100961:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100964:	89 8b 88 01 00 00    	mov    %ecx,0x188(%ebx)
+	shift |= shiftcode[data];
+f010096a:	0f b6 d2             	movzbl %dl,%edx
+f010096d:	0f b6 84 13 28 55 fe 	movzbl -0x1aad8(%ebx,%edx,1),%eax
+f0100974:	ff 
+f0100975:	0b 83 88 01 00 00    	or     0x188(%ebx),%eax
+	shift ^= togglecode[data];
+f010097b:	0f b6 8c 13 28 54 fe 	movzbl -0x1abd8(%ebx,%edx,1),%ecx
+f0100982:	ff 
+f0100983:	31 c8                	xor    %ecx,%eax
+f0100985:	89 83 88 01 00 00    	mov    %eax,0x188(%ebx)
+	c = charcode[shift & (CTL | SHIFT)][data];
+f010098b:	89 c1                	mov    %eax,%ecx
+f010098d:	83 e1 03             	and    $0x3,%ecx
+f0100990:	8b 8c 8b 68 00 00 00 	mov    0x68(%ebx,%ecx,4),%ecx
+f0100997:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f010099b:	0f b6 f2             	movzbl %dl,%esi
+	if (shift & CAPSLOCK) {
+f010099e:	a8 08                	test   $0x8,%al
+f01009a0:	74 61                	je     f0100a03 <kbd_proc_data+0xe8>
+		if ('a' <= c && c <= 'z')
+f01009a2:	89 f2                	mov    %esi,%edx
+f01009a4:	8d 4e 9f             	lea    -0x61(%esi),%ecx
+f01009a7:	83 f9 19             	cmp    $0x19,%ecx
+f01009aa:	77 4b                	ja     f01009f7 <kbd_proc_data+0xdc>
+			c += 'A' - 'a';
+f01009ac:	83 ee 20             	sub    $0x20,%esi
+f01009af:	eb 0c                	jmp    f01009bd <kbd_proc_data+0xa2>
+		shift |= E0ESC;
+f01009b1:	83 8b 88 01 00 00 40 	orl    $0x40,0x188(%ebx)
+		return 0;
+f01009b8:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f01009bd:	89 f0                	mov    %esi,%eax
+f01009bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01009c2:	5b                   	pop    %ebx
+f01009c3:	5e                   	pop    %esi
+f01009c4:	5d                   	pop    %ebp
+f01009c5:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f01009c6:	8b 8b 88 01 00 00    	mov    0x188(%ebx),%ecx
+f01009cc:	83 e0 7f             	and    $0x7f,%eax
+f01009cf:	f6 c1 40             	test   $0x40,%cl
+f01009d2:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f01009d5:	0f b6 d2             	movzbl %dl,%edx
+f01009d8:	0f b6 84 13 28 55 fe 	movzbl -0x1aad8(%ebx,%edx,1),%eax
+f01009df:	ff 
+f01009e0:	83 c8 40             	or     $0x40,%eax
+f01009e3:	0f b6 c0             	movzbl %al,%eax
+f01009e6:	f7 d0                	not    %eax
+f01009e8:	21 c8                	and    %ecx,%eax
+f01009ea:	89 83 88 01 00 00    	mov    %eax,0x188(%ebx)
+		return 0;
+f01009f0:	be 00 00 00 00       	mov    $0x0,%esi
+f01009f5:	eb c6                	jmp    f01009bd <kbd_proc_data+0xa2>
+		else if ('A' <= c && c <= 'Z')
+f01009f7:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f01009fa:	8d 4e 20             	lea    0x20(%esi),%ecx
+f01009fd:	83 fa 1a             	cmp    $0x1a,%edx
+f0100a00:	0f 42 f1             	cmovb  %ecx,%esi
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f0100a03:	f7 d0                	not    %eax
+f0100a05:	a8 06                	test   $0x6,%al
+f0100a07:	75 b4                	jne    f01009bd <kbd_proc_data+0xa2>
+f0100a09:	81 fe e9 00 00 00    	cmp    $0xe9,%esi
+f0100a0f:	75 ac                	jne    f01009bd <kbd_proc_data+0xa2>
+		cprintf("Rebooting!\n");
+f0100a11:	83 ec 0c             	sub    $0xc,%esp
+f0100a14:	8d 83 53 53 fe ff    	lea    -0x1acad(%ebx),%eax
+f0100a1a:	50                   	push   %eax
+f0100a1b:	e8 c4 2f 00 00       	call   f01039e4 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100a20:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100a25:	ba 92 00 00 00       	mov    $0x92,%edx
+f0100a2a:	ee                   	out    %al,(%dx)
+}
+f0100a2b:	83 c4 10             	add    $0x10,%esp
+f0100a2e:	eb 8d                	jmp    f01009bd <kbd_proc_data+0xa2>
+		return -1;
+f0100a30:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f0100a35:	eb 86                	jmp    f01009bd <kbd_proc_data+0xa2>
+		return -1;
+f0100a37:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f0100a3c:	e9 7c ff ff ff       	jmp    f01009bd <kbd_proc_data+0xa2>
+
+f0100a41 <cga_putcell>:
+{
+f0100a41:	55                   	push   %ebp
+f0100a42:	89 e5                	mov    %esp,%ebp
+f0100a44:	57                   	push   %edi
+f0100a45:	56                   	push   %esi
+f0100a46:	53                   	push   %ebx
+f0100a47:	83 ec 0c             	sub    $0xc,%esp
+f0100a4a:	e8 8a f9 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100a4f:	81 c3 89 f9 01 00    	add    $0x1f989,%ebx
+f0100a55:	89 c6                	mov    %eax,%esi
+		c |= 0x0700;
+f0100a57:	80 cc 07             	or     $0x7,%ah
+f0100a5a:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+f0100a60:	0f 42 f0             	cmovb  %eax,%esi
+	switch (c & 0xff) {
+f0100a63:	89 f1                	mov    %esi,%ecx
+f0100a65:	80 f9 0a             	cmp    $0xa,%cl
+f0100a68:	0f 84 d4 00 00 00    	je     f0100b42 <cga_putcell+0x101>
+f0100a6e:	0f b6 c1             	movzbl %cl,%eax
+f0100a71:	83 f8 0a             	cmp    $0xa,%eax
+f0100a74:	7f 2a                	jg     f0100aa0 <cga_putcell+0x5f>
+f0100a76:	83 f8 08             	cmp    $0x8,%eax
+f0100a79:	0f 84 92 00 00 00    	je     f0100b11 <cga_putcell+0xd0>
+f0100a7f:	83 f8 09             	cmp    $0x9,%eax
+f0100a82:	0f 85 c7 00 00 00    	jne    f0100b4f <cga_putcell+0x10e>
+f0100a88:	bf 06 00 00 00       	mov    $0x6,%edi
+		for (i = 0; i < 5; i++)
+f0100a8d:	83 ef 01             	sub    $0x1,%edi
+f0100a90:	74 34                	je     f0100ac6 <cga_putcell+0x85>
+			cga_putcell((c & ~0xff) | ' ');
+f0100a92:	89 f0                	mov    %esi,%eax
+f0100a94:	b0 00                	mov    $0x0,%al
+f0100a96:	83 c8 20             	or     $0x20,%eax
+f0100a99:	e8 a3 ff ff ff       	call   f0100a41 <cga_putcell>
+f0100a9e:	eb ed                	jmp    f0100a8d <cga_putcell+0x4c>
+	switch (c & 0xff) {
+f0100aa0:	83 f8 0d             	cmp    $0xd,%eax
+f0100aa3:	0f 85 a6 00 00 00    	jne    f0100b4f <cga_putcell+0x10e>
+		crt_pos -= (crt_pos % CRT_COLS);
+f0100aa9:	0f b7 83 b4 03 00 00 	movzwl 0x3b4(%ebx),%eax
+f0100ab0:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100ab6:	c1 e8 16             	shr    $0x16,%eax
+f0100ab9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100abc:	c1 e0 04             	shl    $0x4,%eax
+f0100abf:	66 89 83 b4 03 00 00 	mov    %ax,0x3b4(%ebx)
+	if (crt_pos >= CRT_SIZE) {
+f0100ac6:	66 81 bb b4 03 00 00 	cmpw   $0x7cf,0x3b4(%ebx)
+f0100acd:	cf 07 
+f0100acf:	0f 86 ce 00 00 00    	jbe    f0100ba3 <cga_putcell+0x162>
+		if (crt_buf + CRT_SIZE + CRT_COLS > crt_base + crt_ncells) {
+f0100ad5:	8b 83 b8 03 00 00    	mov    0x3b8(%ebx),%eax
+f0100adb:	8b 8b c0 03 00 00    	mov    0x3c0(%ebx),%ecx
+f0100ae1:	8d b0 40 10 00 00    	lea    0x1040(%eax),%esi
+f0100ae7:	8b 93 bc 03 00 00    	mov    0x3bc(%ebx),%edx
+f0100aed:	8d 3c 51             	lea    (%ecx,%edx,2),%edi
+			crt_buf += CRT_COLS;
+f0100af0:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+		if (crt_buf + CRT_SIZE + CRT_COLS > crt_base + crt_ncells) {
+f0100af6:	39 f7                	cmp    %esi,%edi
+f0100af8:	72 78                	jb     f0100b72 <cga_putcell+0x131>
+			crt_buf += CRT_COLS;
+f0100afa:	89 93 b8 03 00 00    	mov    %edx,0x3b8(%ebx)
+f0100b00:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f0100b06:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+f0100b0c:	e9 86 00 00 00       	jmp    f0100b97 <cga_putcell+0x156>
+		if (crt_pos > 0) {
+f0100b11:	0f b7 83 b4 03 00 00 	movzwl 0x3b4(%ebx),%eax
+f0100b18:	66 85 c0             	test   %ax,%ax
+f0100b1b:	0f 84 82 00 00 00    	je     f0100ba3 <cga_putcell+0x162>
+			crt_pos--;
+f0100b21:	83 e8 01             	sub    $0x1,%eax
+f0100b24:	66 89 83 b4 03 00 00 	mov    %ax,0x3b4(%ebx)
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f0100b2b:	0f b7 c0             	movzwl %ax,%eax
+f0100b2e:	66 81 e6 00 ff       	and    $0xff00,%si
+f0100b33:	83 ce 20             	or     $0x20,%esi
+f0100b36:	8b 93 b8 03 00 00    	mov    0x3b8(%ebx),%edx
+f0100b3c:	66 89 34 42          	mov    %si,(%edx,%eax,2)
+f0100b40:	eb 84                	jmp    f0100ac6 <cga_putcell+0x85>
+		crt_pos += CRT_COLS;
+f0100b42:	66 83 83 b4 03 00 00 	addw   $0x50,0x3b4(%ebx)
+f0100b49:	50 
+f0100b4a:	e9 5a ff ff ff       	jmp    f0100aa9 <cga_putcell+0x68>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f0100b4f:	0f b7 83 b4 03 00 00 	movzwl 0x3b4(%ebx),%eax
+f0100b56:	8d 50 01             	lea    0x1(%eax),%edx
+f0100b59:	66 89 93 b4 03 00 00 	mov    %dx,0x3b4(%ebx)
+f0100b60:	0f b7 c0             	movzwl %ax,%eax
+f0100b63:	8b 93 b8 03 00 00    	mov    0x3b8(%ebx),%edx
+f0100b69:	66 89 34 42          	mov    %si,(%edx,%eax,2)
+		break;
+f0100b6d:	e9 54 ff ff ff       	jmp    f0100ac6 <cga_putcell+0x85>
+			memmove(crt_base, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f0100b72:	83 ec 04             	sub    $0x4,%esp
+f0100b75:	68 00 0f 00 00       	push   $0xf00
+f0100b7a:	52                   	push   %edx
+f0100b7b:	51                   	push   %ecx
+f0100b7c:	e8 c8 47 00 00       	call   f0105349 <memmove>
+			crt_buf = crt_base;
+f0100b81:	8b 93 c0 03 00 00    	mov    0x3c0(%ebx),%edx
+f0100b87:	83 c4 10             	add    $0x10,%esp
+f0100b8a:	e9 6b ff ff ff       	jmp    f0100afa <cga_putcell+0xb9>
+			crt_buf[i] = 0x0700 | ' ';
+f0100b8f:	66 c7 00 20 07       	movw   $0x720,(%eax)
+f0100b94:	83 c0 02             	add    $0x2,%eax
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f0100b97:	39 d0                	cmp    %edx,%eax
+f0100b99:	75 f4                	jne    f0100b8f <cga_putcell+0x14e>
+		crt_pos -= CRT_COLS;
+f0100b9b:	66 83 ab b4 03 00 00 	subw   $0x50,0x3b4(%ebx)
+f0100ba2:	50 
+}
+f0100ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100ba6:	5b                   	pop    %ebx
+f0100ba7:	5e                   	pop    %esi
+f0100ba8:	5f                   	pop    %edi
+f0100ba9:	5d                   	pop    %ebp
+f0100baa:	c3                   	ret
+
+f0100bab <cga_write>:
+{
+f0100bab:	55                   	push   %ebp
+f0100bac:	89 e5                	mov    %esp,%ebp
+f0100bae:	57                   	push   %edi
+f0100baf:	56                   	push   %esi
+f0100bb0:	53                   	push   %ebx
+f0100bb1:	83 ec 1c             	sub    $0x1c,%esp
+f0100bb4:	e8 20 f8 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100bb9:	81 c3 1f f8 01 00    	add    $0x1f81f,%ebx
+f0100bbf:	8b 75 08             	mov    0x8(%ebp),%esi
+f0100bc2:	89 f7                	mov    %esi,%edi
+f0100bc4:	03 7d 0c             	add    0xc(%ebp),%edi
+	while (n-- > 0)
+f0100bc7:	eb 0c                	jmp    f0100bd5 <cga_write+0x2a>
+		cga_putcell((uint8_t) *s++);
+f0100bc9:	83 c6 01             	add    $0x1,%esi
+f0100bcc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0100bd0:	e8 6c fe ff ff       	call   f0100a41 <cga_putcell>
+	while (n-- > 0)
+f0100bd5:	39 fe                	cmp    %edi,%esi
+f0100bd7:	75 f0                	jne    f0100bc9 <cga_write+0x1e>
+	unsigned start = crt_buf - crt_base;
+f0100bd9:	8b b3 b8 03 00 00    	mov    0x3b8(%ebx),%esi
+f0100bdf:	89 f1                	mov    %esi,%ecx
+f0100be1:	2b 8b c0 03 00 00    	sub    0x3c0(%ebx),%ecx
+f0100be7:	d1 f9                	sar    %ecx
+f0100be9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (crt_buf != crt_shown) {
+f0100bec:	3b b3 b0 03 00 00    	cmp    0x3b0(%ebx),%esi
+f0100bf2:	74 30                	je     f0100c24 <cga_write+0x79>
+		outb(addr_6845, 12);
+f0100bf4:	8b bb c4 03 00 00    	mov    0x3c4(%ebx),%edi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100bfa:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100bff:	89 fa                	mov    %edi,%edx
+f0100c01:	ee                   	out    %al,(%dx)
+		outb(addr_6845 + 1, start >> 8);
+f0100c02:	8d 57 01             	lea    0x1(%edi),%edx
+f0100c05:	89 c8                	mov    %ecx,%eax
+f0100c07:	c1 e8 08             	shr    $0x8,%eax
+f0100c0a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0100c0d:	ee                   	out    %al,(%dx)
+f0100c0e:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100c13:	89 fa                	mov    %edi,%edx
+f0100c15:	ee                   	out    %al,(%dx)
+f0100c16:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+f0100c1a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0100c1d:	ee                   	out    %al,(%dx)
+		crt_shown = crt_buf;
+f0100c1e:	89 b3 b0 03 00 00    	mov    %esi,0x3b0(%ebx)
+	outb(addr_6845, 14);
+f0100c24:	8b b3 c4 03 00 00    	mov    0x3c4(%ebx),%esi
+f0100c2a:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100c2f:	89 f2                	mov    %esi,%edx
+f0100c31:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, (start + crt_pos) >> 8);
+f0100c32:	0f b7 9b b4 03 00 00 	movzwl 0x3b4(%ebx),%ebx
+f0100c39:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100c3c:	0f b7 c3             	movzwl %bx,%eax
+f0100c3f:	01 c8                	add    %ecx,%eax
+f0100c41:	c1 e8 08             	shr    $0x8,%eax
+f0100c44:	89 fa                	mov    %edi,%edx
+f0100c46:	ee                   	out    %al,(%dx)
+f0100c47:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100c4c:	89 f2                	mov    %esi,%edx
+f0100c4e:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, start + crt_pos);
+f0100c4f:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0100c52:	89 fa                	mov    %edi,%edx
+f0100c54:	ee                   	out    %al,(%dx)
+}
+f0100c55:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100c5a:	83 c4 1c             	add    $0x1c,%esp
+f0100c5d:	5b                   	pop    %ebx
+f0100c5e:	5e                   	pop    %esi
+f0100c5f:	5f                   	pop    %edi
+f0100c60:	5d                   	pop    %ebp
+f0100c61:	c3                   	ret
+
+f0100c62 <lpt_write>:
+{
+f0100c62:	55                   	push   %ebp
+f0100c63:	89 e5                	mov    %esp,%ebp
+f0100c65:	57                   	push   %edi
+f0100c66:	56                   	push   %esi
+f0100c67:	53                   	push   %ebx
+f0100c68:	83 ec 08             	sub    $0x8,%esp
+f0100c6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0100c6e:	89 f8                	mov    %edi,%eax
+f0100c70:	03 45 0c             	add    0xc(%ebp),%eax
+f0100c73:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100c76:	b9 84 00 00 00       	mov    $0x84,%ecx
+	while (n-- > 0)
+f0100c7b:	eb 41                	jmp    f0100cbe <lpt_write+0x5c>
+f0100c7d:	89 ca                	mov    %ecx,%edx
+f0100c7f:	ec                   	in     (%dx),%al
+f0100c80:	ec                   	in     (%dx),%al
+f0100c81:	ec                   	in     (%dx),%al
+f0100c82:	ec                   	in     (%dx),%al
+	for (i = 0; !(inb(LPT1+LPT_STATUS) & LPT_STATUS_BUSY) && i < 12800; i++)
+f0100c83:	83 c3 01             	add    $0x1,%ebx
+f0100c86:	89 f2                	mov    %esi,%edx
+f0100c88:	ec                   	in     (%dx),%al
+f0100c89:	f7 d0                	not    %eax
+f0100c8b:	c0 e8 07             	shr    $0x7,%al
+f0100c8e:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100c94:	0f 9e c2             	setle  %dl
+f0100c97:	20 d0                	and    %dl,%al
+f0100c99:	75 e2                	jne    f0100c7d <lpt_write+0x1b>
+	if (i == 12800)
+f0100c9b:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+f0100ca1:	74 3d                	je     f0100ce0 <lpt_write+0x7e>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100ca3:	ba 78 03 00 00       	mov    $0x378,%edx
+f0100ca8:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+f0100cac:	ee                   	out    %al,(%dx)
+f0100cad:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100cb2:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100cb7:	ee                   	out    %al,(%dx)
+f0100cb8:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100cbd:	ee                   	out    %al,(%dx)
+	while (n-- > 0)
+f0100cbe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0100cc1:	39 c7                	cmp    %eax,%edi
+f0100cc3:	74 16                	je     f0100cdb <lpt_write+0x79>
+		if (!lpt_putc(*s++))
+f0100cc5:	83 c7 01             	add    $0x1,%edi
+f0100cc8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f0100ccc:	88 45 f3             	mov    %al,-0xd(%ebp)
+	for (i = 0; !(inb(LPT1+LPT_STATUS) & LPT_STATUS_BUSY) && i < 12800; i++)
+f0100ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100cd4:	be 79 03 00 00       	mov    $0x379,%esi
+f0100cd9:	eb ab                	jmp    f0100c86 <lpt_write+0x24>
+	return true;
+f0100cdb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0100ce0:	83 c4 08             	add    $0x8,%esp
+f0100ce3:	5b                   	pop    %ebx
+f0100ce4:	5e                   	pop    %esi
+f0100ce5:	5f                   	pop    %edi
+f0100ce6:	5d                   	pop    %ebp
+f0100ce7:	c3                   	ret
+
+f0100ce8 <serial_intr>:
+{
+f0100ce8:	55                   	push   %ebp
+f0100ce9:	89 e5                	mov    %esp,%ebp
+f0100ceb:	57                   	push   %edi
+f0100cec:	56                   	push   %esi
+f0100ced:	53                   	push   %ebx
+f0100cee:	83 ec 1c             	sub    $0x1c,%esp
+f0100cf1:	e8 37 04 00 00       	call   f010112d <__x86.get_pc_thunk.si>
+f0100cf6:	81 c6 e2 f6 01 00    	add    $0x1f6e2,%esi
+	if (!serial_exists)
+f0100cfc:	80 be f0 07 00 00 00 	cmpb   $0x0,0x7f0(%esi)
+f0100d03:	0f 84 84 00 00 00    	je     f0100d8d <serial_intr+0xa5>
+	if (!serial_irq) {
+f0100d09:	80 be c8 03 00 00 00 	cmpb   $0x0,0x3c8(%esi)
+f0100d10:	74 37                	je     f0100d49 <serial_intr+0x61>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0100d12:	9c                   	pushf
+f0100d13:	58                   	pop    %eax
+f0100d14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	asm volatile("cli");
+f0100d17:	fa                   	cli
+	spin_lock(&serial_lock);
+f0100d18:	83 ec 0c             	sub    $0xc,%esp
+f0100d1b:	8d 86 cc 03 00 00    	lea    0x3cc(%esi),%eax
+f0100d21:	50                   	push   %eax
+f0100d22:	89 f3                	mov    %esi,%ebx
+f0100d24:	e8 f5 3a 00 00       	call   f010481e <spin_lock>
+	serial_txfill();
+f0100d29:	e8 fb f6 ff ff       	call   f0100429 <serial_txfill>
+	cons_intr(serial_proc_data);
+f0100d2e:	8d 86 05 00 fe ff    	lea    -0x1fffb(%esi),%eax
+f0100d34:	e8 23 fa ff ff       	call   f010075c <cons_intr>
+	for (i = 0; !(inb(COM1 + COM_IIR) & COM_IIR_NOPEND) && i < 16; i++) {
+f0100d39:	83 c4 10             	add    $0x10,%esp
+f0100d3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		cons_intr(serial_proc_data);
+f0100d41:	8d be 05 00 fe ff    	lea    -0x1fffb(%esi),%edi
+	for (i = 0; !(inb(COM1 + COM_IIR) & COM_IIR_NOPEND) && i < 16; i++) {
+f0100d47:	eb 1c                	jmp    f0100d65 <serial_intr+0x7d>
+		cons_intr(serial_proc_data);
+f0100d49:	8d 86 05 00 fe ff    	lea    -0x1fffb(%esi),%eax
+f0100d4f:	e8 08 fa ff ff       	call   f010075c <cons_intr>
+		return;
+f0100d54:	eb 37                	jmp    f0100d8d <serial_intr+0xa5>
+		serial_txfill();
+f0100d56:	e8 ce f6 ff ff       	call   f0100429 <serial_txfill>
+		cons_intr(serial_proc_data);
+f0100d5b:	89 f8                	mov    %edi,%eax
+f0100d5d:	e8 fa f9 ff ff       	call   f010075c <cons_intr>
+	for (i = 0; !(inb(COM1 + COM_IIR) & COM_IIR_NOPEND) && i < 16; i++) {
+f0100d62:	83 c3 01             	add    $0x1,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100d65:	ba fa 03 00 00       	mov    $0x3fa,%edx
+f0100d6a:	ec                   	in     (%dx),%al
+f0100d6b:	a8 01                	test   $0x1,%al
+f0100d6d:	75 05                	jne    f0100d74 <serial_intr+0x8c>
+f0100d6f:	83 fb 0f             	cmp    $0xf,%ebx
+f0100d72:	7e e2                	jle    f0100d56 <serial_intr+0x6e>
+	spin_unlock(&serial_lock);
+f0100d74:	83 ec 0c             	sub    $0xc,%esp
+f0100d77:	8d 86 cc 03 00 00    	lea    0x3cc(%esi),%eax
+f0100d7d:	50                   	push   %eax
+f0100d7e:	89 f3                	mov    %esi,%ebx
+f0100d80:	e8 09 3b 00 00       	call   f010488e <spin_unlock>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0100d85:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100d88:	50                   	push   %eax
+f0100d89:	9d                   	popf
+}
+f0100d8a:	83 c4 10             	add    $0x10,%esp
+}
+f0100d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100d90:	5b                   	pop    %ebx
+f0100d91:	5e                   	pop    %esi
+f0100d92:	5f                   	pop    %edi
+f0100d93:	5d                   	pop    %ebp
+f0100d94:	c3                   	ret
+
+f0100d95 <serial_irq_init>:
+{
+f0100d95:	55                   	push   %ebp
+f0100d96:	89 e5                	mov    %esp,%ebp
+f0100d98:	53                   	push   %ebx
+f0100d99:	83 ec 04             	sub    $0x4,%esp
+f0100d9c:	e8 38 f6 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100da1:	81 c3 37 f6 01 00    	add    $0x1f637,%ebx
+	if (!serial_exists)
+f0100da7:	80 bb f0 07 00 00 00 	cmpb   $0x0,0x7f0(%ebx)
+f0100dae:	75 05                	jne    f0100db5 <serial_irq_init+0x20>
+}
+f0100db0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100db3:	c9                   	leave
+f0100db4:	c3                   	ret
+	__spin_initlock(&serial_lock, "serial");
+f0100db5:	83 ec 08             	sub    $0x8,%esp
+f0100db8:	8d 83 5f 53 fe ff    	lea    -0x1aca1(%ebx),%eax
+f0100dbe:	50                   	push   %eax
+f0100dbf:	8d 83 cc 03 00 00    	lea    0x3cc(%ebx),%eax
+f0100dc5:	50                   	push   %eax
+f0100dc6:	e8 31 3a 00 00       	call   f01047fc <__spin_initlock>
+	serial_irq = true;
+f0100dcb:	c6 83 c8 03 00 00 01 	movb   $0x1,0x3c8(%ebx)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100dd2:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100dd7:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100ddc:	ee                   	out    %al,(%dx)
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
+f0100ddd:	c7 c0 08 03 12 f0    	mov    $0xf0120308,%eax
+f0100de3:	0f b7 00             	movzwl (%eax),%eax
+f0100de6:	25 ef ff 00 00       	and    $0xffef,%eax
+f0100deb:	89 04 24             	mov    %eax,(%esp)
+f0100dee:	e8 f0 29 00 00       	call   f01037e3 <irq_setmask_8259A>
+f0100df3:	83 c4 10             	add    $0x10,%esp
+f0100df6:	eb b8                	jmp    f0100db0 <serial_irq_init+0x1b>
+
+f0100df8 <cga_map_wc>:
+{
+f0100df8:	55                   	push   %ebp
+f0100df9:	89 e5                	mov    %esp,%ebp
+f0100dfb:	53                   	push   %ebx
+f0100dfc:	83 ec 04             	sub    $0x4,%esp
+f0100dff:	e8 d5 f5 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100e04:	81 c3 d4 f5 01 00    	add    $0x1f5d4,%ebx
+	wc = mmio_map_region_wc(PADDR(crt_base), crt_ncells * sizeof(uint16_t));
+f0100e0a:	8b 83 bc 03 00 00    	mov    0x3bc(%ebx),%eax
+f0100e10:	8d 14 00             	lea    (%eax,%eax,1),%edx
+f0100e13:	8b 83 c0 03 00 00    	mov    0x3c0(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0100e19:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100e1e:	76 47                	jbe    f0100e67 <cga_map_wc+0x6f>
+f0100e20:	83 ec 08             	sub    $0x8,%esp
+f0100e23:	52                   	push   %edx
+	return (physaddr_t)kva - KERNBASE;
+f0100e24:	05 00 00 00 10       	add    $0x10000000,%eax
+f0100e29:	50                   	push   %eax
+f0100e2a:	e8 70 1f 00 00       	call   f0102d9f <mmio_map_region_wc>
+	if (wc) {
+f0100e2f:	83 c4 10             	add    $0x10,%esp
+f0100e32:	85 c0                	test   %eax,%eax
+f0100e34:	74 2c                	je     f0100e62 <cga_map_wc+0x6a>
+		crt_buf = wc + (crt_buf - crt_base);
+f0100e36:	8b 8b c0 03 00 00    	mov    0x3c0(%ebx),%ecx
+f0100e3c:	8b 93 b8 03 00 00    	mov    0x3b8(%ebx),%edx
+f0100e42:	29 ca                	sub    %ecx,%edx
+f0100e44:	01 c2                	add    %eax,%edx
+f0100e46:	89 93 b8 03 00 00    	mov    %edx,0x3b8(%ebx)
+		crt_shown = wc + (crt_shown - crt_base);
+f0100e4c:	8b 93 b0 03 00 00    	mov    0x3b0(%ebx),%edx
+f0100e52:	29 ca                	sub    %ecx,%edx
+f0100e54:	01 c2                	add    %eax,%edx
+f0100e56:	89 93 b0 03 00 00    	mov    %edx,0x3b0(%ebx)
+		crt_base = wc;
+f0100e5c:	89 83 c0 03 00 00    	mov    %eax,0x3c0(%ebx)
+}
+f0100e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100e65:	c9                   	leave
+f0100e66:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100e67:	50                   	push   %eax
+f0100e68:	8d 83 c4 53 fe ff    	lea    -0x1ac3c(%ebx),%eax
+f0100e6e:	50                   	push   %eax
+f0100e6f:	68 8a 01 00 00       	push   $0x18a
+f0100e74:	8d 83 66 53 fe ff    	lea    -0x1ac9a(%ebx),%eax
+f0100e7a:	50                   	push   %eax
+f0100e7b:	e8 32 f3 ff ff       	call   f01001b2 <_panic>
+
+f0100e80 <kbd_intr>:
+{
+f0100e80:	55                   	push   %ebp
+f0100e81:	89 e5                	mov    %esp,%ebp
+f0100e83:	83 ec 08             	sub    $0x8,%esp
+f0100e86:	e8 9a 02 00 00       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0100e8b:	05 4d f5 01 00       	add    $0x1f54d,%eax
+	cons_intr(kbd_proc_data);
+f0100e90:	8d 80 43 05 fe ff    	lea    -0x1fabd(%eax),%eax
+f0100e96:	e8 c1 f8 ff ff       	call   f010075c <cons_intr>
+}
+f0100e9b:	c9                   	leave
+f0100e9c:	c3                   	ret
+
+f0100e9d <cons_getc>:
+
+// return the next input character from the console, or 0 if none waiting
+int
+cons_getc(void)
+{
+f0100e9d:	55                   	push   %ebp
+f0100e9e:	89 e5                	mov    %esp,%ebp
+f0100ea0:	56                   	push   %esi
+f0100ea1:	53                   	push   %ebx
+f0100ea2:	e8 32 f5 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100ea7:	81 c3 31 f5 01 00    	add    $0x1f531,%ebx
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0100ead:	9c                   	pushf
+f0100eae:	5e                   	pop    %esi
+	// poll for any pending input characters,
+	// so that this function works even when interrupts are disabled
+	// (e.g., when called from the kernel monitor).
+	// Keep IRQ 4 out while we touch the input buffer.
+	eflags = read_eflags();
+	asm volatile("cli");
+f0100eaf:	fa                   	cli
+	serial_intr();
+f0100eb0:	e8 33 fe ff ff       	call   f0100ce8 <serial_intr>
+	kbd_intr();
+f0100eb5:	e8 c6 ff ff ff       	call   f0100e80 <kbd_intr>
+
+	// grab the next character from the input buffer.
+	if (cons.rpos != cons.wpos) {
+f0100eba:	8b 83 a8 03 00 00    	mov    0x3a8(%ebx),%eax
+	int c = 0;
+f0100ec0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f0100ec5:	3b 83 ac 03 00 00    	cmp    0x3ac(%ebx),%eax
+f0100ecb:	74 1e                	je     f0100eeb <cons_getc+0x4e>
+		c = cons.buf[cons.rpos++];
+f0100ecd:	8d 48 01             	lea    0x1(%eax),%ecx
+f0100ed0:	0f b6 94 03 a8 01 00 	movzbl 0x1a8(%ebx,%eax,1),%edx
+f0100ed7:	00 
+		if (cons.rpos == CONSBUFSIZE)
+			cons.rpos = 0;
+f0100ed8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f0100edd:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100ee2:	0f 45 c1             	cmovne %ecx,%eax
+f0100ee5:	89 83 a8 03 00 00    	mov    %eax,0x3a8(%ebx)
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0100eeb:	56                   	push   %esi
+f0100eec:	9d                   	popf
+	}
+	write_eflags(eflags);
+	return c;
+}
+f0100eed:	89 d0                	mov    %edx,%eax
+f0100eef:	5b                   	pop    %ebx
+f0100ef0:	5e                   	pop    %esi
+f0100ef1:	5d                   	pop    %ebp
+f0100ef2:	c3                   	ret
+
+f0100ef3 <cons_write>:
+
+// output a span of characters to the console, one device at a time,
+// so that each device handles the whole span in a single pass
+void
+cons_write(const char *s, size_t n)
+{
+f0100ef3:	55                   	push   %ebp
+f0100ef4:	89 e5                	mov    %esp,%ebp
+f0100ef6:	57                   	push   %edi
+f0100ef7:	56                   	push   %esi
+f0100ef8:	53                   	push   %ebx
+f0100ef9:	83 ec 1c             	sub    $0x1c,%esp
+f0100efc:	e8 24 02 00 00       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0100f01:	05 d7 f4 01 00       	add    $0x1f4d7,%eax
+f0100f06:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	uint32_t failed = 0;
+	int i;
+
+	if (n == 0)
+f0100f09:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0100f0d:	74 74                	je     f0100f83 <cons_write+0x90>
+f0100f0f:	8d b8 28 00 00 00    	lea    0x28(%eax),%edi
+f0100f15:	89 fb                	mov    %edi,%ebx
+		return;
+	for (i = 0; i < NSINKS; i++)
+f0100f17:	be 00 00 00 00       	mov    $0x0,%esi
+	uint32_t failed = 0;
+f0100f1c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0100f23:	eb 0b                	jmp    f0100f30 <cons_write+0x3d>
+	for (i = 0; i < NSINKS; i++)
+f0100f25:	83 c6 01             	add    $0x1,%esi
+f0100f28:	83 c3 10             	add    $0x10,%ebx
+f0100f2b:	83 fe 03             	cmp    $0x3,%esi
+f0100f2e:	74 35                	je     f0100f65 <cons_write+0x72>
+f0100f30:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+		if (cons_sinks[i].enabled && !cons_sinks[i].write(s, n)) {
+f0100f33:	80 7b 0d 00          	cmpb   $0x0,0xd(%ebx)
+f0100f37:	74 ec                	je     f0100f25 <cons_write+0x32>
+f0100f39:	83 ec 08             	sub    $0x8,%esp
+f0100f3c:	ff 75 0c             	push   0xc(%ebp)
+f0100f3f:	ff 75 08             	push   0x8(%ebp)
+f0100f42:	ff 53 08             	call   *0x8(%ebx)
+f0100f45:	83 c4 10             	add    $0x10,%esp
+f0100f48:	84 c0                	test   %al,%al
+f0100f4a:	75 d9                	jne    f0100f25 <cons_write+0x32>
+			// A device that times out once is taken to be
+			// offline, so it costs one timeout rather than one
+			// per span.
+			cons_sinks[i].enabled = false;
+f0100f4c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0100f4f:	c6 40 0d 00          	movb   $0x0,0xd(%eax)
+			cons_sinks[i].failed = true;
+f0100f53:	c6 40 0e 01          	movb   $0x1,0xe(%eax)
+			failed |= 1 << i;
+f0100f57:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100f5c:	89 f1                	mov    %esi,%ecx
+f0100f5e:	d3 e0                	shl    %cl,%eax
+f0100f60:	09 45 e4             	or     %eax,-0x1c(%ebp)
+f0100f63:	eb c0                	jmp    f0100f25 <cons_write+0x32>
+		}
+
+	// Report failures only once the whole span is out, so that the
+	// message does not land in the middle of it.
+	for (i = 0; i < NSINKS; i++)
+f0100f65:	be 00 00 00 00       	mov    $0x0,%esi
+		if (failed & (1 << i))
+f0100f6a:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100f6f:	89 f1                	mov    %esi,%ecx
+f0100f71:	d3 e0                	shl    %cl,%eax
+f0100f73:	85 45 e4             	test   %eax,-0x1c(%ebp)
+f0100f76:	75 13                	jne    f0100f8b <cons_write+0x98>
+	for (i = 0; i < NSINKS; i++)
+f0100f78:	83 c6 01             	add    $0x1,%esi
+f0100f7b:	83 c7 10             	add    $0x10,%edi
+f0100f7e:	83 fe 03             	cmp    $0x3,%esi
+f0100f81:	75 e7                	jne    f0100f6a <cons_write+0x77>
+			cprintf("console: %s timed out; turned it off\n",
+				cons_sinks[i].name);
+}
+f0100f83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100f86:	5b                   	pop    %ebx
+f0100f87:	5e                   	pop    %esi
+f0100f88:	5f                   	pop    %edi
+f0100f89:	5d                   	pop    %ebp
+f0100f8a:	c3                   	ret
+			cprintf("console: %s timed out; turned it off\n",
+f0100f8b:	83 ec 08             	sub    $0x8,%esp
+f0100f8e:	ff 37                	push   (%edi)
+f0100f90:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0100f93:	8d 83 e8 53 fe ff    	lea    -0x1ac18(%ebx),%eax
+f0100f99:	50                   	push   %eax
+f0100f9a:	e8 45 2a 00 00       	call   f01039e4 <cprintf>
+f0100f9f:	83 c4 10             	add    $0x10,%esp
+f0100fa2:	eb d4                	jmp    f0100f78 <cons_write+0x85>
+
+f0100fa4 <cons_sink_enable>:
+// Turn output to the named device on or off.
+// Returns 0 on success, -E_INVAL if there is no such device, or
+// -E_NO_DEV if the device was not found at boot.
+int
+cons_sink_enable(const char *name, bool on)
+{
+f0100fa4:	55                   	push   %ebp
+f0100fa5:	89 e5                	mov    %esp,%ebp
+f0100fa7:	57                   	push   %edi
+f0100fa8:	56                   	push   %esi
+f0100fa9:	53                   	push   %ebx
+f0100faa:	83 ec 1c             	sub    $0x1c,%esp
+f0100fad:	e8 27 f4 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0100fb2:	81 c3 26 f4 01 00    	add    $0x1f426,%ebx
+f0100fb8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100fbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0100fbe:	8d bb 28 00 00 00    	lea    0x28(%ebx),%edi
+	int i;
+
+	for (i = 0; i < NSINKS; i++)
+f0100fc4:	be 00 00 00 00       	mov    $0x0,%esi
+		if (strcmp(cons_sinks[i].name, name) == 0) {
+f0100fc9:	83 ec 08             	sub    $0x8,%esp
+f0100fcc:	ff 75 08             	push   0x8(%ebp)
+f0100fcf:	ff 37                	push   (%edi)
+f0100fd1:	e8 9e 42 00 00       	call   f0105274 <strcmp>
+f0100fd6:	83 c7 10             	add    $0x10,%edi
+f0100fd9:	83 c4 10             	add    $0x10,%esp
+f0100fdc:	85 c0                	test   %eax,%eax
+f0100fde:	74 15                	je     f0100ff5 <cons_sink_enable+0x51>
+	for (i = 0; i < NSINKS; i++)
+f0100fe0:	83 c6 01             	add    $0x1,%esi
+f0100fe3:	83 fe 03             	cmp    $0x3,%esi
+f0100fe6:	75 e1                	jne    f0100fc9 <cons_sink_enable+0x25>
+				return -E_NO_DEV;
+			cons_sinks[i].enabled = on;
+			cons_sinks[i].failed = false;
+			return 0;
+		}
+	return -E_INVAL;
+f0100fe8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f0100fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100ff0:	5b                   	pop    %ebx
+f0100ff1:	5e                   	pop    %esi
+f0100ff2:	5f                   	pop    %edi
+f0100ff3:	5d                   	pop    %ebp
+f0100ff4:	c3                   	ret
+			if (!cons_sinks[i].present)
+f0100ff5:	89 f2                	mov    %esi,%edx
+f0100ff7:	c1 e2 04             	shl    $0x4,%edx
+f0100ffa:	80 bc 13 34 00 00 00 	cmpb   $0x0,0x34(%ebx,%edx,1)
+f0101001:	00 
+f0101002:	74 14                	je     f0101018 <cons_sink_enable+0x74>
+			cons_sinks[i].enabled = on;
+f0101004:	8d 94 13 28 00 00 00 	lea    0x28(%ebx,%edx,1),%edx
+f010100b:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+f010100f:	88 4a 0d             	mov    %cl,0xd(%edx)
+			cons_sinks[i].failed = false;
+f0101012:	c6 42 0e 00          	movb   $0x0,0xe(%edx)
+			return 0;
+f0101016:	eb d5                	jmp    f0100fed <cons_sink_enable+0x49>
+				return -E_NO_DEV;
+f0101018:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f010101d:	eb ce                	jmp    f0100fed <cons_sink_enable+0x49>
+
+f010101f <cons_sink_print>:
+
+// List the output devices and their state.
+void
+cons_sink_print(void)
+{
+f010101f:	55                   	push   %ebp
+f0101020:	89 e5                	mov    %esp,%ebp
+f0101022:	57                   	push   %edi
+f0101023:	56                   	push   %esi
+f0101024:	53                   	push   %ebx
+f0101025:	83 ec 1c             	sub    $0x1c,%esp
+f0101028:	e8 ac f3 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010102d:	81 c3 ab f3 01 00    	add    $0x1f3ab,%ebx
+f0101033:	8d b3 28 00 00 00    	lea    0x28(%ebx),%esi
+f0101039:	8d 7e 30             	lea    0x30(%esi),%edi
+	int i;
+
+	for (i = 0; i < NSINKS; i++)
+		cprintf("  %-8s %s\n", cons_sinks[i].name,
+f010103c:	8d 83 75 53 fe ff    	lea    -0x1ac8b(%ebx),%eax
+f0101042:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			!cons_sinks[i].present ? "absent"
+			: cons_sinks[i].enabled ? "on"
+			: cons_sinks[i].failed ? "off (timed out)" : "off");
+f0101045:	8d 83 80 53 fe ff    	lea    -0x1ac80(%ebx),%eax
+f010104b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (i = 0; i < NSINKS; i++)
+f010104e:	eb 18                	jmp    f0101068 <cons_sink_print+0x49>
+		cprintf("  %-8s %s\n", cons_sinks[i].name,
+f0101050:	83 ec 04             	sub    $0x4,%esp
+f0101053:	50                   	push   %eax
+f0101054:	ff 32                	push   (%edx)
+f0101056:	8d 83 93 53 fe ff    	lea    -0x1ac6d(%ebx),%eax
+f010105c:	50                   	push   %eax
+f010105d:	e8 82 29 00 00       	call   f01039e4 <cprintf>
+f0101062:	83 c6 10             	add    $0x10,%esi
+f0101065:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NSINKS; i++)
+f0101068:	39 fe                	cmp    %edi,%esi
+f010106a:	74 28                	je     f0101094 <cons_sink_print+0x75>
+f010106c:	89 f2                	mov    %esi,%edx
+		cprintf("  %-8s %s\n", cons_sinks[i].name,
+f010106e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101071:	80 7e 0c 00          	cmpb   $0x0,0xc(%esi)
+f0101075:	74 d9                	je     f0101050 <cons_sink_print+0x31>
+			: cons_sinks[i].failed ? "off (timed out)" : "off");
+f0101077:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010107a:	80 7e 0d 00          	cmpb   $0x0,0xd(%esi)
+f010107e:	75 d0                	jne    f0101050 <cons_sink_print+0x31>
+f0101080:	8d 83 7c 53 fe ff    	lea    -0x1ac84(%ebx),%eax
+f0101086:	80 7e 0e 00          	cmpb   $0x0,0xe(%esi)
+f010108a:	74 c4                	je     f0101050 <cons_sink_print+0x31>
+f010108c:	8d 83 83 53 fe ff    	lea    -0x1ac7d(%ebx),%eax
+f0101092:	eb bc                	jmp    f0101050 <cons_sink_print+0x31>
+}
+f0101094:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101097:	5b                   	pop    %ebx
+f0101098:	5e                   	pop    %esi
+f0101099:	5f                   	pop    %edi
+f010109a:	5d                   	pop    %ebp
+f010109b:	c3                   	ret
+
+f010109c <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f010109c:	55                   	push   %ebp
+f010109d:	89 e5                	mov    %esp,%ebp
+f010109f:	57                   	push   %edi
+f01010a0:	56                   	push   %esi
+f01010a1:	53                   	push   %ebx
+f01010a2:	83 ec 0c             	sub    $0xc,%esp
+f01010a5:	e8 87 00 00 00       	call   f0101131 <__x86.get_pc_thunk.di>
+f01010aa:	81 c7 2e f3 01 00    	add    $0x1f32e,%edi
+f01010b0:	8d 9f 28 00 00 00    	lea    0x28(%edi),%ebx
+f01010b6:	8d 73 40             	lea    0x40(%ebx),%esi
+	int i;
+
+	kbd_init();
+	for (i = 0; i < NSINKS; i++) {
+f01010b9:	eb 09                	jmp    f01010c4 <cons_init+0x28>
+		cons_sinks[i].present = cons_sinks[i].init();
+f01010bb:	ff 53 f4             	call   *-0xc(%ebx)
+f01010be:	88 43 fc             	mov    %al,-0x4(%ebx)
+		cons_sinks[i].enabled = cons_sinks[i].present;
+f01010c1:	88 43 fd             	mov    %al,-0x3(%ebx)
+	for (i = 0; i < NSINKS; i++) {
+f01010c4:	83 c3 10             	add    $0x10,%ebx
+f01010c7:	39 f3                	cmp    %esi,%ebx
+f01010c9:	75 f0                	jne    f01010bb <cons_init+0x1f>
+	}
+
+	if (!serial_exists)
+f01010cb:	80 bf f0 07 00 00 00 	cmpb   $0x0,0x7f0(%edi)
+f01010d2:	74 08                	je     f01010dc <cons_init+0x40>
+		cprintf("Serial port does not exist!\n");
+}
+f01010d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01010d7:	5b                   	pop    %ebx
+f01010d8:	5e                   	pop    %esi
+f01010d9:	5f                   	pop    %edi
+f01010da:	5d                   	pop    %ebp
+f01010db:	c3                   	ret
+		cprintf("Serial port does not exist!\n");
+f01010dc:	83 ec 0c             	sub    $0xc,%esp
+f01010df:	8d 87 9e 53 fe ff    	lea    -0x1ac62(%edi),%eax
+f01010e5:	50                   	push   %eax
+f01010e6:	89 fb                	mov    %edi,%ebx
+f01010e8:	e8 f7 28 00 00       	call   f01039e4 <cprintf>
+f01010ed:	83 c4 10             	add    $0x10,%esp
+}
+f01010f0:	eb e2                	jmp    f01010d4 <cons_init+0x38>
+
+f01010f2 <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f01010f2:	55                   	push   %ebp
+f01010f3:	89 e5                	mov    %esp,%ebp
+f01010f5:	83 ec 20             	sub    $0x20,%esp
+	char ch = c;
+f01010f8:	8b 45 08             	mov    0x8(%ebp),%eax
+f01010fb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	cons_write(&ch, 1);
+f01010fe:	6a 01                	push   $0x1
+f0101100:	8d 45 f7             	lea    -0x9(%ebp),%eax
+f0101103:	50                   	push   %eax
+f0101104:	e8 ea fd ff ff       	call   f0100ef3 <cons_write>
+	cons_putc(c);
+}
+f0101109:	83 c4 10             	add    $0x10,%esp
+f010110c:	c9                   	leave
+f010110d:	c3                   	ret
+
+f010110e <getchar>:
+
+int
+getchar(void)
+{
+f010110e:	55                   	push   %ebp
+f010110f:	89 e5                	mov    %esp,%ebp
+f0101111:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f0101114:	e8 84 fd ff ff       	call   f0100e9d <cons_getc>
+f0101119:	85 c0                	test   %eax,%eax
+f010111b:	74 f7                	je     f0101114 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f010111d:	c9                   	leave
+f010111e:	c3                   	ret
+
+f010111f <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f010111f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101124:	c3                   	ret
+
+f0101125 <__x86.get_pc_thunk.ax>:
+f0101125:	8b 04 24             	mov    (%esp),%eax
+f0101128:	c3                   	ret
+
+f0101129 <__x86.get_pc_thunk.cx>:
+f0101129:	8b 0c 24             	mov    (%esp),%ecx
+f010112c:	c3                   	ret
+
+f010112d <__x86.get_pc_thunk.si>:
+f010112d:	8b 34 24             	mov    (%esp),%esi
+f0101130:	c3                   	ret
+
+f0101131 <__x86.get_pc_thunk.di>:
+f0101131:	8b 3c 24             	mov    (%esp),%edi
+f0101134:	c3                   	ret
+
+f0101135 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f0101135:	55                   	push   %ebp
+f0101136:	89 e5                	mov    %esp,%ebp
+f0101138:	57                   	push   %edi
+f0101139:	56                   	push   %esi
+f010113a:	53                   	push   %ebx
+f010113b:	83 ec 1c             	sub    $0x1c,%esp
+f010113e:	e8 96 f2 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101143:	81 c3 95 f2 01 00    	add    $0x1f295,%ebx
+f0101149:	8d b3 c8 00 00 00    	lea    0xc8(%ebx),%esi
+f010114f:	8d 7e 54             	lea    0x54(%esi),%edi
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f0101152:	8d 83 28 56 fe ff    	lea    -0x1a9d8(%ebx),%eax
+f0101158:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+f010115b:	eb 16                	jmp    f0101173 <mon_help+0x3e>
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f010115d:	83 ec 04             	sub    $0x4,%esp
+f0101160:	ff 76 04             	push   0x4(%esi)
+f0101163:	ff 36                	push   (%esi)
+f0101165:	ff 75 e4             	push   -0x1c(%ebp)
+f0101168:	e8 77 28 00 00       	call   f01039e4 <cprintf>
+f010116d:	83 c6 0c             	add    $0xc,%esi
+f0101170:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+f0101173:	39 fe                	cmp    %edi,%esi
+f0101175:	75 e6                	jne    f010115d <mon_help+0x28>
+	return 0;
+}
+f0101177:	b8 00 00 00 00       	mov    $0x0,%eax
+f010117c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010117f:	5b                   	pop    %ebx
+f0101180:	5e                   	pop    %esi
+f0101181:	5f                   	pop    %edi
+f0101182:	5d                   	pop    %ebp
+f0101183:	c3                   	ret
+
+f0101184 <mon_boottime>:
+	[BT_E820] = "e820_detect",
+};
+
+int
+mon_boottime(int argc, char **argv, struct Trapframe *tf)
+{
+f0101184:	55                   	push   %ebp
+f0101185:	89 e5                	mov    %esp,%ebp
+f0101187:	57                   	push   %edi
+f0101188:	56                   	push   %esi
+f0101189:	53                   	push   %ebx
+f010118a:	83 ec 2c             	sub    $0x2c,%esp
+f010118d:	e8 47 f2 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101192:	81 c3 46 f2 01 00    	add    $0x1f246,%ebx
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO);
+	struct Bootstamp *bs;
+	uint64_t t0;
+	int i;
+
+	if (bi->bi_magic != BOOTINFO_MAGIC) {
+f0101198:	81 3d 00 10 00 f0 4a 	cmpl   $0x42534f4a,0xf0001000
+f010119f:	4f 53 42 
+f01011a2:	74 1f                	je     f01011c3 <mon_boottime+0x3f>
+		cprintf("No boot timeline: not started by the JOS boot loader\n");
+f01011a4:	83 ec 0c             	sub    $0xc,%esp
+f01011a7:	8d 83 b0 57 fe ff    	lea    -0x1a850(%ebx),%eax
+f01011ad:	50                   	push   %eax
+f01011ae:	e8 31 28 00 00       	call   f01039e4 <cprintf>
+		return 0;
+f01011b3:	83 c4 10             	add    $0x10,%esp
+		if (bs->bs_arg)
+			cprintf(" (%u)", bs->bs_arg);
+		cprintf("\n");
+	}
+	return 0;
+}
+f01011b6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01011bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01011be:	5b                   	pop    %ebx
+f01011bf:	5e                   	pop    %esi
+f01011c0:	5f                   	pop    %edi
+f01011c1:	5d                   	pop    %ebp
+f01011c2:	c3                   	ret
+	cprintf("       cycles        delta  stage\n");
+f01011c3:	83 ec 0c             	sub    $0xc,%esp
+f01011c6:	8d 83 e8 57 fe ff    	lea    -0x1a818(%ebx),%eax
+f01011cc:	50                   	push   %eax
+f01011cd:	e8 12 28 00 00       	call   f01039e4 <cprintf>
+	t0 = bi->bi_stamp[0].bs_tsc;
+f01011d2:	a1 10 10 00 f0       	mov    0xf0001010,%eax
+f01011d7:	8b 15 14 10 00 f0    	mov    0xf0001014,%edx
+f01011dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01011e0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	for (i = 0; i < bi->bi_nstamp && i < BI_MAXSTAMP; i++) {
+f01011e3:	83 c4 10             	add    $0x10,%esp
+f01011e6:	bf 00 00 00 00       	mov    $0x0,%edi
+		cprintf("%13llu %12llu  %s", bs->bs_tsc - t0,
+f01011eb:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+f01011f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = 0; i < bi->bi_nstamp && i < BI_MAXSTAMP; i++) {
+f01011f4:	eb 41                	jmp    f0101237 <mon_boottime+0xb3>
+		cprintf("%13llu %12llu  %s", bs->bs_tsc - t0,
+f01011f6:	83 ec 08             	sub    $0x8,%esp
+f01011f9:	ff 75 e4             	push   -0x1c(%ebp)
+f01011fc:	52                   	push   %edx
+f01011fd:	50                   	push   %eax
+f01011fe:	8b 46 10             	mov    0x10(%esi),%eax
+f0101201:	8b 56 14             	mov    0x14(%esi),%edx
+f0101204:	2b 45 d8             	sub    -0x28(%ebp),%eax
+f0101207:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+f010120a:	52                   	push   %edx
+f010120b:	50                   	push   %eax
+f010120c:	8d 83 33 56 fe ff    	lea    -0x1a9cd(%ebx),%eax
+f0101212:	50                   	push   %eax
+f0101213:	e8 cc 27 00 00       	call   f01039e4 <cprintf>
+		if (bs->bs_arg)
+f0101218:	8b 46 1c             	mov    0x1c(%esi),%eax
+f010121b:	83 c4 20             	add    $0x20,%esp
+f010121e:	85 c0                	test   %eax,%eax
+f0101220:	75 7e                	jne    f01012a0 <mon_boottime+0x11c>
+		cprintf("\n");
+f0101222:	83 ec 0c             	sub    $0xc,%esp
+f0101225:	8d 83 5d 53 fe ff    	lea    -0x1aca3(%ebx),%eax
+f010122b:	50                   	push   %eax
+f010122c:	e8 b3 27 00 00       	call   f01039e4 <cprintf>
+	for (i = 0; i < bi->bi_nstamp && i < BI_MAXSTAMP; i++) {
+f0101231:	83 c7 01             	add    $0x1,%edi
+f0101234:	83 c4 10             	add    $0x10,%esp
+f0101237:	89 f8                	mov    %edi,%eax
+f0101239:	3b 3d 08 10 00 f0    	cmp    0xf0001008,%edi
+f010123f:	0f 83 71 ff ff ff    	jae    f01011b6 <mon_boottime+0x32>
+f0101245:	83 ff 1f             	cmp    $0x1f,%edi
+f0101248:	0f 8f 68 ff ff ff    	jg     f01011b6 <mon_boottime+0x32>
+f010124e:	c1 e0 04             	shl    $0x4,%eax
+f0101251:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101254:	8d b0 00 10 00 f0    	lea    -0xffff000(%eax),%esi
+			bs->bs_stage < BT_NSTAGE ? boot_stages[bs->bs_stage] : "?");
+f010125a:	8b 46 18             	mov    0x18(%esi),%eax
+		cprintf("%13llu %12llu  %s", bs->bs_tsc - t0,
+f010125d:	8d 93 31 56 fe ff    	lea    -0x1a9cf(%ebx),%edx
+f0101263:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101266:	83 f8 08             	cmp    $0x8,%eax
+f0101269:	77 09                	ja     f0101274 <mon_boottime+0xf0>
+f010126b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010126e:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+f0101271:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0101274:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101279:	ba 00 00 00 00       	mov    $0x0,%edx
+f010127e:	85 ff                	test   %edi,%edi
+f0101280:	0f 84 70 ff ff ff    	je     f01011f6 <mon_boottime+0x72>
+f0101286:	8b 46 10             	mov    0x10(%esi),%eax
+f0101289:	8b 56 14             	mov    0x14(%esi),%edx
+f010128c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010128f:	2b 81 00 10 00 f0    	sub    -0xffff000(%ecx),%eax
+f0101295:	1b 91 04 10 00 f0    	sbb    -0xfffeffc(%ecx),%edx
+f010129b:	e9 56 ff ff ff       	jmp    f01011f6 <mon_boottime+0x72>
+			cprintf(" (%u)", bs->bs_arg);
+f01012a0:	83 ec 08             	sub    $0x8,%esp
+f01012a3:	50                   	push   %eax
+f01012a4:	8d 83 45 56 fe ff    	lea    -0x1a9bb(%ebx),%eax
+f01012aa:	50                   	push   %eax
+f01012ab:	e8 34 27 00 00       	call   f01039e4 <cprintf>
+f01012b0:	83 c4 10             	add    $0x10,%esp
+f01012b3:	e9 6a ff ff ff       	jmp    f0101222 <mon_boottime+0x9e>
+
+f01012b8 <mon_kerninfo>:
+{
+f01012b8:	55                   	push   %ebp
+f01012b9:	89 e5                	mov    %esp,%ebp
+f01012bb:	57                   	push   %edi
+f01012bc:	56                   	push   %esi
+f01012bd:	53                   	push   %ebx
+f01012be:	83 ec 18             	sub    $0x18,%esp
+f01012c1:	e8 13 f1 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01012c6:	81 c3 12 f1 01 00    	add    $0x1f112,%ebx
+	cprintf("Special kernel symbols:\n");
+f01012cc:	8d 83 4b 56 fe ff    	lea    -0x1a9b5(%ebx),%eax
+f01012d2:	50                   	push   %eax
+f01012d3:	e8 0c 27 00 00       	call   f01039e4 <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f01012d8:	83 c4 08             	add    $0x8,%esp
+f01012db:	ff b3 f4 ff ff ff    	push   -0xc(%ebx)
+f01012e1:	8d 83 0c 58 fe ff    	lea    -0x1a7f4(%ebx),%eax
+f01012e7:	50                   	push   %eax
+f01012e8:	e8 f7 26 00 00       	call   f01039e4 <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f01012ed:	83 c4 0c             	add    $0xc,%esp
+f01012f0:	c7 c7 0c 00 10 f0    	mov    $0xf010000c,%edi
+f01012f6:	8d 87 00 00 00 10    	lea    0x10000000(%edi),%eax
+f01012fc:	50                   	push   %eax
+f01012fd:	57                   	push   %edi
+f01012fe:	8d 83 34 58 fe ff    	lea    -0x1a7cc(%ebx),%eax
+f0101304:	50                   	push   %eax
+f0101305:	e8 da 26 00 00       	call   f01039e4 <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f010130a:	83 c4 0c             	add    $0xc,%esp
+f010130d:	c7 c0 54 56 10 f0    	mov    $0xf0105654,%eax
+f0101313:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101319:	52                   	push   %edx
+f010131a:	50                   	push   %eax
+f010131b:	8d 83 58 58 fe ff    	lea    -0x1a7a8(%ebx),%eax
+f0101321:	50                   	push   %eax
+f0101322:	e8 bd 26 00 00       	call   f01039e4 <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f0101327:	83 c4 0c             	add    $0xc,%esp
+f010132a:	c7 c0 40 05 12 f0    	mov    $0xf0120540,%eax
+f0101330:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101336:	52                   	push   %edx
+f0101337:	50                   	push   %eax
+f0101338:	8d 83 7c 58 fe ff    	lea    -0x1a784(%ebx),%eax
+f010133e:	50                   	push   %eax
+f010133f:	e8 a0 26 00 00       	call   f01039e4 <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f0101344:	83 c4 0c             	add    $0xc,%esp
+f0101347:	c7 c6 a0 1e 12 f0    	mov    $0xf0121ea0,%esi
+f010134d:	8d 86 00 00 00 10    	lea    0x10000000(%esi),%eax
+f0101353:	50                   	push   %eax
+f0101354:	56                   	push   %esi
+f0101355:	8d 83 a0 58 fe ff    	lea    -0x1a760(%ebx),%eax
+f010135b:	50                   	push   %eax
+f010135c:	e8 83 26 00 00       	call   f01039e4 <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f0101361:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f0101364:	89 f0                	mov    %esi,%eax
+f0101366:	29 f8                	sub    %edi,%eax
+f0101368:	05 ff 03 00 00       	add    $0x3ff,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f010136d:	c1 f8 0a             	sar    $0xa,%eax
+f0101370:	50                   	push   %eax
+f0101371:	8d 83 c4 58 fe ff    	lea    -0x1a73c(%ebx),%eax
+f0101377:	50                   	push   %eax
+f0101378:	e8 67 26 00 00       	call   f01039e4 <cprintf>
+		ROUNDUP((char *) boot_alloc_mark()
+f010137d:	e8 54 09 00 00       	call   f0101cd6 <boot_alloc_mark>
+	cprintf("Early boot allocations: %dKB\n",
+f0101382:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP((char *) boot_alloc_mark()
+f0101385:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+f010138b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0101391:	29 f0                	sub    %esi,%eax
+f0101393:	05 ff 03 00 00       	add    $0x3ff,%eax
+	cprintf("Early boot allocations: %dKB\n",
+f0101398:	c1 f8 0a             	sar    $0xa,%eax
+f010139b:	50                   	push   %eax
+f010139c:	8d 83 64 56 fe ff    	lea    -0x1a99c(%ebx),%eax
+f01013a2:	50                   	push   %eax
+f01013a3:	e8 3c 26 00 00       	call   f01039e4 <cprintf>
+}
+f01013a8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01013ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01013b0:	5b                   	pop    %ebx
+f01013b1:	5e                   	pop    %esi
+f01013b2:	5f                   	pop    %edi
+f01013b3:	5d                   	pop    %ebp
+f01013b4:	c3                   	ret
+
+f01013b5 <mon_backtrace>:
+{
+f01013b5:	55                   	push   %ebp
+f01013b6:	89 e5                	mov    %esp,%ebp
+f01013b8:	57                   	push   %edi
+f01013b9:	56                   	push   %esi
+f01013ba:	53                   	push   %ebx
+f01013bb:	83 ec 3c             	sub    $0x3c,%esp
+f01013be:	e8 16 f0 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01013c3:	81 c3 15 f0 01 00    	add    $0x1f015,%ebx
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f01013c9:	89 ee                	mov    %ebp,%esi
+		cprintf("ebp %08x eip %08x args %08x %08x %08x %08x %08x\n", p, eip, *(p + 2), *(p + 3), *(p + 4), *(p + 5), *(p + 6));
+f01013cb:	8d 83 f0 58 fe ff    	lea    -0x1a710(%ebx),%eax
+f01013d1:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+		cprintf("%s:%d", info.eip_file, info.eip_line);
+f01013d4:	8d 83 82 56 fe ff    	lea    -0x1a97e(%ebx),%eax
+f01013da:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	while (p != 0) {
+f01013dd:	eb 55                	jmp    f0101434 <mon_backtrace+0x7f>
+		uint32_t eip = *(p + 1);
+f01013df:	8b 7e 04             	mov    0x4(%esi),%edi
+		cprintf("ebp %08x eip %08x args %08x %08x %08x %08x %08x\n", p, eip, *(p + 2), *(p + 3), *(p + 4), *(p + 5), *(p + 6));
+f01013e2:	ff 76 18             	push   0x18(%esi)
+f01013e5:	ff 76 14             	push   0x14(%esi)
+f01013e8:	ff 76 10             	push   0x10(%esi)
+f01013eb:	ff 76 0c             	push   0xc(%esi)
+f01013ee:	ff 76 08             	push   0x8(%esi)
+f01013f1:	57                   	push   %edi
+f01013f2:	56                   	push   %esi
+f01013f3:	ff 75 c4             	push   -0x3c(%ebp)
+f01013f6:	e8 e9 25 00 00       	call   f01039e4 <cprintf>
+		debuginfo_eip((uintptr_t)eip, &info);
+f01013fb:	83 c4 18             	add    $0x18,%esp
+f01013fe:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0101401:	50                   	push   %eax
+f0101402:	57                   	push   %edi
+f0101403:	e8 e7 27 00 00       	call   f0103bef <debuginfo_eip>
+		cprintf("%s:%d", info.eip_file, info.eip_line);
+f0101408:	83 c4 0c             	add    $0xc,%esp
+f010140b:	ff 75 d4             	push   -0x2c(%ebp)
+f010140e:	ff 75 d0             	push   -0x30(%ebp)
+f0101411:	ff 75 c0             	push   -0x40(%ebp)
+f0101414:	e8 cb 25 00 00       	call   f01039e4 <cprintf>
+		cprintf(": %.*s+%d\n", info.eip_fn_namelen, info.eip_fn_name, eip - info.eip_fn_addr);
+f0101419:	2b 7d e0             	sub    -0x20(%ebp),%edi
+f010141c:	57                   	push   %edi
+f010141d:	ff 75 d8             	push   -0x28(%ebp)
+f0101420:	ff 75 dc             	push   -0x24(%ebp)
+f0101423:	8d 83 88 56 fe ff    	lea    -0x1a978(%ebx),%eax
+f0101429:	50                   	push   %eax
+f010142a:	e8 b5 25 00 00       	call   f01039e4 <cprintf>
+		p = (uint32_t*)*p;
+f010142f:	8b 36                	mov    (%esi),%esi
+f0101431:	83 c4 20             	add    $0x20,%esp
+	while (p != 0) {
+f0101434:	85 f6                	test   %esi,%esi
+f0101436:	75 a7                	jne    f01013df <mon_backtrace+0x2a>
+}
+f0101438:	b8 00 00 00 00       	mov    $0x0,%eax
+f010143d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101440:	5b                   	pop    %ebx
+f0101441:	5e                   	pop    %esi
+f0101442:	5f                   	pop    %edi
+f0101443:	5d                   	pop    %ebp
+f0101444:	c3                   	ret
+
+f0101445 <mon_kmem>:
+
+
+int
+mon_kmem(int argc, char **argv, struct Trapframe *tf)
+{
+f0101445:	55                   	push   %ebp
+f0101446:	89 e5                	mov    %esp,%ebp
+f0101448:	53                   	push   %ebx
+f0101449:	83 ec 04             	sub    $0x4,%esp
+f010144c:	e8 88 ef ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101451:	81 c3 87 ef 01 00    	add    $0x1ef87,%ebx
+	kmem_print_stats();
+f0101457:	e8 ea 22 00 00       	call   f0103746 <kmem_print_stats>
+	return 0;
+}
+f010145c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101464:	c9                   	leave
+f0101465:	c3                   	ret
+
+f0101466 <mon_locks>:
+
+int
+mon_locks(int argc, char **argv, struct Trapframe *tf)
+{
+f0101466:	55                   	push   %ebp
+f0101467:	89 e5                	mov    %esp,%ebp
+f0101469:	53                   	push   %ebx
+f010146a:	83 ec 04             	sub    $0x4,%esp
+f010146d:	e8 67 ef ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101472:	81 c3 66 ef 01 00    	add    $0x1ef66,%ebx
+	lock_print_stats();
+f0101478:	e8 b7 35 00 00       	call   f0104a34 <lock_print_stats>
+	return 0;
+}
+f010147d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101482:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101485:	c9                   	leave
+f0101486:	c3                   	ret
+
+f0101487 <mon_console>:
+
+int
+mon_console(int argc, char **argv, struct Trapframe *tf)
+{
+f0101487:	55                   	push   %ebp
+f0101488:	89 e5                	mov    %esp,%ebp
+f010148a:	56                   	push   %esi
+f010148b:	53                   	push   %ebx
+f010148c:	e8 48 ef ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101491:	81 c3 47 ef 01 00    	add    $0x1ef47,%ebx
+f0101497:	8b 45 08             	mov    0x8(%ebp),%eax
+f010149a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	if (argc == 1) {
+f010149d:	83 f8 01             	cmp    $0x1,%eax
+f01014a0:	0f 84 84 00 00 00    	je     f010152a <mon_console+0xa3>
+		cons_sink_print();
+		return 0;
+	}
+	if (argc != 3
+f01014a6:	83 f8 03             	cmp    $0x3,%eax
+f01014a9:	0f 85 82 00 00 00    	jne    f0101531 <mon_console+0xaa>
+	    || (strcmp(argv[2], "on") != 0 && strcmp(argv[2], "off") != 0)) {
+f01014af:	83 ec 08             	sub    $0x8,%esp
+f01014b2:	8d 83 80 53 fe ff    	lea    -0x1ac80(%ebx),%eax
+f01014b8:	50                   	push   %eax
+f01014b9:	ff 76 08             	push   0x8(%esi)
+f01014bc:	e8 b3 3d 00 00       	call   f0105274 <strcmp>
+f01014c1:	83 c4 10             	add    $0x10,%esp
+f01014c4:	85 c0                	test   %eax,%eax
+f01014c6:	74 19                	je     f01014e1 <mon_console+0x5a>
+f01014c8:	83 ec 08             	sub    $0x8,%esp
+f01014cb:	8d 83 7c 53 fe ff    	lea    -0x1ac84(%ebx),%eax
+f01014d1:	50                   	push   %eax
+f01014d2:	ff 76 08             	push   0x8(%esi)
+f01014d5:	e8 9a 3d 00 00       	call   f0105274 <strcmp>
+f01014da:	83 c4 10             	add    $0x10,%esp
+f01014dd:	85 c0                	test   %eax,%eax
+f01014df:	75 50                	jne    f0101531 <mon_console+0xaa>
+		cprintf("Usage: console [device on|off]\n");
+		return 0;
+	}
+	r = cons_sink_enable(argv[1], strcmp(argv[2], "on") == 0);
+f01014e1:	83 ec 08             	sub    $0x8,%esp
+f01014e4:	8d 83 80 53 fe ff    	lea    -0x1ac80(%ebx),%eax
+f01014ea:	50                   	push   %eax
+f01014eb:	ff 76 08             	push   0x8(%esi)
+f01014ee:	e8 81 3d 00 00       	call   f0105274 <strcmp>
+f01014f3:	83 c4 08             	add    $0x8,%esp
+f01014f6:	85 c0                	test   %eax,%eax
+f01014f8:	0f 94 c0             	sete   %al
+f01014fb:	0f b6 c0             	movzbl %al,%eax
+f01014fe:	50                   	push   %eax
+f01014ff:	ff 76 04             	push   0x4(%esi)
+f0101502:	e8 9d fa ff ff       	call   f0100fa4 <cons_sink_enable>
+	if (r == -E_NO_DEV)
+f0101507:	83 c4 10             	add    $0x10,%esp
+f010150a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+f010150d:	74 40                	je     f010154f <mon_console+0xc8>
+		cprintf("console: device '%s' is not present\n", argv[1]);
+	else if (r < 0)
+f010150f:	85 c0                	test   %eax,%eax
+f0101511:	79 30                	jns    f0101543 <mon_console+0xbc>
+		cprintf("console: no device '%s'\n", argv[1]);
+f0101513:	83 ec 08             	sub    $0x8,%esp
+f0101516:	ff 76 04             	push   0x4(%esi)
+f0101519:	8d 83 93 56 fe ff    	lea    -0x1a96d(%ebx),%eax
+f010151f:	50                   	push   %eax
+f0101520:	e8 bf 24 00 00       	call   f01039e4 <cprintf>
+f0101525:	83 c4 10             	add    $0x10,%esp
+f0101528:	eb 19                	jmp    f0101543 <mon_console+0xbc>
+		cons_sink_print();
+f010152a:	e8 f0 fa ff ff       	call   f010101f <cons_sink_print>
+		return 0;
+f010152f:	eb 12                	jmp    f0101543 <mon_console+0xbc>
+		cprintf("Usage: console [device on|off]\n");
+f0101531:	83 ec 0c             	sub    $0xc,%esp
+f0101534:	8d 83 24 59 fe ff    	lea    -0x1a6dc(%ebx),%eax
+f010153a:	50                   	push   %eax
+f010153b:	e8 a4 24 00 00       	call   f01039e4 <cprintf>
+		return 0;
+f0101540:	83 c4 10             	add    $0x10,%esp
+	return 0;
+}
+f0101543:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101548:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010154b:	5b                   	pop    %ebx
+f010154c:	5e                   	pop    %esi
+f010154d:	5d                   	pop    %ebp
+f010154e:	c3                   	ret
+		cprintf("console: device '%s' is not present\n", argv[1]);
+f010154f:	83 ec 08             	sub    $0x8,%esp
+f0101552:	ff 76 04             	push   0x4(%esi)
+f0101555:	8d 83 44 59 fe ff    	lea    -0x1a6bc(%ebx),%eax
+f010155b:	50                   	push   %eax
+f010155c:	e8 83 24 00 00       	call   f01039e4 <cprintf>
+f0101561:	83 c4 10             	add    $0x10,%esp
+f0101564:	eb dd                	jmp    f0101543 <mon_console+0xbc>
+
+f0101566 <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0101566:	55                   	push   %ebp
+f0101567:	89 e5                	mov    %esp,%ebp
+f0101569:	57                   	push   %edi
+f010156a:	56                   	push   %esi
+f010156b:	53                   	push   %ebx
+f010156c:	83 ec 68             	sub    $0x68,%esp
+f010156f:	e8 65 ee ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101574:	81 c3 64 ee 01 00    	add    $0x1ee64,%ebx
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f010157a:	8d 83 6c 59 fe ff    	lea    -0x1a694(%ebx),%eax
+f0101580:	50                   	push   %eax
+f0101581:	e8 5e 24 00 00       	call   f01039e4 <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0101586:	8d 83 90 59 fe ff    	lea    -0x1a670(%ebx),%eax
+f010158c:	89 04 24             	mov    %eax,(%esp)
+f010158f:	e8 50 24 00 00       	call   f01039e4 <cprintf>
+f0101594:	83 c4 10             	add    $0x10,%esp
+		while (*buf && strchr(WHITESPACE, *buf))
+f0101597:	8d b3 b0 56 fe ff    	lea    -0x1a950(%ebx),%esi
+f010159d:	89 f7                	mov    %esi,%edi
+f010159f:	eb 4a                	jmp    f01015eb <monitor+0x85>
+f01015a1:	83 ec 08             	sub    $0x8,%esp
+f01015a4:	0f be c0             	movsbl %al,%eax
+f01015a7:	50                   	push   %eax
+f01015a8:	57                   	push   %edi
+f01015a9:	e8 27 3d 00 00       	call   f01052d5 <strchr>
+f01015ae:	83 c4 10             	add    $0x10,%esp
+f01015b1:	85 c0                	test   %eax,%eax
+f01015b3:	74 08                	je     f01015bd <monitor+0x57>
+			*buf++ = 0;
+f01015b5:	c6 06 00             	movb   $0x0,(%esi)
+f01015b8:	8d 76 01             	lea    0x1(%esi),%esi
+f01015bb:	eb 76                	jmp    f0101633 <monitor+0xcd>
+		if (*buf == 0)
+f01015bd:	80 3e 00             	cmpb   $0x0,(%esi)
+f01015c0:	74 7c                	je     f010163e <monitor+0xd8>
+		if (argc == MAXARGS-1) {
+f01015c2:	83 7d a4 0f          	cmpl   $0xf,-0x5c(%ebp)
+f01015c6:	74 0f                	je     f01015d7 <monitor+0x71>
+		argv[argc++] = buf;
+f01015c8:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01015cb:	8d 48 01             	lea    0x1(%eax),%ecx
+f01015ce:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+f01015d1:	89 74 85 a8          	mov    %esi,-0x58(%ebp,%eax,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f01015d5:	eb 41                	jmp    f0101618 <monitor+0xb2>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f01015d7:	83 ec 08             	sub    $0x8,%esp
+f01015da:	6a 10                	push   $0x10
+f01015dc:	8d 83 b5 56 fe ff    	lea    -0x1a94b(%ebx),%eax
+f01015e2:	50                   	push   %eax
+f01015e3:	e8 fc 23 00 00       	call   f01039e4 <cprintf>
+			return 0;
+f01015e8:	83 c4 10             	add    $0x10,%esp
+
+
+	while (1) {
+		buf = readline("K> ");
+f01015eb:	8d 83 ac 56 fe ff    	lea    -0x1a954(%ebx),%eax
+f01015f1:	89 c6                	mov    %eax,%esi
+f01015f3:	83 ec 0c             	sub    $0xc,%esp
+f01015f6:	56                   	push   %esi
+f01015f7:	e8 87 3a 00 00       	call   f0105083 <readline>
+		if (buf != NULL)
+f01015fc:	83 c4 10             	add    $0x10,%esp
+f01015ff:	85 c0                	test   %eax,%eax
+f0101601:	74 f0                	je     f01015f3 <monitor+0x8d>
+	argv[argc] = 0;
+f0101603:	89 c6                	mov    %eax,%esi
+f0101605:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f010160c:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+f0101613:	eb 1e                	jmp    f0101633 <monitor+0xcd>
+			buf++;
+f0101615:	83 c6 01             	add    $0x1,%esi
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0101618:	0f b6 06             	movzbl (%esi),%eax
+f010161b:	84 c0                	test   %al,%al
+f010161d:	74 14                	je     f0101633 <monitor+0xcd>
+f010161f:	83 ec 08             	sub    $0x8,%esp
+f0101622:	0f be c0             	movsbl %al,%eax
+f0101625:	50                   	push   %eax
+f0101626:	57                   	push   %edi
+f0101627:	e8 a9 3c 00 00       	call   f01052d5 <strchr>
+f010162c:	83 c4 10             	add    $0x10,%esp
+f010162f:	85 c0                	test   %eax,%eax
+f0101631:	74 e2                	je     f0101615 <monitor+0xaf>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0101633:	0f b6 06             	movzbl (%esi),%eax
+f0101636:	84 c0                	test   %al,%al
+f0101638:	0f 85 63 ff ff ff    	jne    f01015a1 <monitor+0x3b>
+	argv[argc] = 0;
+f010163e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0101641:	c7 44 85 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%eax,4)
+f0101648:	00 
+	if (argc == 0)
+f0101649:	85 c0                	test   %eax,%eax
+f010164b:	74 9e                	je     f01015eb <monitor+0x85>
+f010164d:	8d b3 c8 00 00 00    	lea    0xc8(%ebx),%esi
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0101653:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101658:	89 7d a0             	mov    %edi,-0x60(%ebp)
+f010165b:	89 c7                	mov    %eax,%edi
+		if (strcmp(argv[0], commands[i].name) == 0)
+f010165d:	83 ec 08             	sub    $0x8,%esp
+f0101660:	ff 36                	push   (%esi)
+f0101662:	ff 75 a8             	push   -0x58(%ebp)
+f0101665:	e8 0a 3c 00 00       	call   f0105274 <strcmp>
+f010166a:	83 c6 0c             	add    $0xc,%esi
+f010166d:	83 c4 10             	add    $0x10,%esp
+f0101670:	85 c0                	test   %eax,%eax
+f0101672:	74 25                	je     f0101699 <monitor+0x133>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0101674:	83 c7 01             	add    $0x1,%edi
+f0101677:	83 ff 07             	cmp    $0x7,%edi
+f010167a:	75 e1                	jne    f010165d <monitor+0xf7>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f010167c:	8b 7d a0             	mov    -0x60(%ebp),%edi
+f010167f:	83 ec 08             	sub    $0x8,%esp
+f0101682:	ff 75 a8             	push   -0x58(%ebp)
+f0101685:	8d 83 d2 56 fe ff    	lea    -0x1a92e(%ebx),%eax
+f010168b:	50                   	push   %eax
+f010168c:	e8 53 23 00 00       	call   f01039e4 <cprintf>
+	return 0;
+f0101691:	83 c4 10             	add    $0x10,%esp
+f0101694:	e9 52 ff ff ff       	jmp    f01015eb <monitor+0x85>
+			return commands[i].func(argc, argv, tf);
+f0101699:	89 f8                	mov    %edi,%eax
+f010169b:	8b 7d a0             	mov    -0x60(%ebp),%edi
+f010169e:	83 ec 04             	sub    $0x4,%esp
+f01016a1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f01016a4:	ff 75 08             	push   0x8(%ebp)
+f01016a7:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f01016aa:	52                   	push   %edx
+f01016ab:	ff 75 a4             	push   -0x5c(%ebp)
+f01016ae:	ff 94 83 d0 00 00 00 	call   *0xd0(%ebx,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f01016b5:	83 c4 10             	add    $0x10,%esp
+f01016b8:	85 c0                	test   %eax,%eax
+f01016ba:	0f 89 2b ff ff ff    	jns    f01015eb <monitor+0x85>
+				break;
+	}
+}
+f01016c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01016c3:	5b                   	pop    %ebx
+f01016c4:	5e                   	pop    %esi
+f01016c5:	5f                   	pop    %edi
+f01016c6:	5d                   	pop    %ebp
+f01016c7:	c3                   	ret
+
+f01016c8 <memmap_add>:
+// Detect machine's physical memory setup.
+// --------------------------------------------------------------
+
+static void
+memmap_add(uint64_t addr, uint64_t len, uint32_t type)
+{
+f01016c8:	55                   	push   %ebp
+f01016c9:	89 e5                	mov    %esp,%ebp
+f01016cb:	57                   	push   %edi
+f01016cc:	56                   	push   %esi
+f01016cd:	53                   	push   %ebx
+f01016ce:	83 ec 14             	sub    $0x14,%esp
+f01016d1:	e8 53 fa ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f01016d6:	81 c1 02 ed 01 00    	add    $0x1ed02,%ecx
+f01016dc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+f01016df:	89 55 ec             	mov    %edx,-0x14(%ebp)
+f01016e2:	8b 75 08             	mov    0x8(%ebp),%esi
+f01016e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (nmemmap == BI_MAXE820 || len == 0)
+f01016e8:	8b b9 08 08 00 00    	mov    0x808(%ecx),%edi
+f01016ee:	89 fa                	mov    %edi,%edx
+f01016f0:	89 f7                	mov    %esi,%edi
+f01016f2:	09 df                	or     %ebx,%edi
+f01016f4:	74 40                	je     f0101736 <memmap_add+0x6e>
+f01016f6:	89 d7                	mov    %edx,%edi
+f01016f8:	83 fa 20             	cmp    $0x20,%edx
+f01016fb:	74 39                	je     f0101736 <memmap_add+0x6e>
+		return;
+	memmap[nmemmap].e_addr = addr;
+f01016fd:	8d 14 95 00 00 00 00 	lea    0x0(,%edx,4),%edx
+f0101704:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0101707:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010170a:	01 d7                	add    %edx,%edi
+f010170c:	8d bc b9 28 08 00 00 	lea    0x828(%ecx,%edi,4),%edi
+f0101713:	8b 45 e8             	mov    -0x18(%ebp),%eax
+f0101716:	8b 55 ec             	mov    -0x14(%ebp),%edx
+f0101719:	89 07                	mov    %eax,(%edi)
+f010171b:	89 57 04             	mov    %edx,0x4(%edi)
+	memmap[nmemmap].e_len = len;
+f010171e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101721:	89 77 08             	mov    %esi,0x8(%edi)
+f0101724:	89 5f 0c             	mov    %ebx,0xc(%edi)
+	memmap[nmemmap].e_type = type;
+f0101727:	8b 55 10             	mov    0x10(%ebp),%edx
+f010172a:	89 57 10             	mov    %edx,0x10(%edi)
+	nmemmap++;
+f010172d:	83 c0 01             	add    $0x1,%eax
+f0101730:	89 81 08 08 00 00    	mov    %eax,0x808(%ecx)
+}
+f0101736:	83 c4 14             	add    $0x14,%esp
+f0101739:	5b                   	pop    %ebx
+f010173a:	5e                   	pop    %esi
+f010173b:	5f                   	pop    %edi
+f010173c:	5d                   	pop    %ebp
+f010173d:	c3                   	ret
+
+f010173e <boot_alloc_init>:
+static char *nextfree;
+#define BOOT_ALLOC_LIMIT	((char *) (KERNBASE + PTSIZE))
+
+static void
+boot_alloc_init(void)
+{
+f010173e:	e8 e2 f9 ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0101743:	05 95 ec 01 00       	add    $0x1ec95,%eax
+	extern char end[];
+
+	if (!nextfree)
+f0101748:	83 b8 b8 0a 00 00 00 	cmpl   $0x0,0xab8(%eax)
+f010174f:	74 01                	je     f0101752 <boot_alloc_init+0x14>
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+}
+f0101751:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f0101752:	c7 c2 a0 1e 12 f0    	mov    $0xf0121ea0,%edx
+f0101758:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+f010175e:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0101764:	89 90 b8 0a 00 00    	mov    %edx,0xab8(%eax)
+}
+f010176a:	eb e5                	jmp    f0101751 <boot_alloc_init+0x13>
+
+f010176c <buddy_push>:
+// singly in a per-CPU cache.
+// --------------------------------------------------------------
+
+static void
+buddy_push(struct PageInfo *pp, int order)
+{
+f010176c:	55                   	push   %ebp
+f010176d:	89 e5                	mov    %esp,%ebp
+f010176f:	53                   	push   %ebx
+f0101770:	e8 b4 f9 ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f0101775:	81 c1 63 ec 01 00    	add    $0x1ec63,%ecx
+	pp->pp_order = order;
+f010177b:	88 50 0a             	mov    %dl,0xa(%eax)
+	pp->pp_flags |= PP_BUDDY;
+f010177e:	80 48 0b 01          	orb    $0x1,0xb(%eax)
+	pp->pp_prev = NULL;
+f0101782:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	pp->pp_link = free_area[order];
+f0101789:	8b 9c 91 68 0b 00 00 	mov    0xb68(%ecx,%edx,4),%ebx
+f0101790:	89 18                	mov    %ebx,(%eax)
+	if (pp->pp_link)
+f0101792:	85 db                	test   %ebx,%ebx
+f0101794:	74 03                	je     f0101799 <buddy_push+0x2d>
+		pp->pp_link->pp_prev = pp;
+f0101796:	89 43 04             	mov    %eax,0x4(%ebx)
+	free_area[order] = pp;
+f0101799:	89 84 91 68 0b 00 00 	mov    %eax,0xb68(%ecx,%edx,4)
+	nfree_area[order]++;
+f01017a0:	83 84 91 28 0b 00 00 	addl   $0x1,0xb28(%ecx,%edx,4)
+f01017a7:	01 
+}
+f01017a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01017ab:	c9                   	leave
+f01017ac:	c3                   	ret
+
+f01017ad <buddy_unlink>:
+
+static void
+buddy_unlink(struct PageInfo *pp, int order)
+{
+f01017ad:	55                   	push   %ebp
+f01017ae:	89 e5                	mov    %esp,%ebp
+f01017b0:	56                   	push   %esi
+f01017b1:	53                   	push   %ebx
+f01017b2:	e8 72 f9 ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f01017b7:	81 c1 21 ec 01 00    	add    $0x1ec21,%ecx
+	if (pp->pp_prev)
+f01017bd:	8b 58 04             	mov    0x4(%eax),%ebx
+f01017c0:	85 db                	test   %ebx,%ebx
+f01017c2:	74 2d                	je     f01017f1 <buddy_unlink+0x44>
+		pp->pp_prev->pp_link = pp->pp_link;
+f01017c4:	8b 30                	mov    (%eax),%esi
+f01017c6:	89 33                	mov    %esi,(%ebx)
+	else
+		free_area[order] = pp->pp_link;
+	if (pp->pp_link)
+f01017c8:	8b 18                	mov    (%eax),%ebx
+f01017ca:	85 db                	test   %ebx,%ebx
+f01017cc:	74 06                	je     f01017d4 <buddy_unlink+0x27>
+		pp->pp_link->pp_prev = pp->pp_prev;
+f01017ce:	8b 70 04             	mov    0x4(%eax),%esi
+f01017d1:	89 73 04             	mov    %esi,0x4(%ebx)
+	pp->pp_link = pp->pp_prev = NULL;
+f01017d4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f01017db:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp->pp_flags &= ~PP_BUDDY;
+f01017e1:	80 60 0b fe          	andb   $0xfe,0xb(%eax)
+	nfree_area[order]--;
+f01017e5:	83 ac 91 28 0b 00 00 	subl   $0x1,0xb28(%ecx,%edx,4)
+f01017ec:	01 
+}
+f01017ed:	5b                   	pop    %ebx
+f01017ee:	5e                   	pop    %esi
+f01017ef:	5d                   	pop    %ebp
+f01017f0:	c3                   	ret
+		free_area[order] = pp->pp_link;
+f01017f1:	8b 18                	mov    (%eax),%ebx
+f01017f3:	89 9c 91 68 0b 00 00 	mov    %ebx,0xb68(%ecx,%edx,4)
+f01017fa:	eb cc                	jmp    f01017c8 <buddy_unlink+0x1b>
+
+f01017fc <buddy_alloc>:
+
+// Take a block of 2^order pages off the buddy lists, splitting the
+// smallest larger block if there is no block of the right size.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+f01017fc:	55                   	push   %ebp
+f01017fd:	89 e5                	mov    %esp,%ebp
+f01017ff:	57                   	push   %edi
+f0101800:	56                   	push   %esi
+f0101801:	53                   	push   %ebx
+f0101802:	83 ec 0c             	sub    $0xc,%esp
+f0101805:	e8 c7 15 00 00       	call   f0102dd1 <__x86.get_pc_thunk.dx>
+f010180a:	81 c2 ce eb 01 00    	add    $0x1ebce,%edx
+f0101810:	89 c6                	mov    %eax,%esi
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= MAXORDER && !free_area[k]; k++)
+f0101812:	89 c3                	mov    %eax,%ebx
+f0101814:	eb 03                	jmp    f0101819 <buddy_alloc+0x1d>
+f0101816:	83 c3 01             	add    $0x1,%ebx
+f0101819:	83 fb 0a             	cmp    $0xa,%ebx
+f010181c:	7f 44                	jg     f0101862 <buddy_alloc+0x66>
+f010181e:	83 bc 9a 68 0b 00 00 	cmpl   $0x0,0xb68(%edx,%ebx,4)
+f0101825:	00 
+f0101826:	74 ee                	je     f0101816 <buddy_alloc+0x1a>
+		/* do nothing */;
+	if (k > MAXORDER)
+		return NULL;
+	pp = free_area[k];
+f0101828:	8b bc 9a 68 0b 00 00 	mov    0xb68(%edx,%ebx,4),%edi
+	buddy_unlink(pp, k);
+f010182f:	89 da                	mov    %ebx,%edx
+f0101831:	89 f8                	mov    %edi,%eax
+f0101833:	e8 75 ff ff ff       	call   f01017ad <buddy_unlink>
+	// Return the upper halves to the lists as we split.
+	while (k > order) {
+f0101838:	39 f3                	cmp    %esi,%ebx
+f010183a:	7e 17                	jle    f0101853 <buddy_alloc+0x57>
+		k--;
+f010183c:	83 eb 01             	sub    $0x1,%ebx
+		buddy_push(pp + (1 << k), k);
+f010183f:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0101844:	89 d9                	mov    %ebx,%ecx
+f0101846:	d3 e0                	shl    %cl,%eax
+f0101848:	01 f8                	add    %edi,%eax
+f010184a:	89 da                	mov    %ebx,%edx
+f010184c:	e8 1b ff ff ff       	call   f010176c <buddy_push>
+f0101851:	eb e5                	jmp    f0101838 <buddy_alloc+0x3c>
+	}
+	pp->pp_order = order;
+f0101853:	89 f0                	mov    %esi,%eax
+f0101855:	88 47 0a             	mov    %al,0xa(%edi)
+	return pp;
+}
+f0101858:	89 f8                	mov    %edi,%eax
+f010185a:	83 c4 0c             	add    $0xc,%esp
+f010185d:	5b                   	pop    %ebx
+f010185e:	5e                   	pop    %esi
+f010185f:	5f                   	pop    %edi
+f0101860:	5d                   	pop    %ebp
+f0101861:	c3                   	ret
+		return NULL;
+f0101862:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101867:	eb ef                	jmp    f0101858 <buddy_alloc+0x5c>
+
+f0101869 <buddy_free>:
+// Return a block of 2^order pages to the buddy lists, merging it with
+// its buddy for as long as the buddy is free too.  A block's buddy is
+// the block it was split from, at page number pn ^ 2^order.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+f0101869:	55                   	push   %ebp
+f010186a:	89 e5                	mov    %esp,%ebp
+f010186c:	57                   	push   %edi
+f010186d:	56                   	push   %esi
+f010186e:	53                   	push   %ebx
+f010186f:	83 ec 1c             	sub    $0x1c,%esp
+f0101872:	e8 ba f8 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f0101877:	81 c7 61 eb 01 00    	add    $0x1eb61,%edi
+f010187d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0101880:	89 d3                	mov    %edx,%ebx
+	size_t pn = pp - pages, bn;
+f0101882:	2b 87 a8 0a 00 00    	sub    0xaa8(%edi),%eax
+f0101888:	c1 f8 02             	sar    $0x2,%eax
+f010188b:	69 f8 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edi
+
+	for (; order < MAXORDER; order++) {
+f0101891:	83 fb 09             	cmp    $0x9,%ebx
+f0101894:	7f 42                	jg     f01018d8 <buddy_free+0x6f>
+		bn = pn ^ (1 << order);
+f0101896:	be 01 00 00 00       	mov    $0x1,%esi
+f010189b:	89 d9                	mov    %ebx,%ecx
+f010189d:	d3 e6                	shl    %cl,%esi
+f010189f:	89 f0                	mov    %esi,%eax
+f01018a1:	31 f8                	xor    %edi,%eax
+		if (bn >= npages || !(pages[bn].pp_flags & PP_BUDDY)
+f01018a3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01018a6:	3b 81 b0 0a 00 00    	cmp    0xab0(%ecx),%eax
+f01018ac:	73 2a                	jae    f01018d8 <buddy_free+0x6f>
+f01018ae:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01018b1:	8b 81 a8 0a 00 00    	mov    0xaa8(%ecx),%eax
+f01018b7:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01018ba:	f6 40 0b 01          	testb  $0x1,0xb(%eax)
+f01018be:	74 18                	je     f01018d8 <buddy_free+0x6f>
+		    || pages[bn].pp_order != order)
+f01018c0:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+f01018c4:	39 da                	cmp    %ebx,%edx
+f01018c6:	75 10                	jne    f01018d8 <buddy_free+0x6f>
+			break;
+		buddy_unlink(&pages[bn], order);
+f01018c8:	89 da                	mov    %ebx,%edx
+f01018ca:	e8 de fe ff ff       	call   f01017ad <buddy_unlink>
+		pn &= ~(size_t) (1 << order);
+f01018cf:	f7 d6                	not    %esi
+f01018d1:	21 f7                	and    %esi,%edi
+	for (; order < MAXORDER; order++) {
+f01018d3:	83 c3 01             	add    $0x1,%ebx
+f01018d6:	eb b9                	jmp    f0101891 <buddy_free+0x28>
+	}
+	buddy_push(&pages[pn], order);
+f01018d8:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f01018db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01018de:	8b 80 a8 0a 00 00    	mov    0xaa8(%eax),%eax
+f01018e4:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01018e7:	89 da                	mov    %ebx,%edx
+f01018e9:	e8 7e fe ff ff       	call   f010176c <buddy_push>
+}
+f01018ee:	83 c4 1c             	add    $0x1c,%esp
+f01018f1:	5b                   	pop    %ebx
+f01018f2:	5e                   	pop    %esi
+f01018f3:	5f                   	pop    %edi
+f01018f4:	5d                   	pop    %ebp
+f01018f5:	c3                   	ret
+
+f01018f6 <i386_detect_memory>:
+{
+f01018f6:	55                   	push   %ebp
+f01018f7:	89 e5                	mov    %esp,%ebp
+f01018f9:	57                   	push   %edi
+f01018fa:	56                   	push   %esi
+f01018fb:	53                   	push   %ebx
+f01018fc:	83 ec 5c             	sub    $0x5c,%esp
+f01018ff:	e8 21 f8 ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0101904:	05 d4 ea 01 00       	add    $0x1ead4,%eax
+f0101909:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	if (bi->bi_magic == BOOTINFO_MAGIC && bi->bi_ne820 > 0) {
+f010190c:	81 3d 00 10 00 f0 4a 	cmpl   $0x42534f4a,0xf0001000
+f0101913:	4f 53 42 
+f0101916:	0f 84 cd 00 00 00    	je     f01019e9 <i386_detect_memory+0xf3>
+	mbi = (struct Multiboot_info *) (KERNBASE + multiboot_info);
+f010191c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010191f:	c7 c0 00 e0 11 f0    	mov    $0xf011e000,%eax
+f0101925:	8b 00                	mov    (%eax),%eax
+	if (multiboot_info && multiboot_info < PTSIZE - sizeof(*mbi)
+f0101927:	8d 50 ff             	lea    -0x1(%eax),%edx
+f010192a:	81 fa ca ff 3f 00    	cmp    $0x3fffca,%edx
+f0101930:	77 20                	ja     f0101952 <i386_detect_memory+0x5c>
+	mbi = (struct Multiboot_info *) (KERNBASE + multiboot_info);
+f0101932:	8d b8 00 00 00 f0    	lea    -0x10000000(%eax),%edi
+	    && (mbi->flags & MULTIBOOT_INFO_MMAP)
+f0101938:	f6 80 00 00 00 f0 40 	testb  $0x40,-0x10000000(%eax)
+f010193f:	74 11                	je     f0101952 <i386_detect_memory+0x5c>
+	    && mbi->mmap_addr + mbi->mmap_length <= PTSIZE) {
+f0101941:	8b 47 2c             	mov    0x2c(%edi),%eax
+f0101944:	03 47 30             	add    0x30(%edi),%eax
+f0101947:	3d 00 00 40 00       	cmp    $0x400000,%eax
+f010194c:	0f 86 38 01 00 00    	jbe    f0101a8a <i386_detect_memory+0x194>
+	cprintf("No memory map; assuming 4MB\n");
+f0101952:	83 ec 0c             	sub    $0xc,%esp
+f0101955:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0101958:	8d 83 a0 5a fe ff    	lea    -0x1a560(%ebx),%eax
+f010195e:	50                   	push   %eax
+f010195f:	e8 80 20 00 00       	call   f01039e4 <cprintf>
+	memmap_add(0, IOPHYSMEM, E820_RAM);
+f0101964:	83 c4 0c             	add    $0xc,%esp
+f0101967:	6a 01                	push   $0x1
+f0101969:	6a 00                	push   $0x0
+f010196b:	68 00 00 0a 00       	push   $0xa0000
+f0101970:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101975:	ba 00 00 00 00       	mov    $0x0,%edx
+f010197a:	e8 49 fd ff ff       	call   f01016c8 <memmap_add>
+	memmap_add(EXTPHYSMEM, PTSIZE - EXTPHYSMEM, E820_RAM);
+f010197f:	83 c4 0c             	add    $0xc,%esp
+f0101982:	6a 01                	push   $0x1
+f0101984:	6a 00                	push   $0x0
+f0101986:	68 00 00 30 00       	push   $0x300000
+f010198b:	b8 00 00 10 00       	mov    $0x100000,%eax
+f0101990:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101995:	e8 2e fd ff ff       	call   f01016c8 <memmap_add>
+f010199a:	83 c4 10             	add    $0x10,%esp
+	npages_basemem = npages_extmem = 0;
+f010199d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01019a0:	c7 80 94 0b 00 00 00 	movl   $0x0,0xb94(%eax)
+f01019a7:	00 00 00 
+	for (i = 0; i < nmemmap; i++) {
+f01019aa:	8b 98 08 08 00 00    	mov    0x808(%eax),%ebx
+f01019b0:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f01019b3:	8d b0 28 08 00 00    	lea    0x828(%eax),%esi
+f01019b9:	c6 45 b3 00          	movb   $0x0,-0x4d(%ebp)
+f01019bd:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+f01019c4:	bf 00 00 00 00       	mov    $0x0,%edi
+	npages_basemem = npages_extmem = 0;
+f01019c9:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+	top = 0;
+f01019d0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f01019d7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f01019de:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f01019e1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+	for (i = 0; i < nmemmap; i++) {
+f01019e4:	e9 cb 00 00 00       	jmp    f0101ab4 <i386_detect_memory+0x1be>
+	if (bi->bi_magic == BOOTINFO_MAGIC && bi->bi_ne820 > 0) {
+f01019e9:	83 3d 0c 10 00 f0 00 	cmpl   $0x0,0xf000100c
+f01019f0:	0f 84 26 ff ff ff    	je     f010191c <i386_detect_memory+0x26>
+		for (i = 0; i < bi->bi_ne820 && i < BI_MAXE820; i++)
+f01019f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01019fb:	bf 00 10 00 f0       	mov    $0xf0001000,%edi
+f0101a00:	eb 3e                	jmp    f0101a40 <i386_detect_memory+0x14a>
+			memmap_add(bi->bi_e820[i].e_addr, bi->bi_e820[i].e_len,
+f0101a02:	8d 0c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%ecx
+f0101a09:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+f0101a0c:	8b 14 85 14 12 00 f0 	mov    -0xfffedec(,%eax,4),%edx
+f0101a13:	8b 04 85 10 12 00 f0 	mov    -0xfffedf0(,%eax,4),%eax
+f0101a1a:	83 ec 04             	sub    $0x4,%esp
+f0101a1d:	8d 34 19             	lea    (%ecx,%ebx,1),%esi
+f0101a20:	ff 34 b5 20 12 00 f0 	push   -0xfffede0(,%esi,4)
+f0101a27:	ff 34 b5 1c 12 00 f0 	push   -0xfffede4(,%esi,4)
+f0101a2e:	ff 34 b5 18 12 00 f0 	push   -0xfffede8(,%esi,4)
+f0101a35:	e8 8e fc ff ff       	call   f01016c8 <memmap_add>
+		for (i = 0; i < bi->bi_ne820 && i < BI_MAXE820; i++)
+f0101a3a:	83 c3 01             	add    $0x1,%ebx
+f0101a3d:	83 c4 10             	add    $0x10,%esp
+f0101a40:	3b 5f 0c             	cmp    0xc(%edi),%ebx
+f0101a43:	0f 83 54 ff ff ff    	jae    f010199d <i386_detect_memory+0xa7>
+f0101a49:	83 fb 1f             	cmp    $0x1f,%ebx
+f0101a4c:	7e b4                	jle    f0101a02 <i386_detect_memory+0x10c>
+f0101a4e:	e9 4a ff ff ff       	jmp    f010199d <i386_detect_memory+0xa7>
+				(KERNBASE + mbi->mmap_addr + off);
+f0101a53:	8b 47 30             	mov    0x30(%edi),%eax
+f0101a56:	8d 9c 06 00 00 00 f0 	lea    -0x10000000(%esi,%eax,1),%ebx
+			memmap_add(mm->addr, mm->len, mm->type);
+f0101a5d:	8b 43 04             	mov    0x4(%ebx),%eax
+f0101a60:	8b 53 08             	mov    0x8(%ebx),%edx
+f0101a63:	83 ec 04             	sub    $0x4,%esp
+f0101a66:	ff 73 14             	push   0x14(%ebx)
+f0101a69:	ff 73 10             	push   0x10(%ebx)
+f0101a6c:	ff 73 0c             	push   0xc(%ebx)
+f0101a6f:	e8 54 fc ff ff       	call   f01016c8 <memmap_add>
+		     off += mm->size + sizeof(mm->size)) {
+f0101a74:	8b 03                	mov    (%ebx),%eax
+f0101a76:	8d 74 06 04          	lea    0x4(%esi,%eax,1),%esi
+f0101a7a:	83 c4 10             	add    $0x10,%esp
+		for (off = 0; off + sizeof(*mm) <= mbi->mmap_length;
+f0101a7d:	8d 46 18             	lea    0x18(%esi),%eax
+f0101a80:	39 47 2c             	cmp    %eax,0x2c(%edi)
+f0101a83:	73 ce                	jae    f0101a53 <i386_detect_memory+0x15d>
+f0101a85:	e9 13 ff ff ff       	jmp    f010199d <i386_detect_memory+0xa7>
+f0101a8a:	be 00 00 00 00       	mov    $0x0,%esi
+f0101a8f:	eb ec                	jmp    f0101a7d <i386_detect_memory+0x187>
+f0101a91:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101a94:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0101a97:	39 c8                	cmp    %ecx,%eax
+f0101a99:	89 d6                	mov    %edx,%esi
+f0101a9b:	19 de                	sbb    %ebx,%esi
+f0101a9d:	0f 42 c1             	cmovb  %ecx,%eax
+f0101aa0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0101aa3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101aa6:	0f 42 c3             	cmovb  %ebx,%eax
+f0101aa9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = 0; i < nmemmap; i++) {
+f0101aac:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+f0101ab0:	83 45 d8 14          	addl   $0x14,-0x28(%ebp)
+f0101ab4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0101ab7:	39 55 cc             	cmp    %edx,-0x34(%ebp)
+f0101aba:	0f 8e 02 01 00 00    	jle    f0101bc2 <i386_detect_memory+0x2cc>
+		if (memmap[i].e_type != E820_RAM)
+f0101ac0:	8b 75 d8             	mov    -0x28(%ebp),%esi
+f0101ac3:	83 7e 10 01          	cmpl   $0x1,0x10(%esi)
+f0101ac7:	75 e3                	jne    f0101aac <i386_detect_memory+0x1b6>
+		start = (memmap[i].e_addr + PGSIZE - 1)
+f0101ac9:	8b 06                	mov    (%esi),%eax
+f0101acb:	8b 56 04             	mov    0x4(%esi),%edx
+f0101ace:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0101ad3:	83 d2 00             	adc    $0x0,%edx
+f0101ad6:	89 c7                	mov    %eax,%edi
+f0101ad8:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+f0101ade:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0101ae1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		end = memmap[i].e_addr + memmap[i].e_len;
+f0101ae4:	8b 06                	mov    (%esi),%eax
+f0101ae6:	8b 56 04             	mov    0x4(%esi),%edx
+f0101ae9:	03 46 08             	add    0x8(%esi),%eax
+f0101aec:	13 56 0c             	adc    0xc(%esi),%edx
+		if (end > 0x100000000ULL - KERNBASE)
+f0101aef:	bf 00 00 00 10       	mov    $0x10000000,%edi
+f0101af4:	89 fe                	mov    %edi,%esi
+f0101af6:	39 c7                	cmp    %eax,%edi
+f0101af8:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101afd:	19 d7                	sbb    %edx,%edi
+f0101aff:	0f 42 c6             	cmovb  %esi,%eax
+f0101b02:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101b07:	0f 42 d7             	cmovb  %edi,%edx
+		end &= ~(uint64_t) (PGSIZE - 1);
+f0101b0a:	89 c7                	mov    %eax,%edi
+f0101b0c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+f0101b12:	89 f9                	mov    %edi,%ecx
+f0101b14:	89 d3                	mov    %edx,%ebx
+		if (start >= end)
+f0101b16:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101b19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0101b1c:	39 f8                	cmp    %edi,%eax
+f0101b1e:	89 d7                	mov    %edx,%edi
+f0101b20:	19 df                	sbb    %ebx,%edi
+f0101b22:	73 88                	jae    f0101aac <i386_detect_memory+0x1b6>
+		if (start < IOPHYSMEM)
+f0101b24:	bf ff ff 09 00       	mov    $0x9ffff,%edi
+f0101b29:	39 c7                	cmp    %eax,%edi
+f0101b2b:	be 00 00 00 00       	mov    $0x0,%esi
+f0101b30:	1b 75 e4             	sbb    -0x1c(%ebp),%esi
+f0101b33:	72 38                	jb     f0101b6d <i386_detect_memory+0x277>
+			npages_basemem += ((end < IOPHYSMEM ? end : IOPHYSMEM)
+f0101b35:	ba 00 00 0a 00       	mov    $0xa0000,%edx
+f0101b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101b3f:	39 ca                	cmp    %ecx,%edx
+f0101b41:	89 c6                	mov    %eax,%esi
+f0101b43:	19 de                	sbb    %ebx,%esi
+f0101b45:	0f 43 d1             	cmovae %ecx,%edx
+f0101b48:	89 55 c0             	mov    %edx,-0x40(%ebp)
+f0101b4b:	89 c6                	mov    %eax,%esi
+f0101b4d:	0f 43 f3             	cmovae %ebx,%esi
+f0101b50:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+					   - start) >> PGSHIFT;
+f0101b53:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0101b56:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0101b59:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0101b5c:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+f0101b5f:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+f0101b63:	c1 ea 0c             	shr    $0xc,%edx
+			npages_basemem += ((end < IOPHYSMEM ? end : IOPHYSMEM)
+f0101b66:	01 45 ac             	add    %eax,-0x54(%ebp)
+f0101b69:	c6 45 b3 01          	movb   $0x1,-0x4d(%ebp)
+		if (end > EXTPHYSMEM)
+f0101b6d:	b8 00 00 10 00       	mov    $0x100000,%eax
+f0101b72:	39 c8                	cmp    %ecx,%eax
+f0101b74:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101b79:	19 d8                	sbb    %ebx,%eax
+f0101b7b:	0f 83 10 ff ff ff    	jae    f0101a91 <i386_detect_memory+0x19b>
+						 : EXTPHYSMEM)) >> PGSHIFT;
+f0101b81:	ba 00 00 10 00       	mov    $0x100000,%edx
+f0101b86:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101b8b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0101b8e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101b91:	39 d6                	cmp    %edx,%esi
+f0101b93:	89 fe                	mov    %edi,%esi
+f0101b95:	19 c6                	sbb    %eax,%esi
+f0101b97:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0101b9a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101b9d:	0f 43 d6             	cmovae %esi,%edx
+f0101ba0:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0101ba3:	0f 43 c7             	cmovae %edi,%eax
+f0101ba6:	89 45 bc             	mov    %eax,-0x44(%ebp)
+			npages_extmem += (end - (start > EXTPHYSMEM ? start
+f0101ba9:	89 c8                	mov    %ecx,%eax
+f0101bab:	89 da                	mov    %ebx,%edx
+f0101bad:	2b 45 b8             	sub    -0x48(%ebp),%eax
+f0101bb0:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+						 : EXTPHYSMEM)) >> PGSHIFT;
+f0101bb3:	0f ac d0 0c          	shrd   $0xc,%edx,%eax
+f0101bb7:	c1 ea 0c             	shr    $0xc,%edx
+			npages_extmem += (end - (start > EXTPHYSMEM ? start
+f0101bba:	01 45 b4             	add    %eax,-0x4c(%ebp)
+f0101bbd:	e9 cf fe ff ff       	jmp    f0101a91 <i386_detect_memory+0x19b>
+f0101bc2:	80 7d b3 00          	cmpb   $0x0,-0x4d(%ebp)
+f0101bc6:	74 0c                	je     f0101bd4 <i386_detect_memory+0x2de>
+f0101bc8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0101bcb:	8b 5d ac             	mov    -0x54(%ebp),%ebx
+f0101bce:	89 98 94 0b 00 00    	mov    %ebx,0xb94(%eax)
+	npages = top >> PGSHIFT;
+f0101bd4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0101bd7:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0101bda:	0f ac d9 0c          	shrd   $0xc,%ebx,%ecx
+f0101bde:	c1 eb 0c             	shr    $0xc,%ebx
+f0101be1:	89 ca                	mov    %ecx,%edx
+f0101be3:	8b 75 c8             	mov    -0x38(%ebp),%esi
+f0101be6:	89 8e b0 0a 00 00    	mov    %ecx,0xab0(%esi)
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101bec:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f0101bef:	c1 e0 02             	shl    $0x2,%eax
+f0101bf2:	50                   	push   %eax
+f0101bf3:	89 f3                	mov    %esi,%ebx
+f0101bf5:	8b 86 94 0b 00 00    	mov    0xb94(%esi),%eax
+f0101bfb:	c1 e0 02             	shl    $0x2,%eax
+f0101bfe:	50                   	push   %eax
+f0101bff:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+f0101c06:	50                   	push   %eax
+f0101c07:	8d 86 3c 5c fe ff    	lea    -0x1a3c4(%esi),%eax
+f0101c0d:	50                   	push   %eax
+f0101c0e:	e8 d1 1d 00 00       	call   f01039e4 <cprintf>
+}
+f0101c13:	83 c4 10             	add    $0x10,%esp
+f0101c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c19:	5b                   	pop    %ebx
+f0101c1a:	5e                   	pop    %esi
+f0101c1b:	5f                   	pop    %edi
+f0101c1c:	5d                   	pop    %ebp
+f0101c1d:	c3                   	ret
+
+f0101c1e <boot_alloc_align>:
+{
+f0101c1e:	55                   	push   %ebp
+f0101c1f:	89 e5                	mov    %esp,%ebp
+f0101c21:	57                   	push   %edi
+f0101c22:	56                   	push   %esi
+f0101c23:	53                   	push   %ebx
+f0101c24:	83 ec 0c             	sub    $0xc,%esp
+f0101c27:	e8 05 f5 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f0101c2c:	81 c7 ac e7 01 00    	add    $0x1e7ac,%edi
+f0101c32:	8b 75 08             	mov    0x8(%ebp),%esi
+f0101c35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	assert(align != 0 && (align & (align - 1)) == 0);
+f0101c38:	85 db                	test   %ebx,%ebx
+f0101c3a:	74 3e                	je     f0101c7a <boot_alloc_align+0x5c>
+f0101c3c:	8d 43 ff             	lea    -0x1(%ebx),%eax
+f0101c3f:	85 d8                	test   %ebx,%eax
+f0101c41:	75 37                	jne    f0101c7a <boot_alloc_align+0x5c>
+	boot_alloc_init();
+f0101c43:	e8 f6 fa ff ff       	call   f010173e <boot_alloc_init>
+	result = ROUNDUP(nextfree, align);
+f0101c48:	8b 87 b8 0a 00 00    	mov    0xab8(%edi),%eax
+f0101c4e:	8d 4c 18 ff          	lea    -0x1(%eax,%ebx,1),%ecx
+f0101c52:	89 c8                	mov    %ecx,%eax
+f0101c54:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101c59:	f7 f3                	div    %ebx
+f0101c5b:	29 d1                	sub    %edx,%ecx
+	if (n > (uint32_t) (BOOT_ALLOC_LIMIT - result))
+f0101c5d:	b8 00 00 40 f0       	mov    $0xf0400000,%eax
+f0101c62:	29 c8                	sub    %ecx,%eax
+f0101c64:	39 f0                	cmp    %esi,%eax
+f0101c66:	72 33                	jb     f0101c9b <boot_alloc_align+0x7d>
+	nextfree = result + n;
+f0101c68:	01 ce                	add    %ecx,%esi
+f0101c6a:	89 b7 b8 0a 00 00    	mov    %esi,0xab8(%edi)
+}
+f0101c70:	89 c8                	mov    %ecx,%eax
+f0101c72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c75:	5b                   	pop    %ebx
+f0101c76:	5e                   	pop    %esi
+f0101c77:	5f                   	pop    %edi
+f0101c78:	5d                   	pop    %ebp
+f0101c79:	c3                   	ret
+	assert(align != 0 && (align & (align - 1)) == 0);
+f0101c7a:	8d 87 78 5c fe ff    	lea    -0x1a388(%edi),%eax
+f0101c80:	50                   	push   %eax
+f0101c81:	8d 87 bd 5a fe ff    	lea    -0x1a543(%edi),%eax
+f0101c87:	50                   	push   %eax
+f0101c88:	68 b0 00 00 00       	push   $0xb0
+f0101c8d:	8d 87 d2 5a fe ff    	lea    -0x1a52e(%edi),%eax
+f0101c93:	50                   	push   %eax
+f0101c94:	89 fb                	mov    %edi,%ebx
+f0101c96:	e8 17 e5 ff ff       	call   f01001b2 <_panic>
+		panic("boot_alloc: out of memory allocating %u bytes", n);
+f0101c9b:	56                   	push   %esi
+f0101c9c:	8d 87 a4 5c fe ff    	lea    -0x1a35c(%edi),%eax
+f0101ca2:	50                   	push   %eax
+f0101ca3:	68 b4 00 00 00       	push   $0xb4
+f0101ca8:	8d 87 d2 5a fe ff    	lea    -0x1a52e(%edi),%eax
+f0101cae:	50                   	push   %eax
+f0101caf:	89 fb                	mov    %edi,%ebx
+f0101cb1:	e8 fc e4 ff ff       	call   f01001b2 <_panic>
+
+f0101cb6 <boot_alloc>:
+{
+f0101cb6:	55                   	push   %ebp
+f0101cb7:	89 e5                	mov    %esp,%ebp
+f0101cb9:	83 ec 10             	sub    $0x10,%esp
+	return boot_alloc_align(ROUNDUP(n, PGSIZE), PGSIZE);
+f0101cbc:	68 00 10 00 00       	push   $0x1000
+f0101cc1:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101cc4:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0101cc9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101cce:	50                   	push   %eax
+f0101ccf:	e8 4a ff ff ff       	call   f0101c1e <boot_alloc_align>
+}
+f0101cd4:	c9                   	leave
+f0101cd5:	c3                   	ret
+
+f0101cd6 <boot_alloc_mark>:
+{
+f0101cd6:	55                   	push   %ebp
+f0101cd7:	89 e5                	mov    %esp,%ebp
+f0101cd9:	53                   	push   %ebx
+f0101cda:	83 ec 04             	sub    $0x4,%esp
+f0101cdd:	e8 f7 e6 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101ce2:	81 c3 f6 e6 01 00    	add    $0x1e6f6,%ebx
+	boot_alloc_init();
+f0101ce8:	e8 51 fa ff ff       	call   f010173e <boot_alloc_init>
+	return nextfree;
+f0101ced:	8b 83 b8 0a 00 00    	mov    0xab8(%ebx),%eax
+}
+f0101cf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101cf6:	c9                   	leave
+f0101cf7:	c3                   	ret
+
+f0101cf8 <boot_alloc_release>:
+{
+f0101cf8:	55                   	push   %ebp
+f0101cf9:	89 e5                	mov    %esp,%ebp
+f0101cfb:	56                   	push   %esi
+f0101cfc:	53                   	push   %ebx
+f0101cfd:	e8 d7 e6 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101d02:	81 c3 d6 e6 01 00    	add    $0x1e6d6,%ebx
+f0101d08:	8b 75 08             	mov    0x8(%ebp),%esi
+	boot_alloc_init();
+f0101d0b:	e8 2e fa ff ff       	call   f010173e <boot_alloc_init>
+	if ((char *) mark < end || (char *) mark > nextfree)
+f0101d10:	81 fe a0 1e 12 f0    	cmp    $0xf0121ea0,%esi
+f0101d16:	72 15                	jb     f0101d2d <boot_alloc_release+0x35>
+f0101d18:	39 b3 b8 0a 00 00    	cmp    %esi,0xab8(%ebx)
+f0101d1e:	72 0d                	jb     f0101d2d <boot_alloc_release+0x35>
+	nextfree = mark;
+f0101d20:	89 b3 b8 0a 00 00    	mov    %esi,0xab8(%ebx)
+}
+f0101d26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101d29:	5b                   	pop    %ebx
+f0101d2a:	5e                   	pop    %esi
+f0101d2b:	5d                   	pop    %ebp
+f0101d2c:	c3                   	ret
+		panic("boot_alloc_release: bad mark %08x", mark);
+f0101d2d:	56                   	push   %esi
+f0101d2e:	8d 83 d4 5c fe ff    	lea    -0x1a32c(%ebx),%eax
+f0101d34:	50                   	push   %eax
+f0101d35:	68 d3 00 00 00       	push   $0xd3
+f0101d3a:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0101d40:	50                   	push   %eax
+f0101d41:	e8 6c e4 ff ff       	call   f01001b2 <_panic>
+
+f0101d46 <pat_init>:
+{
+f0101d46:	55                   	push   %ebp
+f0101d47:	89 e5                	mov    %esp,%ebp
+f0101d49:	57                   	push   %edi
+f0101d4a:	56                   	push   %esi
+f0101d4b:	53                   	push   %ebx
+f0101d4c:	83 ec 0c             	sub    $0xc,%esp
+f0101d4f:	e8 d9 f3 ff ff       	call   f010112d <__x86.get_pc_thunk.si>
+f0101d54:	81 c6 84 e6 01 00    	add    $0x1e684,%esi
+	asm volatile("cpuid"
+f0101d5a:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101d5f:	0f a2                	cpuid
+	if (!(edx & CPUID_PAT))
+f0101d61:	f7 c2 00 00 01 00    	test   $0x10000,%edx
+f0101d67:	75 08                	jne    f0101d71 <pat_init+0x2b>
+}
+f0101d69:	83 c4 0c             	add    $0xc,%esp
+f0101d6c:	5b                   	pop    %ebx
+f0101d6d:	5e                   	pop    %esi
+f0101d6e:	5f                   	pop    %edi
+f0101d6f:	5d                   	pop    %ebp
+f0101d70:	c3                   	ret
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0101d71:	9c                   	pushf
+f0101d72:	58                   	pop    %eax
+f0101d73:	89 c7                	mov    %eax,%edi
+	asm volatile("cli");
+f0101d75:	fa                   	cli
+	asm volatile("movl %%cr0,%0" : "=r" (val));
+f0101d76:	0f 20 c0             	mov    %cr0,%eax
+f0101d79:	89 c3                	mov    %eax,%ebx
+	lcr0((cr0 | CR0_CD) & ~CR0_NW);
+f0101d7b:	25 ff ff ff 9f       	and    $0x9fffffff,%eax
+f0101d80:	0d 00 00 00 40       	or     $0x40000000,%eax
+	asm volatile("movl %0,%%cr0" : : "r" (val));
+f0101d85:	0f 22 c0             	mov    %eax,%cr0
+	asm volatile("wbinvd" : : : "memory");
+f0101d88:	0f 09                	wbinvd
+	asm volatile("movl %%cr4,%0" : "=r" (cr4));
+f0101d8a:	0f 20 e0             	mov    %cr4,%eax
+f0101d8d:	89 c2                	mov    %eax,%edx
+	if (cr4 & CR4_PGE) {
+f0101d8f:	a8 80                	test   $0x80,%al
+f0101d91:	74 4a                	je     f0101ddd <pat_init+0x97>
+		lcr4(cr4 & ~CR4_PGE);
+f0101d93:	24 7f                	and    $0x7f,%al
+	asm volatile("movl %0,%%cr4" : : "r" (val));
+f0101d95:	0f 22 e0             	mov    %eax,%cr4
+f0101d98:	0f 22 e2             	mov    %edx,%cr4
+	asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+f0101d9b:	b9 77 02 00 00       	mov    $0x277,%ecx
+f0101da0:	0f 32                	rdmsr
+	pat = (pat & ~(uint64_t) 0xFF00) | (0x01 << 8);	// PA1 = WC
+f0101da2:	89 c1                	mov    %eax,%ecx
+f0101da4:	30 e5                	xor    %ah,%ch
+f0101da6:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+f0101da9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+f0101dac:	8b 45 e8             	mov    -0x18(%ebp),%eax
+f0101daf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+f0101db2:	80 cc 01             	or     $0x1,%ah
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f0101db5:	b9 77 02 00 00       	mov    $0x277,%ecx
+f0101dba:	0f 30                	wrmsr
+	asm volatile("wbinvd" : : : "memory");
+f0101dbc:	0f 09                	wbinvd
+	asm volatile("movl %%cr4,%0" : "=r" (cr4));
+f0101dbe:	0f 20 e0             	mov    %cr4,%eax
+f0101dc1:	89 c2                	mov    %eax,%edx
+	if (cr4 & CR4_PGE) {
+f0101dc3:	a8 80                	test   $0x80,%al
+f0101dc5:	74 1e                	je     f0101de5 <pat_init+0x9f>
+		lcr4(cr4 & ~CR4_PGE);
+f0101dc7:	24 7f                	and    $0x7f,%al
+	asm volatile("movl %0,%%cr4" : : "r" (val));
+f0101dc9:	0f 22 e0             	mov    %eax,%cr4
+f0101dcc:	0f 22 e2             	mov    %edx,%cr4
+	asm volatile("movl %0,%%cr0" : : "r" (val));
+f0101dcf:	0f 22 c3             	mov    %ebx,%cr0
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0101dd2:	57                   	push   %edi
+f0101dd3:	9d                   	popf
+	pat_wc = true;
+f0101dd4:	c6 86 b4 0a 00 00 01 	movb   $0x1,0xab4(%esi)
+f0101ddb:	eb 8c                	jmp    f0101d69 <pat_init+0x23>
+	asm volatile("movl %%cr3,%0" : "=r" (cr3));
+f0101ddd:	0f 20 d8             	mov    %cr3,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (cr3));
+f0101de0:	0f 22 d8             	mov    %eax,%cr3
+}
+f0101de3:	eb b6                	jmp    f0101d9b <pat_init+0x55>
+	asm volatile("movl %%cr3,%0" : "=r" (cr3));
+f0101de5:	0f 20 d8             	mov    %cr3,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (cr3));
+f0101de8:	0f 22 d8             	mov    %eax,%cr3
+}
+f0101deb:	eb e2                	jmp    f0101dcf <pat_init+0x89>
+
+f0101ded <page_init>:
+// allocator functions below to allocate and deallocate physical
+// memory.
+//
+void
+page_init(void)
+{
+f0101ded:	55                   	push   %ebp
+f0101dee:	89 e5                	mov    %esp,%ebp
+f0101df0:	57                   	push   %edi
+f0101df1:	56                   	push   %esi
+f0101df2:	53                   	push   %ebx
+f0101df3:	83 ec 58             	sub    $0x58,%esp
+f0101df6:	e8 2a f3 ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0101dfb:	05 dd e5 01 00       	add    $0x1e5dd,%eax
+f0101e00:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	physaddr_t kern_end = PADDR(boot_alloc(0));
+f0101e03:	6a 00                	push   $0x0
+f0101e05:	e8 ac fe ff ff       	call   f0101cb6 <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0101e0a:	83 c4 10             	add    $0x10,%esp
+f0101e0d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101e12:	76 22                	jbe    f0101e36 <page_init+0x49>
+	return (physaddr_t)kva - KERNBASE;
+f0101e14:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101e19:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f0101e1c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101e1f:	8d 80 28 08 00 00    	lea    0x828(%eax),%eax
+f0101e25:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	//     MPENTRY_PADDR, where boot_aps copies the AP entry code.
+	//  3) The IO hole [IOPHYSMEM, EXTPHYSMEM), which must never be
+	//     allocated.
+	//  4) Extended memory up to kern_end, which holds the kernel and
+	//     everything boot_alloc handed out.
+	for (i = 0; i < nmemmap; i++) {
+f0101e28:	89 c6                	mov    %eax,%esi
+f0101e2a:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101e2f:	89 fb                	mov    %edi,%ebx
+f0101e31:	e9 31 01 00 00       	jmp    f0101f67 <page_init+0x17a>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101e36:	50                   	push   %eax
+f0101e37:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0101e3a:	8d 83 c4 53 fe ff    	lea    -0x1ac3c(%ebx),%eax
+f0101e40:	50                   	push   %eax
+f0101e41:	68 e5 01 00 00       	push   $0x1e5
+f0101e46:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0101e4c:	50                   	push   %eax
+f0101e4d:	e8 60 e3 ff ff       	call   f01001b2 <_panic>
+	for (i = 0; i < nmemmap; i++)
+f0101e52:	83 c2 01             	add    $0x1,%edx
+f0101e55:	83 c0 14             	add    $0x14,%eax
+f0101e58:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0101e5b:	39 da                	cmp    %ebx,%edx
+f0101e5d:	7d 31                	jge    f0101e90 <page_init+0xa3>
+		if (memmap[i].e_type != E820_RAM
+f0101e5f:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+f0101e63:	74 ed                	je     f0101e52 <page_init+0x65>
+		    && memmap[i].e_addr < pa + PGSIZE
+f0101e65:	8b 08                	mov    (%eax),%ecx
+f0101e67:	8b 58 04             	mov    0x4(%eax),%ebx
+f0101e6a:	8b 75 d8             	mov    -0x28(%ebp),%esi
+f0101e6d:	39 f1                	cmp    %esi,%ecx
+f0101e6f:	89 de                	mov    %ebx,%esi
+f0101e71:	1b 75 dc             	sbb    -0x24(%ebp),%esi
+f0101e74:	73 dc                	jae    f0101e52 <page_init+0x65>
+		    && memmap[i].e_addr + memmap[i].e_len > pa)
+f0101e76:	03 48 08             	add    0x8(%eax),%ecx
+f0101e79:	13 58 0c             	adc    0xc(%eax),%ebx
+f0101e7c:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0101e7f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101e82:	39 ce                	cmp    %ecx,%esi
+f0101e84:	19 df                	sbb    %ebx,%edi
+f0101e86:	73 ca                	jae    f0101e52 <page_init+0x65>
+f0101e88:	8b 75 d8             	mov    -0x28(%ebp),%esi
+f0101e8b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f0101e8e:	eb 22                	jmp    f0101eb2 <page_init+0xc5>
+f0101e90:	8b 75 d8             	mov    -0x28(%ebp),%esi
+f0101e93:	8b 7d dc             	mov    -0x24(%ebp),%edi
+			    || (pa >> PGSHIFT) >= npages
+			    || memmap_reserved(pa))
+				continue;
+			// Free pages one at a time: the buddy lists merge
+			// them into the largest blocks alignment allows.
+			buddy_free(&pages[pa >> PGSHIFT], 0);
+f0101e96:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0101e99:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0101e9c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101e9f:	8b 80 a8 0a 00 00    	mov    0xaa8(%eax),%eax
+f0101ea5:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0101ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101ead:	e8 b7 f9 ff ff       	call   f0101869 <buddy_free>
+	for (i = 0; i < nmemmap; i++)
+f0101eb2:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f0101eb5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0101eb8:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0101ebb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101ebe:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0101ec4:	83 d7 00             	adc    $0x0,%edi
+		for (pa = start; pa + PGSIZE <= end; pa += PGSIZE) {
+f0101ec7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0101eca:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f0101ecd:	39 f0                	cmp    %esi,%eax
+f0101ecf:	89 d0                	mov    %edx,%eax
+f0101ed1:	19 f8                	sbb    %edi,%eax
+f0101ed3:	0f 82 82 00 00 00    	jb     f0101f5b <page_init+0x16e>
+			if (pa == 0 || pa == ROUNDDOWN(BOOTINFO, PGSIZE)
+f0101ed9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0101edc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0101edf:	89 ca                	mov    %ecx,%edx
+f0101ee1:	80 e6 ef             	and    $0xef,%dh
+f0101ee4:	89 d8                	mov    %ebx,%eax
+			    || pa == MPENTRY_PADDR
+f0101ee6:	09 d0                	or     %edx,%eax
+f0101ee8:	74 c8                	je     f0101eb2 <page_init+0xc5>
+f0101eea:	89 c8                	mov    %ecx,%eax
+f0101eec:	80 f4 70             	xor    $0x70,%ah
+f0101eef:	09 d8                	or     %ebx,%eax
+f0101ef1:	74 bf                	je     f0101eb2 <page_init+0xc5>
+			    || (pa >= IOPHYSMEM && pa < kern_end)
+f0101ef3:	b8 ff ff 09 00       	mov    $0x9ffff,%eax
+f0101ef8:	39 c8                	cmp    %ecx,%eax
+f0101efa:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101eff:	19 d8                	sbb    %ebx,%eax
+f0101f01:	73 0e                	jae    f0101f11 <page_init+0x124>
+f0101f03:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f0101f06:	39 c1                	cmp    %eax,%ecx
+f0101f08:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101f0d:	19 d3                	sbb    %edx,%ebx
+f0101f0f:	72 a1                	jb     f0101eb2 <page_init+0xc5>
+			    || (pa >> PGSHIFT) >= npages
+f0101f11:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0101f14:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0101f17:	0f ac d9 0c          	shrd   $0xc,%ebx,%ecx
+f0101f1b:	c1 eb 0c             	shr    $0xc,%ebx
+f0101f1e:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0101f21:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+f0101f24:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101f27:	8b 80 b0 0a 00 00    	mov    0xab0(%eax),%eax
+f0101f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101f32:	39 c1                	cmp    %eax,%ecx
+f0101f34:	19 d3                	sbb    %edx,%ebx
+f0101f36:	0f 83 76 ff ff ff    	jae    f0101eb2 <page_init+0xc5>
+	for (i = 0; i < nmemmap; i++)
+f0101f3c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101f3f:	8b 80 08 08 00 00    	mov    0x808(%eax),%eax
+f0101f45:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101f48:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0101f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101f50:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f0101f53:	89 7d dc             	mov    %edi,-0x24(%ebp)
+f0101f56:	e9 fd fe ff ff       	jmp    f0101e58 <page_init+0x6b>
+f0101f5b:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+f0101f5e:	8b 75 b0             	mov    -0x50(%ebp),%esi
+	for (i = 0; i < nmemmap; i++) {
+f0101f61:	83 c3 01             	add    $0x1,%ebx
+f0101f64:	83 c6 14             	add    $0x14,%esi
+f0101f67:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101f6a:	39 98 08 08 00 00    	cmp    %ebx,0x808(%eax)
+f0101f70:	7e 3d                	jle    f0101faf <page_init+0x1c2>
+		if (memmap[i].e_type != E820_RAM)
+f0101f72:	83 7e 10 01          	cmpl   $0x1,0x10(%esi)
+f0101f76:	75 e9                	jne    f0101f61 <page_init+0x174>
+		start = (memmap[i].e_addr + PGSIZE - 1)
+f0101f78:	8b 06                	mov    (%esi),%eax
+f0101f7a:	8b 56 04             	mov    0x4(%esi),%edx
+f0101f7d:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0101f82:	83 d2 00             	adc    $0x0,%edx
+f0101f85:	89 c7                	mov    %eax,%edi
+f0101f87:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+f0101f8d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0101f90:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		end = memmap[i].e_addr + memmap[i].e_len;
+f0101f93:	8b 06                	mov    (%esi),%eax
+f0101f95:	8b 56 04             	mov    0x4(%esi),%edx
+f0101f98:	03 46 08             	add    0x8(%esi),%eax
+f0101f9b:	13 56 0c             	adc    0xc(%esi),%edx
+f0101f9e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0101fa1:	89 55 cc             	mov    %edx,-0x34(%ebp)
+f0101fa4:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+f0101fa7:	89 75 b0             	mov    %esi,-0x50(%ebp)
+		for (pa = start; pa + PGSIZE <= end; pa += PGSIZE) {
+f0101faa:	e9 09 ff ff ff       	jmp    f0101eb8 <page_init+0xcb>
+		}
+	}
+}
+f0101faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101fb2:	5b                   	pop    %ebx
+f0101fb3:	5e                   	pop    %esi
+f0101fb4:	5f                   	pop    %edi
+f0101fb5:	5d                   	pop    %ebp
+f0101fb6:	c3                   	ret
+
+f0101fb7 <page_alloc>:
+//
+// Returns NULL if out of free memory.
+//
+struct PageInfo *
+page_alloc(int alloc_flags)
+{
+f0101fb7:	55                   	push   %ebp
+f0101fb8:	89 e5                	mov    %esp,%ebp
+f0101fba:	57                   	push   %edi
+f0101fbb:	56                   	push   %esi
+f0101fbc:	53                   	push   %ebx
+f0101fbd:	83 ec 1c             	sub    $0x1c,%esp
+f0101fc0:	e8 14 e4 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0101fc5:	81 c3 13 e4 01 00    	add    $0x1e413,%ebx
+	struct PageCache *pc = this_page_cache;
+f0101fcb:	64 a0 04 00 00 00    	mov    %fs:0x4,%al
+f0101fd1:	0f b6 f0             	movzbl %al,%esi
+	struct PageInfo *pp;
+
+	if (!pc->pc_free) {
+f0101fd4:	8b bc f3 c8 0a 00 00 	mov    0xac8(%ebx,%esi,8),%edi
+f0101fdb:	85 ff                	test   %edi,%edi
+f0101fdd:	74 2b                	je     f010200a <page_alloc+0x53>
+		}
+		spin_unlock(&buddy_lock);
+	}
+	if (!(pp = pc->pc_free))
+		return NULL;
+	pc->pc_free = pp->pp_link;
+f0101fdf:	8b 07                	mov    (%edi),%eax
+f0101fe1:	89 84 f3 c8 0a 00 00 	mov    %eax,0xac8(%ebx,%esi,8)
+	pc->pc_count--;
+f0101fe8:	83 ac f3 cc 0a 00 00 	subl   $0x1,0xacc(%ebx,%esi,8)
+f0101fef:	01 
+	pp->pp_link = NULL;
+f0101ff0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	if (alloc_flags & ALLOC_ZERO)
+f0101ff6:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f0101ffa:	0f 85 87 00 00 00    	jne    f0102087 <page_alloc+0xd0>
+		memset(page2kva(pp), 0, PGSIZE);
+	return pp;
+}
+f0102000:	89 f8                	mov    %edi,%eax
+f0102002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102005:	5b                   	pop    %ebx
+f0102006:	5e                   	pop    %esi
+f0102007:	5f                   	pop    %edi
+f0102008:	5d                   	pop    %ebp
+f0102009:	c3                   	ret
+		spin_lock(&buddy_lock);
+f010200a:	83 ec 0c             	sub    $0xc,%esp
+f010200d:	8d 83 08 0b 00 00    	lea    0xb08(%ebx),%eax
+f0102013:	50                   	push   %eax
+f0102014:	e8 05 28 00 00       	call   f010481e <spin_lock>
+		while (pc->pc_count < PCP_BATCH && (pp = buddy_alloc(0))) {
+f0102019:	83 c4 10             	add    $0x10,%esp
+f010201c:	8d 05 c8 0a 00 00    	lea    0xac8,%eax
+f0102022:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0102025:	8d 84 f3 c8 0a 00 00 	lea    0xac8(%ebx,%esi,8),%eax
+f010202c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010202f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102032:	8b 78 04             	mov    0x4(%eax),%edi
+f0102035:	83 ff 0f             	cmp    $0xf,%edi
+f0102038:	7f 27                	jg     f0102061 <page_alloc+0xaa>
+f010203a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010203f:	e8 b8 f7 ff ff       	call   f01017fc <buddy_alloc>
+f0102044:	85 c0                	test   %eax,%eax
+f0102046:	74 19                	je     f0102061 <page_alloc+0xaa>
+			pp->pp_link = pc->pc_free;
+f0102048:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010204b:	8d 14 0b             	lea    (%ebx,%ecx,1),%edx
+f010204e:	8b 0c f2             	mov    (%edx,%esi,8),%ecx
+f0102051:	89 08                	mov    %ecx,(%eax)
+			pc->pc_free = pp;
+f0102053:	89 04 f2             	mov    %eax,(%edx,%esi,8)
+			pc->pc_count++;
+f0102056:	83 c7 01             	add    $0x1,%edi
+f0102059:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010205c:	89 78 04             	mov    %edi,0x4(%eax)
+f010205f:	eb ce                	jmp    f010202f <page_alloc+0x78>
+		spin_unlock(&buddy_lock);
+f0102061:	83 ec 0c             	sub    $0xc,%esp
+f0102064:	8d 83 08 0b 00 00    	lea    0xb08(%ebx),%eax
+f010206a:	50                   	push   %eax
+f010206b:	e8 1e 28 00 00       	call   f010488e <spin_unlock>
+	if (!(pp = pc->pc_free))
+f0102070:	8b bc f3 c8 0a 00 00 	mov    0xac8(%ebx,%esi,8),%edi
+f0102077:	83 c4 10             	add    $0x10,%esp
+f010207a:	85 ff                	test   %edi,%edi
+f010207c:	0f 85 5d ff ff ff    	jne    f0101fdf <page_alloc+0x28>
+f0102082:	e9 79 ff ff ff       	jmp    f0102000 <page_alloc+0x49>
+void	*mmio_map_region_wc(physaddr_t pa, size_t size);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f0102087:	89 f8                	mov    %edi,%eax
+f0102089:	2b 83 a8 0a 00 00    	sub    0xaa8(%ebx),%eax
+f010208f:	c1 f8 02             	sar    $0x2,%eax
+f0102092:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102098:	89 c2                	mov    %eax,%edx
+f010209a:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010209d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01020a2:	3b 83 b0 0a 00 00    	cmp    0xab0(%ebx),%eax
+f01020a8:	73 1e                	jae    f01020c8 <page_alloc+0x111>
+		memset(page2kva(pp), 0, PGSIZE);
+f01020aa:	83 ec 04             	sub    $0x4,%esp
+f01020ad:	68 00 10 00 00       	push   $0x1000
+f01020b2:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f01020b4:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01020ba:	52                   	push   %edx
+f01020bb:	e8 54 32 00 00       	call   f0105314 <memset>
+f01020c0:	83 c4 10             	add    $0x10,%esp
+f01020c3:	e9 38 ff ff ff       	jmp    f0102000 <page_alloc+0x49>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01020c8:	52                   	push   %edx
+f01020c9:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01020cf:	50                   	push   %eax
+f01020d0:	6a 62                	push   $0x62
+f01020d2:	8d 83 de 5a fe ff    	lea    -0x1a522(%ebx),%eax
+f01020d8:	50                   	push   %eax
+f01020d9:	e8 d4 e0 ff ff       	call   f01001b2 <_panic>
+
+f01020de <page_free>:
+// Return a page to the free list.
+// (This function should only be called when pp->pp_ref reaches 0.)
+//
+void
+page_free(struct PageInfo *pp)
+{
+f01020de:	55                   	push   %ebp
+f01020df:	89 e5                	mov    %esp,%ebp
+f01020e1:	57                   	push   %edi
+f01020e2:	56                   	push   %esi
+f01020e3:	53                   	push   %ebx
+f01020e4:	83 ec 1c             	sub    $0x1c,%esp
+f01020e7:	e8 ed e2 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01020ec:	81 c3 ec e2 01 00    	add    $0x1e2ec,%ebx
+f01020f2:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct PageCache *pc = this_page_cache;
+f01020f5:	64 8a 15 04 00 00 00 	mov    %fs:0x4,%dl
+	struct PageInfo *p;
+
+	if (pp->pp_ref != 0 || pp->pp_link != NULL)
+f01020fc:	66 83 78 08 00       	cmpw   $0x0,0x8(%eax)
+f0102101:	75 34                	jne    f0102137 <page_free+0x59>
+f0102103:	0f b6 f2             	movzbl %dl,%esi
+f0102106:	83 38 00             	cmpl   $0x0,(%eax)
+f0102109:	75 2c                	jne    f0102137 <page_free+0x59>
+		panic("page_free: page %08x is still in use", page2pa(pp));
+	pp->pp_link = pc->pc_free;
+f010210b:	8d 0d c8 0a 00 00    	lea    0xac8,%ecx
+f0102111:	8d 14 0b             	lea    (%ebx,%ecx,1),%edx
+f0102114:	8b 3c f2             	mov    (%edx,%esi,8),%edi
+f0102117:	89 38                	mov    %edi,(%eax)
+	pc->pc_free = pp;
+f0102119:	89 04 f2             	mov    %eax,(%edx,%esi,8)
+	if (++pc->pc_count <= PCP_HIGH)
+f010211c:	8d 14 f3             	lea    (%ebx,%esi,8),%edx
+f010211f:	01 ca                	add    %ecx,%edx
+f0102121:	8b 42 04             	mov    0x4(%edx),%eax
+f0102124:	83 c0 01             	add    $0x1,%eax
+f0102127:	89 42 04             	mov    %eax,0x4(%edx)
+f010212a:	83 f8 40             	cmp    $0x40,%eax
+f010212d:	7f 33                	jg     f0102162 <page_free+0x84>
+		pc->pc_count--;
+		p->pp_link = NULL;
+		buddy_free(p, 0);
+	}
+	spin_unlock(&buddy_lock);
+}
+f010212f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102132:	5b                   	pop    %ebx
+f0102133:	5e                   	pop    %esi
+f0102134:	5f                   	pop    %edi
+f0102135:	5d                   	pop    %ebp
+f0102136:	c3                   	ret
+	return (pp - pages) << PGSHIFT;
+f0102137:	2b 83 a8 0a 00 00    	sub    0xaa8(%ebx),%eax
+f010213d:	c1 f8 02             	sar    $0x2,%eax
+f0102140:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102146:	c1 e0 0c             	shl    $0xc,%eax
+		panic("page_free: page %08x is still in use", page2pa(pp));
+f0102149:	50                   	push   %eax
+f010214a:	8d 83 f8 5c fe ff    	lea    -0x1a308(%ebx),%eax
+f0102150:	50                   	push   %eax
+f0102151:	68 36 02 00 00       	push   $0x236
+f0102156:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f010215c:	50                   	push   %eax
+f010215d:	e8 50 e0 ff ff       	call   f01001b2 <_panic>
+	spin_lock(&buddy_lock);
+f0102162:	83 ec 0c             	sub    $0xc,%esp
+f0102165:	8d 83 08 0b 00 00    	lea    0xb08(%ebx),%eax
+f010216b:	50                   	push   %eax
+f010216c:	e8 ad 26 00 00       	call   f010481e <spin_lock>
+	while (pc->pc_count > PCP_HIGH - PCP_BATCH) {
+f0102171:	83 c4 10             	add    $0x10,%esp
+f0102174:	8d 05 c8 0a 00 00    	lea    0xac8,%eax
+f010217a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010217d:	8d bc f3 c8 0a 00 00 	lea    0xac8(%ebx,%esi,8),%edi
+f0102184:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0102187:	eb 29                	jmp    f01021b2 <page_free+0xd4>
+		p = pc->pc_free;
+f0102189:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010218c:	8d 14 0b             	lea    (%ebx,%ecx,1),%edx
+f010218f:	8b 0c f2             	mov    (%edx,%esi,8),%ecx
+		pc->pc_free = p->pp_link;
+f0102192:	8b 39                	mov    (%ecx),%edi
+f0102194:	89 3c f2             	mov    %edi,(%edx,%esi,8)
+		pc->pc_count--;
+f0102197:	83 e8 01             	sub    $0x1,%eax
+f010219a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010219d:	89 47 04             	mov    %eax,0x4(%edi)
+		p->pp_link = NULL;
+f01021a0:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+		buddy_free(p, 0);
+f01021a6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01021ab:	89 c8                	mov    %ecx,%eax
+f01021ad:	e8 b7 f6 ff ff       	call   f0101869 <buddy_free>
+	while (pc->pc_count > PCP_HIGH - PCP_BATCH) {
+f01021b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01021b5:	8b 40 04             	mov    0x4(%eax),%eax
+f01021b8:	83 f8 30             	cmp    $0x30,%eax
+f01021bb:	7f cc                	jg     f0102189 <page_free+0xab>
+	spin_unlock(&buddy_lock);
+f01021bd:	83 ec 0c             	sub    $0xc,%esp
+f01021c0:	8d 83 08 0b 00 00    	lea    0xb08(%ebx),%eax
+f01021c6:	50                   	push   %eax
+f01021c7:	e8 c2 26 00 00       	call   f010488e <spin_unlock>
+f01021cc:	83 c4 10             	add    $0x10,%esp
+f01021cf:	e9 5b ff ff ff       	jmp    f010212f <page_free+0x51>
+
+f01021d4 <page_alloc_order>:
+// PageInfos follow it in 'pages'.  Flags and reference counts are as
+// for page_alloc.  Returns NULL if no block that large is free.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+f01021d4:	55                   	push   %ebp
+f01021d5:	89 e5                	mov    %esp,%ebp
+f01021d7:	57                   	push   %edi
+f01021d8:	56                   	push   %esi
+f01021d9:	53                   	push   %ebx
+f01021da:	83 ec 0c             	sub    $0xc,%esp
+f01021dd:	e8 f7 e1 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01021e2:	81 c3 f6 e1 01 00    	add    $0x1e1f6,%ebx
+	struct PageInfo *pp;
+
+	assert(order >= 0 && order <= MAXORDER);
+f01021e8:	83 7d 08 0a          	cmpl   $0xa,0x8(%ebp)
+f01021ec:	77 3e                	ja     f010222c <page_alloc_order+0x58>
+	if (order == 0)
+f01021ee:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f01021f2:	74 57                	je     f010224b <page_alloc_order+0x77>
+		return page_alloc(alloc_flags);
+	spin_lock(&buddy_lock);
+f01021f4:	83 ec 0c             	sub    $0xc,%esp
+f01021f7:	8d bb 08 0b 00 00    	lea    0xb08(%ebx),%edi
+f01021fd:	57                   	push   %edi
+f01021fe:	e8 1b 26 00 00       	call   f010481e <spin_lock>
+	pp = buddy_alloc(order);
+f0102203:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102206:	e8 f1 f5 ff ff       	call   f01017fc <buddy_alloc>
+f010220b:	89 c6                	mov    %eax,%esi
+	spin_unlock(&buddy_lock);
+f010220d:	89 3c 24             	mov    %edi,(%esp)
+f0102210:	e8 79 26 00 00       	call   f010488e <spin_unlock>
+	if (!pp)
+f0102215:	83 c4 10             	add    $0x10,%esp
+f0102218:	85 f6                	test   %esi,%esi
+f010221a:	74 06                	je     f0102222 <page_alloc_order+0x4e>
+		return NULL;
+	if (alloc_flags & ALLOC_ZERO)
+f010221c:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+f0102220:	75 3b                	jne    f010225d <page_alloc_order+0x89>
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+f0102222:	89 f0                	mov    %esi,%eax
+f0102224:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102227:	5b                   	pop    %ebx
+f0102228:	5e                   	pop    %esi
+f0102229:	5f                   	pop    %edi
+f010222a:	5d                   	pop    %ebp
+f010222b:	c3                   	ret
+	assert(order >= 0 && order <= MAXORDER);
+f010222c:	8d 83 20 5d fe ff    	lea    -0x1a2e0(%ebx),%eax
+f0102232:	50                   	push   %eax
+f0102233:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102239:	50                   	push   %eax
+f010223a:	68 52 02 00 00       	push   $0x252
+f010223f:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102245:	50                   	push   %eax
+f0102246:	e8 67 df ff ff       	call   f01001b2 <_panic>
+		return page_alloc(alloc_flags);
+f010224b:	83 ec 0c             	sub    $0xc,%esp
+f010224e:	ff 75 0c             	push   0xc(%ebp)
+f0102251:	e8 61 fd ff ff       	call   f0101fb7 <page_alloc>
+f0102256:	89 c6                	mov    %eax,%esi
+f0102258:	83 c4 10             	add    $0x10,%esp
+f010225b:	eb c5                	jmp    f0102222 <page_alloc_order+0x4e>
+		memset(page2kva(pp), 0, PGSIZE << order);
+f010225d:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102262:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+f0102266:	d3 e2                	shl    %cl,%edx
+f0102268:	89 f0                	mov    %esi,%eax
+f010226a:	2b 83 a8 0a 00 00    	sub    0xaa8(%ebx),%eax
+f0102270:	c1 f8 02             	sar    $0x2,%eax
+f0102273:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102279:	89 c1                	mov    %eax,%ecx
+f010227b:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f010227e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102283:	3b 83 b0 0a 00 00    	cmp    0xab0(%ebx),%eax
+f0102289:	73 17                	jae    f01022a2 <page_alloc_order+0xce>
+f010228b:	83 ec 04             	sub    $0x4,%esp
+f010228e:	52                   	push   %edx
+f010228f:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f0102291:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0102297:	51                   	push   %ecx
+f0102298:	e8 77 30 00 00       	call   f0105314 <memset>
+f010229d:	83 c4 10             	add    $0x10,%esp
+f01022a0:	eb 80                	jmp    f0102222 <page_alloc_order+0x4e>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01022a2:	51                   	push   %ecx
+f01022a3:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01022a9:	50                   	push   %eax
+f01022aa:	6a 62                	push   $0x62
+f01022ac:	8d 83 de 5a fe ff    	lea    -0x1a522(%ebx),%eax
+f01022b2:	50                   	push   %eax
+f01022b3:	e8 fa de ff ff       	call   f01001b2 <_panic>
+
+f01022b8 <page_free_order>:
+//
+// Free a block from page_alloc_order(order, ...).
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+f01022b8:	55                   	push   %ebp
+f01022b9:	89 e5                	mov    %esp,%ebp
+f01022bb:	57                   	push   %edi
+f01022bc:	56                   	push   %esi
+f01022bd:	53                   	push   %ebx
+f01022be:	83 ec 0c             	sub    $0xc,%esp
+f01022c1:	e8 13 e1 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01022c6:	81 c3 12 e1 01 00    	add    $0x1e112,%ebx
+f01022cc:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (order == 0) {
+f01022cf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f01022d3:	74 64                	je     f0102339 <page_free_order+0x81>
+		page_free(pp);
+		return;
+	}
+	if (pp->pp_ref != 0 || pp->pp_link != NULL || pp->pp_order != order
+f01022d5:	66 83 7e 08 00       	cmpw   $0x0,0x8(%esi)
+f01022da:	75 6b                	jne    f0102347 <page_free_order+0x8f>
+f01022dc:	83 3e 00             	cmpl   $0x0,(%esi)
+f01022df:	75 66                	jne    f0102347 <page_free_order+0x8f>
+f01022e1:	0f b6 46 0a          	movzbl 0xa(%esi),%eax
+f01022e5:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f01022e8:	75 5d                	jne    f0102347 <page_free_order+0x8f>
+	    || ((pp - pages) & ((1 << order) - 1)))
+f01022ea:	89 f2                	mov    %esi,%edx
+f01022ec:	2b 93 a8 0a 00 00    	sub    0xaa8(%ebx),%edx
+f01022f2:	c1 fa 02             	sar    $0x2,%edx
+f01022f5:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f01022fb:	b8 01 00 00 00       	mov    $0x1,%eax
+f0102300:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+f0102304:	d3 e0                	shl    %cl,%eax
+f0102306:	83 e8 01             	sub    $0x1,%eax
+f0102309:	85 c2                	test   %eax,%edx
+f010230b:	75 3a                	jne    f0102347 <page_free_order+0x8f>
+		panic("page_free_order: bad block %08x, order %d",
+		      page2pa(pp), order);
+	spin_lock(&buddy_lock);
+f010230d:	83 ec 0c             	sub    $0xc,%esp
+f0102310:	8d bb 08 0b 00 00    	lea    0xb08(%ebx),%edi
+f0102316:	57                   	push   %edi
+f0102317:	e8 02 25 00 00       	call   f010481e <spin_lock>
+	buddy_free(pp, order);
+f010231c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010231f:	89 f0                	mov    %esi,%eax
+f0102321:	e8 43 f5 ff ff       	call   f0101869 <buddy_free>
+	spin_unlock(&buddy_lock);
+f0102326:	89 3c 24             	mov    %edi,(%esp)
+f0102329:	e8 60 25 00 00       	call   f010488e <spin_unlock>
+f010232e:	83 c4 10             	add    $0x10,%esp
+}
+f0102331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102334:	5b                   	pop    %ebx
+f0102335:	5e                   	pop    %esi
+f0102336:	5f                   	pop    %edi
+f0102337:	5d                   	pop    %ebp
+f0102338:	c3                   	ret
+		page_free(pp);
+f0102339:	83 ec 0c             	sub    $0xc,%esp
+f010233c:	56                   	push   %esi
+f010233d:	e8 9c fd ff ff       	call   f01020de <page_free>
+		return;
+f0102342:	83 c4 10             	add    $0x10,%esp
+f0102345:	eb ea                	jmp    f0102331 <page_free_order+0x79>
+		panic("page_free_order: bad block %08x, order %d",
+f0102347:	83 ec 0c             	sub    $0xc,%esp
+f010234a:	ff 75 0c             	push   0xc(%ebp)
+	return (pp - pages) << PGSHIFT;
+f010234d:	89 f0                	mov    %esi,%eax
+f010234f:	2b 83 a8 0a 00 00    	sub    0xaa8(%ebx),%eax
+f0102355:	c1 f8 02             	sar    $0x2,%eax
+f0102358:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010235e:	c1 e0 0c             	shl    $0xc,%eax
+f0102361:	50                   	push   %eax
+f0102362:	8d 83 40 5d fe ff    	lea    -0x1a2c0(%ebx),%eax
+f0102368:	50                   	push   %eax
+f0102369:	68 6b 02 00 00       	push   $0x26b
+f010236e:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102374:	50                   	push   %eax
+f0102375:	e8 38 de ff ff       	call   f01001b2 <_panic>
+
+f010237a <page_decref>:
+// Decrement the reference count on a page,
+// freeing it if there are no more refs.
+//
+void
+page_decref(struct PageInfo* pp)
+{
+f010237a:	55                   	push   %ebp
+f010237b:	89 e5                	mov    %esp,%ebp
+f010237d:	83 ec 08             	sub    $0x8,%esp
+f0102380:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (--pp->pp_ref == 0)
+f0102383:	0f b7 42 08          	movzwl 0x8(%edx),%eax
+f0102387:	83 e8 01             	sub    $0x1,%eax
+f010238a:	66 89 42 08          	mov    %ax,0x8(%edx)
+f010238e:	66 85 c0             	test   %ax,%ax
+f0102391:	74 02                	je     f0102395 <page_decref+0x1b>
+		page_free(pp);
+}
+f0102393:	c9                   	leave
+f0102394:	c3                   	ret
+		page_free(pp);
+f0102395:	83 ec 0c             	sub    $0xc,%esp
+f0102398:	52                   	push   %edx
+f0102399:	e8 40 fd ff ff       	call   f01020de <page_free>
+f010239e:	83 c4 10             	add    $0x10,%esp
+}
+f01023a1:	eb f0                	jmp    f0102393 <page_decref+0x19>
+
+f01023a3 <page_nfree>:
+
+// Number of free pages, on the buddy lists and in the CPU caches.
+// This is a snapshot: other CPUs may be allocating as it counts.
+size_t
+page_nfree(void)
+{
+f01023a3:	55                   	push   %ebp
+f01023a4:	89 e5                	mov    %esp,%ebp
+f01023a6:	53                   	push   %ebx
+f01023a7:	e8 2d e0 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01023ac:	81 c3 2c e0 01 00    	add    $0x1e02c,%ebx
+	size_t n = 0;
+	int i;
+
+	for (i = 0; i <= MAXORDER; i++)
+f01023b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	size_t n = 0;
+f01023b7:	ba 00 00 00 00       	mov    $0x0,%edx
+		n += nfree_area[i] << i;
+f01023bc:	8b 84 8b 28 0b 00 00 	mov    0xb28(%ebx,%ecx,4),%eax
+f01023c3:	d3 e0                	shl    %cl,%eax
+f01023c5:	01 c2                	add    %eax,%edx
+	for (i = 0; i <= MAXORDER; i++)
+f01023c7:	83 c1 01             	add    $0x1,%ecx
+f01023ca:	83 f9 0b             	cmp    $0xb,%ecx
+f01023cd:	75 ed                	jne    f01023bc <page_nfree+0x19>
+f01023cf:	8d 83 cc 0a 00 00    	lea    0xacc(%ebx),%eax
+f01023d5:	8d 48 40             	lea    0x40(%eax),%ecx
+f01023d8:	eb 05                	jmp    f01023df <page_nfree+0x3c>
+	for (i = 0; i < NCPU; i++)
+		n += page_cache[i].pc_count;
+f01023da:	03 10                	add    (%eax),%edx
+f01023dc:	83 c0 08             	add    $0x8,%eax
+	for (i = 0; i < NCPU; i++)
+f01023df:	39 c8                	cmp    %ecx,%eax
+f01023e1:	75 f7                	jne    f01023da <page_nfree+0x37>
+	return n;
+}
+f01023e3:	89 d0                	mov    %edx,%eax
+f01023e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01023e8:	c9                   	leave
+f01023e9:	c3                   	ret
+
+f01023ea <mem_init>:
+{
+f01023ea:	55                   	push   %ebp
+f01023eb:	89 e5                	mov    %esp,%ebp
+f01023ed:	57                   	push   %edi
+f01023ee:	56                   	push   %esi
+f01023ef:	53                   	push   %ebx
+f01023f0:	83 ec 1c             	sub    $0x1c,%esp
+f01023f3:	e8 e1 df ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01023f8:	81 c3 e0 df 01 00    	add    $0x1dfe0,%ebx
+f01023fe:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+	i386_detect_memory();
+f0102401:	e8 f0 f4 ff ff       	call   f01018f6 <i386_detect_memory>
+	pages = boot_alloc(npages * sizeof(struct PageInfo));
+f0102406:	83 ec 0c             	sub    $0xc,%esp
+f0102409:	8b 83 b0 0a 00 00    	mov    0xab0(%ebx),%eax
+f010240f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0102412:	c1 e0 02             	shl    $0x2,%eax
+f0102415:	50                   	push   %eax
+f0102416:	e8 9b f8 ff ff       	call   f0101cb6 <boot_alloc>
+f010241b:	89 83 a8 0a 00 00    	mov    %eax,0xaa8(%ebx)
+	memset(pages, 0, npages * sizeof(struct PageInfo));
+f0102421:	83 c4 0c             	add    $0xc,%esp
+f0102424:	8b 93 b0 0a 00 00    	mov    0xab0(%ebx),%edx
+f010242a:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f010242d:	c1 e2 02             	shl    $0x2,%edx
+f0102430:	52                   	push   %edx
+f0102431:	6a 00                	push   $0x0
+f0102433:	50                   	push   %eax
+f0102434:	e8 db 2e 00 00       	call   f0105314 <memset>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f0102439:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+f0102440:	e8 71 f8 ff ff       	call   f0101cb6 <boot_alloc>
+f0102445:	89 83 ac 0a 00 00    	mov    %eax,0xaac(%ebx)
+	memset(kern_pgdir, 0, PGSIZE);
+f010244b:	83 c4 0c             	add    $0xc,%esp
+f010244e:	68 00 10 00 00       	push   $0x1000
+f0102453:	6a 00                	push   $0x0
+f0102455:	50                   	push   %eax
+f0102456:	e8 b9 2e 00 00       	call   f0105314 <memset>
+	boot_map_direct(kern_pgdir);
+f010245b:	8b 83 ac 0a 00 00    	mov    0xaac(%ebx),%eax
+f0102461:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	top = MAX((physaddr_t) npages * PGSIZE, (physaddr_t) PTSIZE);
+f0102464:	8b 9b b0 0a 00 00    	mov    0xab0(%ebx),%ebx
+f010246a:	c1 e3 0c             	shl    $0xc,%ebx
+f010246d:	89 df                	mov    %ebx,%edi
+f010246f:	b8 00 00 40 00       	mov    $0x400000,%eax
+f0102474:	39 c3                	cmp    %eax,%ebx
+f0102476:	0f 42 f8             	cmovb  %eax,%edi
+f0102479:	83 c4 10             	add    $0x10,%esp
+	for (pa = 0; pa < top; ) {
+f010247c:	be 00 00 00 00       	mov    $0x0,%esi
+f0102481:	e9 92 00 00 00       	jmp    f0102518 <mem_init+0x12e>
+		pt = boot_alloc(PGSIZE);
+f0102486:	83 ec 0c             	sub    $0xc,%esp
+f0102489:	68 00 10 00 00       	push   $0x1000
+f010248e:	e8 23 f8 ff ff       	call   f0101cb6 <boot_alloc>
+		memset(pt, 0, PGSIZE);
+f0102493:	83 c4 0c             	add    $0xc,%esp
+f0102496:	68 00 10 00 00       	push   $0x1000
+f010249b:	6a 00                	push   $0x0
+f010249d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01024a0:	50                   	push   %eax
+f01024a1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01024a4:	e8 6b 2e 00 00       	call   f0105314 <memset>
+	if ((uint32_t)kva < KERNBASE)
+f01024a9:	83 c4 10             	add    $0x10,%esp
+f01024ac:	81 7d e4 ff ff ff ef 	cmpl   $0xefffffff,-0x1c(%ebp)
+f01024b3:	76 22                	jbe    f01024d7 <mem_init+0xed>
+		pgdir[PDX(KERNBASE + pa)] = PADDR(pt) | PTE_W | PTE_P;
+f01024b5:	8d 86 00 00 00 f0    	lea    -0x10000000(%esi),%eax
+f01024bb:	c1 e8 16             	shr    $0x16,%eax
+	return (physaddr_t)kva - KERNBASE;
+f01024be:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01024c1:	8d 91 00 00 00 10    	lea    0x10000000(%ecx),%edx
+f01024c7:	83 ca 03             	or     $0x3,%edx
+f01024ca:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01024cd:	89 14 83             	mov    %edx,(%ebx,%eax,4)
+		for (i = 0; i < NPTENTRIES && pa < top; i++, pa += PGSIZE)
+f01024d0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01024d5:	eb 32                	jmp    f0102509 <mem_init+0x11f>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01024d7:	ff 75 e4             	push   -0x1c(%ebp)
+f01024da:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01024dd:	8d 83 c4 53 fe ff    	lea    -0x1ac3c(%ebx),%eax
+f01024e3:	50                   	push   %eax
+f01024e4:	68 68 01 00 00       	push   $0x168
+f01024e9:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01024ef:	50                   	push   %eax
+f01024f0:	e8 bd dc ff ff       	call   f01001b2 <_panic>
+			pt[i] = pa | PTE_G | PTE_W | PTE_P;
+f01024f5:	89 f2                	mov    %esi,%edx
+f01024f7:	81 ca 03 01 00 00    	or     $0x103,%edx
+f01024fd:	89 14 81             	mov    %edx,(%ecx,%eax,4)
+		for (i = 0; i < NPTENTRIES && pa < top; i++, pa += PGSIZE)
+f0102500:	83 c0 01             	add    $0x1,%eax
+f0102503:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0102509:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+f010250e:	7f 04                	jg     f0102514 <mem_init+0x12a>
+f0102510:	39 fe                	cmp    %edi,%esi
+f0102512:	72 e1                	jb     f01024f5 <mem_init+0x10b>
+	for (pa = 0; pa < top; ) {
+f0102514:	39 fe                	cmp    %edi,%esi
+f0102516:	73 2e                	jae    f0102546 <mem_init+0x15c>
+		if (top - pa >= PTSIZE) {
+f0102518:	89 f8                	mov    %edi,%eax
+f010251a:	29 f0                	sub    %esi,%eax
+f010251c:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+f0102521:	0f 86 5f ff ff ff    	jbe    f0102486 <mem_init+0x9c>
+			pgdir[PDX(KERNBASE + pa)] =
+f0102527:	8d 86 00 00 00 f0    	lea    -0x10000000(%esi),%eax
+f010252d:	c1 e8 16             	shr    $0x16,%eax
+				pa | PTE_PS | PTE_G | PTE_W | PTE_P;
+f0102530:	89 f2                	mov    %esi,%edx
+f0102532:	81 ca 83 01 00 00    	or     $0x183,%edx
+f0102538:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f010253b:	89 14 83             	mov    %edx,(%ebx,%eax,4)
+			pa += PTSIZE;
+f010253e:	81 c6 00 00 40 00    	add    $0x400000,%esi
+			continue;
+f0102544:	eb ce                	jmp    f0102514 <mem_init+0x12a>
+	lcr3(PADDR(kern_pgdir));
+f0102546:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0102549:	8b 80 ac 0a 00 00    	mov    0xaac(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f010254f:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102554:	0f 86 ea 01 00 00    	jbe    f0102744 <mem_init+0x35a>
+	return (physaddr_t)kva - KERNBASE;
+f010255a:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f010255f:	0f 22 d8             	mov    %eax,%cr3
+	asm volatile("movl %%cr4,%0" : "=r" (cr4));
+f0102562:	0f 20 e0             	mov    %cr4,%eax
+f0102565:	89 c2                	mov    %eax,%edx
+	if (cr4 & CR4_PGE) {
+f0102567:	a8 80                	test   $0x80,%al
+f0102569:	0f 84 f1 01 00 00    	je     f0102760 <mem_init+0x376>
+		lcr4(cr4 & ~CR4_PGE);
+f010256f:	24 7f                	and    $0x7f,%al
+	asm volatile("movl %0,%%cr4" : : "r" (val));
+f0102571:	0f 22 e0             	mov    %eax,%cr4
+f0102574:	0f 22 e2             	mov    %edx,%cr4
+	__spin_initlock(&buddy_lock, "buddy");
+f0102577:	83 ec 08             	sub    $0x8,%esp
+f010257a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f010257d:	8d 83 ec 5a fe ff    	lea    -0x1a514(%ebx),%eax
+f0102583:	50                   	push   %eax
+f0102584:	8d 83 08 0b 00 00    	lea    0xb08(%ebx),%eax
+f010258a:	50                   	push   %eax
+f010258b:	e8 6c 22 00 00       	call   f01047fc <__spin_initlock>
+	page_init();
+f0102590:	e8 58 f8 ff ff       	call   f0101ded <page_init>
+	struct PageInfo *pp0, *pp1, *pp2, *big;
+	size_t nfree;
+	char *c;
+	int i;
+
+	if (!pages)
+f0102595:	83 c4 10             	add    $0x10,%esp
+f0102598:	83 bb a8 0a 00 00 00 	cmpl   $0x0,0xaa8(%ebx)
+f010259f:	0f 84 c6 01 00 00    	je     f010276b <mem_init+0x381>
+		panic("'pages' is a null pointer!");
+	nfree = page_nfree();
+f01025a5:	e8 f9 fd ff ff       	call   f01023a3 <page_nfree>
+f01025aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	assert(nfree > 0);
+f01025ad:	85 c0                	test   %eax,%eax
+f01025af:	0f 84 d4 01 00 00    	je     f0102789 <mem_init+0x39f>
+
+	// should be able to allocate three pages
+	assert((pp0 = page_alloc(0)));
+f01025b5:	83 ec 0c             	sub    $0xc,%esp
+f01025b8:	6a 00                	push   $0x0
+f01025ba:	e8 f8 f9 ff ff       	call   f0101fb7 <page_alloc>
+f01025bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01025c2:	83 c4 10             	add    $0x10,%esp
+f01025c5:	85 c0                	test   %eax,%eax
+f01025c7:	0f 84 de 01 00 00    	je     f01027ab <mem_init+0x3c1>
+	assert((pp1 = page_alloc(0)));
+f01025cd:	83 ec 0c             	sub    $0xc,%esp
+f01025d0:	6a 00                	push   $0x0
+f01025d2:	e8 e0 f9 ff ff       	call   f0101fb7 <page_alloc>
+f01025d7:	89 c6                	mov    %eax,%esi
+f01025d9:	83 c4 10             	add    $0x10,%esp
+f01025dc:	85 c0                	test   %eax,%eax
+f01025de:	0f 84 e9 01 00 00    	je     f01027cd <mem_init+0x3e3>
+	assert((pp2 = page_alloc(0)));
+f01025e4:	83 ec 0c             	sub    $0xc,%esp
+f01025e7:	6a 00                	push   $0x0
+f01025e9:	e8 c9 f9 ff ff       	call   f0101fb7 <page_alloc>
+f01025ee:	89 c7                	mov    %eax,%edi
+f01025f0:	83 c4 10             	add    $0x10,%esp
+f01025f3:	85 c0                	test   %eax,%eax
+f01025f5:	0f 84 f4 01 00 00    	je     f01027ef <mem_init+0x405>
+	assert(pp0 != pp1 && pp1 != pp2 && pp2 != pp0);
+f01025fb:	39 c6                	cmp    %eax,%esi
+f01025fd:	0f 94 c0             	sete   %al
+f0102600:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0102603:	39 f9                	cmp    %edi,%ecx
+f0102605:	0f 94 c2             	sete   %dl
+f0102608:	08 d0                	or     %dl,%al
+f010260a:	0f 85 01 02 00 00    	jne    f0102811 <mem_init+0x427>
+f0102610:	39 f1                	cmp    %esi,%ecx
+f0102612:	0f 84 f9 01 00 00    	je     f0102811 <mem_init+0x427>
+	return (pp - pages) << PGSHIFT;
+f0102618:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010261b:	8b 8a a8 0a 00 00    	mov    0xaa8(%edx),%ecx
+f0102621:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102624:	29 c8                	sub    %ecx,%eax
+f0102626:	c1 f8 02             	sar    $0x2,%eax
+f0102629:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010262f:	c1 e0 0c             	shl    $0xc,%eax
+f0102632:	89 c3                	mov    %eax,%ebx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102634:	8b 82 b0 0a 00 00    	mov    0xab0(%edx),%eax
+f010263a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010263d:	89 c2                	mov    %eax,%edx
+f010263f:	c1 e2 0c             	shl    $0xc,%edx
+f0102642:	39 d3                	cmp    %edx,%ebx
+f0102644:	0f 83 e9 01 00 00    	jae    f0102833 <mem_init+0x449>
+f010264a:	89 f0                	mov    %esi,%eax
+f010264c:	29 c8                	sub    %ecx,%eax
+f010264e:	c1 f8 02             	sar    $0x2,%eax
+f0102651:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102657:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp1) < npages*PGSIZE);
+f010265a:	39 d0                	cmp    %edx,%eax
+f010265c:	0f 83 f3 01 00 00    	jae    f0102855 <mem_init+0x46b>
+f0102662:	89 f8                	mov    %edi,%eax
+f0102664:	29 c8                	sub    %ecx,%eax
+f0102666:	c1 f8 02             	sar    $0x2,%eax
+f0102669:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010266f:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0102672:	39 d0                	cmp    %edx,%eax
+f0102674:	0f 83 fd 01 00 00    	jae    f0102877 <mem_init+0x48d>
+	assert(page_nfree() == nfree - 3);
+f010267a:	e8 24 fd ff ff       	call   f01023a3 <page_nfree>
+f010267f:	89 c2                	mov    %eax,%edx
+f0102681:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102684:	83 e8 03             	sub    $0x3,%eax
+f0102687:	39 c2                	cmp    %eax,%edx
+f0102689:	0f 85 0a 02 00 00    	jne    f0102899 <mem_init+0x4af>
+	if (PGNUM(pa) >= npages)
+f010268f:	89 d8                	mov    %ebx,%eax
+f0102691:	c1 e8 0c             	shr    $0xc,%eax
+f0102694:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0102697:	39 c8                	cmp    %ecx,%eax
+f0102699:	0f 83 1c 02 00 00    	jae    f01028bb <mem_init+0x4d1>
+
+	// test ALLOC_ZERO on a dirtied page
+	memset(page2kva(pp0), 1, PGSIZE);
+f010269f:	83 ec 04             	sub    $0x4,%esp
+f01026a2:	68 00 10 00 00       	push   $0x1000
+f01026a7:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f01026a9:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f01026af:	53                   	push   %ebx
+f01026b0:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01026b3:	e8 5c 2c 00 00       	call   f0105314 <memset>
+	page_free(pp0);
+f01026b8:	83 c4 04             	add    $0x4,%esp
+f01026bb:	ff 75 e4             	push   -0x1c(%ebp)
+f01026be:	e8 1b fa ff ff       	call   f01020de <page_free>
+	assert((pp0 = page_alloc(ALLOC_ZERO)));
+f01026c3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01026ca:	e8 e8 f8 ff ff       	call   f0101fb7 <page_alloc>
+f01026cf:	89 c3                	mov    %eax,%ebx
+f01026d1:	83 c4 10             	add    $0x10,%esp
+f01026d4:	85 c0                	test   %eax,%eax
+f01026d6:	0f 84 f8 01 00 00    	je     f01028d4 <mem_init+0x4ea>
+	return (pp - pages) << PGSHIFT;
+f01026dc:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01026df:	2b 82 a8 0a 00 00    	sub    0xaa8(%edx),%eax
+f01026e5:	c1 f8 02             	sar    $0x2,%eax
+f01026e8:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01026ee:	89 c1                	mov    %eax,%ecx
+f01026f0:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01026f3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01026f8:	3b 82 b0 0a 00 00    	cmp    0xab0(%edx),%eax
+f01026fe:	0f 83 f2 01 00 00    	jae    f01028f6 <mem_init+0x50c>
+	return (void *)(pa + KERNBASE);
+f0102704:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+f010270a:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+	c = page2kva(pp0);
+	for (i = 0; i < PGSIZE; i++)
+f0102710:	39 c1                	cmp    %eax,%ecx
+f0102712:	0f 84 f6 01 00 00    	je     f010290e <mem_init+0x524>
+		assert(c[i] == 0);
+f0102718:	0f b6 10             	movzbl (%eax),%edx
+f010271b:	83 c0 01             	add    $0x1,%eax
+f010271e:	84 d2                	test   %dl,%dl
+f0102720:	74 ee                	je     f0102710 <mem_init+0x326>
+f0102722:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102725:	8d 83 ca 5b fe ff    	lea    -0x1a436(%ebx),%eax
+f010272b:	50                   	push   %eax
+f010272c:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102732:	50                   	push   %eax
+f0102733:	68 fb 02 00 00       	push   $0x2fb
+f0102738:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f010273e:	50                   	push   %eax
+f010273f:	e8 6e da ff ff       	call   f01001b2 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102744:	50                   	push   %eax
+f0102745:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102748:	8d 83 c4 53 fe ff    	lea    -0x1ac3c(%ebx),%eax
+f010274e:	50                   	push   %eax
+f010274f:	68 f1 00 00 00       	push   $0xf1
+f0102754:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f010275a:	50                   	push   %eax
+f010275b:	e8 52 da ff ff       	call   f01001b2 <_panic>
+	asm volatile("movl %%cr3,%0" : "=r" (cr3));
+f0102760:	0f 20 d8             	mov    %cr3,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (cr3));
+f0102763:	0f 22 d8             	mov    %eax,%cr3
+}
+f0102766:	e9 0c fe ff ff       	jmp    f0102577 <mem_init+0x18d>
+		panic("'pages' is a null pointer!");
+f010276b:	83 ec 04             	sub    $0x4,%esp
+f010276e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102771:	8d 83 f2 5a fe ff    	lea    -0x1a50e(%ebx),%eax
+f0102777:	50                   	push   %eax
+f0102778:	68 e7 02 00 00       	push   $0x2e7
+f010277d:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102783:	50                   	push   %eax
+f0102784:	e8 29 da ff ff       	call   f01001b2 <_panic>
+	assert(nfree > 0);
+f0102789:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f010278c:	8d 83 0d 5b fe ff    	lea    -0x1a4f3(%ebx),%eax
+f0102792:	50                   	push   %eax
+f0102793:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102799:	50                   	push   %eax
+f010279a:	68 e9 02 00 00       	push   $0x2e9
+f010279f:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01027a5:	50                   	push   %eax
+f01027a6:	e8 07 da ff ff       	call   f01001b2 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01027ab:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01027ae:	8d 83 17 5b fe ff    	lea    -0x1a4e9(%ebx),%eax
+f01027b4:	50                   	push   %eax
+f01027b5:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01027bb:	50                   	push   %eax
+f01027bc:	68 ec 02 00 00       	push   $0x2ec
+f01027c1:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01027c7:	50                   	push   %eax
+f01027c8:	e8 e5 d9 ff ff       	call   f01001b2 <_panic>
+	assert((pp1 = page_alloc(0)));
+f01027cd:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01027d0:	8d 83 2d 5b fe ff    	lea    -0x1a4d3(%ebx),%eax
+f01027d6:	50                   	push   %eax
+f01027d7:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01027dd:	50                   	push   %eax
+f01027de:	68 ed 02 00 00       	push   $0x2ed
+f01027e3:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01027e9:	50                   	push   %eax
+f01027ea:	e8 c3 d9 ff ff       	call   f01001b2 <_panic>
+	assert((pp2 = page_alloc(0)));
+f01027ef:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01027f2:	8d 83 43 5b fe ff    	lea    -0x1a4bd(%ebx),%eax
+f01027f8:	50                   	push   %eax
+f01027f9:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01027ff:	50                   	push   %eax
+f0102800:	68 ee 02 00 00       	push   $0x2ee
+f0102805:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f010280b:	50                   	push   %eax
+f010280c:	e8 a1 d9 ff ff       	call   f01001b2 <_panic>
+	assert(pp0 != pp1 && pp1 != pp2 && pp2 != pp0);
+f0102811:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102814:	8d 83 6c 5d fe ff    	lea    -0x1a294(%ebx),%eax
+f010281a:	50                   	push   %eax
+f010281b:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102821:	50                   	push   %eax
+f0102822:	68 ef 02 00 00       	push   $0x2ef
+f0102827:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f010282d:	50                   	push   %eax
+f010282e:	e8 7f d9 ff ff       	call   f01001b2 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102833:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102836:	8d 83 59 5b fe ff    	lea    -0x1a4a7(%ebx),%eax
+f010283c:	50                   	push   %eax
+f010283d:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102843:	50                   	push   %eax
+f0102844:	68 f0 02 00 00       	push   $0x2f0
+f0102849:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f010284f:	50                   	push   %eax
+f0102850:	e8 5d d9 ff ff       	call   f01001b2 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0102855:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102858:	8d 83 76 5b fe ff    	lea    -0x1a48a(%ebx),%eax
+f010285e:	50                   	push   %eax
+f010285f:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102865:	50                   	push   %eax
+f0102866:	68 f1 02 00 00       	push   $0x2f1
+f010286b:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102871:	50                   	push   %eax
+f0102872:	e8 3b d9 ff ff       	call   f01001b2 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0102877:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f010287a:	8d 83 93 5b fe ff    	lea    -0x1a46d(%ebx),%eax
+f0102880:	50                   	push   %eax
+f0102881:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102887:	50                   	push   %eax
+f0102888:	68 f2 02 00 00       	push   $0x2f2
+f010288d:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102893:	50                   	push   %eax
+f0102894:	e8 19 d9 ff ff       	call   f01001b2 <_panic>
+	assert(page_nfree() == nfree - 3);
+f0102899:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f010289c:	8d 83 b0 5b fe ff    	lea    -0x1a450(%ebx),%eax
+f01028a2:	50                   	push   %eax
+f01028a3:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01028a9:	50                   	push   %eax
+f01028aa:	68 f3 02 00 00       	push   $0x2f3
+f01028af:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01028b5:	50                   	push   %eax
+f01028b6:	e8 f7 d8 ff ff       	call   f01001b2 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01028bb:	53                   	push   %ebx
+f01028bc:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01028bf:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01028c5:	50                   	push   %eax
+f01028c6:	6a 62                	push   $0x62
+f01028c8:	8d 83 de 5a fe ff    	lea    -0x1a522(%ebx),%eax
+f01028ce:	50                   	push   %eax
+f01028cf:	e8 de d8 ff ff       	call   f01001b2 <_panic>
+	assert((pp0 = page_alloc(ALLOC_ZERO)));
+f01028d4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01028d7:	8d 83 94 5d fe ff    	lea    -0x1a26c(%ebx),%eax
+f01028dd:	50                   	push   %eax
+f01028de:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01028e4:	50                   	push   %eax
+f01028e5:	68 f8 02 00 00       	push   $0x2f8
+f01028ea:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01028f0:	50                   	push   %eax
+f01028f1:	e8 bc d8 ff ff       	call   f01001b2 <_panic>
+f01028f6:	51                   	push   %ecx
+f01028f7:	89 d3                	mov    %edx,%ebx
+f01028f9:	8d 82 30 53 fe ff    	lea    -0x1acd0(%edx),%eax
+f01028ff:	50                   	push   %eax
+f0102900:	6a 62                	push   $0x62
+f0102902:	8d 82 de 5a fe ff    	lea    -0x1a522(%edx),%eax
+f0102908:	50                   	push   %eax
+f0102909:	e8 a4 d8 ff ff       	call   f01001b2 <_panic>
+
+	page_free(pp0);
+f010290e:	83 ec 0c             	sub    $0xc,%esp
+f0102911:	53                   	push   %ebx
+f0102912:	e8 c7 f7 ff ff       	call   f01020de <page_free>
+	page_free(pp1);
+f0102917:	89 34 24             	mov    %esi,(%esp)
+f010291a:	e8 bf f7 ff ff       	call   f01020de <page_free>
+	page_free(pp2);
+f010291f:	89 3c 24             	mov    %edi,(%esp)
+f0102922:	e8 b7 f7 ff ff       	call   f01020de <page_free>
+
+	// contiguous blocks are aligned to their size, and their pages
+	// are not handed out again until the block is freed
+	assert((big = page_alloc_order(3, 0)));
+f0102927:	83 c4 08             	add    $0x8,%esp
+f010292a:	6a 00                	push   $0x0
+f010292c:	6a 03                	push   $0x3
+f010292e:	e8 a1 f8 ff ff       	call   f01021d4 <page_alloc_order>
+f0102933:	89 c7                	mov    %eax,%edi
+f0102935:	83 c4 10             	add    $0x10,%esp
+f0102938:	85 c0                	test   %eax,%eax
+f010293a:	74 3a                	je     f0102976 <mem_init+0x58c>
+	return (pp - pages) << PGSHIFT;
+f010293c:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f010293f:	2b 83 a8 0a 00 00    	sub    0xaa8(%ebx),%eax
+f0102945:	c1 f8 02             	sar    $0x2,%eax
+f0102948:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010294e:	c1 e0 0c             	shl    $0xc,%eax
+	assert((page2pa(big) & ((PGSIZE << 3) - 1)) == 0);
+f0102951:	a9 ff 7f 00 00       	test   $0x7fff,%eax
+f0102956:	75 40                	jne    f0102998 <mem_init+0x5ae>
+	assert(page_nfree() == nfree - 8);
+f0102958:	e8 46 fa ff ff       	call   f01023a3 <page_nfree>
+f010295d:	89 c2                	mov    %eax,%edx
+f010295f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102962:	83 e8 08             	sub    $0x8,%eax
+f0102965:	39 c2                	cmp    %eax,%edx
+f0102967:	75 4e                	jne    f01029b7 <mem_init+0x5cd>
+f0102969:	be 01 01 00 00       	mov    $0x101,%esi
+	for (i = 0; i < 4 * PCP_HIGH; i++) {
+		assert((pp0 = page_alloc(0)));
+		assert(pp0 < big || pp0 >= big + 8);
+f010296e:	8d 5f 60             	lea    0x60(%edi),%ebx
+f0102971:	e9 91 00 00 00       	jmp    f0102a07 <mem_init+0x61d>
+	assert((big = page_alloc_order(3, 0)));
+f0102976:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102979:	8d 83 b4 5d fe ff    	lea    -0x1a24c(%ebx),%eax
+f010297f:	50                   	push   %eax
+f0102980:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102986:	50                   	push   %eax
+f0102987:	68 03 03 00 00       	push   $0x303
+f010298c:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102992:	50                   	push   %eax
+f0102993:	e8 1a d8 ff ff       	call   f01001b2 <_panic>
+	assert((page2pa(big) & ((PGSIZE << 3) - 1)) == 0);
+f0102998:	8d 83 d4 5d fe ff    	lea    -0x1a22c(%ebx),%eax
+f010299e:	50                   	push   %eax
+f010299f:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01029a5:	50                   	push   %eax
+f01029a6:	68 04 03 00 00       	push   $0x304
+f01029ab:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01029b1:	50                   	push   %eax
+f01029b2:	e8 fb d7 ff ff       	call   f01001b2 <_panic>
+	assert(page_nfree() == nfree - 8);
+f01029b7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01029ba:	8d 83 d4 5b fe ff    	lea    -0x1a42c(%ebx),%eax
+f01029c0:	50                   	push   %eax
+f01029c1:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01029c7:	50                   	push   %eax
+f01029c8:	68 05 03 00 00       	push   $0x305
+f01029cd:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01029d3:	50                   	push   %eax
+f01029d4:	e8 d9 d7 ff ff       	call   f01001b2 <_panic>
+		assert((pp0 = page_alloc(0)));
+f01029d9:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01029dc:	8d 83 17 5b fe ff    	lea    -0x1a4e9(%ebx),%eax
+f01029e2:	50                   	push   %eax
+f01029e3:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f01029e9:	50                   	push   %eax
+f01029ea:	68 07 03 00 00       	push   $0x307
+f01029ef:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f01029f5:	50                   	push   %eax
+f01029f6:	e8 b7 d7 ff ff       	call   f01001b2 <_panic>
+		page_free(pp0);
+f01029fb:	83 ec 0c             	sub    $0xc,%esp
+f01029fe:	50                   	push   %eax
+f01029ff:	e8 da f6 ff ff       	call   f01020de <page_free>
+f0102a04:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 4 * PCP_HIGH; i++) {
+f0102a07:	83 ee 01             	sub    $0x1,%esi
+f0102a0a:	74 3b                	je     f0102a47 <mem_init+0x65d>
+		assert((pp0 = page_alloc(0)));
+f0102a0c:	83 ec 0c             	sub    $0xc,%esp
+f0102a0f:	6a 00                	push   $0x0
+f0102a11:	e8 a1 f5 ff ff       	call   f0101fb7 <page_alloc>
+f0102a16:	83 c4 10             	add    $0x10,%esp
+f0102a19:	85 c0                	test   %eax,%eax
+f0102a1b:	74 bc                	je     f01029d9 <mem_init+0x5ef>
+		assert(pp0 < big || pp0 >= big + 8);
+f0102a1d:	39 f8                	cmp    %edi,%eax
+f0102a1f:	72 da                	jb     f01029fb <mem_init+0x611>
+f0102a21:	39 d8                	cmp    %ebx,%eax
+f0102a23:	73 d6                	jae    f01029fb <mem_init+0x611>
+f0102a25:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102a28:	8d 83 ee 5b fe ff    	lea    -0x1a412(%ebx),%eax
+f0102a2e:	50                   	push   %eax
+f0102a2f:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102a35:	50                   	push   %eax
+f0102a36:	68 08 03 00 00       	push   $0x308
+f0102a3b:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102a41:	50                   	push   %eax
+f0102a42:	e8 6b d7 ff ff       	call   f01001b2 <_panic>
+	}
+	page_free_order(big, 3);
+f0102a47:	83 ec 08             	sub    $0x8,%esp
+f0102a4a:	6a 03                	push   $0x3
+f0102a4c:	57                   	push   %edi
+f0102a4d:	e8 66 f8 ff ff       	call   f01022b8 <page_free_order>
+	assert(page_nfree() == nfree);
+f0102a52:	e8 4c f9 ff ff       	call   f01023a3 <page_nfree>
+f0102a57:	83 c4 10             	add    $0x10,%esp
+f0102a5a:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+f0102a5d:	75 22                	jne    f0102a81 <mem_init+0x697>
+
+	cprintf("check_page_alloc() succeeded!\n");
+f0102a5f:	83 ec 0c             	sub    $0xc,%esp
+f0102a62:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102a65:	8d 83 00 5e fe ff    	lea    -0x1a200(%ebx),%eax
+f0102a6b:	50                   	push   %eax
+f0102a6c:	e8 73 0f 00 00       	call   f01039e4 <cprintf>
+	pat_init();
+f0102a71:	e8 d0 f2 ff ff       	call   f0101d46 <pat_init>
+}
+f0102a76:	83 c4 10             	add    $0x10,%esp
+f0102a79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102a7c:	5b                   	pop    %ebx
+f0102a7d:	5e                   	pop    %esi
+f0102a7e:	5f                   	pop    %edi
+f0102a7f:	5d                   	pop    %ebp
+f0102a80:	c3                   	ret
+	assert(page_nfree() == nfree);
+f0102a81:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102a84:	8d 83 0a 5c fe ff    	lea    -0x1a3f6(%ebx),%eax
+f0102a8a:	50                   	push   %eax
+f0102a8b:	8d 83 bd 5a fe ff    	lea    -0x1a543(%ebx),%eax
+f0102a91:	50                   	push   %eax
+f0102a92:	68 0c 03 00 00       	push   $0x30c
+f0102a97:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102a9d:	50                   	push   %eax
+f0102a9e:	e8 0f d7 ff ff       	call   f01001b2 <_panic>
+
+f0102aa3 <pgdir_walk>:
+{
+f0102aa3:	55                   	push   %ebp
+f0102aa4:	89 e5                	mov    %esp,%ebp
+f0102aa6:	57                   	push   %edi
+f0102aa7:	56                   	push   %esi
+f0102aa8:	53                   	push   %ebx
+f0102aa9:	83 ec 0c             	sub    $0xc,%esp
+f0102aac:	e8 80 e6 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f0102ab1:	81 c7 27 d9 01 00    	add    $0x1d927,%edi
+f0102ab7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pde_t *pde = &pgdir[PDX(va)];
+f0102aba:	89 f3                	mov    %esi,%ebx
+f0102abc:	c1 eb 16             	shr    $0x16,%ebx
+f0102abf:	c1 e3 02             	shl    $0x2,%ebx
+f0102ac2:	03 5d 08             	add    0x8(%ebp),%ebx
+	if (!(*pde & PTE_P)) {
+f0102ac5:	8b 03                	mov    (%ebx),%eax
+f0102ac7:	a8 01                	test   $0x1,%al
+f0102ac9:	75 35                	jne    f0102b00 <pgdir_walk+0x5d>
+		if (!create || !(pp = page_alloc(ALLOC_ZERO)))
+f0102acb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0102acf:	74 7b                	je     f0102b4c <pgdir_walk+0xa9>
+f0102ad1:	83 ec 0c             	sub    $0xc,%esp
+f0102ad4:	6a 01                	push   $0x1
+f0102ad6:	e8 dc f4 ff ff       	call   f0101fb7 <page_alloc>
+f0102adb:	83 c4 10             	add    $0x10,%esp
+f0102ade:	85 c0                	test   %eax,%eax
+f0102ae0:	74 47                	je     f0102b29 <pgdir_walk+0x86>
+		pp->pp_ref++;
+f0102ae2:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+f0102ae7:	2b 87 a8 0a 00 00    	sub    0xaa8(%edi),%eax
+f0102aed:	c1 f8 02             	sar    $0x2,%eax
+f0102af0:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102af6:	c1 e0 0c             	shl    $0xc,%eax
+		*pde = page2pa(pp) | PTE_U | PTE_W | PTE_P;
+f0102af9:	83 c8 07             	or     $0x7,%eax
+f0102afc:	89 03                	mov    %eax,(%ebx)
+f0102afe:	eb 04                	jmp    f0102b04 <pgdir_walk+0x61>
+	} else if (*pde & PTE_PS)
+f0102b00:	a8 80                	test   $0x80,%al
+f0102b02:	75 4f                	jne    f0102b53 <pgdir_walk+0xb0>
+	return (pte_t *) KADDR(PTE_ADDR(*pde)) + PTX(va);
+f0102b04:	8b 03                	mov    (%ebx),%eax
+f0102b06:	89 c2                	mov    %eax,%edx
+f0102b08:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f0102b0e:	c1 e8 0c             	shr    $0xc,%eax
+f0102b11:	3b 87 b0 0a 00 00    	cmp    0xab0(%edi),%eax
+f0102b17:	73 18                	jae    f0102b31 <pgdir_walk+0x8e>
+f0102b19:	c1 ee 0a             	shr    $0xa,%esi
+f0102b1c:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f0102b22:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+}
+f0102b29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102b2c:	5b                   	pop    %ebx
+f0102b2d:	5e                   	pop    %esi
+f0102b2e:	5f                   	pop    %edi
+f0102b2f:	5d                   	pop    %ebp
+f0102b30:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102b31:	52                   	push   %edx
+f0102b32:	8d 87 30 53 fe ff    	lea    -0x1acd0(%edi),%eax
+f0102b38:	50                   	push   %eax
+f0102b39:	68 a4 02 00 00       	push   $0x2a4
+f0102b3e:	8d 87 d2 5a fe ff    	lea    -0x1a52e(%edi),%eax
+f0102b44:	50                   	push   %eax
+f0102b45:	89 fb                	mov    %edi,%ebx
+f0102b47:	e8 66 d6 ff ff       	call   f01001b2 <_panic>
+			return NULL;
+f0102b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102b51:	eb d6                	jmp    f0102b29 <pgdir_walk+0x86>
+		return NULL;
+f0102b53:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102b58:	eb cf                	jmp    f0102b29 <pgdir_walk+0x86>
+
+f0102b5a <boot_map_region>:
+{
+f0102b5a:	55                   	push   %ebp
+f0102b5b:	89 e5                	mov    %esp,%ebp
+f0102b5d:	57                   	push   %edi
+f0102b5e:	56                   	push   %esi
+f0102b5f:	53                   	push   %ebx
+f0102b60:	83 ec 1c             	sub    $0x1c,%esp
+f0102b63:	e8 c9 e5 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f0102b68:	81 c7 70 d8 01 00    	add    $0x1d870,%edi
+f0102b6e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0102b71:	89 c7                	mov    %eax,%edi
+f0102b73:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0102b76:	89 ce                	mov    %ecx,%esi
+	for (off = 0; off < size; off += PGSIZE) {
+f0102b78:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0102b7d:	39 f3                	cmp    %esi,%ebx
+f0102b7f:	73 4d                	jae    f0102bce <boot_map_region+0x74>
+		if (!(pte = pgdir_walk(pgdir, (void *) (va + off), 1)))
+f0102b81:	83 ec 04             	sub    $0x4,%esp
+f0102b84:	6a 01                	push   $0x1
+f0102b86:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102b89:	01 d8                	add    %ebx,%eax
+f0102b8b:	50                   	push   %eax
+f0102b8c:	57                   	push   %edi
+f0102b8d:	e8 11 ff ff ff       	call   f0102aa3 <pgdir_walk>
+f0102b92:	89 c2                	mov    %eax,%edx
+f0102b94:	83 c4 10             	add    $0x10,%esp
+f0102b97:	85 c0                	test   %eax,%eax
+f0102b99:	74 15                	je     f0102bb0 <boot_map_region+0x56>
+		*pte = (pa + off) | perm | PTE_P;
+f0102b9b:	89 d8                	mov    %ebx,%eax
+f0102b9d:	03 45 08             	add    0x8(%ebp),%eax
+f0102ba0:	0b 45 0c             	or     0xc(%ebp),%eax
+f0102ba3:	83 c8 01             	or     $0x1,%eax
+f0102ba6:	89 02                	mov    %eax,(%edx)
+	for (off = 0; off < size; off += PGSIZE) {
+f0102ba8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102bae:	eb cd                	jmp    f0102b7d <boot_map_region+0x23>
+			panic("boot_map_region: out of memory");
+f0102bb0:	83 ec 04             	sub    $0x4,%esp
+f0102bb3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0102bb6:	8d 83 20 5e fe ff    	lea    -0x1a1e0(%ebx),%eax
+f0102bbc:	50                   	push   %eax
+f0102bbd:	68 7c 01 00 00       	push   $0x17c
+f0102bc2:	8d 83 d2 5a fe ff    	lea    -0x1a52e(%ebx),%eax
+f0102bc8:	50                   	push   %eax
+f0102bc9:	e8 e4 d5 ff ff       	call   f01001b2 <_panic>
+}
+f0102bce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102bd1:	5b                   	pop    %ebx
+f0102bd2:	5e                   	pop    %esi
+f0102bd3:	5f                   	pop    %edi
+f0102bd4:	5d                   	pop    %ebp
+f0102bd5:	c3                   	ret
+
+f0102bd6 <mem_init_mp>:
+{
+f0102bd6:	55                   	push   %ebp
+f0102bd7:	89 e5                	mov    %esp,%ebp
+f0102bd9:	57                   	push   %edi
+f0102bda:	56                   	push   %esi
+f0102bdb:	53                   	push   %ebx
+f0102bdc:	83 ec 1c             	sub    $0x1c,%esp
+f0102bdf:	e8 49 e5 ff ff       	call   f010112d <__x86.get_pc_thunk.si>
+f0102be4:	81 c6 f4 d7 01 00    	add    $0x1d7f4,%esi
+	for (i = 0; i < ncpu; i++) {
+f0102bea:	c7 45 e4 00 80 ff ef 	movl   $0xefff8000,-0x1c(%ebp)
+f0102bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if ((uint32_t)kva < KERNBASE)
+f0102bf6:	c7 c0 00 60 11 f0    	mov    $0xf0116000,%eax
+f0102bfc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f0102bff:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102c04:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0102c07:	e9 ab 00 00 00       	jmp    f0102cb7 <mem_init_mp+0xe1>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102c0c:	ff b6 fc ff ff ff    	push   -0x4(%esi)
+f0102c12:	8d 86 c4 53 fe ff    	lea    -0x1ac3c(%esi),%eax
+f0102c18:	50                   	push   %eax
+f0102c19:	68 13 01 00 00       	push   $0x113
+f0102c1e:	8d 86 d2 5a fe ff    	lea    -0x1a52e(%esi),%eax
+f0102c24:	50                   	push   %eax
+f0102c25:	89 f3                	mov    %esi,%ebx
+f0102c27:	e8 86 d5 ff ff       	call   f01001b2 <_panic>
+				panic("mem_init_mp: out of memory");
+f0102c2c:	83 ec 04             	sub    $0x4,%esp
+f0102c2f:	8d 86 20 5c fe ff    	lea    -0x1a3e0(%esi),%eax
+f0102c35:	50                   	push   %eax
+f0102c36:	68 19 01 00 00       	push   $0x119
+f0102c3b:	8d 86 d2 5a fe ff    	lea    -0x1a52e(%esi),%eax
+f0102c41:	50                   	push   %eax
+f0102c42:	89 f3                	mov    %esi,%ebx
+f0102c44:	e8 69 d5 ff ff       	call   f01001b2 <_panic>
+f0102c49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102c4c:	89 c3                	mov    %eax,%ebx
+		for (off = 0; off < KSTKSIZE; off += PGSIZE) {
+f0102c4e:	05 00 80 00 00       	add    $0x8000,%eax
+f0102c53:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0102c56:	89 c7                	mov    %eax,%edi
+f0102c58:	39 fb                	cmp    %edi,%ebx
+f0102c5a:	74 4e                	je     f0102caa <mem_init_mp+0xd4>
+			if (!(pp = page_alloc(ALLOC_ZERO)))
+f0102c5c:	83 ec 0c             	sub    $0xc,%esp
+f0102c5f:	6a 01                	push   $0x1
+f0102c61:	e8 51 f3 ff ff       	call   f0101fb7 <page_alloc>
+f0102c66:	83 c4 10             	add    $0x10,%esp
+f0102c69:	85 c0                	test   %eax,%eax
+f0102c6b:	74 bf                	je     f0102c2c <mem_init_mp+0x56>
+			pp->pp_ref++;
+f0102c6d:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+			boot_map_region(kern_pgdir,
+f0102c72:	83 ec 08             	sub    $0x8,%esp
+f0102c75:	68 02 01 00 00       	push   $0x102
+	return (pp - pages) << PGSHIFT;
+f0102c7a:	2b 86 a8 0a 00 00    	sub    0xaa8(%esi),%eax
+f0102c80:	c1 f8 02             	sar    $0x2,%eax
+f0102c83:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102c89:	c1 e0 0c             	shl    $0xc,%eax
+f0102c8c:	50                   	push   %eax
+f0102c8d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f0102c92:	89 da                	mov    %ebx,%edx
+f0102c94:	8b 86 ac 0a 00 00    	mov    0xaac(%esi),%eax
+f0102c9a:	e8 bb fe ff ff       	call   f0102b5a <boot_map_region>
+f0102c9f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102ca5:	83 c4 10             	add    $0x10,%esp
+f0102ca8:	eb ae                	jmp    f0102c58 <mem_init_mp+0x82>
+f0102caa:	8b 7d d8             	mov    -0x28(%ebp),%edi
+	for (i = 0; i < ncpu; i++) {
+f0102cad:	83 c7 01             	add    $0x1,%edi
+f0102cb0:	81 6d e4 00 00 01 00 	subl   $0x10000,-0x1c(%ebp)
+f0102cb7:	c7 c0 40 18 12 f0    	mov    $0xf0121840,%eax
+f0102cbd:	39 38                	cmp    %edi,(%eax)
+f0102cbf:	7e 34                	jle    f0102cf5 <mem_init_mp+0x11f>
+		if (i == 0) {
+f0102cc1:	85 ff                	test   %edi,%edi
+f0102cc3:	75 84                	jne    f0102c49 <mem_init_mp+0x73>
+	if ((uint32_t)kva < KERNBASE)
+f0102cc5:	81 7d e0 ff ff ff ef 	cmpl   $0xefffffff,-0x20(%ebp)
+f0102ccc:	0f 86 3a ff ff ff    	jbe    f0102c0c <mem_init_mp+0x36>
+			boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE,
+f0102cd2:	83 ec 08             	sub    $0x8,%esp
+f0102cd5:	68 02 01 00 00       	push   $0x102
+f0102cda:	ff 75 dc             	push   -0x24(%ebp)
+f0102cdd:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f0102ce2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0102ce5:	8b 86 ac 0a 00 00    	mov    0xaac(%esi),%eax
+f0102ceb:	e8 6a fe ff ff       	call   f0102b5a <boot_map_region>
+			continue;
+f0102cf0:	83 c4 10             	add    $0x10,%esp
+f0102cf3:	eb b8                	jmp    f0102cad <mem_init_mp+0xd7>
+}
+f0102cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102cf8:	5b                   	pop    %ebx
+f0102cf9:	5e                   	pop    %esi
+f0102cfa:	5f                   	pop    %edi
+f0102cfb:	5d                   	pop    %ebp
+f0102cfc:	c3                   	ret
+
+f0102cfd <mmio_map>:
+{
+f0102cfd:	55                   	push   %ebp
+f0102cfe:	89 e5                	mov    %esp,%ebp
+f0102d00:	57                   	push   %edi
+f0102d01:	56                   	push   %esi
+f0102d02:	53                   	push   %ebx
+f0102d03:	83 ec 1c             	sub    $0x1c,%esp
+f0102d06:	e8 22 e4 ff ff       	call   f010112d <__x86.get_pc_thunk.si>
+f0102d0b:	81 c6 cd d6 01 00    	add    $0x1d6cd,%esi
+	uintptr_t va = base;
+f0102d11:	8b be 2c ff ff ff    	mov    -0xd4(%esi),%edi
+	size = ROUNDUP(size + PGOFF(pa), PGSIZE);
+f0102d17:	89 c3                	mov    %eax,%ebx
+f0102d19:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f0102d1f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0102d22:	8d 9c 13 ff 0f 00 00 	lea    0xfff(%ebx,%edx,1),%ebx
+f0102d29:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (size > MMIOLIM - base)
+f0102d2f:	ba 00 00 c0 ef       	mov    $0xefc00000,%edx
+f0102d34:	29 fa                	sub    %edi,%edx
+f0102d36:	39 da                	cmp    %ebx,%edx
+f0102d38:	72 32                	jb     f0102d6c <mmio_map+0x6f>
+	boot_map_region(kern_pgdir, va, size, ROUNDDOWN(pa, PGSIZE),
+f0102d3a:	83 ec 08             	sub    $0x8,%esp
+f0102d3d:	81 c9 02 01 00 00    	or     $0x102,%ecx
+f0102d43:	51                   	push   %ecx
+f0102d44:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0102d49:	50                   	push   %eax
+f0102d4a:	89 d9                	mov    %ebx,%ecx
+f0102d4c:	89 fa                	mov    %edi,%edx
+f0102d4e:	8b 86 ac 0a 00 00    	mov    0xaac(%esi),%eax
+f0102d54:	e8 01 fe ff ff       	call   f0102b5a <boot_map_region>
+	base += size;
+f0102d59:	01 9e 2c ff ff ff    	add    %ebx,-0xd4(%esi)
+	return (void *) (va + PGOFF(pa));
+f0102d5f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102d62:	01 f8                	add    %edi,%eax
+}
+f0102d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102d67:	5b                   	pop    %ebx
+f0102d68:	5e                   	pop    %esi
+f0102d69:	5f                   	pop    %edi
+f0102d6a:	5d                   	pop    %ebp
+f0102d6b:	c3                   	ret
+		panic("mmio_map: %u bytes overflow MMIOLIM", size);
+f0102d6c:	53                   	push   %ebx
+f0102d6d:	8d 86 40 5e fe ff    	lea    -0x1a1c0(%esi),%eax
+f0102d73:	50                   	push   %eax
+f0102d74:	68 b7 02 00 00       	push   $0x2b7
+f0102d79:	8d 86 d2 5a fe ff    	lea    -0x1a52e(%esi),%eax
+f0102d7f:	50                   	push   %eax
+f0102d80:	89 f3                	mov    %esi,%ebx
+f0102d82:	e8 2b d4 ff ff       	call   f01001b2 <_panic>
+
+f0102d87 <mmio_map_region>:
+{
+f0102d87:	55                   	push   %ebp
+f0102d88:	89 e5                	mov    %esp,%ebp
+f0102d8a:	83 ec 08             	sub    $0x8,%esp
+	return mmio_map(pa, size, PTE_PCD | PTE_PWT);
+f0102d8d:	b9 18 00 00 00       	mov    $0x18,%ecx
+f0102d92:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0102d95:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102d98:	e8 60 ff ff ff       	call   f0102cfd <mmio_map>
+}
+f0102d9d:	c9                   	leave
+f0102d9e:	c3                   	ret
+
+f0102d9f <mmio_map_region_wc>:
+{
+f0102d9f:	e8 2d 00 00 00       	call   f0102dd1 <__x86.get_pc_thunk.dx>
+f0102da4:	81 c2 34 d6 01 00    	add    $0x1d634,%edx
+		return NULL;
+f0102daa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!pat_wc)
+f0102daf:	80 ba b4 0a 00 00 00 	cmpb   $0x0,0xab4(%edx)
+f0102db6:	74 18                	je     f0102dd0 <mmio_map_region_wc+0x31>
+{
+f0102db8:	55                   	push   %ebp
+f0102db9:	89 e5                	mov    %esp,%ebp
+f0102dbb:	83 ec 08             	sub    $0x8,%esp
+	return mmio_map(pa, size, PTE_WC);
+f0102dbe:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0102dc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0102dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102dc9:	e8 2f ff ff ff       	call   f0102cfd <mmio_map>
+}
+f0102dce:	c9                   	leave
+f0102dcf:	c3                   	ret
+f0102dd0:	c3                   	ret
+
+f0102dd1 <__x86.get_pc_thunk.dx>:
+f0102dd1:	8b 14 24             	mov    (%esp),%edx
+f0102dd4:	c3                   	ret
+
+f0102dd5 <slab_unlink>:
+}
+
+static void
+slab_unlink(struct Slab **list, struct Slab *s)
+{
+	if (s->s_prev)
+f0102dd5:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0102dd8:	85 c9                	test   %ecx,%ecx
+f0102dda:	74 1e                	je     f0102dfa <slab_unlink+0x25>
+		s->s_prev->s_next = s->s_next;
+f0102ddc:	8b 02                	mov    (%edx),%eax
+f0102dde:	89 01                	mov    %eax,(%ecx)
+	else
+		*list = s->s_next;
+	if (s->s_next)
+f0102de0:	8b 02                	mov    (%edx),%eax
+f0102de2:	85 c0                	test   %eax,%eax
+f0102de4:	74 06                	je     f0102dec <slab_unlink+0x17>
+		s->s_next->s_prev = s->s_prev;
+f0102de6:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0102de9:	89 48 04             	mov    %ecx,0x4(%eax)
+	s->s_next = s->s_prev = NULL;
+f0102dec:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+f0102df3:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+}
+f0102df9:	c3                   	ret
+		*list = s->s_next;
+f0102dfa:	8b 0a                	mov    (%edx),%ecx
+f0102dfc:	89 08                	mov    %ecx,(%eax)
+f0102dfe:	eb e0                	jmp    f0102de0 <slab_unlink+0xb>
+
+f0102e00 <obj_slab>:
+}
+
+// The slab holding the object at 'p', or NULL if 'p' is not in a slab.
+static struct Slab *
+obj_slab(void *p)
+{
+f0102e00:	55                   	push   %ebp
+f0102e01:	89 e5                	mov    %esp,%ebp
+f0102e03:	53                   	push   %ebx
+f0102e04:	83 ec 04             	sub    $0x4,%esp
+f0102e07:	e8 1d e3 ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f0102e0c:	81 c1 cc d5 01 00    	add    $0x1d5cc,%ecx
+f0102e12:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102e17:	76 39                	jbe    f0102e52 <obj_slab+0x52>
+	return (physaddr_t)kva - KERNBASE;
+f0102e19:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0102e1f:	c1 ea 0c             	shr    $0xc,%edx
+f0102e22:	c7 c3 88 0e 12 f0    	mov    $0xf0120e88,%ebx
+f0102e28:	3b 13                	cmp    (%ebx),%edx
+f0102e2a:	73 41                	jae    f0102e6d <obj_slab+0x6d>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f0102e2c:	8d 1c 52             	lea    (%edx,%edx,2),%ebx
+f0102e2f:	c7 c2 80 0e 12 f0    	mov    $0xf0120e80,%edx
+f0102e35:	8b 12                	mov    (%edx),%edx
+f0102e37:	8d 14 9a             	lea    (%edx,%ebx,4),%edx
+	struct PageInfo *pp = pa2page(PADDR(p));
+
+	if (!(pp->pp_flags & PP_SLAB))
+f0102e3a:	f6 42 0b 02          	testb  $0x2,0xb(%edx)
+f0102e3e:	74 47                	je     f0102e87 <obj_slab+0x87>
+		return NULL;
+	return ROUNDDOWN(p, PGSIZE << pp->pp_order);
+f0102e40:	0f b6 4a 0a          	movzbl 0xa(%edx),%ecx
+f0102e44:	ba 00 f0 ff ff       	mov    $0xfffff000,%edx
+f0102e49:	d3 e2                	shl    %cl,%edx
+f0102e4b:	21 d0                	and    %edx,%eax
+}
+f0102e4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0102e50:	c9                   	leave
+f0102e51:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102e52:	50                   	push   %eax
+f0102e53:	8d 81 c4 53 fe ff    	lea    -0x1ac3c(%ecx),%eax
+f0102e59:	50                   	push   %eax
+f0102e5a:	68 b1 00 00 00       	push   $0xb1
+f0102e5f:	8d 81 98 5f fe ff    	lea    -0x1a068(%ecx),%eax
+f0102e65:	50                   	push   %eax
+f0102e66:	89 cb                	mov    %ecx,%ebx
+f0102e68:	e8 45 d3 ff ff       	call   f01001b2 <_panic>
+		panic("pa2page called with invalid pa");
+f0102e6d:	83 ec 04             	sub    $0x4,%esp
+f0102e70:	8d 81 64 5e fe ff    	lea    -0x1a19c(%ecx),%eax
+f0102e76:	50                   	push   %eax
+f0102e77:	6a 5b                	push   $0x5b
+f0102e79:	8d 81 de 5a fe ff    	lea    -0x1a522(%ecx),%eax
+f0102e7f:	50                   	push   %eax
+f0102e80:	89 cb                	mov    %ecx,%ebx
+f0102e82:	e8 2b d3 ff ff       	call   f01001b2 <_panic>
+		return NULL;
+f0102e87:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102e8c:	eb bf                	jmp    f0102e4d <obj_slab+0x4d>
+
+f0102e8e <kmem_cache_setup>:
+{
+f0102e8e:	55                   	push   %ebp
+f0102e8f:	89 e5                	mov    %esp,%ebp
+f0102e91:	57                   	push   %edi
+f0102e92:	56                   	push   %esi
+f0102e93:	53                   	push   %ebx
+f0102e94:	83 ec 3c             	sub    $0x3c,%esp
+f0102e97:	e8 95 e2 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f0102e9c:	81 c7 3c d5 01 00    	add    $0x1d53c,%edi
+f0102ea2:	89 7d c8             	mov    %edi,-0x38(%ebp)
+f0102ea5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0102ea8:	89 d6                	mov    %edx,%esi
+f0102eaa:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+f0102ead:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (align < sizeof(uint64_t))
+f0102eb0:	ba 08 00 00 00       	mov    $0x8,%edx
+f0102eb5:	39 d0                	cmp    %edx,%eax
+f0102eb7:	89 d7                	mov    %edx,%edi
+f0102eb9:	0f 43 f8             	cmovae %eax,%edi
+	if ((align & (align - 1)) != 0 || align > PGSIZE)
+f0102ebc:	8d 5f ff             	lea    -0x1(%edi),%ebx
+f0102ebf:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0102ec2:	85 fb                	test   %edi,%ebx
+f0102ec4:	75 6b                	jne    f0102f31 <kmem_cache_setup+0xa3>
+f0102ec6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0102ecb:	77 64                	ja     f0102f31 <kmem_cache_setup+0xa3>
+	memset(kc, 0, sizeof(*kc));
+f0102ecd:	83 ec 04             	sub    $0x4,%esp
+f0102ed0:	6a 48                	push   $0x48
+f0102ed2:	6a 00                	push   $0x0
+f0102ed4:	ff 75 d8             	push   -0x28(%ebp)
+f0102ed7:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0102eda:	e8 35 24 00 00       	call   f0105314 <memset>
+	kc->kc_name = name;
+f0102edf:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0102ee2:	89 33                	mov    %esi,(%ebx)
+	kc->kc_align = align;
+f0102ee4:	89 7b 08             	mov    %edi,0x8(%ebx)
+	kc->kc_size = ROUNDUP(size ? size : 1, align);
+f0102ee7:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0102eea:	85 d2                	test   %edx,%edx
+f0102eec:	b8 01 00 00 00       	mov    $0x1,%eax
+f0102ef1:	0f 45 c2             	cmovne %edx,%eax
+f0102ef4:	8d 4c 07 ff          	lea    -0x1(%edi,%eax,1),%ecx
+f0102ef8:	89 c8                	mov    %ecx,%eax
+f0102efa:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102eff:	f7 f7                	div    %edi
+f0102f01:	29 d1                	sub    %edx,%ecx
+f0102f03:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	kc->kc_ctor = ctor;
+f0102f06:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0102f09:	89 43 0c             	mov    %eax,0xc(%ebx)
+	__spin_initlock(&kc->kc_lock, name);
+f0102f0c:	83 c4 08             	add    $0x8,%esp
+f0102f0f:	56                   	push   %esi
+f0102f10:	8d 43 1c             	lea    0x1c(%ebx),%eax
+f0102f13:	50                   	push   %eax
+f0102f14:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0102f17:	e8 e0 18 00 00       	call   f01047fc <__spin_initlock>
+f0102f1c:	83 c4 10             	add    $0x10,%esp
+	for (order = 0; order <= KMEM_MAXORDER; order++) {
+f0102f1f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+f0102f26:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0102f29:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0102f2c:	e9 8f 00 00 00       	jmp    f0102fc0 <kmem_cache_setup+0x132>
+		panic("kmem_cache_create %s: bad alignment %u", name, align);
+f0102f31:	83 ec 0c             	sub    $0xc,%esp
+f0102f34:	57                   	push   %edi
+f0102f35:	56                   	push   %esi
+f0102f36:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0102f39:	8d 83 84 5e fe ff    	lea    -0x1a17c(%ebx),%eax
+f0102f3f:	50                   	push   %eax
+f0102f40:	6a 60                	push   $0x60
+f0102f42:	8d 83 98 5f fe ff    	lea    -0x1a068(%ebx),%eax
+f0102f48:	50                   	push   %eax
+f0102f49:	e8 64 d2 ff ff       	call   f01001b2 <_panic>
+			n--;
+f0102f4e:	83 ee 01             	sub    $0x1,%esi
+		while (n > 0 && slab_offset(n, align) + n * kc->kc_size
+f0102f51:	85 f6                	test   %esi,%esi
+f0102f53:	74 5f                	je     f0102fb4 <kmem_cache_setup+0x126>
+	return ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), align);
+f0102f55:	89 d8                	mov    %ebx,%eax
+f0102f57:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102f5c:	f7 75 e0             	divl   -0x20(%ebp)
+		while (n > 0 && slab_offset(n, align) + n * kc->kc_size
+f0102f5f:	89 c8                	mov    %ecx,%eax
+f0102f61:	29 d0                	sub    %edx,%eax
+f0102f63:	83 eb 02             	sub    $0x2,%ebx
+f0102f66:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0102f69:	01 d1                	add    %edx,%ecx
+f0102f6b:	39 c7                	cmp    %eax,%edi
+f0102f6d:	72 df                	jb     f0102f4e <kmem_cache_setup+0xc0>
+		kc->kc_order = order;
+f0102f6f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0102f72:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0102f75:	89 58 10             	mov    %ebx,0x10(%eax)
+		kc->kc_perslab = MIN(n, SLAB_END);
+f0102f78:	b9 ff ff 00 00       	mov    $0xffff,%ecx
+f0102f7d:	39 ce                	cmp    %ecx,%esi
+f0102f7f:	0f 46 ce             	cmovbe %esi,%ecx
+f0102f82:	89 c6                	mov    %eax,%esi
+f0102f84:	89 48 14             	mov    %ecx,0x14(%eax)
+	return ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), align);
+f0102f87:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102f8a:	8d 5c 48 18          	lea    0x18(%eax,%ecx,2),%ebx
+f0102f8e:	89 d8                	mov    %ebx,%eax
+f0102f90:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102f95:	f7 75 e0             	divl   -0x20(%ebp)
+f0102f98:	89 d8                	mov    %ebx,%eax
+f0102f9a:	29 d0                	sub    %edx,%eax
+f0102f9c:	89 46 18             	mov    %eax,0x18(%esi)
+		     - kc->kc_perslab * kc->kc_size) * 8 <= slabsize)
+f0102f9f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0102fa2:	0f af c1             	imul   %ecx,%eax
+f0102fa5:	89 f9                	mov    %edi,%ecx
+f0102fa7:	29 c1                	sub    %eax,%ecx
+f0102fa9:	01 d1                	add    %edx,%ecx
+f0102fab:	29 d9                	sub    %ebx,%ecx
+f0102fad:	c1 e1 03             	shl    $0x3,%ecx
+		if ((slabsize - kc->kc_offset
+f0102fb0:	39 cf                	cmp    %ecx,%edi
+f0102fb2:	73 63                	jae    f0103017 <kmem_cache_setup+0x189>
+	for (order = 0; order <= KMEM_MAXORDER; order++) {
+f0102fb4:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+f0102fb8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0102fbb:	83 f8 04             	cmp    $0x4,%eax
+f0102fbe:	74 4b                	je     f010300b <kmem_cache_setup+0x17d>
+		slabsize = PGSIZE << order;
+f0102fc0:	bf 00 10 00 00       	mov    $0x1000,%edi
+f0102fc5:	0f b6 4d dc          	movzbl -0x24(%ebp),%ecx
+f0102fc9:	d3 e7                	shl    %cl,%edi
+			/ (kc->kc_size + sizeof(uint16_t));
+f0102fcb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0102fce:	8b 48 04             	mov    0x4(%eax),%ecx
+f0102fd1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+		n = (slabsize - sizeof(struct Slab))
+f0102fd4:	8d 47 e8             	lea    -0x18(%edi),%eax
+			/ (kc->kc_size + sizeof(uint16_t));
+f0102fd7:	8d 59 02             	lea    0x2(%ecx),%ebx
+		n = (slabsize - sizeof(struct Slab))
+f0102fda:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102fdf:	f7 f3                	div    %ebx
+f0102fe1:	89 c6                	mov    %eax,%esi
+f0102fe3:	8d 54 00 18          	lea    0x18(%eax,%eax,1),%edx
+f0102fe7:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0102fea:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f0102fed:	01 d3                	add    %edx,%ebx
+f0102fef:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f0102ff4:	29 ca                	sub    %ecx,%edx
+f0102ff6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0102ff9:	0f af c1             	imul   %ecx,%eax
+f0102ffc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0102fff:	01 c1                	add    %eax,%ecx
+f0103001:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103004:	01 c1                	add    %eax,%ecx
+		while (n > 0 && slab_offset(n, align) + n * kc->kc_size
+f0103006:	e9 46 ff ff ff       	jmp    f0102f51 <kmem_cache_setup+0xc3>
+	if (kc->kc_perslab == 0)
+f010300b:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f010300e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0103011:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+f0103015:	74 38                	je     f010304f <kmem_cache_setup+0x1c1>
+	spin_lock(&kmem_caches_lock);
+f0103017:	83 ec 0c             	sub    $0xc,%esp
+f010301a:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f010301d:	8d b7 a8 0b 00 00    	lea    0xba8(%edi),%esi
+f0103023:	56                   	push   %esi
+f0103024:	89 fb                	mov    %edi,%ebx
+f0103026:	e8 f3 17 00 00       	call   f010481e <spin_lock>
+	kc->kc_next = kmem_caches;
+f010302b:	8b 87 b8 0b 00 00    	mov    0xbb8(%edi),%eax
+f0103031:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0103034:	89 43 44             	mov    %eax,0x44(%ebx)
+	kmem_caches = kc;
+f0103037:	89 9f b8 0b 00 00    	mov    %ebx,0xbb8(%edi)
+	spin_unlock(&kmem_caches_lock);
+f010303d:	89 34 24             	mov    %esi,(%esp)
+f0103040:	89 fb                	mov    %edi,%ebx
+f0103042:	e8 47 18 00 00       	call   f010488e <spin_unlock>
+}
+f0103047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010304a:	5b                   	pop    %ebx
+f010304b:	5e                   	pop    %esi
+f010304c:	5f                   	pop    %edi
+f010304d:	5d                   	pop    %ebp
+f010304e:	c3                   	ret
+		panic("kmem_cache_create %s: %u-byte objects are too big",
+f010304f:	83 ec 0c             	sub    $0xc,%esp
+f0103052:	ff 75 c4             	push   -0x3c(%ebp)
+f0103055:	56                   	push   %esi
+f0103056:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0103059:	8d 83 ac 5e fe ff    	lea    -0x1a154(%ebx),%eax
+f010305f:	50                   	push   %eax
+f0103060:	6a 7a                	push   $0x7a
+f0103062:	8d 83 98 5f fe ff    	lea    -0x1a068(%ebx),%eax
+f0103068:	50                   	push   %eax
+f0103069:	e8 44 d1 ff ff       	call   f01001b2 <_panic>
+
+f010306e <kmem_cache_alloc>:
+//
+// Allocate an object from 'kc'.  Returns NULL if out of memory.
+//
+void *
+kmem_cache_alloc(struct Kmem_cache *kc)
+{
+f010306e:	55                   	push   %ebp
+f010306f:	89 e5                	mov    %esp,%ebp
+f0103071:	57                   	push   %edi
+f0103072:	56                   	push   %esi
+f0103073:	53                   	push   %ebx
+f0103074:	83 ec 28             	sub    $0x28,%esp
+f0103077:	e8 5d d3 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010307c:	81 c3 5c d3 01 00    	add    $0x1d35c,%ebx
+f0103082:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct Slab *s;
+	uint16_t i;
+
+	spin_lock(&kc->kc_lock);
+f0103085:	8d 47 1c             	lea    0x1c(%edi),%eax
+f0103088:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010308b:	50                   	push   %eax
+f010308c:	e8 8d 17 00 00       	call   f010481e <spin_lock>
+	if (!(s = kc->kc_partial)) {
+f0103091:	8b 77 2c             	mov    0x2c(%edi),%esi
+f0103094:	83 c4 10             	add    $0x10,%esp
+f0103097:	85 f6                	test   %esi,%esi
+f0103099:	74 53                	je     f01030ee <kmem_cache_alloc+0x80>
+			return NULL;
+		}
+		slab_push(&kc->kc_partial, s);
+	}
+
+	i = s->s_free;
+f010309b:	0f b7 46 14          	movzwl 0x14(%esi),%eax
+f010309f:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+	s->s_free = s->s_link[i];
+f01030a3:	0f b7 c0             	movzwl %ax,%eax
+f01030a6:	0f b7 44 46 16       	movzwl 0x16(%esi,%eax,2),%eax
+f01030ab:	66 89 46 14          	mov    %ax,0x14(%esi)
+	s->s_inuse++;
+f01030af:	83 46 10 01          	addl   $0x1,0x10(%esi)
+	if (s->s_free == SLAB_END) {
+f01030b3:	66 83 f8 ff          	cmp    $0xffff,%ax
+f01030b7:	0f 84 6b 01 00 00    	je     f0103228 <kmem_cache_alloc+0x1ba>
+		slab_unlink(&kc->kc_partial, s);
+		slab_push(&kc->kc_full, s);
+	}
+	kc->kc_inuse++;
+f01030bd:	83 47 3c 01          	addl   $0x1,0x3c(%edi)
+	kc->kc_nalloc++;
+f01030c1:	83 47 40 01          	addl   $0x1,0x40(%edi)
+	spin_unlock(&kc->kc_lock);
+f01030c5:	83 ec 0c             	sub    $0xc,%esp
+f01030c8:	ff 75 e0             	push   -0x20(%ebp)
+f01030cb:	e8 be 17 00 00       	call   f010488e <spin_unlock>
+	return s->s_mem + i * kc->kc_size;
+f01030d0:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+f01030d4:	0f af 47 04          	imul   0x4(%edi),%eax
+f01030d8:	89 c7                	mov    %eax,%edi
+f01030da:	03 7e 0c             	add    0xc(%esi),%edi
+f01030dd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f01030e0:	83 c4 10             	add    $0x10,%esp
+}
+f01030e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01030e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01030e9:	5b                   	pop    %ebx
+f01030ea:	5e                   	pop    %esi
+f01030eb:	5f                   	pop    %edi
+f01030ec:	5d                   	pop    %ebp
+f01030ed:	c3                   	ret
+		if ((s = kc->kc_empty))
+f01030ee:	8b 77 34             	mov    0x34(%edi),%esi
+f01030f1:	85 f6                	test   %esi,%esi
+f01030f3:	74 1f                	je     f0103114 <kmem_cache_alloc+0xa6>
+			kc->kc_empty = NULL;
+f01030f5:	c7 47 34 00 00 00 00 	movl   $0x0,0x34(%edi)
+	s->s_prev = NULL;
+f01030fc:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->s_next = *list;
+f0103103:	8b 47 2c             	mov    0x2c(%edi),%eax
+f0103106:	89 06                	mov    %eax,(%esi)
+	if (s->s_next)
+f0103108:	85 c0                	test   %eax,%eax
+f010310a:	74 03                	je     f010310f <kmem_cache_alloc+0xa1>
+		s->s_next->s_prev = s;
+f010310c:	89 70 04             	mov    %esi,0x4(%eax)
+	*list = s;
+f010310f:	89 77 2c             	mov    %esi,0x2c(%edi)
+}
+f0103112:	eb 87                	jmp    f010309b <kmem_cache_alloc+0x2d>
+	if (!(pp = page_alloc_order(kc->kc_order, 0)))
+f0103114:	83 ec 08             	sub    $0x8,%esp
+f0103117:	6a 00                	push   $0x0
+f0103119:	ff 77 10             	push   0x10(%edi)
+f010311c:	e8 b3 f0 ff ff       	call   f01021d4 <page_alloc_order>
+f0103121:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0103124:	83 c4 10             	add    $0x10,%esp
+f0103127:	85 c0                	test   %eax,%eax
+f0103129:	0f 84 1e 01 00 00    	je     f010324d <kmem_cache_alloc+0x1df>
+f010312f:	83 c0 0b             	add    $0xb,%eax
+	for (i = 0; i < (1 << kc->kc_order); i++) {
+f0103132:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103137:	be 01 00 00 00       	mov    $0x1,%esi
+f010313c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f010313f:	eb 10                	jmp    f0103151 <kmem_cache_alloc+0xe3>
+		pp[i].pp_flags |= PP_SLAB;
+f0103141:	80 08 02             	orb    $0x2,(%eax)
+		pp[i].pp_order = kc->kc_order;
+f0103144:	8b 4f 10             	mov    0x10(%edi),%ecx
+f0103147:	88 48 ff             	mov    %cl,-0x1(%eax)
+	for (i = 0; i < (1 << kc->kc_order); i++) {
+f010314a:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+f010314e:	83 c0 0c             	add    $0xc,%eax
+f0103151:	8b 4f 10             	mov    0x10(%edi),%ecx
+f0103154:	89 f2                	mov    %esi,%edx
+f0103156:	d3 e2                	shl    %cl,%edx
+f0103158:	39 55 dc             	cmp    %edx,-0x24(%ebp)
+f010315b:	72 e4                	jb     f0103141 <kmem_cache_alloc+0xd3>
+	return (pp - pages) << PGSHIFT;
+f010315d:	c7 c0 80 0e 12 f0    	mov    $0xf0120e80,%eax
+f0103163:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0103166:	2b 08                	sub    (%eax),%ecx
+f0103168:	89 c8                	mov    %ecx,%eax
+f010316a:	c1 f8 02             	sar    $0x2,%eax
+f010316d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103173:	89 c2                	mov    %eax,%edx
+f0103175:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103178:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010317d:	c7 c1 88 0e 12 f0    	mov    $0xf0120e88,%ecx
+f0103183:	3b 01                	cmp    (%ecx),%eax
+f0103185:	73 48                	jae    f01031cf <kmem_cache_alloc+0x161>
+	return (void *)(pa + KERNBASE);
+f0103187:	8d b2 00 00 00 f0    	lea    -0x10000000(%edx),%esi
+	s->s_next = s->s_prev = NULL;
+f010318d:	c7 82 04 00 00 f0 00 	movl   $0x0,-0xffffffc(%edx)
+f0103194:	00 00 00 
+f0103197:	c7 82 00 00 00 f0 00 	movl   $0x0,-0x10000000(%edx)
+f010319e:	00 00 00 
+	s->s_cache = kc;
+f01031a1:	89 ba 08 00 00 f0    	mov    %edi,-0xffffff8(%edx)
+	s->s_mem = (char *) s + kc->kc_offset;
+f01031a7:	89 f0                	mov    %esi,%eax
+f01031a9:	03 47 18             	add    0x18(%edi),%eax
+f01031ac:	89 82 0c 00 00 f0    	mov    %eax,-0xffffff4(%edx)
+	s->s_inuse = 0;
+f01031b2:	c7 82 10 00 00 f0 00 	movl   $0x0,-0xffffff0(%edx)
+f01031b9:	00 00 00 
+	s->s_free = 0;
+f01031bc:	66 c7 82 14 00 00 f0 	movw   $0x0,-0xfffffec(%edx)
+f01031c3:	00 00 
+	for (i = 0; i < kc->kc_perslab; i++) {
+f01031c5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01031ca:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f01031cd:	eb 18                	jmp    f01031e7 <kmem_cache_alloc+0x179>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01031cf:	52                   	push   %edx
+f01031d0:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01031d6:	50                   	push   %eax
+f01031d7:	6a 62                	push   $0x62
+f01031d9:	8d 83 de 5a fe ff    	lea    -0x1a522(%ebx),%eax
+f01031df:	50                   	push   %eax
+f01031e0:	e8 cd cf ff ff       	call   f01001b2 <_panic>
+f01031e5:	89 f0                	mov    %esi,%eax
+f01031e7:	8b 57 14             	mov    0x14(%edi),%edx
+f01031ea:	39 d0                	cmp    %edx,%eax
+f01031ec:	73 2e                	jae    f010321c <kmem_cache_alloc+0x1ae>
+		s->s_link[i] = i + 1 < kc->kc_perslab ? i + 1 : SLAB_END;
+f01031ee:	8d 70 01             	lea    0x1(%eax),%esi
+f01031f1:	39 d6                	cmp    %edx,%esi
+f01031f3:	ba ff ff 00 00       	mov    $0xffff,%edx
+f01031f8:	0f 42 d6             	cmovb  %esi,%edx
+f01031fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01031fe:	66 89 54 71 14       	mov    %dx,0x14(%ecx,%esi,2)
+		if (kc->kc_ctor)
+f0103203:	8b 57 0c             	mov    0xc(%edi),%edx
+f0103206:	85 d2                	test   %edx,%edx
+f0103208:	74 db                	je     f01031e5 <kmem_cache_alloc+0x177>
+			kc->kc_ctor(s->s_mem + i * kc->kc_size);
+f010320a:	83 ec 0c             	sub    $0xc,%esp
+f010320d:	0f af 47 04          	imul   0x4(%edi),%eax
+f0103211:	03 41 0c             	add    0xc(%ecx),%eax
+f0103214:	50                   	push   %eax
+f0103215:	ff d2                	call   *%edx
+f0103217:	83 c4 10             	add    $0x10,%esp
+f010321a:	eb c9                	jmp    f01031e5 <kmem_cache_alloc+0x177>
+	kc->kc_nslabs++;
+f010321c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f010321f:	83 47 38 01          	addl   $0x1,0x38(%edi)
+f0103223:	e9 d4 fe ff ff       	jmp    f01030fc <kmem_cache_alloc+0x8e>
+		slab_unlink(&kc->kc_partial, s);
+f0103228:	8d 47 2c             	lea    0x2c(%edi),%eax
+f010322b:	89 f2                	mov    %esi,%edx
+f010322d:	e8 a3 fb ff ff       	call   f0102dd5 <slab_unlink>
+	s->s_prev = NULL;
+f0103232:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->s_next = *list;
+f0103239:	8b 47 30             	mov    0x30(%edi),%eax
+f010323c:	89 06                	mov    %eax,(%esi)
+	if (s->s_next)
+f010323e:	85 c0                	test   %eax,%eax
+f0103240:	74 03                	je     f0103245 <kmem_cache_alloc+0x1d7>
+		s->s_next->s_prev = s;
+f0103242:	89 70 04             	mov    %esi,0x4(%eax)
+	*list = s;
+f0103245:	89 77 30             	mov    %esi,0x30(%edi)
+}
+f0103248:	e9 70 fe ff ff       	jmp    f01030bd <kmem_cache_alloc+0x4f>
+			spin_unlock(&kc->kc_lock);
+f010324d:	83 ec 0c             	sub    $0xc,%esp
+f0103250:	ff 75 e0             	push   -0x20(%ebp)
+f0103253:	e8 36 16 00 00       	call   f010488e <spin_unlock>
+			return NULL;
+f0103258:	83 c4 10             	add    $0x10,%esp
+f010325b:	e9 83 fe ff ff       	jmp    f01030e3 <kmem_cache_alloc+0x75>
+
+f0103260 <kmem_cache_create>:
+{
+f0103260:	55                   	push   %ebp
+f0103261:	89 e5                	mov    %esp,%ebp
+f0103263:	53                   	push   %ebx
+f0103264:	83 ec 10             	sub    $0x10,%esp
+f0103267:	e8 b9 de ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f010326c:	05 6c d1 01 00       	add    $0x1d16c,%eax
+	if (!(kc = kmem_cache_alloc(&kmem_cache_cache)))
+f0103271:	8d 80 e8 0b 00 00    	lea    0xbe8(%eax),%eax
+f0103277:	50                   	push   %eax
+f0103278:	e8 f1 fd ff ff       	call   f010306e <kmem_cache_alloc>
+f010327d:	89 c3                	mov    %eax,%ebx
+f010327f:	83 c4 10             	add    $0x10,%esp
+f0103282:	85 c0                	test   %eax,%eax
+f0103284:	74 17                	je     f010329d <kmem_cache_create+0x3d>
+	kmem_cache_setup(kc, name, size, align, ctor);
+f0103286:	83 ec 08             	sub    $0x8,%esp
+f0103289:	ff 75 14             	push   0x14(%ebp)
+f010328c:	ff 75 10             	push   0x10(%ebp)
+f010328f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0103292:	8b 55 08             	mov    0x8(%ebp),%edx
+f0103295:	e8 f4 fb ff ff       	call   f0102e8e <kmem_cache_setup>
+	return kc;
+f010329a:	83 c4 10             	add    $0x10,%esp
+}
+f010329d:	89 d8                	mov    %ebx,%eax
+f010329f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01032a2:	c9                   	leave
+f01032a3:	c3                   	ret
+
+f01032a4 <kmem_init>:
+{
+f01032a4:	55                   	push   %ebp
+f01032a5:	89 e5                	mov    %esp,%ebp
+f01032a7:	57                   	push   %edi
+f01032a8:	56                   	push   %esi
+f01032a9:	53                   	push   %ebx
+f01032aa:	83 ec 14             	sub    $0x14,%esp
+f01032ad:	e8 7f de ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f01032b2:	81 c7 26 d1 01 00    	add    $0x1d126,%edi
+	__spin_initlock(&kmem_caches_lock, "kmem_caches");
+f01032b8:	8d 87 a4 5f fe ff    	lea    -0x1a05c(%edi),%eax
+f01032be:	50                   	push   %eax
+f01032bf:	8d 87 a8 0b 00 00    	lea    0xba8(%edi),%eax
+f01032c5:	50                   	push   %eax
+f01032c6:	89 fb                	mov    %edi,%ebx
+f01032c8:	e8 2f 15 00 00       	call   f01047fc <__spin_initlock>
+	kmem_cache_setup(&kmem_cache_cache, "kmem_cache",
+f01032cd:	83 c4 08             	add    $0x8,%esp
+f01032d0:	6a 00                	push   $0x0
+f01032d2:	6a 00                	push   $0x0
+f01032d4:	b9 48 00 00 00       	mov    $0x48,%ecx
+f01032d9:	8d 97 b0 5f fe ff    	lea    -0x1a050(%edi),%edx
+f01032df:	8d 87 e8 0b 00 00    	lea    0xbe8(%edi),%eax
+f01032e5:	e8 a4 fb ff ff       	call   f0102e8e <kmem_cache_setup>
+f01032ea:	83 c4 10             	add    $0x10,%esp
+f01032ed:	bb 05 00 00 00       	mov    $0x5,%ebx
+			MIN(1 << (KMALLOC_MINSHIFT + i), KMEM_CACHELINE), NULL);
+f01032f2:	ba 01 00 00 00       	mov    $0x1,%edx
+f01032f7:	89 d9                	mov    %ebx,%ecx
+f01032f9:	d3 e2                	shl    %cl,%edx
+		kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i],
+f01032fb:	6a 00                	push   $0x0
+			MIN(1 << (KMALLOC_MINSHIFT + i), KMEM_CACHELINE), NULL);
+f01032fd:	b8 40 00 00 00       	mov    $0x40,%eax
+f0103302:	39 c2                	cmp    %eax,%edx
+f0103304:	0f 4e c2             	cmovle %edx,%eax
+		kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i],
+f0103307:	50                   	push   %eax
+f0103308:	52                   	push   %edx
+f0103309:	8d 34 9d 00 00 00 00 	lea    0x0(,%ebx,4),%esi
+f0103310:	ff b4 3e 08 01 00 00 	push   0x108(%esi,%edi,1)
+f0103317:	e8 44 ff ff ff       	call   f0103260 <kmem_cache_create>
+f010331c:	89 84 3e a8 0b 00 00 	mov    %eax,0xba8(%esi,%edi,1)
+		if (!kmalloc_caches[i])
+f0103323:	83 c3 01             	add    $0x1,%ebx
+f0103326:	83 c4 10             	add    $0x10,%esp
+f0103329:	85 c0                	test   %eax,%eax
+f010332b:	74 0d                	je     f010333a <kmem_init+0x96>
+	for (i = 0; i < KMALLOC_NCLASS; i++) {
+f010332d:	83 fb 0c             	cmp    $0xc,%ebx
+f0103330:	75 c0                	jne    f01032f2 <kmem_init+0x4e>
+}
+f0103332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103335:	5b                   	pop    %ebx
+f0103336:	5e                   	pop    %esi
+f0103337:	5f                   	pop    %edi
+f0103338:	5d                   	pop    %ebp
+f0103339:	c3                   	ret
+			panic("kmem_init: out of memory");
+f010333a:	83 ec 04             	sub    $0x4,%esp
+f010333d:	8d 87 bb 5f fe ff    	lea    -0x1a045(%edi),%eax
+f0103343:	50                   	push   %eax
+f0103344:	68 c8 00 00 00       	push   $0xc8
+f0103349:	8d 87 98 5f fe ff    	lea    -0x1a068(%edi),%eax
+f010334f:	50                   	push   %eax
+f0103350:	89 fb                	mov    %edi,%ebx
+f0103352:	e8 5b ce ff ff       	call   f01001b2 <_panic>
+
+f0103357 <kmem_cache_free>:
+// slab for the next allocation unless the cache already has one spare,
+// in which case give it back to the page allocator.
+//
+void
+kmem_cache_free(struct Kmem_cache *kc, void *obj)
+{
+f0103357:	55                   	push   %ebp
+f0103358:	89 e5                	mov    %esp,%ebp
+f010335a:	57                   	push   %edi
+f010335b:	56                   	push   %esi
+f010335c:	53                   	push   %ebx
+f010335d:	83 ec 1c             	sub    $0x1c,%esp
+f0103360:	e8 c0 dd ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0103365:	05 73 d0 01 00       	add    $0x1d073,%eax
+f010336a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010336d:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0103370:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Slab *s = obj_slab(obj);
+f0103373:	89 d8                	mov    %ebx,%eax
+f0103375:	e8 86 fa ff ff       	call   f0102e00 <obj_slab>
+	uint32_t off;
+
+	if (!s || s->s_cache != kc)
+f010337a:	85 c0                	test   %eax,%eax
+f010337c:	0f 84 a7 00 00 00    	je     f0103429 <kmem_cache_free+0xd2>
+f0103382:	89 c6                	mov    %eax,%esi
+f0103384:	39 78 08             	cmp    %edi,0x8(%eax)
+f0103387:	0f 85 9c 00 00 00    	jne    f0103429 <kmem_cache_free+0xd2>
+		panic("kmem_cache_free %s: %08x is not from this cache",
+		      kc->kc_name, obj);
+	off = (char *) obj - s->s_mem;
+f010338d:	89 d8                	mov    %ebx,%eax
+f010338f:	2b 46 0c             	sub    0xc(%esi),%eax
+	if (off % kc->kc_size != 0 || off / kc->kc_size >= kc->kc_perslab)
+f0103392:	8b 4f 04             	mov    0x4(%edi),%ecx
+f0103395:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0103398:	ba 00 00 00 00       	mov    $0x0,%edx
+f010339d:	f7 f1                	div    %ecx
+f010339f:	85 d2                	test   %edx,%edx
+f01033a1:	0f 85 a3 00 00 00    	jne    f010344a <kmem_cache_free+0xf3>
+f01033a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01033aa:	ba 00 00 00 00       	mov    $0x0,%edx
+f01033af:	f7 f1                	div    %ecx
+f01033b1:	3b 47 14             	cmp    0x14(%edi),%eax
+f01033b4:	0f 83 90 00 00 00    	jae    f010344a <kmem_cache_free+0xf3>
+		panic("kmem_cache_free %s: bad object %08x", kc->kc_name, obj);
+
+	spin_lock(&kc->kc_lock);
+f01033ba:	8d 47 1c             	lea    0x1c(%edi),%eax
+f01033bd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01033c0:	83 ec 0c             	sub    $0xc,%esp
+f01033c3:	50                   	push   %eax
+f01033c4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01033c7:	e8 52 14 00 00       	call   f010481e <spin_lock>
+	if (s->s_free == SLAB_END) {
+f01033cc:	83 c4 10             	add    $0x10,%esp
+f01033cf:	66 83 7e 14 ff       	cmpw   $0xffff,0x14(%esi)
+f01033d4:	0f 84 91 00 00 00    	je     f010346b <kmem_cache_free+0x114>
+		slab_unlink(&kc->kc_full, s);
+		slab_push(&kc->kc_partial, s);
+	}
+	s->s_link[off / kc->kc_size] = s->s_free;
+f01033da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01033dd:	ba 00 00 00 00       	mov    $0x0,%edx
+f01033e2:	f7 77 04             	divl   0x4(%edi)
+f01033e5:	0f b7 56 14          	movzwl 0x14(%esi),%edx
+f01033e9:	66 89 54 46 16       	mov    %dx,0x16(%esi,%eax,2)
+	s->s_free = off / kc->kc_size;
+f01033ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01033f1:	ba 00 00 00 00       	mov    $0x0,%edx
+f01033f6:	f7 77 04             	divl   0x4(%edi)
+f01033f9:	66 89 46 14          	mov    %ax,0x14(%esi)
+	s->s_inuse--;
+f01033fd:	83 6e 10 01          	subl   $0x1,0x10(%esi)
+	kc->kc_inuse--;
+f0103401:	83 6f 3c 01          	subl   $0x1,0x3c(%edi)
+
+	if (s->s_inuse == 0) {
+f0103405:	8b 5e 10             	mov    0x10(%esi),%ebx
+f0103408:	85 db                	test   %ebx,%ebx
+f010340a:	0f 84 80 00 00 00    	je     f0103490 <kmem_cache_free+0x139>
+		if (!kc->kc_empty)
+			kc->kc_empty = s;
+		else
+			slab_destroy(kc, s);
+	}
+	spin_unlock(&kc->kc_lock);
+f0103410:	83 ec 0c             	sub    $0xc,%esp
+f0103413:	ff 75 dc             	push   -0x24(%ebp)
+f0103416:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103419:	e8 70 14 00 00       	call   f010488e <spin_unlock>
+}
+f010341e:	83 c4 10             	add    $0x10,%esp
+f0103421:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103424:	5b                   	pop    %ebx
+f0103425:	5e                   	pop    %esi
+f0103426:	5f                   	pop    %edi
+f0103427:	5d                   	pop    %ebp
+f0103428:	c3                   	ret
+		panic("kmem_cache_free %s: %08x is not from this cache",
+f0103429:	83 ec 0c             	sub    $0xc,%esp
+f010342c:	53                   	push   %ebx
+f010342d:	ff 37                	push   (%edi)
+f010342f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103432:	8d 83 e0 5e fe ff    	lea    -0x1a120(%ebx),%eax
+f0103438:	50                   	push   %eax
+f0103439:	68 0b 01 00 00       	push   $0x10b
+f010343e:	8d 83 98 5f fe ff    	lea    -0x1a068(%ebx),%eax
+f0103444:	50                   	push   %eax
+f0103445:	e8 68 cd ff ff       	call   f01001b2 <_panic>
+		panic("kmem_cache_free %s: bad object %08x", kc->kc_name, obj);
+f010344a:	83 ec 0c             	sub    $0xc,%esp
+f010344d:	53                   	push   %ebx
+f010344e:	ff 37                	push   (%edi)
+f0103450:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103453:	8d 83 10 5f fe ff    	lea    -0x1a0f0(%ebx),%eax
+f0103459:	50                   	push   %eax
+f010345a:	68 0f 01 00 00       	push   $0x10f
+f010345f:	8d 83 98 5f fe ff    	lea    -0x1a068(%ebx),%eax
+f0103465:	50                   	push   %eax
+f0103466:	e8 47 cd ff ff       	call   f01001b2 <_panic>
+		slab_unlink(&kc->kc_full, s);
+f010346b:	8d 47 30             	lea    0x30(%edi),%eax
+f010346e:	89 f2                	mov    %esi,%edx
+f0103470:	e8 60 f9 ff ff       	call   f0102dd5 <slab_unlink>
+	s->s_prev = NULL;
+f0103475:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->s_next = *list;
+f010347c:	8b 47 2c             	mov    0x2c(%edi),%eax
+f010347f:	89 06                	mov    %eax,(%esi)
+	if (s->s_next)
+f0103481:	85 c0                	test   %eax,%eax
+f0103483:	74 03                	je     f0103488 <kmem_cache_free+0x131>
+		s->s_next->s_prev = s;
+f0103485:	89 70 04             	mov    %esi,0x4(%eax)
+	*list = s;
+f0103488:	89 77 2c             	mov    %esi,0x2c(%edi)
+}
+f010348b:	e9 4a ff ff ff       	jmp    f01033da <kmem_cache_free+0x83>
+		slab_unlink(&kc->kc_partial, s);
+f0103490:	8d 47 2c             	lea    0x2c(%edi),%eax
+f0103493:	89 f2                	mov    %esi,%edx
+f0103495:	e8 3b f9 ff ff       	call   f0102dd5 <slab_unlink>
+		if (!kc->kc_empty)
+f010349a:	83 7f 34 00          	cmpl   $0x0,0x34(%edi)
+f010349e:	74 3c                	je     f01034dc <kmem_cache_free+0x185>
+	if ((uint32_t)kva < KERNBASE)
+f01034a0:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f01034a6:	76 3c                	jbe    f01034e4 <kmem_cache_free+0x18d>
+	return (physaddr_t)kva - KERNBASE;
+f01034a8:	81 c6 00 00 00 10    	add    $0x10000000,%esi
+	if (PGNUM(pa) >= npages)
+f01034ae:	c1 ee 0c             	shr    $0xc,%esi
+f01034b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01034b4:	c7 c0 88 0e 12 f0    	mov    $0xf0120e88,%eax
+f01034ba:	3b 30                	cmp    (%eax),%esi
+f01034bc:	73 42                	jae    f0103500 <kmem_cache_free+0x1a9>
+	return &pages[PGNUM(pa)];
+f01034be:	8d 14 76             	lea    (%esi,%esi,2),%edx
+f01034c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01034c4:	c7 c0 80 0e 12 f0    	mov    $0xf0120e80,%eax
+f01034ca:	8b 00                	mov    (%eax),%eax
+f01034cc:	8d 14 90             	lea    (%eax,%edx,4),%edx
+f01034cf:	8d 42 0b             	lea    0xb(%edx),%eax
+	for (i = 0; i < (1 << kc->kc_order); i++)
+f01034d2:	be 01 00 00 00       	mov    $0x1,%esi
+f01034d7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f01034da:	eb 48                	jmp    f0103524 <kmem_cache_free+0x1cd>
+			kc->kc_empty = s;
+f01034dc:	89 77 34             	mov    %esi,0x34(%edi)
+f01034df:	e9 2c ff ff ff       	jmp    f0103410 <kmem_cache_free+0xb9>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01034e4:	56                   	push   %esi
+f01034e5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01034e8:	8d 83 c4 53 fe ff    	lea    -0x1ac3c(%ebx),%eax
+f01034ee:	50                   	push   %eax
+f01034ef:	68 a3 00 00 00       	push   $0xa3
+f01034f4:	8d 83 98 5f fe ff    	lea    -0x1a068(%ebx),%eax
+f01034fa:	50                   	push   %eax
+f01034fb:	e8 b2 cc ff ff       	call   f01001b2 <_panic>
+		panic("pa2page called with invalid pa");
+f0103500:	83 ec 04             	sub    $0x4,%esp
+f0103503:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103506:	8d 83 64 5e fe ff    	lea    -0x1a19c(%ebx),%eax
+f010350c:	50                   	push   %eax
+f010350d:	6a 5b                	push   $0x5b
+f010350f:	8d 83 de 5a fe ff    	lea    -0x1a522(%ebx),%eax
+f0103515:	50                   	push   %eax
+f0103516:	e8 97 cc ff ff       	call   f01001b2 <_panic>
+		pp[i].pp_flags &= ~PP_SLAB;
+f010351b:	80 20 fd             	andb   $0xfd,(%eax)
+	for (i = 0; i < (1 << kc->kc_order); i++)
+f010351e:	83 c3 01             	add    $0x1,%ebx
+f0103521:	83 c0 0c             	add    $0xc,%eax
+f0103524:	8b 4f 10             	mov    0x10(%edi),%ecx
+f0103527:	89 f2                	mov    %esi,%edx
+f0103529:	d3 e2                	shl    %cl,%edx
+f010352b:	39 d3                	cmp    %edx,%ebx
+f010352d:	72 ec                	jb     f010351b <kmem_cache_free+0x1c4>
+	pp->pp_order = kc->kc_order;
+f010352f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0103532:	88 4a 0a             	mov    %cl,0xa(%edx)
+	page_free_order(pp, kc->kc_order);
+f0103535:	83 ec 08             	sub    $0x8,%esp
+f0103538:	ff 77 10             	push   0x10(%edi)
+f010353b:	52                   	push   %edx
+f010353c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f010353f:	e8 74 ed ff ff       	call   f01022b8 <page_free_order>
+	kc->kc_nslabs--;
+f0103544:	83 6f 38 01          	subl   $0x1,0x38(%edi)
+}
+f0103548:	83 c4 10             	add    $0x10,%esp
+f010354b:	e9 c0 fe ff ff       	jmp    f0103410 <kmem_cache_free+0xb9>
+
+f0103550 <kmalloc>:
+// up are cache-line aligned.  Larger requests get a whole block of
+// pages.  Returns NULL if out of memory or if n is 0.
+//
+void *
+kmalloc(size_t n)
+{
+f0103550:	55                   	push   %ebp
+f0103551:	89 e5                	mov    %esp,%ebp
+f0103553:	57                   	push   %edi
+f0103554:	56                   	push   %esi
+f0103555:	53                   	push   %ebx
+f0103556:	83 ec 0c             	sub    $0xc,%esp
+f0103559:	e8 7b ce ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010355e:	81 c3 7a ce 01 00    	add    $0x1ce7a,%ebx
+f0103564:	8b 55 08             	mov    0x8(%ebp),%edx
+	struct PageInfo *pp;
+	int i;
+
+	if (n == 0)
+f0103567:	85 d2                	test   %edx,%edx
+f0103569:	0f 84 b9 00 00 00    	je     f0103628 <kmalloc+0xd8>
+		return NULL;
+	for (i = 0; i < KMALLOC_NCLASS; i++)
+f010356f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (n <= (1 << (KMALLOC_MINSHIFT + i)))
+f0103574:	be 01 00 00 00       	mov    $0x1,%esi
+f0103579:	8d 48 05             	lea    0x5(%eax),%ecx
+f010357c:	89 f7                	mov    %esi,%edi
+f010357e:	d3 e7                	shl    %cl,%edi
+f0103580:	39 d7                	cmp    %edx,%edi
+f0103582:	73 31                	jae    f01035b5 <kmalloc+0x65>
+	for (i = 0; i < KMALLOC_NCLASS; i++)
+f0103584:	83 c0 01             	add    $0x1,%eax
+f0103587:	83 f8 07             	cmp    $0x7,%eax
+f010358a:	75 ed                	jne    f0103579 <kmalloc+0x29>
+			return kmem_cache_alloc(kmalloc_caches[i]);
+
+	for (i = 0; i <= MAXORDER; i++)
+f010358c:	be 00 00 00 00       	mov    $0x0,%esi
+		if (n <= (PGSIZE << i))
+f0103591:	bf 00 10 00 00       	mov    $0x1000,%edi
+f0103596:	89 f8                	mov    %edi,%eax
+f0103598:	89 f1                	mov    %esi,%ecx
+f010359a:	d3 e0                	shl    %cl,%eax
+f010359c:	39 d0                	cmp    %edx,%eax
+f010359e:	73 29                	jae    f01035c9 <kmalloc+0x79>
+	for (i = 0; i <= MAXORDER; i++)
+f01035a0:	83 c6 01             	add    $0x1,%esi
+f01035a3:	83 fe 0b             	cmp    $0xb,%esi
+f01035a6:	75 ee                	jne    f0103596 <kmalloc+0x46>
+			break;
+	if (i > MAXORDER || !(pp = page_alloc_order(i, 0)))
+		return NULL;
+f01035a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	pp->pp_order = i;
+	return page2kva(pp);
+}
+f01035ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01035b0:	5b                   	pop    %ebx
+f01035b1:	5e                   	pop    %esi
+f01035b2:	5f                   	pop    %edi
+f01035b3:	5d                   	pop    %ebp
+f01035b4:	c3                   	ret
+			return kmem_cache_alloc(kmalloc_caches[i]);
+f01035b5:	83 ec 0c             	sub    $0xc,%esp
+f01035b8:	ff b4 83 bc 0b 00 00 	push   0xbbc(%ebx,%eax,4)
+f01035bf:	e8 aa fa ff ff       	call   f010306e <kmem_cache_alloc>
+f01035c4:	83 c4 10             	add    $0x10,%esp
+f01035c7:	eb e4                	jmp    f01035ad <kmalloc+0x5d>
+	if (i > MAXORDER || !(pp = page_alloc_order(i, 0)))
+f01035c9:	83 fe 0a             	cmp    $0xa,%esi
+f01035cc:	7f 64                	jg     f0103632 <kmalloc+0xe2>
+f01035ce:	83 ec 08             	sub    $0x8,%esp
+f01035d1:	6a 00                	push   $0x0
+f01035d3:	56                   	push   %esi
+f01035d4:	e8 fb eb ff ff       	call   f01021d4 <page_alloc_order>
+f01035d9:	83 c4 10             	add    $0x10,%esp
+f01035dc:	85 c0                	test   %eax,%eax
+f01035de:	74 cd                	je     f01035ad <kmalloc+0x5d>
+	pp->pp_order = i;
+f01035e0:	89 f2                	mov    %esi,%edx
+f01035e2:	88 50 0a             	mov    %dl,0xa(%eax)
+	return (pp - pages) << PGSHIFT;
+f01035e5:	c7 c2 80 0e 12 f0    	mov    $0xf0120e80,%edx
+f01035eb:	2b 02                	sub    (%edx),%eax
+f01035ed:	c1 f8 02             	sar    $0x2,%eax
+f01035f0:	69 d0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edx
+f01035f6:	89 d0                	mov    %edx,%eax
+f01035f8:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f01035fb:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0103601:	c7 c1 88 0e 12 f0    	mov    $0xf0120e88,%ecx
+f0103607:	3b 11                	cmp    (%ecx),%edx
+f0103609:	73 07                	jae    f0103612 <kmalloc+0xc2>
+	return (void *)(pa + KERNBASE);
+f010360b:	2d 00 00 00 10       	sub    $0x10000000,%eax
+	return page2kva(pp);
+f0103610:	eb 9b                	jmp    f01035ad <kmalloc+0x5d>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103612:	50                   	push   %eax
+f0103613:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f0103619:	50                   	push   %eax
+f010361a:	6a 62                	push   $0x62
+f010361c:	8d 83 de 5a fe ff    	lea    -0x1a522(%ebx),%eax
+f0103622:	50                   	push   %eax
+f0103623:	e8 8a cb ff ff       	call   f01001b2 <_panic>
+		return NULL;
+f0103628:	b8 00 00 00 00       	mov    $0x0,%eax
+f010362d:	e9 7b ff ff ff       	jmp    f01035ad <kmalloc+0x5d>
+		return NULL;
+f0103632:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103637:	e9 71 ff ff ff       	jmp    f01035ad <kmalloc+0x5d>
+
+f010363c <kfree>:
+
+void
+kfree(void *p)
+{
+f010363c:	55                   	push   %ebp
+f010363d:	89 e5                	mov    %esp,%ebp
+f010363f:	57                   	push   %edi
+f0103640:	56                   	push   %esi
+f0103641:	53                   	push   %ebx
+f0103642:	83 ec 0c             	sub    $0xc,%esp
+f0103645:	e8 e3 da ff ff       	call   f010112d <__x86.get_pc_thunk.si>
+f010364a:	81 c6 8e cd 01 00    	add    $0x1cd8e,%esi
+f0103650:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct PageInfo *pp;
+	struct Slab *s;
+
+	if (p == NULL)
+f0103653:	85 db                	test   %ebx,%ebx
+f0103655:	74 6e                	je     f01036c5 <kfree+0x89>
+		return;
+	if ((s = obj_slab(p))) {
+f0103657:	89 d8                	mov    %ebx,%eax
+f0103659:	e8 a2 f7 ff ff       	call   f0102e00 <obj_slab>
+f010365e:	85 c0                	test   %eax,%eax
+f0103660:	75 6b                	jne    f01036cd <kfree+0x91>
+	if ((uint32_t)kva < KERNBASE)
+f0103662:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0103668:	76 74                	jbe    f01036de <kfree+0xa2>
+	return (physaddr_t)kva - KERNBASE;
+f010366a:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+	if (PGNUM(pa) >= npages)
+f0103670:	c1 e8 0c             	shr    $0xc,%eax
+f0103673:	c7 c2 88 0e 12 f0    	mov    $0xf0120e88,%edx
+f0103679:	8b 0a                	mov    (%edx),%ecx
+f010367b:	39 c8                	cmp    %ecx,%eax
+f010367d:	73 7a                	jae    f01036f9 <kfree+0xbd>
+	return &pages[PGNUM(pa)];
+f010367f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0103682:	c1 e0 02             	shl    $0x2,%eax
+f0103685:	c7 c2 80 0e 12 f0    	mov    $0xf0120e80,%edx
+f010368b:	89 c7                	mov    %eax,%edi
+f010368d:	03 3a                	add    (%edx),%edi
+f010368f:	89 fa                	mov    %edi,%edx
+	return (pp - pages) << PGSHIFT;
+f0103691:	c1 f8 02             	sar    $0x2,%eax
+f0103694:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010369a:	89 c7                	mov    %eax,%edi
+f010369c:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f010369f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01036a4:	39 c8                	cmp    %ecx,%eax
+f01036a6:	73 6b                	jae    f0103713 <kfree+0xd7>
+	return (void *)(pa + KERNBASE);
+f01036a8:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+		kmem_cache_free(s->s_cache, p);
+		return;
+	}
+	pp = pa2page(PADDR(p));
+	if (page2kva(pp) != p)
+f01036ae:	39 fb                	cmp    %edi,%ebx
+f01036b0:	75 79                	jne    f010372b <kfree+0xef>
+		panic("kfree: bad pointer %08x", p);
+	page_free_order(pp, pp->pp_order);
+f01036b2:	83 ec 08             	sub    $0x8,%esp
+f01036b5:	0f b6 42 0a          	movzbl 0xa(%edx),%eax
+f01036b9:	50                   	push   %eax
+f01036ba:	52                   	push   %edx
+f01036bb:	89 f3                	mov    %esi,%ebx
+f01036bd:	e8 f6 eb ff ff       	call   f01022b8 <page_free_order>
+f01036c2:	83 c4 10             	add    $0x10,%esp
+}
+f01036c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01036c8:	5b                   	pop    %ebx
+f01036c9:	5e                   	pop    %esi
+f01036ca:	5f                   	pop    %edi
+f01036cb:	5d                   	pop    %ebp
+f01036cc:	c3                   	ret
+		kmem_cache_free(s->s_cache, p);
+f01036cd:	83 ec 08             	sub    $0x8,%esp
+f01036d0:	53                   	push   %ebx
+f01036d1:	ff 70 08             	push   0x8(%eax)
+f01036d4:	e8 7e fc ff ff       	call   f0103357 <kmem_cache_free>
+		return;
+f01036d9:	83 c4 10             	add    $0x10,%esp
+f01036dc:	eb e7                	jmp    f01036c5 <kfree+0x89>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01036de:	53                   	push   %ebx
+f01036df:	8d 86 c4 53 fe ff    	lea    -0x1ac3c(%esi),%eax
+f01036e5:	50                   	push   %eax
+f01036e6:	68 4c 01 00 00       	push   $0x14c
+f01036eb:	8d 86 98 5f fe ff    	lea    -0x1a068(%esi),%eax
+f01036f1:	50                   	push   %eax
+f01036f2:	89 f3                	mov    %esi,%ebx
+f01036f4:	e8 b9 ca ff ff       	call   f01001b2 <_panic>
+		panic("pa2page called with invalid pa");
+f01036f9:	83 ec 04             	sub    $0x4,%esp
+f01036fc:	8d 86 64 5e fe ff    	lea    -0x1a19c(%esi),%eax
+f0103702:	50                   	push   %eax
+f0103703:	6a 5b                	push   $0x5b
+f0103705:	8d 86 de 5a fe ff    	lea    -0x1a522(%esi),%eax
+f010370b:	50                   	push   %eax
+f010370c:	89 f3                	mov    %esi,%ebx
+f010370e:	e8 9f ca ff ff       	call   f01001b2 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103713:	57                   	push   %edi
+f0103714:	8d 86 30 53 fe ff    	lea    -0x1acd0(%esi),%eax
+f010371a:	50                   	push   %eax
+f010371b:	6a 62                	push   $0x62
+f010371d:	8d 86 de 5a fe ff    	lea    -0x1a522(%esi),%eax
+f0103723:	50                   	push   %eax
+f0103724:	89 f3                	mov    %esi,%ebx
+f0103726:	e8 87 ca ff ff       	call   f01001b2 <_panic>
+		panic("kfree: bad pointer %08x", p);
+f010372b:	53                   	push   %ebx
+f010372c:	8d 86 d4 5f fe ff    	lea    -0x1a02c(%esi),%eax
+f0103732:	50                   	push   %eax
+f0103733:	68 4e 01 00 00       	push   $0x14e
+f0103738:	8d 86 98 5f fe ff    	lea    -0x1a068(%esi),%eax
+f010373e:	50                   	push   %eax
+f010373f:	89 f3                	mov    %esi,%ebx
+f0103741:	e8 6c ca ff ff       	call   f01001b2 <_panic>
+
+f0103746 <kmem_print_stats>:
+
+void
+kmem_print_stats(void)
+{
+f0103746:	55                   	push   %ebp
+f0103747:	89 e5                	mov    %esp,%ebp
+f0103749:	57                   	push   %edi
+f010374a:	56                   	push   %esi
+f010374b:	53                   	push   %ebx
+f010374c:	83 ec 18             	sub    $0x18,%esp
+f010374f:	e8 85 cc ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0103754:	81 c3 84 cc 01 00    	add    $0x1cc84,%ebx
+	struct Kmem_cache *kc;
+
+	cprintf("cache           objsize  inuse  total  slabs  pages/slab  allocs\n");
+f010375a:	8d 83 34 5f fe ff    	lea    -0x1a0cc(%ebx),%eax
+f0103760:	50                   	push   %eax
+f0103761:	e8 7e 02 00 00       	call   f01039e4 <cprintf>
+	spin_lock(&kmem_caches_lock);
+f0103766:	8d 83 a8 0b 00 00    	lea    0xba8(%ebx),%eax
+f010376c:	89 04 24             	mov    %eax,(%esp)
+f010376f:	e8 aa 10 00 00       	call   f010481e <spin_lock>
+	for (kc = kmem_caches; kc; kc = kc->kc_next)
+f0103774:	8b b3 b8 0b 00 00    	mov    0xbb8(%ebx),%esi
+f010377a:	83 c4 10             	add    $0x10,%esp
+		cprintf("%-15s %7u %6u %6u %6u %11u %7u\n",
+f010377d:	8d bb 78 5f fe ff    	lea    -0x1a088(%ebx),%edi
+	for (kc = kmem_caches; kc; kc = kc->kc_next)
+f0103783:	eb 2b                	jmp    f01037b0 <kmem_print_stats+0x6a>
+		cprintf("%-15s %7u %6u %6u %6u %11u %7u\n",
+f0103785:	8b 46 38             	mov    0x38(%esi),%eax
+f0103788:	ff 76 40             	push   0x40(%esi)
+f010378b:	8b 4e 10             	mov    0x10(%esi),%ecx
+f010378e:	ba 01 00 00 00       	mov    $0x1,%edx
+f0103793:	d3 e2                	shl    %cl,%edx
+f0103795:	52                   	push   %edx
+f0103796:	50                   	push   %eax
+f0103797:	0f af 46 14          	imul   0x14(%esi),%eax
+f010379b:	50                   	push   %eax
+f010379c:	ff 76 3c             	push   0x3c(%esi)
+f010379f:	ff 76 04             	push   0x4(%esi)
+f01037a2:	ff 36                	push   (%esi)
+f01037a4:	57                   	push   %edi
+f01037a5:	e8 3a 02 00 00       	call   f01039e4 <cprintf>
+	for (kc = kmem_caches; kc; kc = kc->kc_next)
+f01037aa:	8b 76 44             	mov    0x44(%esi),%esi
+f01037ad:	83 c4 20             	add    $0x20,%esp
+f01037b0:	85 f6                	test   %esi,%esi
+f01037b2:	75 d1                	jne    f0103785 <kmem_print_stats+0x3f>
+			kc->kc_name, kc->kc_size, kc->kc_inuse,
+			kc->kc_nslabs * kc->kc_perslab, kc->kc_nslabs,
+			1 << kc->kc_order, kc->kc_nalloc);
+	spin_unlock(&kmem_caches_lock);
+f01037b4:	83 ec 0c             	sub    $0xc,%esp
+f01037b7:	8d 83 a8 0b 00 00    	lea    0xba8(%ebx),%eax
+f01037bd:	50                   	push   %eax
+f01037be:	e8 cb 10 00 00       	call   f010488e <spin_unlock>
+	cprintf("free pages: %u\n", page_nfree());
+f01037c3:	e8 db eb ff ff       	call   f01023a3 <page_nfree>
+f01037c8:	83 c4 08             	add    $0x8,%esp
+f01037cb:	50                   	push   %eax
+f01037cc:	8d 83 ec 5f fe ff    	lea    -0x1a014(%ebx),%eax
+f01037d2:	50                   	push   %eax
+f01037d3:	e8 0c 02 00 00       	call   f01039e4 <cprintf>
+}
+f01037d8:	83 c4 10             	add    $0x10,%esp
+f01037db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01037de:	5b                   	pop    %ebx
+f01037df:	5e                   	pop    %esi
+f01037e0:	5f                   	pop    %edi
+f01037e1:	5d                   	pop    %ebp
+f01037e2:	c3                   	ret
+
+f01037e3 <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f01037e3:	55                   	push   %ebp
+f01037e4:	89 e5                	mov    %esp,%ebp
+f01037e6:	57                   	push   %edi
+f01037e7:	56                   	push   %esi
+f01037e8:	53                   	push   %ebx
+f01037e9:	83 ec 1c             	sub    $0x1c,%esp
+f01037ec:	e8 e8 cb ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01037f1:	81 c3 e7 cb 01 00    	add    $0x1cbe7,%ebx
+f01037f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f01037fa:	66 89 8b 30 ff ff ff 	mov    %cx,-0xd0(%ebx)
+	if (!didinit)
+f0103801:	80 bb 30 0c 00 00 00 	cmpb   $0x0,0xc30(%ebx)
+f0103808:	75 08                	jne    f0103812 <irq_setmask_8259A+0x2f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & 1<<i)
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f010380a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010380d:	5b                   	pop    %ebx
+f010380e:	5e                   	pop    %esi
+f010380f:	5f                   	pop    %edi
+f0103810:	5d                   	pop    %ebp
+f0103811:	c3                   	ret
+f0103812:	89 cf                	mov    %ecx,%edi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0103814:	ba 21 00 00 00       	mov    $0x21,%edx
+f0103819:	89 c8                	mov    %ecx,%eax
+f010381b:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f010381c:	89 c8                	mov    %ecx,%eax
+f010381e:	66 c1 e8 08          	shr    $0x8,%ax
+f0103822:	ba a1 00 00 00       	mov    $0xa1,%edx
+f0103827:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f0103828:	83 ec 0c             	sub    $0xc,%esp
+f010382b:	8d 83 50 60 fe ff    	lea    -0x19fb0(%ebx),%eax
+f0103831:	50                   	push   %eax
+f0103832:	e8 ad 01 00 00       	call   f01039e4 <cprintf>
+f0103837:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f010383a:	be 00 00 00 00       	mov    $0x0,%esi
+		if (~mask & 1<<i)
+f010383f:	0f b7 ff             	movzwl %di,%edi
+f0103842:	f7 d7                	not    %edi
+			cprintf(" %d", i);
+f0103844:	8d 83 c8 63 fe ff    	lea    -0x19c38(%ebx),%eax
+f010384a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010384d:	eb 08                	jmp    f0103857 <irq_setmask_8259A+0x74>
+	for (i = 0; i < 16; i++)
+f010384f:	83 c6 01             	add    $0x1,%esi
+f0103852:	83 fe 10             	cmp    $0x10,%esi
+f0103855:	74 16                	je     f010386d <irq_setmask_8259A+0x8a>
+		if (~mask & 1<<i)
+f0103857:	0f a3 f7             	bt     %esi,%edi
+f010385a:	73 f3                	jae    f010384f <irq_setmask_8259A+0x6c>
+			cprintf(" %d", i);
+f010385c:	83 ec 08             	sub    $0x8,%esp
+f010385f:	56                   	push   %esi
+f0103860:	ff 75 e4             	push   -0x1c(%ebp)
+f0103863:	e8 7c 01 00 00       	call   f01039e4 <cprintf>
+f0103868:	83 c4 10             	add    $0x10,%esp
+f010386b:	eb e2                	jmp    f010384f <irq_setmask_8259A+0x6c>
+	cprintf("\n");
+f010386d:	83 ec 0c             	sub    $0xc,%esp
+f0103870:	8d 83 5d 53 fe ff    	lea    -0x1aca3(%ebx),%eax
+f0103876:	50                   	push   %eax
+f0103877:	e8 68 01 00 00       	call   f01039e4 <cprintf>
+f010387c:	83 c4 10             	add    $0x10,%esp
+f010387f:	eb 89                	jmp    f010380a <irq_setmask_8259A+0x27>
+
+f0103881 <pic_init>:
+{
+f0103881:	55                   	push   %ebp
+f0103882:	89 e5                	mov    %esp,%ebp
+f0103884:	57                   	push   %edi
+f0103885:	56                   	push   %esi
+f0103886:	53                   	push   %ebx
+f0103887:	83 ec 0c             	sub    $0xc,%esp
+f010388a:	e8 4a cb ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010388f:	81 c3 49 cb 01 00    	add    $0x1cb49,%ebx
+	didinit = 1;
+f0103895:	c6 83 30 0c 00 00 01 	movb   $0x1,0xc30(%ebx)
+f010389c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01038a1:	b9 21 00 00 00       	mov    $0x21,%ecx
+f01038a6:	89 ca                	mov    %ecx,%edx
+f01038a8:	ee                   	out    %al,(%dx)
+f01038a9:	be a1 00 00 00       	mov    $0xa1,%esi
+f01038ae:	89 f2                	mov    %esi,%edx
+f01038b0:	ee                   	out    %al,(%dx)
+f01038b1:	bf 11 00 00 00       	mov    $0x11,%edi
+f01038b6:	89 f8                	mov    %edi,%eax
+f01038b8:	ba 20 00 00 00       	mov    $0x20,%edx
+f01038bd:	ee                   	out    %al,(%dx)
+f01038be:	b8 20 00 00 00       	mov    $0x20,%eax
+f01038c3:	89 ca                	mov    %ecx,%edx
+f01038c5:	ee                   	out    %al,(%dx)
+f01038c6:	b8 04 00 00 00       	mov    $0x4,%eax
+f01038cb:	ee                   	out    %al,(%dx)
+f01038cc:	b8 03 00 00 00       	mov    $0x3,%eax
+f01038d1:	ee                   	out    %al,(%dx)
+f01038d2:	b9 a0 00 00 00       	mov    $0xa0,%ecx
+f01038d7:	89 f8                	mov    %edi,%eax
+f01038d9:	89 ca                	mov    %ecx,%edx
+f01038db:	ee                   	out    %al,(%dx)
+f01038dc:	b8 28 00 00 00       	mov    $0x28,%eax
+f01038e1:	89 f2                	mov    %esi,%edx
+f01038e3:	ee                   	out    %al,(%dx)
+f01038e4:	b8 02 00 00 00       	mov    $0x2,%eax
+f01038e9:	ee                   	out    %al,(%dx)
+f01038ea:	b8 01 00 00 00       	mov    $0x1,%eax
+f01038ef:	ee                   	out    %al,(%dx)
+f01038f0:	bf 68 00 00 00       	mov    $0x68,%edi
+f01038f5:	89 f8                	mov    %edi,%eax
+f01038f7:	ba 20 00 00 00       	mov    $0x20,%edx
+f01038fc:	ee                   	out    %al,(%dx)
+f01038fd:	be 0a 00 00 00       	mov    $0xa,%esi
+f0103902:	89 f0                	mov    %esi,%eax
+f0103904:	ee                   	out    %al,(%dx)
+f0103905:	89 f8                	mov    %edi,%eax
+f0103907:	89 ca                	mov    %ecx,%edx
+f0103909:	ee                   	out    %al,(%dx)
+f010390a:	89 f0                	mov    %esi,%eax
+f010390c:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f010390d:	0f b7 83 30 ff ff ff 	movzwl -0xd0(%ebx),%eax
+f0103914:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0103918:	75 08                	jne    f0103922 <pic_init+0xa1>
+}
+f010391a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010391d:	5b                   	pop    %ebx
+f010391e:	5e                   	pop    %esi
+f010391f:	5f                   	pop    %edi
+f0103920:	5d                   	pop    %ebp
+f0103921:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f0103922:	83 ec 0c             	sub    $0xc,%esp
+f0103925:	0f b7 c0             	movzwl %ax,%eax
+f0103928:	50                   	push   %eax
+f0103929:	e8 b5 fe ff ff       	call   f01037e3 <irq_setmask_8259A>
+f010392e:	83 c4 10             	add    $0x10,%esp
+}
+f0103931:	eb e7                	jmp    f010391a <pic_init+0x99>
+
+f0103933 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+f0103933:	55                   	push   %ebp
+f0103934:	89 e5                	mov    %esp,%ebp
+f0103936:	56                   	push   %esi
+f0103937:	53                   	push   %ebx
+f0103938:	e8 9c ca ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010393d:	81 c3 9b ca 01 00    	add    $0x1ca9b,%ebx
+f0103943:	8b 75 0c             	mov    0xc(%ebp),%esi
+	b->buf[b->idx++] = ch;
+f0103946:	8b 16                	mov    (%esi),%edx
+f0103948:	8d 42 01             	lea    0x1(%edx),%eax
+f010394b:	89 06                	mov    %eax,(%esi)
+f010394d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0103950:	88 4c 16 08          	mov    %cl,0x8(%esi,%edx,1)
+	if (b->idx == sizeof(b->buf)) {
+f0103954:	3d 00 01 00 00       	cmp    $0x100,%eax
+f0103959:	74 0b                	je     f0103966 <putch+0x33>
+		cons_write(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+f010395b:	83 46 04 01          	addl   $0x1,0x4(%esi)
+}
+f010395f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0103962:	5b                   	pop    %ebx
+f0103963:	5e                   	pop    %esi
+f0103964:	5d                   	pop    %ebp
+f0103965:	c3                   	ret
+		cons_write(b->buf, b->idx);
+f0103966:	83 ec 08             	sub    $0x8,%esp
+f0103969:	68 00 01 00 00       	push   $0x100
+f010396e:	8d 46 08             	lea    0x8(%esi),%eax
+f0103971:	50                   	push   %eax
+f0103972:	e8 7c d5 ff ff       	call   f0100ef3 <cons_write>
+		b->idx = 0;
+f0103977:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+f010397d:	83 c4 10             	add    $0x10,%esp
+f0103980:	eb d9                	jmp    f010395b <putch+0x28>
+
+f0103982 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f0103982:	55                   	push   %ebp
+f0103983:	89 e5                	mov    %esp,%ebp
+f0103985:	53                   	push   %ebx
+f0103986:	81 ec 14 01 00 00    	sub    $0x114,%esp
+f010398c:	e8 48 ca ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0103991:	81 c3 47 ca 01 00    	add    $0x1ca47,%ebx
+	struct printbuf b;
+
+	b.idx = 0;
+f0103997:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+f010399e:	00 00 00 
+	b.cnt = 0;
+f01039a1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+f01039a8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+f01039ab:	ff 75 0c             	push   0xc(%ebp)
+f01039ae:	ff 75 08             	push   0x8(%ebp)
+f01039b1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+f01039b7:	50                   	push   %eax
+f01039b8:	8d 83 5b 35 fe ff    	lea    -0x1caa5(%ebx),%eax
+f01039be:	50                   	push   %eax
+f01039bf:	e8 8e 11 00 00       	call   f0104b52 <vprintfmt>
+	cons_write(b.buf, b.idx);
+f01039c4:	83 c4 08             	add    $0x8,%esp
+f01039c7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+f01039cd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+f01039d3:	50                   	push   %eax
+f01039d4:	e8 1a d5 ff ff       	call   f0100ef3 <cons_write>
+
+	return b.cnt;
+}
+f01039d9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+f01039df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01039e2:	c9                   	leave
+f01039e3:	c3                   	ret
+
+f01039e4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f01039e4:	55                   	push   %ebp
+f01039e5:	89 e5                	mov    %esp,%ebp
+f01039e7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f01039ea:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f01039ed:	50                   	push   %eax
+f01039ee:	ff 75 08             	push   0x8(%ebp)
+f01039f1:	e8 8c ff ff ff       	call   f0103982 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f01039f6:	c9                   	leave
+f01039f7:	c3                   	ret
+
+f01039f8 <trap_init>:
+};
+
+
+void
+trap_init(void)
+{
+f01039f8:	e8 28 d7 ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f01039fd:	05 db c9 01 00       	add    $0x1c9db,%eax
+	extern void irq_serial(void);
+	extern void irq_spurious(void);
+
+	// Interrupt gates, so that handlers run with interrupts off.
+	SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, irq_serial, 0);
+f0103a02:	c7 c2 c4 3a 10 f0    	mov    $0xf0103ac4,%edx
+f0103a08:	66 89 90 68 0d 00 00 	mov    %dx,0xd68(%eax)
+f0103a0f:	66 c7 80 6a 0d 00 00 	movw   $0x8,0xd6a(%eax)
+f0103a16:	08 00 
+f0103a18:	c6 80 6c 0d 00 00 00 	movb   $0x0,0xd6c(%eax)
+f0103a1f:	c6 80 6d 0d 00 00 8e 	movb   $0x8e,0xd6d(%eax)
+f0103a26:	c1 ea 10             	shr    $0x10,%edx
+f0103a29:	66 89 90 6e 0d 00 00 	mov    %dx,0xd6e(%eax)
+	SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, irq_spurious, 0);
+f0103a30:	c7 c2 ca 3a 10 f0    	mov    $0xf0103aca,%edx
+f0103a36:	66 89 90 80 0d 00 00 	mov    %dx,0xd80(%eax)
+f0103a3d:	66 c7 80 82 0d 00 00 	movw   $0x8,0xd82(%eax)
+f0103a44:	08 00 
+f0103a46:	c6 80 84 0d 00 00 00 	movb   $0x0,0xd84(%eax)
+f0103a4d:	c6 80 85 0d 00 00 8e 	movb   $0x8e,0xd85(%eax)
+f0103a54:	c1 ea 10             	shr    $0x10,%edx
+f0103a57:	66 89 90 86 0d 00 00 	mov    %dx,0xd86(%eax)
+	asm volatile("lidt (%0)" : : "r" (p));
+f0103a5e:	8d 80 58 00 00 00    	lea    0x58(%eax),%eax
+f0103a64:	0f 01 18             	lidtl  (%eax)
+
+	lidt(&idt_pd);
+}
+f0103a67:	c3                   	ret
+
+f0103a68 <trap>:
+
+void
+trap(struct Trapframe *tf)
+{
+f0103a68:	55                   	push   %ebp
+f0103a69:	89 e5                	mov    %esp,%ebp
+f0103a6b:	53                   	push   %ebx
+f0103a6c:	83 ec 04             	sub    $0x4,%esp
+f0103a6f:	e8 65 c9 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0103a74:	81 c3 64 c9 01 00    	add    $0x1c964,%ebx
+f0103a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+	// The 8259A runs in automatic EOI mode, and its interrupts reach
+	// the boot CPU through LINT0 as ExtINT, which needs no local APIC
+	// EOI either.
+	switch (tf->tf_trapno) {
+f0103a7d:	8b 42 28             	mov    0x28(%edx),%eax
+f0103a80:	83 f8 24             	cmp    $0x24,%eax
+f0103a83:	74 19                	je     f0103a9e <trap+0x36>
+f0103a85:	83 f8 27             	cmp    $0x27,%eax
+f0103a88:	75 1e                	jne    f0103aa8 <trap+0x40>
+	case IRQ_OFFSET + IRQ_SPURIOUS:
+		// Handle spurious interrupts
+		// The hardware sometimes raises these because of noise on the
+		// IRQ line or other reasons. We don't care.
+		// The local APIC's spurious vector is this one too.
+		cprintf("Spurious interrupt on irq 7\n");
+f0103a8a:	83 ec 0c             	sub    $0xc,%esp
+f0103a8d:	8d 83 64 60 fe ff    	lea    -0x19f9c(%ebx),%eax
+f0103a93:	50                   	push   %eax
+f0103a94:	e8 4b ff ff ff       	call   f01039e4 <cprintf>
+		return;
+f0103a99:	83 c4 10             	add    $0x10,%esp
+f0103a9c:	eb 05                	jmp    f0103aa3 <trap+0x3b>
+		serial_intr();
+f0103a9e:	e8 45 d2 ff ff       	call   f0100ce8 <serial_intr>
+	}
+
+	panic("unexpected trap %d at eip %08x", tf->tf_trapno, tf->tf_eip);
+}
+f0103aa3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103aa6:	c9                   	leave
+f0103aa7:	c3                   	ret
+	panic("unexpected trap %d at eip %08x", tf->tf_trapno, tf->tf_eip);
+f0103aa8:	83 ec 0c             	sub    $0xc,%esp
+f0103aab:	ff 72 30             	push   0x30(%edx)
+f0103aae:	50                   	push   %eax
+f0103aaf:	8d 83 90 60 fe ff    	lea    -0x19f70(%ebx),%eax
+f0103ab5:	50                   	push   %eax
+f0103ab6:	6a 32                	push   $0x32
+f0103ab8:	8d 83 81 60 fe ff    	lea    -0x19f7f(%ebx),%eax
+f0103abe:	50                   	push   %eax
+f0103abf:	e8 ee c6 ff ff       	call   f01001b2 <_panic>
+
+f0103ac4 <irq_serial>:
+.text
+
+/*
+ * Only the interrupts the kernel turns on have handlers so far.
+ */
+TRAPHANDLER_NOEC(irq_serial, IRQ_OFFSET + IRQ_SERIAL)
+f0103ac4:	6a 00                	push   $0x0
+f0103ac6:	6a 24                	push   $0x24
+f0103ac8:	eb 06                	jmp    f0103ad0 <_alltraps>
+
+f0103aca <irq_spurious>:
+TRAPHANDLER_NOEC(irq_spurious, IRQ_OFFSET + IRQ_SPURIOUS)
+f0103aca:	6a 00                	push   $0x0
+f0103acc:	6a 27                	push   $0x27
+f0103ace:	eb 00                	jmp    f0103ad0 <_alltraps>
+
+f0103ad0 <_alltraps>:
+ * Build a struct Trapframe on the stack and call trap(tf).  Traps only
+ * come from the kernel, so %fs still holds this CPU's per-CPU segment;
+ * when trap returns, pop the frame and resume where we were.
+ */
+_alltraps:
+	pushl %ds
+f0103ad0:	1e                   	push   %ds
+	pushl %es
+f0103ad1:	06                   	push   %es
+	pushal
+f0103ad2:	60                   	pusha
+
+	movw $GD_KD, %ax
+f0103ad3:	66 b8 10 00          	mov    $0x10,%ax
+	movw %ax, %ds
+f0103ad7:	8e d8                	mov    %eax,%ds
+	movw %ax, %es
+f0103ad9:	8e c0                	mov    %eax,%es
+
+	pushl %esp
+f0103adb:	54                   	push   %esp
+	call trap
+f0103adc:	e8 87 ff ff ff       	call   f0103a68 <trap>
+	addl $4, %esp
+f0103ae1:	83 c4 04             	add    $0x4,%esp
+
+	popal
+f0103ae4:	61                   	popa
+	popl %es
+f0103ae5:	07                   	pop    %es
+	popl %ds
+f0103ae6:	1f                   	pop    %ds
+	addl $8, %esp		# trapno and error code
+f0103ae7:	83 c4 08             	add    $0x8,%esp
+	iret
+f0103aea:	cf                   	iret
+
+f0103aeb <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f0103aeb:	55                   	push   %ebp
+f0103aec:	89 e5                	mov    %esp,%ebp
+f0103aee:	57                   	push   %edi
+f0103aef:	56                   	push   %esi
+f0103af0:	53                   	push   %ebx
+f0103af1:	83 ec 14             	sub    $0x14,%esp
+f0103af4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0103af7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0103afa:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0103afd:	8b 1a                	mov    (%edx),%ebx
+f0103aff:	8b 09                	mov    (%ecx),%ecx
+f0103b01:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f0103b08:	eb 4f                	jmp    f0103b59 <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f0103b0a:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0103b0d:	39 c3                	cmp    %eax,%ebx
+f0103b0f:	0f 8f cc 00 00 00    	jg     f0103be1 <stab_binsearch+0xf6>
+f0103b15:	0f b6 0a             	movzbl (%edx),%ecx
+f0103b18:	83 ea 0c             	sub    $0xc,%edx
+f0103b1b:	39 f1                	cmp    %esi,%ecx
+f0103b1d:	75 eb                	jne    f0103b0a <stab_binsearch+0x1f>
+f0103b1f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0103b22:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0103b25:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0103b28:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f0103b2b:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0103b2f:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0103b32:	72 16                	jb     f0103b4a <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f0103b34:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0103b37:	73 48                	jae    f0103b81 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f0103b39:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0103b3c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103b3f:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f0103b41:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0103b48:	eb 0f                	jmp    f0103b59 <stab_binsearch+0x6e>
+			*region_left = m;
+f0103b4a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0103b4d:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f0103b4f:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f0103b52:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f0103b59:	39 cb                	cmp    %ecx,%ebx
+f0103b5b:	7f 38                	jg     f0103b95 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f0103b5d:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0103b60:	89 c2                	mov    %eax,%edx
+f0103b62:	c1 ea 1f             	shr    $0x1f,%edx
+f0103b65:	01 d0                	add    %edx,%eax
+f0103b67:	89 c7                	mov    %eax,%edi
+f0103b69:	d1 ff                	sar    %edi
+f0103b6b:	83 e0 fe             	and    $0xfffffffe,%eax
+f0103b6e:	01 f8                	add    %edi,%eax
+f0103b70:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0103b73:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+f0103b77:	89 f8                	mov    %edi,%eax
+f0103b79:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f0103b7c:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f0103b7f:	eb 8c                	jmp    f0103b0d <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f0103b81:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0103b84:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f0103b86:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0103b8a:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f0103b8c:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0103b93:	eb c4                	jmp    f0103b59 <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f0103b95:	8b 75 08             	mov    0x8(%ebp),%esi
+f0103b98:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0103b9c:	75 15                	jne    f0103bb3 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f0103b9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103ba1:	8b 00                	mov    (%eax),%eax
+f0103ba3:	83 e8 01             	sub    $0x1,%eax
+f0103ba6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0103ba9:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f0103bab:	83 c4 14             	add    $0x14,%esp
+f0103bae:	5b                   	pop    %ebx
+f0103baf:	5e                   	pop    %esi
+f0103bb0:	5f                   	pop    %edi
+f0103bb1:	5d                   	pop    %ebp
+f0103bb2:	c3                   	ret
+		for (l = *region_right;
+f0103bb3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103bb6:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f0103bb8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0103bbb:	8b 0f                	mov    (%edi),%ecx
+f0103bbd:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0103bc0:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0103bc3:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0103bc7:	39 c1                	cmp    %eax,%ecx
+f0103bc9:	7d 0f                	jge    f0103bda <stab_binsearch+0xef>
+f0103bcb:	0f b6 1a             	movzbl (%edx),%ebx
+f0103bce:	83 ea 0c             	sub    $0xc,%edx
+f0103bd1:	39 f3                	cmp    %esi,%ebx
+f0103bd3:	74 05                	je     f0103bda <stab_binsearch+0xef>
+		     l--)
+f0103bd5:	83 e8 01             	sub    $0x1,%eax
+f0103bd8:	eb ed                	jmp    f0103bc7 <stab_binsearch+0xdc>
+		*region_left = l;
+f0103bda:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0103bdd:	89 07                	mov    %eax,(%edi)
+}
+f0103bdf:	eb ca                	jmp    f0103bab <stab_binsearch+0xc0>
+			l = true_m + 1;
+f0103be1:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0103be4:	89 75 08             	mov    %esi,0x8(%ebp)
+f0103be7:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f0103bea:	e9 6a ff ff ff       	jmp    f0103b59 <stab_binsearch+0x6e>
+
+f0103bef <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0103bef:	55                   	push   %ebp
+f0103bf0:	89 e5                	mov    %esp,%ebp
+f0103bf2:	57                   	push   %edi
+f0103bf3:	56                   	push   %esi
+f0103bf4:	53                   	push   %ebx
+f0103bf5:	83 ec 3c             	sub    $0x3c,%esp
+f0103bf8:	e8 dc c7 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0103bfd:	81 c3 db c7 01 00    	add    $0x1c7db,%ebx
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0103c03:	8d 83 af 60 fe ff    	lea    -0x19f51(%ebx),%eax
+f0103c09:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0103c0c:	89 07                	mov    %eax,(%edi)
+	info->eip_line = 0;
+f0103c0e:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	info->eip_fn_name = "<unknown>";
+f0103c15:	89 47 08             	mov    %eax,0x8(%edi)
+	info->eip_fn_namelen = 9;
+f0103c18:	89 f8                	mov    %edi,%eax
+f0103c1a:	c7 47 0c 09 00 00 00 	movl   $0x9,0xc(%edi)
+	info->eip_fn_addr = addr;
+f0103c21:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0103c24:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f0103c27:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0103c2e:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0103c34:	0f 86 43 01 00 00    	jbe    f0103d7d <debuginfo_eip+0x18e>
+		// Can't search for user-level addresses yet!
+  	        panic("User address");
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0103c3a:	c7 c0 d2 5c 11 f0    	mov    $0xf0115cd2,%eax
+f0103c40:	39 83 f0 ff ff ff    	cmp    %eax,-0x10(%ebx)
+f0103c46:	0f 83 d2 01 00 00    	jae    f0103e1e <debuginfo_eip+0x22f>
+f0103c4c:	c7 c0 d2 5c 11 f0    	mov    $0xf0115cd2,%eax
+f0103c52:	80 78 ff 00          	cmpb   $0x0,-0x1(%eax)
+f0103c56:	0f 85 c9 01 00 00    	jne    f0103e25 <debuginfo_eip+0x236>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f0103c5c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f0103c63:	c7 c0 7c 69 10 f0    	mov    $0xf010697c,%eax
+f0103c69:	c7 c2 3c 15 11 f0    	mov    $0xf011153c,%edx
+f0103c6f:	29 c2                	sub    %eax,%edx
+f0103c71:	c1 fa 02             	sar    $0x2,%edx
+f0103c74:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f0103c7a:	83 ea 01             	sub    $0x1,%edx
+f0103c7d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f0103c80:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+f0103c83:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0103c86:	83 ec 08             	sub    $0x8,%esp
+f0103c89:	ff 75 08             	push   0x8(%ebp)
+f0103c8c:	6a 64                	push   $0x64
+f0103c8e:	e8 58 fe ff ff       	call   f0103aeb <stab_binsearch>
+	if (lfile == 0)
+f0103c93:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0103c96:	83 c4 10             	add    $0x10,%esp
+f0103c99:	85 ff                	test   %edi,%edi
+f0103c9b:	0f 84 8b 01 00 00    	je     f0103e2c <debuginfo_eip+0x23d>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f0103ca1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+	rfun = rfile;
+f0103ca4:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0103ca7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0103caa:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+f0103cad:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0103cb0:	83 ec 08             	sub    $0x8,%esp
+f0103cb3:	ff 75 08             	push   0x8(%ebp)
+f0103cb6:	6a 24                	push   $0x24
+f0103cb8:	c7 c0 7c 69 10 f0    	mov    $0xf010697c,%eax
+f0103cbe:	e8 28 fe ff ff       	call   f0103aeb <stab_binsearch>
+
+	if (lfun <= rfun) {
+f0103cc3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0103cc6:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+f0103cc9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0103ccc:	89 55 c0             	mov    %edx,-0x40(%ebp)
+f0103ccf:	83 c4 10             	add    $0x10,%esp
+f0103cd2:	89 f8                	mov    %edi,%eax
+f0103cd4:	39 d1                	cmp    %edx,%ecx
+f0103cd6:	7f 3c                	jg     f0103d14 <debuginfo_eip+0x125>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0103cd8:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+f0103cdb:	c7 c2 7c 69 10 f0    	mov    $0xf010697c,%edx
+f0103ce1:	8d 0c 82             	lea    (%edx,%eax,4),%ecx
+f0103ce4:	8b 11                	mov    (%ecx),%edx
+f0103ce6:	c7 c0 d2 5c 11 f0    	mov    $0xf0115cd2,%eax
+f0103cec:	81 e8 3d 15 11 f0    	sub    $0xf011153d,%eax
+f0103cf2:	39 c2                	cmp    %eax,%edx
+f0103cf4:	73 0c                	jae    f0103d02 <debuginfo_eip+0x113>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0103cf6:	81 c2 3d 15 11 f0    	add    $0xf011153d,%edx
+f0103cfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103cff:	89 50 08             	mov    %edx,0x8(%eax)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0103d02:	8b 41 08             	mov    0x8(%ecx),%eax
+f0103d05:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103d08:	89 46 10             	mov    %eax,0x10(%esi)
+		addr -= info->eip_fn_addr;
+f0103d0b:	29 45 08             	sub    %eax,0x8(%ebp)
+f0103d0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0103d11:	8b 75 c0             	mov    -0x40(%ebp),%esi
+		// Search within the function definition for the line number.
+		lline = lfun;
+f0103d14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		rline = rfun;
+f0103d17:	89 75 d0             	mov    %esi,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0103d1a:	83 ec 08             	sub    $0x8,%esp
+f0103d1d:	6a 3a                	push   $0x3a
+f0103d1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103d22:	ff 70 08             	push   0x8(%eax)
+f0103d25:	e8 ce 15 00 00       	call   f01052f8 <strfind>
+f0103d2a:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103d2d:	2b 46 08             	sub    0x8(%esi),%eax
+f0103d30:	89 46 0c             	mov    %eax,0xc(%esi)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f0103d33:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0103d36:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0103d39:	83 c4 08             	add    $0x8,%esp
+f0103d3c:	ff 75 08             	push   0x8(%ebp)
+f0103d3f:	6a 44                	push   $0x44
+f0103d41:	c7 c0 7c 69 10 f0    	mov    $0xf010697c,%eax
+f0103d47:	e8 9f fd ff ff       	call   f0103aeb <stab_binsearch>
+	if (lline > rline)
+f0103d4c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103d4f:	83 c4 10             	add    $0x10,%esp
+f0103d52:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0103d55:	0f 8f d8 00 00 00    	jg     f0103e33 <debuginfo_eip+0x244>
+		return -1;
+	info->eip_line = stabs[lline].n_desc;
+f0103d5b:	89 c2                	mov    %eax,%edx
+f0103d5d:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f0103d60:	c7 c0 7c 69 10 f0    	mov    $0xf010697c,%eax
+f0103d66:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0103d69:	0f b7 74 88 06       	movzwl 0x6(%eax,%ecx,4),%esi
+f0103d6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103d71:	89 70 04             	mov    %esi,0x4(%eax)
+f0103d74:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0103d77:	8d 44 88 04          	lea    0x4(%eax,%ecx,4),%eax
+	// Search backwards from the line number for the relevant filename
+	// stab.
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+f0103d7b:	eb 1e                	jmp    f0103d9b <debuginfo_eip+0x1ac>
+  	        panic("User address");
+f0103d7d:	83 ec 04             	sub    $0x4,%esp
+f0103d80:	8d 83 b9 60 fe ff    	lea    -0x19f47(%ebx),%eax
+f0103d86:	50                   	push   %eax
+f0103d87:	6a 7f                	push   $0x7f
+f0103d89:	8d 83 c6 60 fe ff    	lea    -0x19f3a(%ebx),%eax
+f0103d8f:	50                   	push   %eax
+f0103d90:	e8 1d c4 ff ff       	call   f01001b2 <_panic>
+f0103d95:	83 ea 01             	sub    $0x1,%edx
+f0103d98:	83 e8 0c             	sub    $0xc,%eax
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0103d9b:	39 d7                	cmp    %edx,%edi
+f0103d9d:	7f 2f                	jg     f0103dce <debuginfo_eip+0x1df>
+	       && stabs[lline].n_type != N_SOL
+f0103d9f:	0f b6 08             	movzbl (%eax),%ecx
+f0103da2:	80 f9 84             	cmp    $0x84,%cl
+f0103da5:	74 0b                	je     f0103db2 <debuginfo_eip+0x1c3>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0103da7:	80 f9 64             	cmp    $0x64,%cl
+f0103daa:	75 e9                	jne    f0103d95 <debuginfo_eip+0x1a6>
+f0103dac:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0103db0:	74 e3                	je     f0103d95 <debuginfo_eip+0x1a6>
+		lline--;
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0103db2:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0103db5:	c7 c0 7c 69 10 f0    	mov    $0xf010697c,%eax
+f0103dbb:	8b 14 90             	mov    (%eax,%edx,4),%edx
+f0103dbe:	c7 c0 d2 5c 11 f0    	mov    $0xf0115cd2,%eax
+f0103dc4:	81 e8 3d 15 11 f0    	sub    $0xf011153d,%eax
+f0103dca:	39 c2                	cmp    %eax,%edx
+f0103dcc:	72 26                	jb     f0103df4 <debuginfo_eip+0x205>
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+
+	return 0;
+f0103dce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f0103dd3:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f0103dd6:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0103dd9:	39 f7                	cmp    %esi,%edi
+f0103ddb:	7d 62                	jge    f0103e3f <debuginfo_eip+0x250>
+		for (lline = lfun + 1;
+f0103ddd:	89 f8                	mov    %edi,%eax
+f0103ddf:	83 c0 01             	add    $0x1,%eax
+f0103de2:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f0103de5:	c7 c2 7c 69 10 f0    	mov    $0xf010697c,%edx
+f0103deb:	8d 54 8a 04          	lea    0x4(%edx,%ecx,4),%edx
+f0103def:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0103df2:	eb 11                	jmp    f0103e05 <debuginfo_eip+0x216>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f0103df4:	81 c2 3d 15 11 f0    	add    $0xf011153d,%edx
+f0103dfa:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103dfd:	89 10                	mov    %edx,(%eax)
+f0103dff:	eb cd                	jmp    f0103dce <debuginfo_eip+0x1df>
+			info->eip_fn_narg++;
+f0103e01:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f0103e05:	39 c6                	cmp    %eax,%esi
+f0103e07:	7e 31                	jle    f0103e3a <debuginfo_eip+0x24b>
+f0103e09:	0f b6 0a             	movzbl (%edx),%ecx
+f0103e0c:	83 c0 01             	add    $0x1,%eax
+f0103e0f:	83 c2 0c             	add    $0xc,%edx
+f0103e12:	80 f9 a0             	cmp    $0xa0,%cl
+f0103e15:	74 ea                	je     f0103e01 <debuginfo_eip+0x212>
+	return 0;
+f0103e17:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103e1c:	eb 21                	jmp    f0103e3f <debuginfo_eip+0x250>
+		return -1;
+f0103e1e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0103e23:	eb 1a                	jmp    f0103e3f <debuginfo_eip+0x250>
+f0103e25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0103e2a:	eb 13                	jmp    f0103e3f <debuginfo_eip+0x250>
+		return -1;
+f0103e2c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0103e31:	eb 0c                	jmp    f0103e3f <debuginfo_eip+0x250>
+		return -1;
+f0103e33:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0103e38:	eb 05                	jmp    f0103e3f <debuginfo_eip+0x250>
+	return 0;
+f0103e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103e42:	5b                   	pop    %ebx
+f0103e43:	5e                   	pop    %esi
+f0103e44:	5f                   	pop    %edi
+f0103e45:	5d                   	pop    %ebp
+f0103e46:	c3                   	ret
+
+f0103e47 <ramdisk_init>:
+static char *rd_base;
+static size_t rd_size;
+
+void
+ramdisk_init(void)
+{
+f0103e47:	55                   	push   %ebp
+f0103e48:	89 e5                	mov    %esp,%ebp
+f0103e4a:	53                   	push   %ebx
+f0103e4b:	83 ec 04             	sub    $0x4,%esp
+f0103e4e:	e8 86 c5 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0103e53:	81 c3 85 c5 01 00    	add    $0x1c585,%ebx
+	rd_base = _binary_obj_fs_ramdisk_img_start;
+f0103e59:	c7 c2 00 00 00 00    	mov    $0x0,%edx
+f0103e5f:	89 93 4c 14 00 00    	mov    %edx,0x144c(%ebx)
+	rd_size = _binary_obj_fs_ramdisk_img_end - rd_base;
+f0103e65:	c7 c0 00 00 00 00    	mov    $0x0,%eax
+f0103e6b:	29 d0                	sub    %edx,%eax
+f0103e6d:	89 83 48 14 00 00    	mov    %eax,0x1448(%ebx)
+	if (rd_size == 0)
+f0103e73:	74 3a                	je     f0103eaf <ramdisk_init+0x68>
+	if ((uint32_t)kva < KERNBASE)
+f0103e75:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0103e7b:	76 37                	jbe    f0103eb4 <ramdisk_init+0x6d>
+
+	// The image is part of the kernel's .data, so it must lie within
+	// the physical memory that mem_init direct-maps at KERNBASE.  A
+	// partial trailing block is dropped: the file system never asks
+	// for one.
+	if (PADDR(rd_base) + rd_size > (physaddr_t) npages * PGSIZE) {
+f0103e7d:	8d 8c 02 00 00 00 10 	lea    0x10000000(%edx,%eax,1),%ecx
+f0103e84:	c7 c2 88 0e 12 f0    	mov    $0xf0120e88,%edx
+f0103e8a:	8b 12                	mov    (%edx),%edx
+f0103e8c:	c1 e2 0c             	shl    $0xc,%edx
+f0103e8f:	39 ca                	cmp    %ecx,%edx
+f0103e91:	72 37                	jb     f0103eca <ramdisk_init+0x83>
+		cprintf("ramdisk: %u-byte image is not fully mapped; "
+			"ignoring it\n", rd_size);
+		rd_size = 0;
+		return;
+	}
+	cprintf("ramdisk: %u blocks at %08x\n", ramdisk_nblocks(), rd_base);
+f0103e93:	83 ec 04             	sub    $0x4,%esp
+f0103e96:	ff b3 f8 ff ff ff    	push   -0x8(%ebx)
+}
+
+uint32_t
+ramdisk_nblocks(void)
+{
+	return rd_size / RAMDISK_BLKSIZE;
+f0103e9c:	c1 e8 0c             	shr    $0xc,%eax
+	cprintf("ramdisk: %u blocks at %08x\n", ramdisk_nblocks(), rd_base);
+f0103e9f:	50                   	push   %eax
+f0103ea0:	8d 83 1c 61 fe ff    	lea    -0x19ee4(%ebx),%eax
+f0103ea6:	50                   	push   %eax
+f0103ea7:	e8 38 fb ff ff       	call   f01039e4 <cprintf>
+f0103eac:	83 c4 10             	add    $0x10,%esp
+}
+f0103eaf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103eb2:	c9                   	leave
+f0103eb3:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103eb4:	52                   	push   %edx
+f0103eb5:	8d 83 c4 53 fe ff    	lea    -0x1ac3c(%ebx),%eax
+f0103ebb:	50                   	push   %eax
+f0103ebc:	6a 24                	push   $0x24
+f0103ebe:	8d 83 0d 61 fe ff    	lea    -0x19ef3(%ebx),%eax
+f0103ec4:	50                   	push   %eax
+f0103ec5:	e8 e8 c2 ff ff       	call   f01001b2 <_panic>
+		cprintf("ramdisk: %u-byte image is not fully mapped; "
+f0103eca:	83 ec 08             	sub    $0x8,%esp
+f0103ecd:	50                   	push   %eax
+f0103ece:	8d 83 d4 60 fe ff    	lea    -0x19f2c(%ebx),%eax
+f0103ed4:	50                   	push   %eax
+f0103ed5:	e8 0a fb ff ff       	call   f01039e4 <cprintf>
+		rd_size = 0;
+f0103eda:	c7 83 48 14 00 00 00 	movl   $0x0,0x1448(%ebx)
+f0103ee1:	00 00 00 
+		return;
+f0103ee4:	83 c4 10             	add    $0x10,%esp
+f0103ee7:	eb c6                	jmp    f0103eaf <ramdisk_init+0x68>
+
+f0103ee9 <ramdisk_nblocks>:
+{
+f0103ee9:	e8 37 d2 ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0103eee:	05 ea c4 01 00       	add    $0x1c4ea,%eax
+	return rd_size / RAMDISK_BLKSIZE;
+f0103ef3:	8b 80 48 14 00 00    	mov    0x1448(%eax),%eax
+f0103ef9:	c1 e8 0c             	shr    $0xc,%eax
+}
+f0103efc:	c3                   	ret
+
+f0103efd <ramdisk_get_block>:
+// This is the backend for file_get_block when the file system runs
+// from the RAM disk.  Returns 0 on success, -E_INVAL if the block is
+// out of range.
+int
+ramdisk_get_block(uint32_t blockno, char **blk)
+{
+f0103efd:	55                   	push   %ebp
+f0103efe:	89 e5                	mov    %esp,%ebp
+f0103f00:	e8 24 d2 ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f0103f05:	81 c1 d3 c4 01 00    	add    $0x1c4d3,%ecx
+f0103f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+	return rd_size / RAMDISK_BLKSIZE;
+f0103f0e:	8b 91 48 14 00 00    	mov    0x1448(%ecx),%edx
+f0103f14:	c1 ea 0c             	shr    $0xc,%edx
+	if (blockno >= ramdisk_nblocks())
+f0103f17:	39 d0                	cmp    %edx,%eax
+f0103f19:	73 15                	jae    f0103f30 <ramdisk_get_block+0x33>
+		return -E_INVAL;
+	*blk = rd_base + blockno * RAMDISK_BLKSIZE;
+f0103f1b:	c1 e0 0c             	shl    $0xc,%eax
+f0103f1e:	03 81 4c 14 00 00    	add    0x144c(%ecx),%eax
+f0103f24:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103f27:	89 02                	mov    %eax,(%edx)
+	return 0;
+f0103f29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103f2e:	5d                   	pop    %ebp
+f0103f2f:	c3                   	ret
+		return -E_INVAL;
+f0103f30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0103f35:	eb f7                	jmp    f0103f2e <ramdisk_get_block+0x31>
+
+f0103f37 <ramdisk_read>:
+
+// Read 'nsecs' sectors starting at 'secno' into 'dst', with the same
+// interface as the IDE driver's ide_read.
+int
+ramdisk_read(uint32_t secno, void *dst, size_t nsecs)
+{
+f0103f37:	55                   	push   %ebp
+f0103f38:	89 e5                	mov    %esp,%ebp
+f0103f3a:	53                   	push   %ebx
+f0103f3b:	83 ec 04             	sub    $0x4,%esp
+f0103f3e:	e8 96 c4 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0103f43:	81 c3 95 c4 01 00    	add    $0x1c495,%ebx
+f0103f49:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103f4c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	size_t nsect = rd_size / RAMDISK_SECTSIZE;
+f0103f4f:	8b 93 48 14 00 00    	mov    0x1448(%ebx),%edx
+f0103f55:	c1 ea 09             	shr    $0x9,%edx
+
+	if (secno > nsect || nsecs > nsect - secno)
+f0103f58:	39 c2                	cmp    %eax,%edx
+f0103f5a:	72 2c                	jb     f0103f88 <ramdisk_read+0x51>
+f0103f5c:	29 c2                	sub    %eax,%edx
+f0103f5e:	39 ca                	cmp    %ecx,%edx
+f0103f60:	72 2d                	jb     f0103f8f <ramdisk_read+0x58>
+		return -E_INVAL;
+	memcpy(dst, rd_base + secno * RAMDISK_SECTSIZE,
+f0103f62:	83 ec 04             	sub    $0x4,%esp
+f0103f65:	c1 e1 09             	shl    $0x9,%ecx
+f0103f68:	51                   	push   %ecx
+f0103f69:	c1 e0 09             	shl    $0x9,%eax
+f0103f6c:	03 83 4c 14 00 00    	add    0x144c(%ebx),%eax
+f0103f72:	50                   	push   %eax
+f0103f73:	ff 75 0c             	push   0xc(%ebp)
+f0103f76:	e8 30 14 00 00       	call   f01053ab <memcpy>
+	       nsecs * RAMDISK_SECTSIZE);
+	return 0;
+f0103f7b:	83 c4 10             	add    $0x10,%esp
+f0103f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103f83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103f86:	c9                   	leave
+f0103f87:	c3                   	ret
+		return -E_INVAL;
+f0103f88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0103f8d:	eb f4                	jmp    f0103f83 <ramdisk_read+0x4c>
+f0103f8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0103f94:	eb ed                	jmp    f0103f83 <ramdisk_read+0x4c>
+f0103f96:	66 90                	xchg   %ax,%ax
+
+f0103f98 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f0103f98:	fa                   	cli
+
+	xorw    %ax, %ax
+f0103f99:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f0103f9b:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0103f9d:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0103f9f:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0103fa1:	0f 01 16             	lgdtl  (%esi)
+f0103fa4:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+f0103fa5:	70 0f                	jo     f0103fb6 <mpentry_start+0x1e>
+	movl    %cr0, %eax
+f0103fa7:	20 c0                	and    %al,%al
+	orl     $CR0_PE, %eax
+f0103fa9:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f0103fad:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0103fb0:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0103fb6:	08 00                	or     %al,(%eax)
+
+f0103fb8 <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f0103fb8:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f0103fbc:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0103fbe:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0103fc0:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0103fc2:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f0103fc6:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f0103fc8:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.  entry_pgdir maps 4MB global
+	# pages, as in entry.S.
+	movl    $(RELOC(entry_pgdir)), %eax
+f0103fca:	b8 00 f0 11 00       	mov    $0x11f000,%eax
+	movl    %eax, %cr3
+f0103fcf:	0f 22 d8             	mov    %eax,%cr3
+	movl    $1, %eax
+f0103fd2:	b8 01 00 00 00       	mov    $0x1,%eax
+	cpuid
+f0103fd7:	0f a2                	cpuid
+	movl    %cr4, %eax
+f0103fd9:	0f 20 e0             	mov    %cr4,%eax
+	orl     $CR4_PSE, %eax
+f0103fdc:	83 c8 10             	or     $0x10,%eax
+	testl   $CPUID_PGE, %edx
+f0103fdf:	f7 c2 00 20 00 00    	test   $0x2000,%edx
+	jz      1f
+f0103fe5:	74 05                	je     f0103fec <start32+0x34>
+	orl     $CR4_PGE, %eax
+f0103fe7:	0d 80 00 00 00       	or     $0x80,%eax
+1:
+	movl    %eax, %cr4
+f0103fec:	0f 22 e0             	mov    %eax,%cr4
+	# Turn on paging.
+	movl    %cr0, %eax
+f0103fef:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f0103ff2:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f0103ff7:	0f 22 c0             	mov    %eax,%cr0
+
+	# Jump up to the kernel's own copy of this code, above KERNBASE,
+	# which kern_pgdir maps too.  Then switch to kern_pgdir: the
+	# per-cpu stacks below KSTACKTOP exist only there.
+	movl    $mpentry_high, %eax
+f0103ffa:	b8 01 40 10 f0       	mov    $0xf0104001,%eax
+	jmp     *%eax
+f0103fff:	ff e0                	jmp    *%eax
+
+f0104001 <mpentry_high>:
+mpentry_high:
+	movl    kern_pgdir, %eax
+f0104001:	a1 84 0e 12 f0       	mov    0xf0120e84,%eax
+	subl    $KERNBASE, %eax
+f0104006:	2d 00 00 00 f0       	sub    $0xf0000000,%eax
+	movl    %eax, %cr3
+f010400b:	0f 22 d8             	mov    %eax,%cr3
+
+	# Switch to the per-cpu stack allocated in mem_init_mp()
+	movl    mpentry_kstack, %esp
+f010400e:	8b 25 44 05 12 f0    	mov    0xf0120544,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f0104014:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f0104019:	b8 66 01 10 f0       	mov    $0xf0100166,%eax
+	call    *%eax
+f010401e:	ff d0                	call   *%eax
+
+f0104020 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f0104020:	eb fe                	jmp    f0104020 <spin>
+f0104022:	66 90                	xchg   %ax,%ax
+
+f0104024 <gdt>:
+	...
+f010402c:	ff                   	(bad)
+f010402d:	ff 00                	incl   (%eax)
+f010402f:	00 00                	add    %al,(%eax)
+f0104031:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f0104038:	00                   	.byte 0x0
+f0104039:	92                   	xchg   %eax,%edx
+f010403a:	cf                   	iret
+	...
+
+f010403c <gdtdesc>:
+f010403c:	17                   	pop    %ss
+f010403d:	00                   	.byte 0x0
+f010403e:	8c 70 00             	mov    %?,0x0(%eax)
+	...
+
+f0104042 <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f0104042:	90                   	nop
+
+f0104043 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f0104043:	55                   	push   %ebp
+f0104044:	89 e5                	mov    %esp,%ebp
+f0104046:	57                   	push   %edi
+f0104047:	56                   	push   %esi
+f0104048:	53                   	push   %ebx
+f0104049:	83 ec 1c             	sub    $0x1c,%esp
+f010404c:	e8 88 c3 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0104051:	81 c3 87 c3 01 00    	add    $0x1c387,%ebx
+f0104057:	89 c6                	mov    %eax,%esi
+f0104059:	89 d0                	mov    %edx,%eax
+	if (PGNUM(pa) >= npages)
+f010405b:	c7 c2 88 0e 12 f0    	mov    $0xf0120e88,%edx
+f0104061:	8b 12                	mov    (%edx),%edx
+f0104063:	89 f1                	mov    %esi,%ecx
+f0104065:	c1 e9 0c             	shr    $0xc,%ecx
+f0104068:	39 d1                	cmp    %edx,%ecx
+f010406a:	73 2a                	jae    f0104096 <mpsearch1+0x53>
+	return (void *)(pa + KERNBASE);
+f010406c:	8d be 00 00 00 f0    	lea    -0x10000000(%esi),%edi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f0104072:	01 f0                	add    %esi,%eax
+	if (PGNUM(pa) >= npages)
+f0104074:	89 c1                	mov    %eax,%ecx
+f0104076:	c1 e9 0c             	shr    $0xc,%ecx
+f0104079:	39 d1                	cmp    %edx,%ecx
+f010407b:	73 2f                	jae    f01040ac <mpsearch1+0x69>
+	return (void *)(pa + KERNBASE);
+f010407d:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0104082:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0104085:	81 ee f0 ff ff 0f    	sub    $0xffffff0,%esi
+
+	for (; mp < end; mp++)
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f010408b:	8d 83 d5 62 fe ff    	lea    -0x19d2b(%ebx),%eax
+f0104091:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (; mp < end; mp++)
+f0104094:	eb 42                	jmp    f01040d8 <mpsearch1+0x95>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0104096:	56                   	push   %esi
+f0104097:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f010409d:	50                   	push   %eax
+f010409e:	6a 53                	push   $0x53
+f01040a0:	8d 83 c5 62 fe ff    	lea    -0x19d3b(%ebx),%eax
+f01040a6:	50                   	push   %eax
+f01040a7:	e8 06 c1 ff ff       	call   f01001b2 <_panic>
+f01040ac:	50                   	push   %eax
+f01040ad:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01040b3:	50                   	push   %eax
+f01040b4:	6a 53                	push   $0x53
+f01040b6:	8d 83 c5 62 fe ff    	lea    -0x19d3b(%ebx),%eax
+f01040bc:	50                   	push   %eax
+f01040bd:	e8 f0 c0 ff ff       	call   f01001b2 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f01040c2:	0f b6 0a             	movzbl (%edx),%ecx
+f01040c5:	01 c8                	add    %ecx,%eax
+f01040c7:	83 c2 01             	add    $0x1,%edx
+	for (i = 0; i < len; i++)
+f01040ca:	39 f2                	cmp    %esi,%edx
+f01040cc:	75 f4                	jne    f01040c2 <mpsearch1+0x7f>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f01040ce:	84 c0                	test   %al,%al
+f01040d0:	74 2b                	je     f01040fd <mpsearch1+0xba>
+	for (; mp < end; mp++)
+f01040d2:	83 c7 10             	add    $0x10,%edi
+f01040d5:	83 c6 10             	add    $0x10,%esi
+f01040d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01040db:	39 c7                	cmp    %eax,%edi
+f01040dd:	73 19                	jae    f01040f8 <mpsearch1+0xb5>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f01040df:	83 ec 04             	sub    $0x4,%esp
+f01040e2:	6a 04                	push   $0x4
+f01040e4:	ff 75 e0             	push   -0x20(%ebp)
+f01040e7:	57                   	push   %edi
+f01040e8:	e8 d4 12 00 00       	call   f01053c1 <memcmp>
+f01040ed:	83 c4 10             	add    $0x10,%esp
+f01040f0:	89 fa                	mov    %edi,%edx
+f01040f2:	85 c0                	test   %eax,%eax
+f01040f4:	74 d4                	je     f01040ca <mpsearch1+0x87>
+f01040f6:	eb da                	jmp    f01040d2 <mpsearch1+0x8f>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f01040f8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+f01040fd:	89 f8                	mov    %edi,%eax
+f01040ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104102:	5b                   	pop    %ebx
+f0104103:	5e                   	pop    %esi
+f0104104:	5f                   	pop    %edi
+f0104105:	5d                   	pop    %ebp
+f0104106:	c3                   	ret
+
+f0104107 <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f0104107:	55                   	push   %ebp
+f0104108:	89 e5                	mov    %esp,%ebp
+f010410a:	57                   	push   %edi
+f010410b:	56                   	push   %esi
+f010410c:	53                   	push   %ebx
+f010410d:	83 ec 1c             	sub    $0x1c,%esp
+f0104110:	e8 c4 c2 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0104115:	81 c3 c3 c2 01 00    	add    $0x1c2c3,%ebx
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f010411b:	8d 83 a8 14 00 00    	lea    0x14a8(%ebx),%eax
+f0104121:	89 83 70 14 00 00    	mov    %eax,0x1470(%ebx)
+	if (PGNUM(pa) >= npages)
+f0104127:	c7 c0 88 0e 12 f0    	mov    $0xf0120e88,%eax
+f010412d:	83 38 00             	cmpl   $0x0,(%eax)
+f0104130:	0f 84 9b 00 00 00    	je     f01041d1 <mp_init+0xca>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f0104136:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f010413d:	85 c0                	test   %eax,%eax
+f010413f:	0f 84 a6 00 00 00    	je     f01041eb <mp_init+0xe4>
+		p <<= 4;	// Translate from segment to PA
+f0104145:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f0104148:	ba 00 04 00 00       	mov    $0x400,%edx
+f010414d:	e8 f1 fe ff ff       	call   f0104043 <mpsearch1>
+f0104152:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104155:	85 c0                	test   %eax,%eax
+f0104157:	75 1a                	jne    f0104173 <mp_init+0x6c>
+	return mpsearch1(0xF0000, 0x10000);
+f0104159:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010415e:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f0104163:	e8 db fe ff ff       	call   f0104043 <mpsearch1>
+f0104168:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if ((mp = mpsearch()) == 0)
+f010416b:	85 c0                	test   %eax,%eax
+f010416d:	0f 84 b3 00 00 00    	je     f0104226 <mp_init+0x11f>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f0104173:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104176:	8b 70 04             	mov    0x4(%eax),%esi
+f0104179:	85 f6                	test   %esi,%esi
+f010417b:	0f 84 93 00 00 00    	je     f0104214 <mp_init+0x10d>
+f0104181:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f0104185:	0f 85 89 00 00 00    	jne    f0104214 <mp_init+0x10d>
+f010418b:	89 f2                	mov    %esi,%edx
+f010418d:	c1 ea 0c             	shr    $0xc,%edx
+f0104190:	c7 c0 88 0e 12 f0    	mov    $0xf0120e88,%eax
+f0104196:	3b 10                	cmp    (%eax),%edx
+f0104198:	0f 83 a4 00 00 00    	jae    f0104242 <mp_init+0x13b>
+	return (void *)(pa + KERNBASE);
+f010419e:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+f01041a4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f01041a7:	83 ec 04             	sub    $0x4,%esp
+f01041aa:	6a 04                	push   $0x4
+f01041ac:	8d 83 da 62 fe ff    	lea    -0x19d26(%ebx),%eax
+f01041b2:	50                   	push   %eax
+f01041b3:	56                   	push   %esi
+f01041b4:	e8 08 12 00 00       	call   f01053c1 <memcmp>
+f01041b9:	83 c4 10             	add    $0x10,%esp
+f01041bc:	85 c0                	test   %eax,%eax
+f01041be:	0f 85 97 00 00 00    	jne    f010425b <mp_init+0x154>
+f01041c4:	0f b7 7e 04          	movzwl 0x4(%esi),%edi
+f01041c8:	01 f7                	add    %esi,%edi
+	sum = 0;
+f01041ca:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f01041cc:	e9 a6 00 00 00       	jmp    f0104277 <mp_init+0x170>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01041d1:	68 00 04 00 00       	push   $0x400
+f01041d6:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f01041dc:	50                   	push   %eax
+f01041dd:	6a 6b                	push   $0x6b
+f01041df:	8d 83 c5 62 fe ff    	lea    -0x19d3b(%ebx),%eax
+f01041e5:	50                   	push   %eax
+f01041e6:	e8 c7 bf ff ff       	call   f01001b2 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f01041eb:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f01041f2:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f01041f5:	2d 00 04 00 00       	sub    $0x400,%eax
+f01041fa:	ba 00 04 00 00       	mov    $0x400,%edx
+f01041ff:	e8 3f fe ff ff       	call   f0104043 <mpsearch1>
+f0104204:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104207:	85 c0                	test   %eax,%eax
+f0104209:	0f 85 64 ff ff ff    	jne    f0104173 <mp_init+0x6c>
+f010420f:	e9 45 ff ff ff       	jmp    f0104159 <mp_init+0x52>
+		cprintf("SMP: Default configurations not implemented\n");
+f0104214:	83 ec 0c             	sub    $0xc,%esp
+f0104217:	8d 83 38 61 fe ff    	lea    -0x19ec8(%ebx),%eax
+f010421d:	50                   	push   %eax
+f010421e:	e8 c1 f7 ff ff       	call   f01039e4 <cprintf>
+		return NULL;
+f0104223:	83 c4 10             	add    $0x10,%esp
+	if ((conf = mpconfig(&mp)) == 0) {
+		// No MP tables: this is a uniprocessor.
+		ncpu = 1;
+f0104226:	c7 83 68 14 00 00 01 	movl   $0x1,0x1468(%ebx)
+f010422d:	00 00 00 
+		bootcpu->cpu_status = CPU_STARTED;
+f0104230:	8b 83 70 14 00 00    	mov    0x1470(%ebx),%eax
+f0104236:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+		return;
+f010423d:	e9 c9 01 00 00       	jmp    f010440b <mp_init+0x304>
+f0104242:	56                   	push   %esi
+f0104243:	8d 83 30 53 fe ff    	lea    -0x1acd0(%ebx),%eax
+f0104249:	50                   	push   %eax
+f010424a:	68 8c 00 00 00       	push   $0x8c
+f010424f:	8d 83 c5 62 fe ff    	lea    -0x19d3b(%ebx),%eax
+f0104255:	50                   	push   %eax
+f0104256:	e8 57 bf ff ff       	call   f01001b2 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f010425b:	83 ec 0c             	sub    $0xc,%esp
+f010425e:	8d 83 68 61 fe ff    	lea    -0x19e98(%ebx),%eax
+f0104264:	50                   	push   %eax
+f0104265:	e8 7a f7 ff ff       	call   f01039e4 <cprintf>
+		return NULL;
+f010426a:	83 c4 10             	add    $0x10,%esp
+f010426d:	eb b7                	jmp    f0104226 <mp_init+0x11f>
+		sum += ((uint8_t *)addr)[i];
+f010426f:	0f b6 0e             	movzbl (%esi),%ecx
+f0104272:	01 ca                	add    %ecx,%edx
+f0104274:	83 c6 01             	add    $0x1,%esi
+	for (i = 0; i < len; i++)
+f0104277:	39 fe                	cmp    %edi,%esi
+f0104279:	75 f4                	jne    f010426f <mp_init+0x168>
+	if (sum(conf, conf->length) != 0) {
+f010427b:	84 d2                	test   %dl,%dl
+f010427d:	75 1c                	jne    f010429b <mp_init+0x194>
+	if (conf->version != 1 && conf->version != 4) {
+f010427f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0104282:	0f b6 57 06          	movzbl 0x6(%edi),%edx
+f0104286:	80 fa 01             	cmp    $0x1,%dl
+f0104289:	74 05                	je     f0104290 <mp_init+0x189>
+f010428b:	80 fa 04             	cmp    $0x4,%dl
+f010428e:	75 22                	jne    f01042b2 <mp_init+0x1ab>
+f0104290:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0104293:	0f b7 4f 28          	movzwl 0x28(%edi),%ecx
+f0104297:	01 f1                	add    %esi,%ecx
+	for (i = 0; i < len; i++)
+f0104299:	eb 3a                	jmp    f01042d5 <mp_init+0x1ce>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f010429b:	83 ec 0c             	sub    $0xc,%esp
+f010429e:	8d 83 9c 61 fe ff    	lea    -0x19e64(%ebx),%eax
+f01042a4:	50                   	push   %eax
+f01042a5:	e8 3a f7 ff ff       	call   f01039e4 <cprintf>
+		return NULL;
+f01042aa:	83 c4 10             	add    $0x10,%esp
+f01042ad:	e9 74 ff ff ff       	jmp    f0104226 <mp_init+0x11f>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f01042b2:	83 ec 08             	sub    $0x8,%esp
+f01042b5:	0f b6 d2             	movzbl %dl,%edx
+f01042b8:	52                   	push   %edx
+f01042b9:	8d 83 c0 61 fe ff    	lea    -0x19e40(%ebx),%eax
+f01042bf:	50                   	push   %eax
+f01042c0:	e8 1f f7 ff ff       	call   f01039e4 <cprintf>
+		return NULL;
+f01042c5:	83 c4 10             	add    $0x10,%esp
+f01042c8:	e9 59 ff ff ff       	jmp    f0104226 <mp_init+0x11f>
+		sum += ((uint8_t *)addr)[i];
+f01042cd:	0f b6 16             	movzbl (%esi),%edx
+f01042d0:	01 d0                	add    %edx,%eax
+f01042d2:	83 c6 01             	add    $0x1,%esi
+	for (i = 0; i < len; i++)
+f01042d5:	39 f1                	cmp    %esi,%ecx
+f01042d7:	75 f4                	jne    f01042cd <mp_init+0x1c6>
+	if ((sum((uint8_t *)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f01042d9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01042dc:	02 41 2a             	add    0x2a(%ecx),%al
+f01042df:	75 34                	jne    f0104315 <mp_init+0x20e>
+	}
+	ismp = 1;
+f01042e1:	c7 83 6c 14 00 00 01 	movl   $0x1,0x146c(%ebx)
+f01042e8:	00 00 00 
+	lapicaddr = conf->lapicaddr;
+f01042eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01042ee:	8b 51 24             	mov    0x24(%ecx),%edx
+f01042f1:	c7 c0 84 1a 12 f0    	mov    $0xf0121a84,%eax
+f01042f7:	89 10                	mov    %edx,(%eax)
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01042f9:	8d 79 2c             	lea    0x2c(%ecx),%edi
+f01042fc:	be 00 00 00 00       	mov    $0x0,%esi
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+				bootcpu = &cpus[ncpu];
+			if (ncpu < NCPU) {
+				cpus[ncpu].cpu_id = ncpu;
+f0104301:	8d 05 a8 14 00 00    	lea    0x14a8,%eax
+f0104307:	89 45 dc             	mov    %eax,-0x24(%ebp)
+				bootcpu = &cpus[ncpu];
+f010430a:	8d 83 a8 14 00 00    	lea    0x14a8(%ebx),%eax
+f0104310:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0104313:	eb 59                	jmp    f010436e <mp_init+0x267>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f0104315:	83 ec 0c             	sub    $0xc,%esp
+f0104318:	8d 83 e0 61 fe ff    	lea    -0x19e20(%ebx),%eax
+f010431e:	50                   	push   %eax
+f010431f:	e8 c0 f6 ff ff       	call   f01039e4 <cprintf>
+		return NULL;
+f0104324:	83 c4 10             	add    $0x10,%esp
+f0104327:	e9 fa fe ff ff       	jmp    f0104226 <mp_init+0x11f>
+			if (proc->flags & MPPROC_BOOT)
+f010432c:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f0104330:	74 14                	je     f0104346 <mp_init+0x23f>
+				bootcpu = &cpus[ncpu];
+f0104332:	8b 83 68 14 00 00    	mov    0x1468(%ebx),%eax
+f0104338:	c1 e0 06             	shl    $0x6,%eax
+f010433b:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010433e:	01 c8                	add    %ecx,%eax
+f0104340:	89 83 70 14 00 00    	mov    %eax,0x1470(%ebx)
+			if (ncpu < NCPU) {
+f0104346:	8b 83 68 14 00 00    	mov    0x1468(%ebx),%eax
+f010434c:	83 f8 07             	cmp    $0x7,%eax
+f010434f:	7f 3c                	jg     f010438d <mp_init+0x286>
+				cpus[ncpu].cpu_id = ncpu;
+f0104351:	89 c2                	mov    %eax,%edx
+f0104353:	c1 e2 06             	shl    $0x6,%edx
+f0104356:	01 da                	add    %ebx,%edx
+f0104358:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010435b:	88 44 11 04          	mov    %al,0x4(%ecx,%edx,1)
+				ncpu++;
+f010435f:	83 c0 01             	add    $0x1,%eax
+f0104362:	89 83 68 14 00 00    	mov    %eax,0x1468(%ebx)
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f0104368:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f010436b:	83 c6 01             	add    $0x1,%esi
+f010436e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0104371:	0f b7 40 22          	movzwl 0x22(%eax),%eax
+f0104375:	39 c6                	cmp    %eax,%esi
+f0104377:	73 56                	jae    f01043cf <mp_init+0x2c8>
+		switch (*p) {
+f0104379:	0f b6 07             	movzbl (%edi),%eax
+f010437c:	84 c0                	test   %al,%al
+f010437e:	74 ac                	je     f010432c <mp_init+0x225>
+f0104380:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0104383:	80 fa 03             	cmp    $0x3,%dl
+f0104386:	77 1e                	ja     f01043a6 <mp_init+0x29f>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f0104388:	83 c7 08             	add    $0x8,%edi
+			continue;
+f010438b:	eb de                	jmp    f010436b <mp_init+0x264>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f010438d:	83 ec 08             	sub    $0x8,%esp
+f0104390:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0104394:	50                   	push   %eax
+f0104395:	8d 83 10 62 fe ff    	lea    -0x19df0(%ebx),%eax
+f010439b:	50                   	push   %eax
+f010439c:	e8 43 f6 ff ff       	call   f01039e4 <cprintf>
+f01043a1:	83 c4 10             	add    $0x10,%esp
+f01043a4:	eb c2                	jmp    f0104368 <mp_init+0x261>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f01043a6:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f01043a9:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f01043ac:	50                   	push   %eax
+f01043ad:	8d 83 38 62 fe ff    	lea    -0x19dc8(%ebx),%eax
+f01043b3:	50                   	push   %eax
+f01043b4:	e8 2b f6 ff ff       	call   f01039e4 <cprintf>
+			ismp = 0;
+f01043b9:	c7 83 6c 14 00 00 00 	movl   $0x0,0x146c(%ebx)
+f01043c0:	00 00 00 
+			i = conf->entry;
+f01043c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01043c6:	0f b7 70 22          	movzwl 0x22(%eax),%esi
+f01043ca:	83 c4 10             	add    $0x10,%esp
+f01043cd:	eb 9c                	jmp    f010436b <mp_init+0x264>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f01043cf:	8b 83 70 14 00 00    	mov    0x1470(%ebx),%eax
+f01043d5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	if (!ismp) {
+f01043dc:	83 bb 6c 14 00 00 00 	cmpl   $0x0,0x146c(%ebx)
+f01043e3:	74 2e                	je     f0104413 <mp_init+0x30c>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f01043e5:	83 ec 04             	sub    $0x4,%esp
+f01043e8:	ff b3 68 14 00 00    	push   0x1468(%ebx)
+f01043ee:	0f b6 40 04          	movzbl 0x4(%eax),%eax
+f01043f2:	50                   	push   %eax
+f01043f3:	8d 83 df 62 fe ff    	lea    -0x19d21(%ebx),%eax
+f01043f9:	50                   	push   %eax
+f01043fa:	e8 e5 f5 ff ff       	call   f01039e4 <cprintf>
+
+	if (mp->imcrp) {
+f01043ff:	83 c4 10             	add    $0x10,%esp
+f0104402:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104405:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f0104409:	75 32                	jne    f010443d <mp_init+0x336>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f010440b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010440e:	5b                   	pop    %ebx
+f010440f:	5e                   	pop    %esi
+f0104410:	5f                   	pop    %edi
+f0104411:	5d                   	pop    %ebp
+f0104412:	c3                   	ret
+		ncpu = 1;
+f0104413:	c7 83 68 14 00 00 01 	movl   $0x1,0x1468(%ebx)
+f010441a:	00 00 00 
+		lapicaddr = 0;
+f010441d:	c7 c0 84 1a 12 f0    	mov    $0xf0121a84,%eax
+f0104423:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f0104429:	83 ec 0c             	sub    $0xc,%esp
+f010442c:	8d 83 58 62 fe ff    	lea    -0x19da8(%ebx),%eax
+f0104432:	50                   	push   %eax
+f0104433:	e8 ac f5 ff ff       	call   f01039e4 <cprintf>
+		return;
+f0104438:	83 c4 10             	add    $0x10,%esp
+f010443b:	eb ce                	jmp    f010440b <mp_init+0x304>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f010443d:	83 ec 0c             	sub    $0xc,%esp
+f0104440:	8d 83 84 62 fe ff    	lea    -0x19d7c(%ebx),%eax
+f0104446:	50                   	push   %eax
+f0104447:	e8 98 f5 ff ff       	call   f01039e4 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010444c:	b8 70 00 00 00       	mov    $0x70,%eax
+f0104451:	ba 22 00 00 00       	mov    $0x22,%edx
+f0104456:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0104457:	ba 23 00 00 00       	mov    $0x23,%edx
+f010445c:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f010445d:	83 c8 01             	or     $0x1,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104460:	ee                   	out    %al,(%dx)
+}
+f0104461:	83 c4 10             	add    $0x10,%esp
+f0104464:	eb a5                	jmp    f010440b <mp_init+0x304>
+
+f0104466 <lapicw>:
+physaddr_t lapicaddr;        // Initialized in mpconfig.c
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+f0104466:	55                   	push   %ebp
+f0104467:	89 e5                	mov    %esp,%ebp
+f0104469:	53                   	push   %ebx
+f010446a:	e8 ba cc ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f010446f:	81 c1 69 bf 01 00    	add    $0x1bf69,%ecx
+f0104475:	89 c3                	mov    %eax,%ebx
+	lapic[index] = value;
+f0104477:	8b 81 a8 16 00 00    	mov    0x16a8(%ecx),%eax
+f010447d:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+f0104480:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f0104482:	8b 81 a8 16 00 00    	mov    0x16a8(%ecx),%eax
+f0104488:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f010448b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010448e:	c9                   	leave
+f010448f:	c3                   	ret
+
+f0104490 <lapic_init>:
+
+void
+lapic_init(void)
+{
+f0104490:	55                   	push   %ebp
+f0104491:	89 e5                	mov    %esp,%ebp
+f0104493:	53                   	push   %ebx
+f0104494:	83 ec 04             	sub    $0x4,%esp
+f0104497:	e8 3d bf ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f010449c:	81 c3 3c bf 01 00    	add    $0x1bf3c,%ebx
+	if (!lapicaddr)
+f01044a2:	8b 83 ac 16 00 00    	mov    0x16ac(%ebx),%eax
+f01044a8:	85 c0                	test   %eax,%eax
+f01044aa:	0f 84 e7 00 00 00    	je     f0104597 <lapic_init+0x107>
+
+	// lapicaddr is the physical address of the LAPIC's 4K MMIO
+	// region.  Map it in to virtual memory so we can access it.
+	// All CPUs' LAPICs appear at the same address, so the boot CPU
+	// maps it once for everyone.
+	if (!lapic)
+f01044b0:	83 bb a8 16 00 00 00 	cmpl   $0x0,0x16a8(%ebx)
+f01044b7:	0f 84 df 00 00 00    	je     f010459c <lapic_init+0x10c>
+		lapic = mmio_map_region(lapicaddr, 4096);
+
+	// Enable local APIC; set spurious interrupt vector.
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f01044bd:	ba 27 01 00 00       	mov    $0x127,%edx
+f01044c2:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f01044c7:	e8 9a ff ff ff       	call   f0104466 <lapicw>
+
+	// No timer interrupts until there is a trap handler for them.
+	lapicw(TIMER, MASKED);
+f01044cc:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01044d1:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f01044d6:	e8 8b ff ff ff       	call   f0104466 <lapicw>
+
+	// Leave LINT0 of the BSP enabled so that it can get
+	// interrupts from the 8259A chip.
+	if (thiscpu != bootcpu)
+f01044db:	64 a1 00 00 00 00    	mov    %fs:0x0,%eax
+f01044e1:	c7 c2 48 18 12 f0    	mov    $0xf0121848,%edx
+f01044e7:	39 02                	cmp    %eax,(%edx)
+f01044e9:	74 0f                	je     f01044fa <lapic_init+0x6a>
+		lapicw(LINT0, MASKED);
+f01044eb:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01044f0:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f01044f5:	e8 6c ff ff ff       	call   f0104466 <lapicw>
+
+	// Disable NMI (LINT1) on all CPUs
+	lapicw(LINT1, MASKED);
+f01044fa:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01044ff:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0104504:	e8 5d ff ff ff       	call   f0104466 <lapicw>
+
+	// Disable performance counter overflow interrupts
+	// on machines that provide that interrupt entry.
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f0104509:	8b 83 a8 16 00 00    	mov    0x16a8(%ebx),%eax
+f010450f:	8b 40 30             	mov    0x30(%eax),%eax
+f0104512:	c1 e8 10             	shr    $0x10,%eax
+f0104515:	a8 fc                	test   $0xfc,%al
+f0104517:	0f 85 9b 00 00 00    	jne    f01045b8 <lapic_init+0x128>
+		lapicw(PCINT, MASKED);
+
+	// No error interrupts either.
+	lapicw(ERROR, MASKED);
+f010451d:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0104522:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f0104527:	e8 3a ff ff ff       	call   f0104466 <lapicw>
+
+	// Clear error status register (requires back-to-back writes).
+	lapicw(ESR, 0);
+f010452c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104531:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0104536:	e8 2b ff ff ff       	call   f0104466 <lapicw>
+	lapicw(ESR, 0);
+f010453b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104540:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0104545:	e8 1c ff ff ff       	call   f0104466 <lapicw>
+
+	// Ack any outstanding interrupts.
+	lapicw(EOI, 0);
+f010454a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010454f:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0104554:	e8 0d ff ff ff       	call   f0104466 <lapicw>
+
+	// Send an Init Level De-Assert to synchronize arbitration ID's.
+	lapicw(ICRHI, 0);
+f0104559:	ba 00 00 00 00       	mov    $0x0,%edx
+f010455e:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0104563:	e8 fe fe ff ff       	call   f0104466 <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f0104568:	ba 00 85 08 00       	mov    $0x88500,%edx
+f010456d:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0104572:	e8 ef fe ff ff       	call   f0104466 <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f0104577:	8b 93 a8 16 00 00    	mov    0x16a8(%ebx),%edx
+f010457d:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0104583:	f6 c4 10             	test   $0x10,%ah
+f0104586:	75 f5                	jne    f010457d <lapic_init+0xed>
+		;
+
+	// Enable interrupts on the APIC (but not on the processor).
+	lapicw(TPR, 0);
+f0104588:	ba 00 00 00 00       	mov    $0x0,%edx
+f010458d:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104592:	e8 cf fe ff ff       	call   f0104466 <lapicw>
+}
+f0104597:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010459a:	c9                   	leave
+f010459b:	c3                   	ret
+		lapic = mmio_map_region(lapicaddr, 4096);
+f010459c:	83 ec 08             	sub    $0x8,%esp
+f010459f:	68 00 10 00 00       	push   $0x1000
+f01045a4:	50                   	push   %eax
+f01045a5:	e8 dd e7 ff ff       	call   f0102d87 <mmio_map_region>
+f01045aa:	89 83 a8 16 00 00    	mov    %eax,0x16a8(%ebx)
+f01045b0:	83 c4 10             	add    $0x10,%esp
+f01045b3:	e9 05 ff ff ff       	jmp    f01044bd <lapic_init+0x2d>
+		lapicw(PCINT, MASKED);
+f01045b8:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01045bd:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f01045c2:	e8 9f fe ff ff       	call   f0104466 <lapicw>
+f01045c7:	e9 51 ff ff ff       	jmp    f010451d <lapic_init+0x8d>
+
+f01045cc <cpunum>:
+
+int
+cpunum(void)
+{
+f01045cc:	e8 54 cb ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f01045d1:	05 07 be 01 00       	add    $0x1be07,%eax
+	if (lapic)
+f01045d6:	8b 90 a8 16 00 00    	mov    0x16a8(%eax),%edx
+		return lapic[ID] >> 24;
+	return 0;
+f01045dc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f01045e1:	85 d2                	test   %edx,%edx
+f01045e3:	74 06                	je     f01045eb <cpunum+0x1f>
+		return lapic[ID] >> 24;
+f01045e5:	8b 42 20             	mov    0x20(%edx),%eax
+f01045e8:	c1 e8 18             	shr    $0x18,%eax
+}
+f01045eb:	c3                   	ret
+
+f01045ec <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+f01045ec:	e8 34 cb ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f01045f1:	05 e7 bd 01 00       	add    $0x1bde7,%eax
+	if (lapic)
+f01045f6:	83 b8 a8 16 00 00 00 	cmpl   $0x0,0x16a8(%eax)
+f01045fd:	74 17                	je     f0104616 <lapic_eoi+0x2a>
+{
+f01045ff:	55                   	push   %ebp
+f0104600:	89 e5                	mov    %esp,%ebp
+f0104602:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f0104605:	ba 00 00 00 00       	mov    $0x0,%edx
+f010460a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010460f:	e8 52 fe ff ff       	call   f0104466 <lapicw>
+}
+f0104614:	c9                   	leave
+f0104615:	c3                   	ret
+f0104616:	c3                   	ret
+
+f0104617 <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f0104617:	55                   	push   %ebp
+f0104618:	89 e5                	mov    %esp,%ebp
+f010461a:	56                   	push   %esi
+f010461b:	53                   	push   %ebx
+f010461c:	e8 08 cb ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f0104621:	81 c1 b7 bd 01 00    	add    $0x1bdb7,%ecx
+f0104627:	8b 75 08             	mov    0x8(%ebp),%esi
+f010462a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010462d:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0104632:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104637:	ee                   	out    %al,(%dx)
+f0104638:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010463d:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104642:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f0104643:	c7 c0 88 0e 12 f0    	mov    $0xf0120e88,%eax
+f0104649:	83 38 00             	cmpl   $0x0,(%eax)
+f010464c:	74 7e                	je     f01046cc <lapic_startap+0xb5>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f010464e:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0104655:	00 00 
+	wrv[1] = addr >> 4;
+f0104657:	89 d8                	mov    %ebx,%eax
+f0104659:	c1 e8 04             	shr    $0x4,%eax
+f010465c:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f0104662:	c1 e6 18             	shl    $0x18,%esi
+f0104665:	89 f2                	mov    %esi,%edx
+f0104667:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010466c:	e8 f5 fd ff ff       	call   f0104466 <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f0104671:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f0104676:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010467b:	e8 e6 fd ff ff       	call   f0104466 <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f0104680:	ba 00 85 00 00       	mov    $0x8500,%edx
+f0104685:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010468a:	e8 d7 fd ff ff       	call   f0104466 <lapicw>
+	// state due to an INIT.  So the second should be ignored, but it is part
+	// of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f010468f:	c1 eb 0c             	shr    $0xc,%ebx
+f0104692:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f0104695:	89 f2                	mov    %esi,%edx
+f0104697:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010469c:	e8 c5 fd ff ff       	call   f0104466 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01046a1:	89 da                	mov    %ebx,%edx
+f01046a3:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01046a8:	e8 b9 fd ff ff       	call   f0104466 <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f01046ad:	89 f2                	mov    %esi,%edx
+f01046af:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01046b4:	e8 ad fd ff ff       	call   f0104466 <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01046b9:	89 da                	mov    %ebx,%edx
+f01046bb:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01046c0:	e8 a1 fd ff ff       	call   f0104466 <lapicw>
+		microdelay(200);
+	}
+}
+f01046c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01046c8:	5b                   	pop    %ebx
+f01046c9:	5e                   	pop    %esi
+f01046ca:	5d                   	pop    %ebp
+f01046cb:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01046cc:	68 67 04 00 00       	push   $0x467
+f01046d1:	8d 81 30 53 fe ff    	lea    -0x1acd0(%ecx),%eax
+f01046d7:	50                   	push   %eax
+f01046d8:	68 8e 00 00 00       	push   $0x8e
+f01046dd:	8d 81 fc 62 fe ff    	lea    -0x19d04(%ecx),%eax
+f01046e3:	50                   	push   %eax
+f01046e4:	89 cb                	mov    %ecx,%ebx
+f01046e6:	e8 c7 ba ff ff       	call   f01001b2 <_panic>
+
+f01046eb <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f01046eb:	55                   	push   %ebp
+f01046ec:	89 e5                	mov    %esp,%ebp
+f01046ee:	53                   	push   %ebx
+f01046ef:	83 ec 04             	sub    $0x4,%esp
+f01046f2:	e8 e2 bc ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f01046f7:	81 c3 e1 bc 01 00    	add    $0x1bce1,%ebx
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f01046fd:	8b 55 08             	mov    0x8(%ebp),%edx
+f0104700:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f0104706:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010470b:	e8 56 fd ff ff       	call   f0104466 <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f0104710:	8b 93 a8 16 00 00    	mov    0x16a8(%ebx),%edx
+f0104716:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010471c:	f6 c4 10             	test   $0x10,%ah
+f010471f:	75 f5                	jne    f0104716 <lapic_ipi+0x2b>
+		;
+}
+f0104721:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104724:	c9                   	leave
+f0104725:	c3                   	ret
+
+f0104726 <percpu_init>:
+// The boot CPU calls it before the LAPIC is mapped, while cpunum() is
+// still 0.
+//
+void
+percpu_init(void)
+{
+f0104726:	55                   	push   %ebp
+f0104727:	89 e5                	mov    %esp,%ebp
+f0104729:	57                   	push   %edi
+f010472a:	56                   	push   %esi
+f010472b:	53                   	push   %ebx
+f010472c:	83 ec 1c             	sub    $0x1c,%esp
+f010472f:	e8 a5 bc ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0104734:	81 c3 a4 bc 01 00    	add    $0x1bca4,%ebx
+	struct CpuInfo *c = &cpus[cpunum()];
+f010473a:	e8 8d fe ff ff       	call   f01045cc <cpunum>
+f010473f:	c1 e0 06             	shl    $0x6,%eax
+f0104742:	89 c2                	mov    %eax,%edx
+f0104744:	89 c1                	mov    %eax,%ecx
+f0104746:	81 c1 80 18 12 f0    	add    $0xf0121880,%ecx
+	uint16_t sel = GD_KCPU0 + ((c - cpus) << 3);
+f010474c:	c1 fa 06             	sar    $0x6,%edx
+f010474f:	8d 04 d5 68 00 00 00 	lea    0x68(,%edx,8),%eax
+
+	static_assert(GD_KCPU0 == GD_TSS0 + (NCPU << 3));
+
+	c->cpu_self = c;
+f0104756:	89 09                	mov    %ecx,(%ecx)
+	// A byte-granular 32-bit data segment exactly covering 'c'.
+	gdt[sel >> 3] = SEG16(STA_W, (uint32_t) c, sizeof(*c) - 1, 0);
+f0104758:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+f010475c:	66 c1 e8 03          	shr    $0x3,%ax
+f0104760:	0f b7 c0             	movzwl %ax,%eax
+f0104763:	66 c7 84 c3 48 ff ff 	movw   $0x3f,-0xb8(%ebx,%eax,8)
+f010476a:	ff 3f 00 
+f010476d:	8d b4 c3 48 ff ff ff 	lea    -0xb8(%ebx,%eax,8),%esi
+f0104774:	66 89 4e 02          	mov    %cx,0x2(%esi)
+f0104778:	89 cf                	mov    %ecx,%edi
+f010477a:	c1 ef 10             	shr    $0x10,%edi
+f010477d:	89 fa                	mov    %edi,%edx
+f010477f:	88 56 04             	mov    %dl,0x4(%esi)
+f0104782:	c6 84 c3 4d ff ff ff 	movb   $0x92,-0xb3(%ebx,%eax,8)
+f0104789:	92 
+f010478a:	80 a4 c3 4e ff ff ff 	andb   $0x40,-0xb2(%ebx,%eax,8)
+f0104791:	40 
+f0104792:	c1 e9 18             	shr    $0x18,%ecx
+f0104795:	88 4e 07             	mov    %cl,0x7(%esi)
+	gdt[sel >> 3].sd_db = 1;
+f0104798:	80 8c c3 4e ff ff ff 	orb    $0x40,-0xb2(%ebx,%eax,8)
+f010479f:	40 
+	asm volatile("lgdt (%0)" : : "r" (p));
+f01047a0:	8d 83 60 00 00 00    	lea    0x60(%ebx),%eax
+f01047a6:	0f 01 10             	lgdtl  (%eax)
+
+	lgdt(&gdt_pd);
+	// The kernel never uses GS.
+	asm volatile("movw %%ax,%%gs" : : "a" (0));
+f01047a9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01047ae:	8e e8                	mov    %eax,%gs
+	// The kernel does use ES, DS, and SS.  We'll change between
+	// the kernel and user data segments as needed.
+	asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+f01047b0:	b8 10 00 00 00       	mov    $0x10,%eax
+f01047b5:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+f01047b7:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+f01047b9:	8e d0                	mov    %eax,%ss
+	// Load the kernel text segment into CS.
+	asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+f01047bb:	ea c2 47 10 f0 08 00 	ljmp   $0x8,$0xf01047c2
+	// And this CPU's per-CPU segment into FS.
+	asm volatile("movw %%ax,%%fs" : : "a" (sel));
+f01047c2:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+f01047c6:	8e e0                	mov    %eax,%fs
+}
+f01047c8:	83 c4 1c             	add    $0x1c,%esp
+f01047cb:	5b                   	pop    %ebx
+f01047cc:	5e                   	pop    %esi
+f01047cd:	5f                   	pop    %edi
+f01047ce:	5d                   	pop    %ebp
+f01047cf:	c3                   	ret
+
+f01047d0 <spin_holding>:
+#endif
+
+// Check whether this CPU is holding the lock.
+int
+spin_holding(struct spinlock *lk)
+{
+f01047d0:	55                   	push   %ebp
+f01047d1:	89 e5                	mov    %esp,%ebp
+f01047d3:	53                   	push   %ebx
+f01047d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	return lk->owner != lk->next && lk->cpu == thiscpu;
+f01047d7:	8b 58 04             	mov    0x4(%eax),%ebx
+f01047da:	8b 08                	mov    (%eax),%ecx
+f01047dc:	ba 00 00 00 00       	mov    $0x0,%edx
+f01047e1:	39 cb                	cmp    %ecx,%ebx
+f01047e3:	74 10                	je     f01047f5 <spin_holding+0x25>
+f01047e5:	64 8b 15 00 00 00 00 	mov    %fs:0x0,%edx
+f01047ec:	39 50 0c             	cmp    %edx,0xc(%eax)
+f01047ef:	0f 94 c2             	sete   %dl
+f01047f2:	0f b6 d2             	movzbl %dl,%edx
+}
+f01047f5:	89 d0                	mov    %edx,%eax
+f01047f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01047fa:	c9                   	leave
+f01047fb:	c3                   	ret
+
+f01047fc <__spin_initlock>:
+
+void
+__spin_initlock(struct spinlock *lk, const char *name)
+{
+f01047fc:	55                   	push   %ebp
+f01047fd:	89 e5                	mov    %esp,%ebp
+f01047ff:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->next = 0;
+f0104802:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	lk->owner = 0;
+f0104808:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	lk->name = name;
+f010480f:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0104812:	89 50 08             	mov    %edx,0x8(%eax)
+	lk->cpu = NULL;
+f0104815:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+#ifdef LOCK_STATS
+	stats_init(&lk->stats, name);
+#endif
+}
+f010481c:	5d                   	pop    %ebp
+f010481d:	c3                   	ret
+
+f010481e <spin_lock>:
+// Loops (spins) until our ticket comes up.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f010481e:	55                   	push   %ebp
+f010481f:	89 e5                	mov    %esp,%ebp
+f0104821:	57                   	push   %edi
+f0104822:	56                   	push   %esi
+f0104823:	53                   	push   %ebx
+f0104824:	83 ec 18             	sub    $0x18,%esp
+f0104827:	e8 01 c9 ff ff       	call   f010112d <__x86.get_pc_thunk.si>
+f010482c:	81 c6 ac bb 01 00    	add    $0x1bbac,%esi
+f0104832:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	bool waited;
+#ifdef LOCK_STATS
+	uint64_t t0 = read_tsc();
+#endif
+
+	if (spin_holding(lk))
+f0104835:	53                   	push   %ebx
+f0104836:	e8 95 ff ff ff       	call   f01047d0 <spin_holding>
+f010483b:	83 c4 10             	add    $0x10,%esp
+f010483e:	85 c0                	test   %eax,%eax
+f0104840:	75 0e                	jne    f0104850 <spin_lock+0x32>
+
+// Atomically add 'inc' to *addr and return the old value.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %1, %0"
+f0104842:	ba 01 00 00 00       	mov    $0x1,%edx
+f0104847:	f0 0f c1 13          	lock xadd %edx,(%ebx)
+
+	// The lock xaddl hands out tickets atomically, and the loads of
+	// 'owner' cannot pass it, so the critical section cannot start
+	// before our turn.
+	ticket = xadd(&lk->next, 1);
+	waited = lk->owner != ticket;
+f010484b:	8b 43 04             	mov    0x4(%ebx),%eax
+	while (lk->owner != ticket)
+f010484e:	eb 26                	jmp    f0104876 <spin_lock+0x58>
+		panic("CPU %d cannot acquire %s: already holding",
+f0104850:	8b 7b 08             	mov    0x8(%ebx),%edi
+f0104853:	89 f3                	mov    %esi,%ebx
+f0104855:	e8 72 fd ff ff       	call   f01045cc <cpunum>
+f010485a:	83 ec 0c             	sub    $0xc,%esp
+f010485d:	57                   	push   %edi
+f010485e:	50                   	push   %eax
+f010485f:	8d 86 0c 63 fe ff    	lea    -0x19cf4(%esi),%eax
+f0104865:	50                   	push   %eax
+f0104866:	6a 56                	push   $0x56
+f0104868:	8d 86 9b 63 fe ff    	lea    -0x19c65(%esi),%eax
+f010486e:	50                   	push   %eax
+f010486f:	e8 3e b9 ff ff       	call   f01001b2 <_panic>
+
+// Hint to the CPU that this is a spin-wait loop.
+static inline void
+pause(void)
+{
+	asm volatile("pause" : : : "memory");
+f0104874:	f3 90                	pause
+	while (lk->owner != ticket)
+f0104876:	8b 43 04             	mov    0x4(%ebx),%eax
+f0104879:	39 d0                	cmp    %edx,%eax
+f010487b:	75 f7                	jne    f0104874 <spin_lock+0x56>
+		pause();
+
+	lk->cpu = thiscpu;
+f010487d:	64 a1 00 00 00 00    	mov    %fs:0x0,%eax
+f0104883:	89 43 0c             	mov    %eax,0xc(%ebx)
+#ifdef LOCK_STATS
+	stats_acquired(&lk->stats, t0, waited);
+#else
+	(void) waited;
+#endif
+}
+f0104886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104889:	5b                   	pop    %ebx
+f010488a:	5e                   	pop    %esi
+f010488b:	5f                   	pop    %edi
+f010488c:	5d                   	pop    %ebp
+f010488d:	c3                   	ret
+
+f010488e <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f010488e:	55                   	push   %ebp
+f010488f:	89 e5                	mov    %esp,%ebp
+f0104891:	57                   	push   %edi
+f0104892:	56                   	push   %esi
+f0104893:	53                   	push   %ebx
+f0104894:	83 ec 18             	sub    $0x18,%esp
+f0104897:	e8 91 c8 ff ff       	call   f010112d <__x86.get_pc_thunk.si>
+f010489c:	81 c6 3c bb 01 00    	add    $0x1bb3c,%esi
+f01048a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!spin_holding(lk))
+f01048a5:	53                   	push   %ebx
+f01048a6:	e8 25 ff ff ff       	call   f01047d0 <spin_holding>
+f01048ab:	83 c4 10             	add    $0x10,%esp
+f01048ae:	85 c0                	test   %eax,%eax
+f01048b0:	74 18                	je     f01048ca <spin_unlock+0x3c>
+		panic("CPU %d cannot release %s: not holding",
+		      cpunum(), lk->name);
+#ifdef LOCK_STATS
+	stats_released(&lk->stats);
+#endif
+	lk->cpu = NULL;
+f01048b2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Only the holder writes 'owner', and x86 does not reorder
+	// stores, so a plain increment releases the lock once the
+	// compiler has finished the critical section's accesses.
+	asm volatile("" : : : "memory");
+	lk->owner++;
+f01048b9:	8b 43 04             	mov    0x4(%ebx),%eax
+f01048bc:	83 c0 01             	add    $0x1,%eax
+f01048bf:	89 43 04             	mov    %eax,0x4(%ebx)
+}
+f01048c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01048c5:	5b                   	pop    %ebx
+f01048c6:	5e                   	pop    %esi
+f01048c7:	5f                   	pop    %edi
+f01048c8:	5d                   	pop    %ebp
+f01048c9:	c3                   	ret
+		panic("CPU %d cannot release %s: not holding",
+f01048ca:	8b 7b 08             	mov    0x8(%ebx),%edi
+f01048cd:	89 f3                	mov    %esi,%ebx
+f01048cf:	e8 f8 fc ff ff       	call   f01045cc <cpunum>
+f01048d4:	83 ec 0c             	sub    $0xc,%esp
+f01048d7:	57                   	push   %edi
+f01048d8:	50                   	push   %eax
+f01048d9:	8d 86 38 63 fe ff    	lea    -0x19cc8(%esi),%eax
+f01048df:	50                   	push   %eax
+f01048e0:	6a 6e                	push   $0x6e
+f01048e2:	8d 86 9b 63 fe ff    	lea    -0x19c65(%esi),%eax
+f01048e8:	50                   	push   %eax
+f01048e9:	e8 c4 b8 ff ff       	call   f01001b2 <_panic>
+
+f01048ee <mcs_holding>:
+
+// Check whether this CPU is holding the MCS lock.
+int
+mcs_holding(struct mcslock *lk)
+{
+f01048ee:	55                   	push   %ebp
+f01048ef:	89 e5                	mov    %esp,%ebp
+f01048f1:	8b 55 08             	mov    0x8(%ebp),%edx
+	return lk->tail != NULL && lk->cpu == thiscpu;
+f01048f4:	8b 0a                	mov    (%edx),%ecx
+f01048f6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01048fb:	85 c9                	test   %ecx,%ecx
+f01048fd:	74 0f                	je     f010490e <mcs_holding+0x20>
+f01048ff:	64 a1 00 00 00 00    	mov    %fs:0x0,%eax
+f0104905:	39 42 08             	cmp    %eax,0x8(%edx)
+f0104908:	0f 94 c0             	sete   %al
+f010490b:	0f b6 c0             	movzbl %al,%eax
+}
+f010490e:	5d                   	pop    %ebp
+f010490f:	c3                   	ret
+
+f0104910 <__mcs_initlock>:
+
+void
+__mcs_initlock(struct mcslock *lk, const char *name)
+{
+f0104910:	55                   	push   %ebp
+f0104911:	89 e5                	mov    %esp,%ebp
+f0104913:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->tail = NULL;
+f0104916:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	lk->name = name;
+f010491c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010491f:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = NULL;
+f0104922:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#ifdef LOCK_STATS
+	stats_init(&lk->stats, name);
+#endif
+}
+f0104929:	5d                   	pop    %ebp
+f010492a:	c3                   	ret
+
+f010492b <mcs_lock>:
+
+// Acquire the lock, queueing 'me' behind the current tail and spinning
+// on me->locked until our predecessor hands the lock over.
+void
+mcs_lock(struct mcslock *lk, struct mcs_node *me)
+{
+f010492b:	55                   	push   %ebp
+f010492c:	89 e5                	mov    %esp,%ebp
+f010492e:	57                   	push   %edi
+f010492f:	56                   	push   %esi
+f0104930:	53                   	push   %ebx
+f0104931:	83 ec 18             	sub    $0x18,%esp
+f0104934:	e8 f8 c7 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f0104939:	81 c7 9f ba 01 00    	add    $0x1ba9f,%edi
+f010493f:	8b 75 08             	mov    0x8(%ebp),%esi
+f0104942:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	bool waited = false;
+#ifdef LOCK_STATS
+	uint64_t t0 = read_tsc();
+#endif
+
+	if (mcs_holding(lk))
+f0104945:	56                   	push   %esi
+f0104946:	e8 a3 ff ff ff       	call   f01048ee <mcs_holding>
+f010494b:	83 c4 10             	add    $0x10,%esp
+f010494e:	85 c0                	test   %eax,%eax
+f0104950:	75 1a                	jne    f010496c <mcs_lock+0x41>
+		panic("CPU %d cannot acquire %s: already holding",
+		      cpunum(), lk->name);
+
+	me->next = NULL;
+f0104952:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	me->locked = 1;
+f0104958:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+	asm volatile("lock; xchgl %0, %1"
+f010495f:	89 d8                	mov    %ebx,%eax
+f0104961:	f0 87 06             	lock xchg %eax,(%esi)
+	pred = (struct mcs_node *) xchg((volatile uint32_t *) &lk->tail,
+					(uint32_t) me);
+	if (pred) {
+f0104964:	85 c0                	test   %eax,%eax
+f0104966:	74 34                	je     f010499c <mcs_lock+0x71>
+		waited = true;
+		pred->next = me;
+f0104968:	89 18                	mov    %ebx,(%eax)
+		while (me->locked)
+f010496a:	eb 29                	jmp    f0104995 <mcs_lock+0x6a>
+		panic("CPU %d cannot acquire %s: already holding",
+f010496c:	8b 76 04             	mov    0x4(%esi),%esi
+f010496f:	89 fb                	mov    %edi,%ebx
+f0104971:	e8 56 fc ff ff       	call   f01045cc <cpunum>
+f0104976:	83 ec 0c             	sub    $0xc,%esp
+f0104979:	56                   	push   %esi
+f010497a:	50                   	push   %eax
+f010497b:	8d 87 0c 63 fe ff    	lea    -0x19cf4(%edi),%eax
+f0104981:	50                   	push   %eax
+f0104982:	68 9a 00 00 00       	push   $0x9a
+f0104987:	8d 87 9b 63 fe ff    	lea    -0x19c65(%edi),%eax
+f010498d:	50                   	push   %eax
+f010498e:	e8 1f b8 ff ff       	call   f01001b2 <_panic>
+	asm volatile("pause" : : : "memory");
+f0104993:	f3 90                	pause
+		while (me->locked)
+f0104995:	8b 43 04             	mov    0x4(%ebx),%eax
+f0104998:	85 c0                	test   %eax,%eax
+f010499a:	75 f7                	jne    f0104993 <mcs_lock+0x68>
+			pause();
+	}
+
+	lk->cpu = thiscpu;
+f010499c:	64 a1 00 00 00 00    	mov    %fs:0x0,%eax
+f01049a2:	89 46 08             	mov    %eax,0x8(%esi)
+#ifdef LOCK_STATS
+	stats_acquired(&lk->stats, t0, waited);
+#else
+	(void) waited;
+#endif
+}
+f01049a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01049a8:	5b                   	pop    %ebx
+f01049a9:	5e                   	pop    %esi
+f01049aa:	5f                   	pop    %edi
+f01049ab:	5d                   	pop    %ebp
+f01049ac:	c3                   	ret
+
+f01049ad <mcs_unlock>:
+
+// Release the lock, passing it to the next queued node if there is one.
+void
+mcs_unlock(struct mcslock *lk, struct mcs_node *me)
+{
+f01049ad:	55                   	push   %ebp
+f01049ae:	89 e5                	mov    %esp,%ebp
+f01049b0:	57                   	push   %edi
+f01049b1:	56                   	push   %esi
+f01049b2:	53                   	push   %ebx
+f01049b3:	83 ec 18             	sub    $0x18,%esp
+f01049b6:	e8 76 c7 ff ff       	call   f0101131 <__x86.get_pc_thunk.di>
+f01049bb:	81 c7 1d ba 01 00    	add    $0x1ba1d,%edi
+f01049c1:	8b 75 08             	mov    0x8(%ebp),%esi
+f01049c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (!mcs_holding(lk))
+f01049c7:	56                   	push   %esi
+f01049c8:	e8 21 ff ff ff       	call   f01048ee <mcs_holding>
+f01049cd:	83 c4 10             	add    $0x10,%esp
+f01049d0:	85 c0                	test   %eax,%eax
+f01049d2:	74 1e                	je     f01049f2 <mcs_unlock+0x45>
+		panic("CPU %d cannot release %s: not holding",
+		      cpunum(), lk->name);
+#ifdef LOCK_STATS
+	stats_released(&lk->stats);
+#endif
+	lk->cpu = NULL;
+f01049d4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+
+	if (!me->next) {
+f01049db:	8b 03                	mov    (%ebx),%eax
+f01049dd:	85 c0                	test   %eax,%eax
+f01049df:	74 38                	je     f0104a19 <mcs_unlock+0x6c>
+			return;
+		while (!me->next)
+			pause();
+	}
+	asm volatile("" : : : "memory");
+	me->next->locked = 0;
+f01049e1:	8b 03                	mov    (%ebx),%eax
+f01049e3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+f01049ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01049ed:	5b                   	pop    %ebx
+f01049ee:	5e                   	pop    %esi
+f01049ef:	5f                   	pop    %edi
+f01049f0:	5d                   	pop    %ebp
+f01049f1:	c3                   	ret
+		panic("CPU %d cannot release %s: not holding",
+f01049f2:	8b 76 04             	mov    0x4(%esi),%esi
+f01049f5:	89 fb                	mov    %edi,%ebx
+f01049f7:	e8 d0 fb ff ff       	call   f01045cc <cpunum>
+f01049fc:	83 ec 0c             	sub    $0xc,%esp
+f01049ff:	56                   	push   %esi
+f0104a00:	50                   	push   %eax
+f0104a01:	8d 87 38 63 fe ff    	lea    -0x19cc8(%edi),%eax
+f0104a07:	50                   	push   %eax
+f0104a08:	68 b5 00 00 00       	push   $0xb5
+f0104a0d:	8d 87 9b 63 fe ff    	lea    -0x19c65(%edi),%eax
+f0104a13:	50                   	push   %eax
+f0104a14:	e8 99 b7 ff ff       	call   f01001b2 <_panic>
+	asm volatile("lock; cmpxchgl %2, %0"
+f0104a19:	89 d8                	mov    %ebx,%eax
+f0104a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104a20:	f0 0f b1 16          	lock cmpxchg %edx,(%esi)
+		if (cmpxchg((volatile uint32_t *) &lk->tail,
+f0104a24:	39 c3                	cmp    %eax,%ebx
+f0104a26:	75 04                	jne    f0104a2c <mcs_unlock+0x7f>
+f0104a28:	eb c0                	jmp    f01049ea <mcs_unlock+0x3d>
+	asm volatile("pause" : : : "memory");
+f0104a2a:	f3 90                	pause
+		while (!me->next)
+f0104a2c:	8b 03                	mov    (%ebx),%eax
+f0104a2e:	85 c0                	test   %eax,%eax
+f0104a30:	74 f8                	je     f0104a2a <mcs_unlock+0x7d>
+f0104a32:	eb ad                	jmp    f01049e1 <mcs_unlock+0x34>
+
+f0104a34 <lock_print_stats>:
+
+// Print every lock's statistics, for the monitor's 'locks' command.
+// Spin time is averaged over the acquisitions that had to wait.
+void
+lock_print_stats(void)
+{
+f0104a34:	55                   	push   %ebp
+f0104a35:	89 e5                	mov    %esp,%ebp
+f0104a37:	53                   	push   %ebx
+f0104a38:	83 ec 10             	sub    $0x10,%esp
+f0104a3b:	e8 99 b9 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0104a40:	81 c3 98 b9 01 00    	add    $0x1b998,%ebx
+			ls->ls_name, ls->ls_acquired, ls->ls_contended,
+			ls->ls_contended ? ls->ls_spin / ls->ls_contended : 0,
+			ls->ls_acquired ? ls->ls_hold / ls->ls_acquired : 0,
+			ls->ls_maxhold);
+#else
+	cprintf("Lock statistics are off; rebuild with 'make LOCKSTATS=1'.\n");
+f0104a46:	8d 83 60 63 fe ff    	lea    -0x19ca0(%ebx),%eax
+f0104a4c:	50                   	push   %eax
+f0104a4d:	e8 92 ef ff ff       	call   f01039e4 <cprintf>
+#endif
+}
+f0104a52:	83 c4 10             	add    $0x10,%esp
+f0104a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104a58:	c9                   	leave
+f0104a59:	c3                   	ret
+
+f0104a5a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0104a5a:	55                   	push   %ebp
+f0104a5b:	89 e5                	mov    %esp,%ebp
+f0104a5d:	57                   	push   %edi
+f0104a5e:	56                   	push   %esi
+f0104a5f:	53                   	push   %ebx
+f0104a60:	83 ec 2c             	sub    $0x2c,%esp
+f0104a63:	e8 c1 c6 ff ff       	call   f0101129 <__x86.get_pc_thunk.cx>
+f0104a68:	81 c1 70 b9 01 00    	add    $0x1b970,%ecx
+f0104a6e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0104a71:	89 c7                	mov    %eax,%edi
+f0104a73:	89 d6                	mov    %edx,%esi
+f0104a75:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104a78:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0104a7b:	89 d1                	mov    %edx,%ecx
+f0104a7d:	89 c2                	mov    %eax,%edx
+f0104a7f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0104a82:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f0104a85:	8b 45 10             	mov    0x10(%ebp),%eax
+f0104a88:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0104a8b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104a8e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0104a95:	39 c2                	cmp    %eax,%edx
+f0104a97:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0104a9a:	72 41                	jb     f0104add <printnum+0x83>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f0104a9c:	83 ec 0c             	sub    $0xc,%esp
+f0104a9f:	ff 75 18             	push   0x18(%ebp)
+f0104aa2:	83 eb 01             	sub    $0x1,%ebx
+f0104aa5:	53                   	push   %ebx
+f0104aa6:	50                   	push   %eax
+f0104aa7:	83 ec 08             	sub    $0x8,%esp
+f0104aaa:	ff 75 e4             	push   -0x1c(%ebp)
+f0104aad:	ff 75 e0             	push   -0x20(%ebp)
+f0104ab0:	ff 75 d4             	push   -0x2c(%ebp)
+f0104ab3:	ff 75 d0             	push   -0x30(%ebp)
+f0104ab6:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0104ab9:	e8 35 0a 00 00       	call   f01054f3 <__udivdi3>
+f0104abe:	83 c4 18             	add    $0x18,%esp
+f0104ac1:	52                   	push   %edx
+f0104ac2:	50                   	push   %eax
+f0104ac3:	89 f2                	mov    %esi,%edx
+f0104ac5:	89 f8                	mov    %edi,%eax
+f0104ac7:	e8 8e ff ff ff       	call   f0104a5a <printnum>
+f0104acc:	83 c4 20             	add    $0x20,%esp
+f0104acf:	eb 13                	jmp    f0104ae4 <printnum+0x8a>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f0104ad1:	83 ec 08             	sub    $0x8,%esp
+f0104ad4:	56                   	push   %esi
+f0104ad5:	ff 75 18             	push   0x18(%ebp)
+f0104ad8:	ff d7                	call   *%edi
+f0104ada:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f0104add:	83 eb 01             	sub    $0x1,%ebx
+f0104ae0:	85 db                	test   %ebx,%ebx
+f0104ae2:	7f ed                	jg     f0104ad1 <printnum+0x77>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f0104ae4:	83 ec 08             	sub    $0x8,%esp
+f0104ae7:	56                   	push   %esi
+f0104ae8:	83 ec 04             	sub    $0x4,%esp
+f0104aeb:	ff 75 e4             	push   -0x1c(%ebp)
+f0104aee:	ff 75 e0             	push   -0x20(%ebp)
+f0104af1:	ff 75 d4             	push   -0x2c(%ebp)
+f0104af4:	ff 75 d0             	push   -0x30(%ebp)
+f0104af7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0104afa:	e8 ba 0a 00 00       	call   f01055b9 <__umoddi3>
+f0104aff:	83 c4 14             	add    $0x14,%esp
+f0104b02:	0f be 84 03 ab 63 fe 	movsbl -0x19c55(%ebx,%eax,1),%eax
+f0104b09:	ff 
+f0104b0a:	50                   	push   %eax
+f0104b0b:	ff d7                	call   *%edi
+}
+f0104b0d:	83 c4 10             	add    $0x10,%esp
+f0104b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104b13:	5b                   	pop    %ebx
+f0104b14:	5e                   	pop    %esi
+f0104b15:	5f                   	pop    %edi
+f0104b16:	5d                   	pop    %ebp
+f0104b17:	c3                   	ret
+
+f0104b18 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0104b18:	55                   	push   %ebp
+f0104b19:	89 e5                	mov    %esp,%ebp
+f0104b1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f0104b1e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f0104b22:	8b 10                	mov    (%eax),%edx
+f0104b24:	3b 50 04             	cmp    0x4(%eax),%edx
+f0104b27:	73 0a                	jae    f0104b33 <sprintputch+0x1b>
+		*b->buf++ = ch;
+f0104b29:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0104b2c:	89 08                	mov    %ecx,(%eax)
+f0104b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104b31:	88 02                	mov    %al,(%edx)
+}
+f0104b33:	5d                   	pop    %ebp
+f0104b34:	c3                   	ret
+
+f0104b35 <printfmt>:
+{
+f0104b35:	55                   	push   %ebp
+f0104b36:	89 e5                	mov    %esp,%ebp
+f0104b38:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f0104b3b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f0104b3e:	50                   	push   %eax
+f0104b3f:	ff 75 10             	push   0x10(%ebp)
+f0104b42:	ff 75 0c             	push   0xc(%ebp)
+f0104b45:	ff 75 08             	push   0x8(%ebp)
+f0104b48:	e8 05 00 00 00       	call   f0104b52 <vprintfmt>
+}
+f0104b4d:	83 c4 10             	add    $0x10,%esp
+f0104b50:	c9                   	leave
+f0104b51:	c3                   	ret
+
+f0104b52 <vprintfmt>:
+{
+f0104b52:	55                   	push   %ebp
+f0104b53:	89 e5                	mov    %esp,%ebp
+f0104b55:	57                   	push   %edi
+f0104b56:	56                   	push   %esi
+f0104b57:	53                   	push   %ebx
+f0104b58:	83 ec 3c             	sub    $0x3c,%esp
+f0104b5b:	e8 c5 c5 ff ff       	call   f0101125 <__x86.get_pc_thunk.ax>
+f0104b60:	05 78 b8 01 00       	add    $0x1b878,%eax
+f0104b65:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104b68:	8b 75 08             	mov    0x8(%ebp),%esi
+f0104b6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f0104b6e:	89 f7                	mov    %esi,%edi
+f0104b70:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104b73:	eb 0a                	jmp    f0104b7f <vprintfmt+0x2d>
+			putch(ch, putdat);
+f0104b75:	83 ec 08             	sub    $0x8,%esp
+f0104b78:	56                   	push   %esi
+f0104b79:	50                   	push   %eax
+f0104b7a:	ff d7                	call   *%edi
+f0104b7c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0104b7f:	83 c3 01             	add    $0x1,%ebx
+f0104b82:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+f0104b86:	83 f8 25             	cmp    $0x25,%eax
+f0104b89:	74 0c                	je     f0104b97 <vprintfmt+0x45>
+			if (ch == '\0')
+f0104b8b:	85 c0                	test   %eax,%eax
+f0104b8d:	75 e6                	jne    f0104b75 <vprintfmt+0x23>
+}
+f0104b8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104b92:	5b                   	pop    %ebx
+f0104b93:	5e                   	pop    %esi
+f0104b94:	5f                   	pop    %edi
+f0104b95:	5d                   	pop    %ebp
+f0104b96:	c3                   	ret
+		padc = ' ';
+f0104b97:	c6 45 d8 20          	movb   $0x20,-0x28(%ebp)
+		altflag = 0;
+f0104b9b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		precision = -1;
+f0104ba2:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%ebp)
+		width = -1;
+f0104ba9:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+		lflag = 0;
+f0104bb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0104bb5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+f0104bb8:	89 75 0c             	mov    %esi,0xc(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0104bbb:	8d 43 01             	lea    0x1(%ebx),%eax
+f0104bbe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0104bc1:	0f b6 13             	movzbl (%ebx),%edx
+f0104bc4:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0104bc7:	3c 55                	cmp    $0x55,%al
+f0104bc9:	0f 87 18 04 00 00    	ja     f0104fe7 <.L21>
+f0104bcf:	0f b6 c0             	movzbl %al,%eax
+f0104bd2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0104bd5:	89 ce                	mov    %ecx,%esi
+f0104bd7:	03 b4 81 3c 64 fe ff 	add    -0x19bc4(%ecx,%eax,4),%esi
+f0104bde:	ff e6                	jmp    *%esi
+
+f0104be0 <.L19>:
+f0104be0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			padc = '-';
+f0104be3:	c6 45 d8 2d          	movb   $0x2d,-0x28(%ebp)
+f0104be7:	eb d2                	jmp    f0104bbb <vprintfmt+0x69>
+
+f0104be9 <.L70>:
+		switch (ch = *(unsigned char *) fmt++) {
+f0104be9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0104bec:	c6 45 d8 30          	movb   $0x30,-0x28(%ebp)
+f0104bf0:	eb c9                	jmp    f0104bbb <vprintfmt+0x69>
+
+f0104bf2 <.L32>:
+f0104bf2:	0f b6 d2             	movzbl %dl,%edx
+f0104bf5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			for (precision = 0; ; ++fmt) {
+f0104bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104bfd:	8b 75 0c             	mov    0xc(%ebp),%esi
+				precision = precision * 10 + ch - '0';
+f0104c00:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0104c03:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f0104c07:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+f0104c0a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f0104c0d:	83 f9 09             	cmp    $0x9,%ecx
+f0104c10:	77 58                	ja     f0104c6a <.L36+0xf>
+			for (precision = 0; ; ++fmt) {
+f0104c12:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+f0104c15:	eb e9                	jmp    f0104c00 <.L32+0xe>
+
+f0104c17 <.L34>:
+			precision = va_arg(ap, int);
+f0104c17:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104c1a:	8b 00                	mov    (%eax),%eax
+f0104c1c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0104c1f:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104c22:	8d 40 04             	lea    0x4(%eax),%eax
+f0104c25:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0104c28:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			if (width < 0)
+f0104c2b:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+f0104c2f:	79 8a                	jns    f0104bbb <vprintfmt+0x69>
+				width = precision, precision = -1;
+f0104c31:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0104c34:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0104c37:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%ebp)
+f0104c3e:	e9 78 ff ff ff       	jmp    f0104bbb <vprintfmt+0x69>
+
+f0104c43 <.L33>:
+			if (width < 0)
+f0104c43:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0104c46:	85 d2                	test   %edx,%edx
+f0104c48:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104c4d:	0f 49 c2             	cmovns %edx,%eax
+f0104c50:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0104c53:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			goto reswitch;
+f0104c56:	e9 60 ff ff ff       	jmp    f0104bbb <vprintfmt+0x69>
+
+f0104c5b <.L36>:
+		switch (ch = *(unsigned char *) fmt++) {
+f0104c5b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			altflag = 1;
+f0104c5e:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+			goto reswitch;
+f0104c65:	e9 51 ff ff ff       	jmp    f0104bbb <vprintfmt+0x69>
+f0104c6a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0104c6d:	89 75 0c             	mov    %esi,0xc(%ebp)
+f0104c70:	eb b9                	jmp    f0104c2b <.L34+0x14>
+
+f0104c72 <.L28>:
+			lflag++;
+f0104c72:	83 45 cc 01          	addl   $0x1,-0x34(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0104c76:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			goto reswitch;
+f0104c79:	e9 3d ff ff ff       	jmp    f0104bbb <vprintfmt+0x69>
+
+f0104c7e <.L31>:
+			putch(va_arg(ap, int), putdat);
+f0104c7e:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104c81:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104c84:	8d 58 04             	lea    0x4(%eax),%ebx
+f0104c87:	83 ec 08             	sub    $0x8,%esp
+f0104c8a:	56                   	push   %esi
+f0104c8b:	ff 30                	push   (%eax)
+f0104c8d:	ff d7                	call   *%edi
+			break;
+f0104c8f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f0104c92:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+f0104c95:	e9 e3 02 00 00       	jmp    f0104f7d <.L26+0x45>
+
+f0104c9a <.L29>:
+			err = va_arg(ap, int);
+f0104c9a:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104c9d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104ca0:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+f0104ca3:	8b 10                	mov    (%eax),%edx
+f0104ca5:	89 d0                	mov    %edx,%eax
+f0104ca7:	f7 d8                	neg    %eax
+f0104ca9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f0104cac:	83 f8 07             	cmp    $0x7,%eax
+f0104caf:	7f 2b                	jg     f0104cdc <.L29+0x42>
+f0104cb1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0104cb4:	8b 94 82 48 01 00 00 	mov    0x148(%edx,%eax,4),%edx
+f0104cbb:	85 d2                	test   %edx,%edx
+f0104cbd:	74 1d                	je     f0104cdc <.L29+0x42>
+				printfmt(putch, putdat, "%s", p);
+f0104cbf:	52                   	push   %edx
+f0104cc0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104cc3:	8d 80 42 56 fe ff    	lea    -0x1a9be(%eax),%eax
+f0104cc9:	50                   	push   %eax
+f0104cca:	56                   	push   %esi
+f0104ccb:	57                   	push   %edi
+f0104ccc:	e8 64 fe ff ff       	call   f0104b35 <printfmt>
+f0104cd1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0104cd4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+f0104cd7:	e9 a1 02 00 00       	jmp    f0104f7d <.L26+0x45>
+				printfmt(putch, putdat, "error %d", err);
+f0104cdc:	50                   	push   %eax
+f0104cdd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104ce0:	8d 80 c3 63 fe ff    	lea    -0x19c3d(%eax),%eax
+f0104ce6:	50                   	push   %eax
+f0104ce7:	56                   	push   %esi
+f0104ce8:	57                   	push   %edi
+f0104ce9:	e8 47 fe ff ff       	call   f0104b35 <printfmt>
+f0104cee:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0104cf1:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f0104cf4:	e9 84 02 00 00       	jmp    f0104f7d <.L26+0x45>
+
+f0104cf9 <.L25>:
+			if ((p = va_arg(ap, char *)) == NULL)
+f0104cf9:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104cfc:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104cff:	83 c0 04             	add    $0x4,%eax
+f0104d02:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0104d05:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104d08:	8b 10                	mov    (%eax),%edx
+				p = "(null)";
+f0104d0a:	85 d2                	test   %edx,%edx
+f0104d0c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104d0f:	8d 80 bc 63 fe ff    	lea    -0x19c44(%eax),%eax
+f0104d15:	0f 45 c2             	cmovne %edx,%eax
+f0104d18:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f0104d1b:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+f0104d1f:	7e 06                	jle    f0104d27 <.L25+0x2e>
+f0104d21:	80 7d d8 2d          	cmpb   $0x2d,-0x28(%ebp)
+f0104d25:	75 0b                	jne    f0104d32 <.L25+0x39>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0104d27:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0104d2a:	89 7d 08             	mov    %edi,0x8(%ebp)
+f0104d2d:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0104d30:	eb 5d                	jmp    f0104d8f <.L25+0x96>
+f0104d32:	83 ec 08             	sub    $0x8,%esp
+f0104d35:	ff 75 c8             	push   -0x38(%ebp)
+f0104d38:	ff 75 cc             	push   -0x34(%ebp)
+f0104d3b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0104d3e:	e8 5d 04 00 00       	call   f01051a0 <strnlen>
+f0104d43:	89 c2                	mov    %eax,%edx
+f0104d45:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0104d48:	29 d0                	sub    %edx,%eax
+f0104d4a:	83 c4 10             	add    $0x10,%esp
+f0104d4d:	89 c3                	mov    %eax,%ebx
+					putch(padc, putdat);
+f0104d4f:	0f be 55 d8          	movsbl -0x28(%ebp),%edx
+f0104d53:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0104d56:	89 45 d8             	mov    %eax,-0x28(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0104d59:	eb 0f                	jmp    f0104d6a <.L25+0x71>
+					putch(padc, putdat);
+f0104d5b:	83 ec 08             	sub    $0x8,%esp
+f0104d5e:	56                   	push   %esi
+f0104d5f:	ff 75 dc             	push   -0x24(%ebp)
+f0104d62:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0104d64:	83 eb 01             	sub    $0x1,%ebx
+f0104d67:	83 c4 10             	add    $0x10,%esp
+f0104d6a:	85 db                	test   %ebx,%ebx
+f0104d6c:	7f ed                	jg     f0104d5b <.L25+0x62>
+f0104d6e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0104d71:	85 c0                	test   %eax,%eax
+f0104d73:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104d78:	0f 49 d0             	cmovns %eax,%edx
+f0104d7b:	29 d0                	sub    %edx,%eax
+f0104d7d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0104d80:	eb a5                	jmp    f0104d27 <.L25+0x2e>
+					putch(ch, putdat);
+f0104d82:	83 ec 08             	sub    $0x8,%esp
+f0104d85:	56                   	push   %esi
+f0104d86:	52                   	push   %edx
+f0104d87:	ff 55 08             	call   *0x8(%ebp)
+f0104d8a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0104d8d:	89 d9                	mov    %ebx,%ecx
+f0104d8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+f0104d92:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+f0104d96:	0f be d0             	movsbl %al,%edx
+f0104d99:	85 d2                	test   %edx,%edx
+f0104d9b:	74 28                	je     f0104dc5 <.L25+0xcc>
+f0104d9d:	85 ff                	test   %edi,%edi
+f0104d9f:	78 05                	js     f0104da6 <.L25+0xad>
+f0104da1:	83 ef 01             	sub    $0x1,%edi
+f0104da4:	78 2e                	js     f0104dd4 <.L25+0xdb>
+				if (altflag && (ch < ' ' || ch > '~'))
+f0104da6:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+f0104daa:	74 d6                	je     f0104d82 <.L25+0x89>
+f0104dac:	0f be c0             	movsbl %al,%eax
+f0104daf:	83 e8 20             	sub    $0x20,%eax
+f0104db2:	83 f8 5e             	cmp    $0x5e,%eax
+f0104db5:	76 cb                	jbe    f0104d82 <.L25+0x89>
+					putch('?', putdat);
+f0104db7:	83 ec 08             	sub    $0x8,%esp
+f0104dba:	56                   	push   %esi
+f0104dbb:	6a 3f                	push   $0x3f
+f0104dbd:	ff 55 08             	call   *0x8(%ebp)
+f0104dc0:	83 c4 10             	add    $0x10,%esp
+f0104dc3:	eb c8                	jmp    f0104d8d <.L25+0x94>
+f0104dc5:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0104dc8:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f0104dcb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0104dce:	01 c3                	add    %eax,%ebx
+f0104dd0:	29 cb                	sub    %ecx,%ebx
+f0104dd2:	eb 13                	jmp    f0104de7 <.L25+0xee>
+f0104dd4:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0104dd7:	eb ef                	jmp    f0104dc8 <.L25+0xcf>
+				putch(' ', putdat);
+f0104dd9:	83 ec 08             	sub    $0x8,%esp
+f0104ddc:	56                   	push   %esi
+f0104ddd:	6a 20                	push   $0x20
+f0104ddf:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+f0104de1:	83 eb 01             	sub    $0x1,%ebx
+f0104de4:	83 c4 10             	add    $0x10,%esp
+f0104de7:	85 db                	test   %ebx,%ebx
+f0104de9:	7f ee                	jg     f0104dd9 <.L25+0xe0>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0104deb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0104dee:	89 45 14             	mov    %eax,0x14(%ebp)
+f0104df1:	e9 87 01 00 00       	jmp    f0104f7d <.L26+0x45>
+
+f0104df6 <.L30>:
+	if (lflag >= 2)
+f0104df6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0104df9:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104dfc:	83 f9 01             	cmp    $0x1,%ecx
+f0104dff:	7f 1b                	jg     f0104e1c <.L30+0x26>
+	else if (lflag)
+f0104e01:	85 c9                	test   %ecx,%ecx
+f0104e03:	74 63                	je     f0104e68 <.L30+0x72>
+		return va_arg(*ap, long);
+f0104e05:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e08:	8b 00                	mov    (%eax),%eax
+f0104e0a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0104e0d:	99                   	cltd
+f0104e0e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0104e11:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e14:	8d 40 04             	lea    0x4(%eax),%eax
+f0104e17:	89 45 14             	mov    %eax,0x14(%ebp)
+f0104e1a:	eb 17                	jmp    f0104e33 <.L30+0x3d>
+		return va_arg(*ap, long long);
+f0104e1c:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e1f:	8b 50 04             	mov    0x4(%eax),%edx
+f0104e22:	8b 00                	mov    (%eax),%eax
+f0104e24:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0104e27:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0104e2a:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e2d:	8d 40 08             	lea    0x8(%eax),%eax
+f0104e30:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f0104e33:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0104e36:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+			base = 10;
+f0104e39:	ba 0a 00 00 00       	mov    $0xa,%edx
+			if ((long long) num < 0) {
+f0104e3e:	85 db                	test   %ebx,%ebx
+f0104e40:	0f 89 1d 01 00 00    	jns    f0104f63 <.L26+0x2b>
+				putch('-', putdat);
+f0104e46:	83 ec 08             	sub    $0x8,%esp
+f0104e49:	56                   	push   %esi
+f0104e4a:	6a 2d                	push   $0x2d
+f0104e4c:	ff d7                	call   *%edi
+				num = -(long long) num;
+f0104e4e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0104e51:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0104e54:	f7 d9                	neg    %ecx
+f0104e56:	83 d3 00             	adc    $0x0,%ebx
+f0104e59:	f7 db                	neg    %ebx
+f0104e5b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f0104e5e:	ba 0a 00 00 00       	mov    $0xa,%edx
+f0104e63:	e9 fb 00 00 00       	jmp    f0104f63 <.L26+0x2b>
+		return va_arg(*ap, int);
+f0104e68:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e6b:	8b 00                	mov    (%eax),%eax
+f0104e6d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0104e70:	99                   	cltd
+f0104e71:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0104e74:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e77:	8d 40 04             	lea    0x4(%eax),%eax
+f0104e7a:	89 45 14             	mov    %eax,0x14(%ebp)
+f0104e7d:	eb b4                	jmp    f0104e33 <.L30+0x3d>
+
+f0104e7f <.L24>:
+	if (lflag >= 2)
+f0104e7f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0104e82:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104e85:	83 f9 01             	cmp    $0x1,%ecx
+f0104e88:	7f 1e                	jg     f0104ea8 <.L24+0x29>
+	else if (lflag)
+f0104e8a:	85 c9                	test   %ecx,%ecx
+f0104e8c:	74 32                	je     f0104ec0 <.L24+0x41>
+		return va_arg(*ap, unsigned long);
+f0104e8e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104e91:	8b 08                	mov    (%eax),%ecx
+f0104e93:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104e98:	8d 40 04             	lea    0x4(%eax),%eax
+f0104e9b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0104e9e:	ba 0a 00 00 00       	mov    $0xa,%edx
+		return va_arg(*ap, unsigned long);
+f0104ea3:	e9 bb 00 00 00       	jmp    f0104f63 <.L26+0x2b>
+		return va_arg(*ap, unsigned long long);
+f0104ea8:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104eab:	8b 08                	mov    (%eax),%ecx
+f0104ead:	8b 58 04             	mov    0x4(%eax),%ebx
+f0104eb0:	8d 40 08             	lea    0x8(%eax),%eax
+f0104eb3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0104eb6:	ba 0a 00 00 00       	mov    $0xa,%edx
+		return va_arg(*ap, unsigned long long);
+f0104ebb:	e9 a3 00 00 00       	jmp    f0104f63 <.L26+0x2b>
+		return va_arg(*ap, unsigned int);
+f0104ec0:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104ec3:	8b 08                	mov    (%eax),%ecx
+f0104ec5:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104eca:	8d 40 04             	lea    0x4(%eax),%eax
+f0104ecd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0104ed0:	ba 0a 00 00 00       	mov    $0xa,%edx
+		return va_arg(*ap, unsigned int);
+f0104ed5:	e9 89 00 00 00       	jmp    f0104f63 <.L26+0x2b>
+
+f0104eda <.L27>:
+	if (lflag >= 2)
+f0104eda:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0104edd:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104ee0:	83 f9 01             	cmp    $0x1,%ecx
+f0104ee3:	7f 16                	jg     f0104efb <.L27+0x21>
+	else if (lflag)
+f0104ee5:	85 c9                	test   %ecx,%ecx
+f0104ee7:	74 3d                	je     f0104f26 <.L27+0x4c>
+		return va_arg(*ap, unsigned long);
+f0104ee9:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104eec:	8b 08                	mov    (%eax),%ecx
+f0104eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104ef3:	8d 40 04             	lea    0x4(%eax),%eax
+f0104ef6:	89 45 14             	mov    %eax,0x14(%ebp)
+f0104ef9:	eb 0e                	jmp    f0104f09 <.L27+0x2f>
+		return va_arg(*ap, unsigned long long);
+f0104efb:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104efe:	8b 08                	mov    (%eax),%ecx
+f0104f00:	8b 58 04             	mov    0x4(%eax),%ebx
+f0104f03:	8d 40 08             	lea    0x8(%eax),%eax
+f0104f06:	89 45 14             	mov    %eax,0x14(%ebp)
+			printnum(putch, putdat, num, base, width, padc);
+f0104f09:	83 ec 0c             	sub    $0xc,%esp
+f0104f0c:	0f be 45 d8          	movsbl -0x28(%ebp),%eax
+f0104f10:	50                   	push   %eax
+f0104f11:	ff 75 dc             	push   -0x24(%ebp)
+f0104f14:	6a 08                	push   $0x8
+f0104f16:	53                   	push   %ebx
+f0104f17:	51                   	push   %ecx
+f0104f18:	89 f2                	mov    %esi,%edx
+f0104f1a:	89 f8                	mov    %edi,%eax
+f0104f1c:	e8 39 fb ff ff       	call   f0104a5a <printnum>
+			break;
+f0104f21:	83 c4 20             	add    $0x20,%esp
+f0104f24:	eb 57                	jmp    f0104f7d <.L26+0x45>
+		return va_arg(*ap, unsigned int);
+f0104f26:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104f29:	8b 08                	mov    (%eax),%ecx
+f0104f2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104f30:	8d 40 04             	lea    0x4(%eax),%eax
+f0104f33:	89 45 14             	mov    %eax,0x14(%ebp)
+f0104f36:	eb d1                	jmp    f0104f09 <.L27+0x2f>
+
+f0104f38 <.L26>:
+			putch('0', putdat);
+f0104f38:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104f3b:	83 ec 08             	sub    $0x8,%esp
+f0104f3e:	56                   	push   %esi
+f0104f3f:	6a 30                	push   $0x30
+f0104f41:	ff d7                	call   *%edi
+			putch('x', putdat);
+f0104f43:	83 c4 08             	add    $0x8,%esp
+f0104f46:	56                   	push   %esi
+f0104f47:	6a 78                	push   $0x78
+f0104f49:	ff d7                	call   *%edi
+			num = (unsigned long long)
+f0104f4b:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104f4e:	8b 08                	mov    (%eax),%ecx
+f0104f50:	bb 00 00 00 00       	mov    $0x0,%ebx
+			goto number;
+f0104f55:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f0104f58:	8d 40 04             	lea    0x4(%eax),%eax
+f0104f5b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0104f5e:	ba 10 00 00 00       	mov    $0x10,%edx
+			printnum(putch, putdat, num, base, width, padc);
+f0104f63:	83 ec 0c             	sub    $0xc,%esp
+f0104f66:	0f be 45 d8          	movsbl -0x28(%ebp),%eax
+f0104f6a:	50                   	push   %eax
+f0104f6b:	ff 75 dc             	push   -0x24(%ebp)
+f0104f6e:	52                   	push   %edx
+f0104f6f:	53                   	push   %ebx
+f0104f70:	51                   	push   %ecx
+f0104f71:	89 f2                	mov    %esi,%edx
+f0104f73:	89 f8                	mov    %edi,%eax
+f0104f75:	e8 e0 fa ff ff       	call   f0104a5a <printnum>
+			break;
+f0104f7a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f0104f7d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0104f80:	e9 fa fb ff ff       	jmp    f0104b7f <vprintfmt+0x2d>
+
+f0104f85 <.L22>:
+	if (lflag >= 2)
+f0104f85:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0104f88:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104f8b:	83 f9 01             	cmp    $0x1,%ecx
+f0104f8e:	7f 1b                	jg     f0104fab <.L22+0x26>
+	else if (lflag)
+f0104f90:	85 c9                	test   %ecx,%ecx
+f0104f92:	74 2c                	je     f0104fc0 <.L22+0x3b>
+		return va_arg(*ap, unsigned long);
+f0104f94:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104f97:	8b 08                	mov    (%eax),%ecx
+f0104f99:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104f9e:	8d 40 04             	lea    0x4(%eax),%eax
+f0104fa1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0104fa4:	ba 10 00 00 00       	mov    $0x10,%edx
+		return va_arg(*ap, unsigned long);
+f0104fa9:	eb b8                	jmp    f0104f63 <.L26+0x2b>
+		return va_arg(*ap, unsigned long long);
+f0104fab:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104fae:	8b 08                	mov    (%eax),%ecx
+f0104fb0:	8b 58 04             	mov    0x4(%eax),%ebx
+f0104fb3:	8d 40 08             	lea    0x8(%eax),%eax
+f0104fb6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0104fb9:	ba 10 00 00 00       	mov    $0x10,%edx
+		return va_arg(*ap, unsigned long long);
+f0104fbe:	eb a3                	jmp    f0104f63 <.L26+0x2b>
+		return va_arg(*ap, unsigned int);
+f0104fc0:	8b 45 14             	mov    0x14(%ebp),%eax
+f0104fc3:	8b 08                	mov    (%eax),%ecx
+f0104fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104fca:	8d 40 04             	lea    0x4(%eax),%eax
+f0104fcd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0104fd0:	ba 10 00 00 00       	mov    $0x10,%edx
+		return va_arg(*ap, unsigned int);
+f0104fd5:	eb 8c                	jmp    f0104f63 <.L26+0x2b>
+
+f0104fd7 <.L35>:
+			putch(ch, putdat);
+f0104fd7:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104fda:	83 ec 08             	sub    $0x8,%esp
+f0104fdd:	56                   	push   %esi
+f0104fde:	6a 25                	push   $0x25
+f0104fe0:	ff d7                	call   *%edi
+			break;
+f0104fe2:	83 c4 10             	add    $0x10,%esp
+f0104fe5:	eb 96                	jmp    f0104f7d <.L26+0x45>
+
+f0104fe7 <.L21>:
+			putch('%', putdat);
+f0104fe7:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104fea:	83 ec 08             	sub    $0x8,%esp
+f0104fed:	56                   	push   %esi
+f0104fee:	6a 25                	push   $0x25
+f0104ff0:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f0104ff2:	83 c4 10             	add    $0x10,%esp
+f0104ff5:	89 d8                	mov    %ebx,%eax
+f0104ff7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f0104ffb:	74 05                	je     f0105002 <.L21+0x1b>
+f0104ffd:	83 e8 01             	sub    $0x1,%eax
+f0105000:	eb f5                	jmp    f0104ff7 <.L21+0x10>
+f0105002:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0105005:	e9 73 ff ff ff       	jmp    f0104f7d <.L26+0x45>
+
+f010500a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f010500a:	55                   	push   %ebp
+f010500b:	89 e5                	mov    %esp,%ebp
+f010500d:	53                   	push   %ebx
+f010500e:	83 ec 14             	sub    $0x14,%esp
+f0105011:	e8 c3 b3 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0105016:	81 c3 c2 b3 01 00    	add    $0x1b3c2,%ebx
+f010501c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010501f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f0105022:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0105025:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0105029:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f010502c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f0105033:	85 c0                	test   %eax,%eax
+f0105035:	74 2b                	je     f0105062 <vsnprintf+0x58>
+f0105037:	85 d2                	test   %edx,%edx
+f0105039:	7e 27                	jle    f0105062 <vsnprintf+0x58>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f010503b:	ff 75 14             	push   0x14(%ebp)
+f010503e:	ff 75 10             	push   0x10(%ebp)
+f0105041:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0105044:	50                   	push   %eax
+f0105045:	8d 83 40 47 fe ff    	lea    -0x1b8c0(%ebx),%eax
+f010504b:	50                   	push   %eax
+f010504c:	e8 01 fb ff ff       	call   f0104b52 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f0105051:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0105054:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f0105057:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010505a:	83 c4 10             	add    $0x10,%esp
+}
+f010505d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105060:	c9                   	leave
+f0105061:	c3                   	ret
+		return -E_INVAL;
+f0105062:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105067:	eb f4                	jmp    f010505d <vsnprintf+0x53>
+
+f0105069 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f0105069:	55                   	push   %ebp
+f010506a:	89 e5                	mov    %esp,%ebp
+f010506c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f010506f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f0105072:	50                   	push   %eax
+f0105073:	ff 75 10             	push   0x10(%ebp)
+f0105076:	ff 75 0c             	push   0xc(%ebp)
+f0105079:	ff 75 08             	push   0x8(%ebp)
+f010507c:	e8 89 ff ff ff       	call   f010500a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f0105081:	c9                   	leave
+f0105082:	c3                   	ret
+
+f0105083 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0105083:	55                   	push   %ebp
+f0105084:	89 e5                	mov    %esp,%ebp
+f0105086:	57                   	push   %edi
+f0105087:	56                   	push   %esi
+f0105088:	53                   	push   %ebx
+f0105089:	83 ec 1c             	sub    $0x1c,%esp
+f010508c:	e8 48 b3 ff ff       	call   f01003d9 <__x86.get_pc_thunk.bx>
+f0105091:	81 c3 47 b3 01 00    	add    $0x1b347,%ebx
+f0105097:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+	if (prompt != NULL)
+f010509a:	85 c0                	test   %eax,%eax
+f010509c:	74 13                	je     f01050b1 <readline+0x2e>
+		cprintf("%s", prompt);
+f010509e:	83 ec 08             	sub    $0x8,%esp
+f01050a1:	50                   	push   %eax
+f01050a2:	8d 83 42 56 fe ff    	lea    -0x1a9be(%ebx),%eax
+f01050a8:	50                   	push   %eax
+f01050a9:	e8 36 e9 ff ff       	call   f01039e4 <cprintf>
+f01050ae:	83 c4 10             	add    $0x10,%esp
+
+	i = 0;
+	echoing = iscons(0);
+f01050b1:	83 ec 0c             	sub    $0xc,%esp
+f01050b4:	6a 00                	push   $0x0
+f01050b6:	e8 64 c0 ff ff       	call   f010111f <iscons>
+f01050bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01050be:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f01050c1:	bf 00 00 00 00       	mov    $0x0,%edi
+				cputchar('\b');
+			i--;
+		} else if (c >= ' ' && i < BUFLEN-1) {
+			if (echoing)
+				cputchar(c);
+			buf[i++] = c;
+f01050c6:	8d 83 c8 16 00 00    	lea    0x16c8(%ebx),%eax
+f01050cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01050cf:	eb 45                	jmp    f0105116 <readline+0x93>
+			cprintf("read error: %e\n", c);
+f01050d1:	83 ec 08             	sub    $0x8,%esp
+f01050d4:	50                   	push   %eax
+f01050d5:	8d 83 94 65 fe ff    	lea    -0x19a6c(%ebx),%eax
+f01050db:	50                   	push   %eax
+f01050dc:	e8 03 e9 ff ff       	call   f01039e4 <cprintf>
+			return NULL;
+f01050e1:	83 c4 10             	add    $0x10,%esp
+f01050e4:	b8 00 00 00 00       	mov    $0x0,%eax
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f01050e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01050ec:	5b                   	pop    %ebx
+f01050ed:	5e                   	pop    %esi
+f01050ee:	5f                   	pop    %edi
+f01050ef:	5d                   	pop    %ebp
+f01050f0:	c3                   	ret
+			if (echoing)
+f01050f1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f01050f5:	75 05                	jne    f01050fc <readline+0x79>
+			i--;
+f01050f7:	83 ef 01             	sub    $0x1,%edi
+f01050fa:	eb 1a                	jmp    f0105116 <readline+0x93>
+				cputchar('\b');
+f01050fc:	83 ec 0c             	sub    $0xc,%esp
+f01050ff:	6a 08                	push   $0x8
+f0105101:	e8 ec bf ff ff       	call   f01010f2 <cputchar>
+f0105106:	83 c4 10             	add    $0x10,%esp
+f0105109:	eb ec                	jmp    f01050f7 <readline+0x74>
+			buf[i++] = c;
+f010510b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010510e:	89 f0                	mov    %esi,%eax
+f0105110:	88 04 39             	mov    %al,(%ecx,%edi,1)
+f0105113:	8d 7f 01             	lea    0x1(%edi),%edi
+		c = getchar();
+f0105116:	e8 f3 bf ff ff       	call   f010110e <getchar>
+f010511b:	89 c6                	mov    %eax,%esi
+		if (c < 0) {
+f010511d:	85 c0                	test   %eax,%eax
+f010511f:	78 b0                	js     f01050d1 <readline+0x4e>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f0105121:	83 f8 08             	cmp    $0x8,%eax
+f0105124:	0f 94 c0             	sete   %al
+f0105127:	83 fe 7f             	cmp    $0x7f,%esi
+f010512a:	0f 94 c2             	sete   %dl
+f010512d:	08 d0                	or     %dl,%al
+f010512f:	74 04                	je     f0105135 <readline+0xb2>
+f0105131:	85 ff                	test   %edi,%edi
+f0105133:	7f bc                	jg     f01050f1 <readline+0x6e>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0105135:	83 fe 1f             	cmp    $0x1f,%esi
+f0105138:	7e 1c                	jle    f0105156 <readline+0xd3>
+f010513a:	81 ff fe 03 00 00    	cmp    $0x3fe,%edi
+f0105140:	7f 14                	jg     f0105156 <readline+0xd3>
+			if (echoing)
+f0105142:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0105146:	74 c3                	je     f010510b <readline+0x88>
+				cputchar(c);
+f0105148:	83 ec 0c             	sub    $0xc,%esp
+f010514b:	56                   	push   %esi
+f010514c:	e8 a1 bf ff ff       	call   f01010f2 <cputchar>
+f0105151:	83 c4 10             	add    $0x10,%esp
+f0105154:	eb b5                	jmp    f010510b <readline+0x88>
+		} else if (c == '\n' || c == '\r') {
+f0105156:	83 fe 0a             	cmp    $0xa,%esi
+f0105159:	74 05                	je     f0105160 <readline+0xdd>
+f010515b:	83 fe 0d             	cmp    $0xd,%esi
+f010515e:	75 b6                	jne    f0105116 <readline+0x93>
+			if (echoing)
+f0105160:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0105164:	75 13                	jne    f0105179 <readline+0xf6>
+			buf[i] = 0;
+f0105166:	c6 84 3b c8 16 00 00 	movb   $0x0,0x16c8(%ebx,%edi,1)
+f010516d:	00 
+			return buf;
+f010516e:	8d 83 c8 16 00 00    	lea    0x16c8(%ebx),%eax
+f0105174:	e9 70 ff ff ff       	jmp    f01050e9 <readline+0x66>
+				cputchar('\n');
+f0105179:	83 ec 0c             	sub    $0xc,%esp
+f010517c:	6a 0a                	push   $0xa
+f010517e:	e8 6f bf ff ff       	call   f01010f2 <cputchar>
+f0105183:	83 c4 10             	add    $0x10,%esp
+f0105186:	eb de                	jmp    f0105166 <readline+0xe3>
+
+f0105188 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f0105188:	55                   	push   %ebp
+f0105189:	89 e5                	mov    %esp,%ebp
+f010518b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f010518e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105193:	eb 03                	jmp    f0105198 <strlen+0x10>
+		n++;
+f0105195:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f0105198:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f010519c:	75 f7                	jne    f0105195 <strlen+0xd>
+	return n;
+}
+f010519e:	5d                   	pop    %ebp
+f010519f:	c3                   	ret
+
+f01051a0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f01051a0:	55                   	push   %ebp
+f01051a1:	89 e5                	mov    %esp,%ebp
+f01051a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01051a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f01051a9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01051ae:	eb 03                	jmp    f01051b3 <strnlen+0x13>
+		n++;
+f01051b0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f01051b3:	39 d0                	cmp    %edx,%eax
+f01051b5:	74 08                	je     f01051bf <strnlen+0x1f>
+f01051b7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f01051bb:	75 f3                	jne    f01051b0 <strnlen+0x10>
+f01051bd:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f01051bf:	89 d0                	mov    %edx,%eax
+f01051c1:	5d                   	pop    %ebp
+f01051c2:	c3                   	ret
+
+f01051c3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f01051c3:	55                   	push   %ebp
+f01051c4:	89 e5                	mov    %esp,%ebp
+f01051c6:	53                   	push   %ebx
+f01051c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01051ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f01051cd:	b8 00 00 00 00       	mov    $0x0,%eax
+f01051d2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f01051d6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f01051d9:	83 c0 01             	add    $0x1,%eax
+f01051dc:	84 d2                	test   %dl,%dl
+f01051de:	75 f2                	jne    f01051d2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f01051e0:	89 c8                	mov    %ecx,%eax
+f01051e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01051e5:	c9                   	leave
+f01051e6:	c3                   	ret
+
+f01051e7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f01051e7:	55                   	push   %ebp
+f01051e8:	89 e5                	mov    %esp,%ebp
+f01051ea:	53                   	push   %ebx
+f01051eb:	83 ec 10             	sub    $0x10,%esp
+f01051ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f01051f1:	53                   	push   %ebx
+f01051f2:	e8 91 ff ff ff       	call   f0105188 <strlen>
+f01051f7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f01051fa:	ff 75 0c             	push   0xc(%ebp)
+f01051fd:	01 d8                	add    %ebx,%eax
+f01051ff:	50                   	push   %eax
+f0105200:	e8 be ff ff ff       	call   f01051c3 <strcpy>
+	return dst;
+}
+f0105205:	89 d8                	mov    %ebx,%eax
+f0105207:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010520a:	c9                   	leave
+f010520b:	c3                   	ret
+
+f010520c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f010520c:	55                   	push   %ebp
+f010520d:	89 e5                	mov    %esp,%ebp
+f010520f:	56                   	push   %esi
+f0105210:	53                   	push   %ebx
+f0105211:	8b 75 08             	mov    0x8(%ebp),%esi
+f0105214:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105217:	89 f3                	mov    %esi,%ebx
+f0105219:	03 5d 10             	add    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f010521c:	89 f0                	mov    %esi,%eax
+f010521e:	eb 0f                	jmp    f010522f <strncpy+0x23>
+		*dst++ = *src;
+f0105220:	83 c0 01             	add    $0x1,%eax
+f0105223:	0f b6 0a             	movzbl (%edx),%ecx
+f0105226:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0105229:	80 f9 01             	cmp    $0x1,%cl
+f010522c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f010522f:	39 d8                	cmp    %ebx,%eax
+f0105231:	75 ed                	jne    f0105220 <strncpy+0x14>
+	}
+	return ret;
+}
+f0105233:	89 f0                	mov    %esi,%eax
+f0105235:	5b                   	pop    %ebx
+f0105236:	5e                   	pop    %esi
+f0105237:	5d                   	pop    %ebp
+f0105238:	c3                   	ret
+
+f0105239 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0105239:	55                   	push   %ebp
+f010523a:	89 e5                	mov    %esp,%ebp
+f010523c:	56                   	push   %esi
+f010523d:	53                   	push   %ebx
+f010523e:	8b 75 08             	mov    0x8(%ebp),%esi
+f0105241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0105244:	8b 55 10             	mov    0x10(%ebp),%edx
+f0105247:	89 f0                	mov    %esi,%eax
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f0105249:	85 d2                	test   %edx,%edx
+f010524b:	74 21                	je     f010526e <strlcpy+0x35>
+f010524d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0105251:	89 f2                	mov    %esi,%edx
+f0105253:	eb 09                	jmp    f010525e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f0105255:	83 c1 01             	add    $0x1,%ecx
+f0105258:	83 c2 01             	add    $0x1,%edx
+f010525b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f010525e:	39 c2                	cmp    %eax,%edx
+f0105260:	74 09                	je     f010526b <strlcpy+0x32>
+f0105262:	0f b6 19             	movzbl (%ecx),%ebx
+f0105265:	84 db                	test   %bl,%bl
+f0105267:	75 ec                	jne    f0105255 <strlcpy+0x1c>
+f0105269:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f010526b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f010526e:	29 f0                	sub    %esi,%eax
+}
+f0105270:	5b                   	pop    %ebx
+f0105271:	5e                   	pop    %esi
+f0105272:	5d                   	pop    %ebp
+f0105273:	c3                   	ret
+
+f0105274 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f0105274:	55                   	push   %ebp
+f0105275:	89 e5                	mov    %esp,%ebp
+f0105277:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010527a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f010527d:	eb 06                	jmp    f0105285 <strcmp+0x11>
+		p++, q++;
+f010527f:	83 c1 01             	add    $0x1,%ecx
+f0105282:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f0105285:	0f b6 01             	movzbl (%ecx),%eax
+f0105288:	84 c0                	test   %al,%al
+f010528a:	74 04                	je     f0105290 <strcmp+0x1c>
+f010528c:	3a 02                	cmp    (%edx),%al
+f010528e:	74 ef                	je     f010527f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f0105290:	0f b6 c0             	movzbl %al,%eax
+f0105293:	0f b6 12             	movzbl (%edx),%edx
+f0105296:	29 d0                	sub    %edx,%eax
+}
+f0105298:	5d                   	pop    %ebp
+f0105299:	c3                   	ret
+
+f010529a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f010529a:	55                   	push   %ebp
+f010529b:	89 e5                	mov    %esp,%ebp
+f010529d:	53                   	push   %ebx
+f010529e:	8b 45 08             	mov    0x8(%ebp),%eax
+f01052a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01052a4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f01052a7:	eb 09                	jmp    f01052b2 <strncmp+0x18>
+		n--, p++, q++;
+f01052a9:	83 ea 01             	sub    $0x1,%edx
+f01052ac:	83 c0 01             	add    $0x1,%eax
+f01052af:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f01052b2:	85 d2                	test   %edx,%edx
+f01052b4:	74 18                	je     f01052ce <strncmp+0x34>
+f01052b6:	0f b6 18             	movzbl (%eax),%ebx
+f01052b9:	84 db                	test   %bl,%bl
+f01052bb:	74 04                	je     f01052c1 <strncmp+0x27>
+f01052bd:	3a 19                	cmp    (%ecx),%bl
+f01052bf:	74 e8                	je     f01052a9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f01052c1:	0f b6 00             	movzbl (%eax),%eax
+f01052c4:	0f b6 11             	movzbl (%ecx),%edx
+f01052c7:	29 d0                	sub    %edx,%eax
+}
+f01052c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01052cc:	c9                   	leave
+f01052cd:	c3                   	ret
+		return 0;
+f01052ce:	b8 00 00 00 00       	mov    $0x0,%eax
+f01052d3:	eb f4                	jmp    f01052c9 <strncmp+0x2f>
+
+f01052d5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f01052d5:	55                   	push   %ebp
+f01052d6:	89 e5                	mov    %esp,%ebp
+f01052d8:	8b 45 08             	mov    0x8(%ebp),%eax
+f01052db:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f01052df:	eb 03                	jmp    f01052e4 <strchr+0xf>
+f01052e1:	83 c0 01             	add    $0x1,%eax
+f01052e4:	0f b6 10             	movzbl (%eax),%edx
+f01052e7:	84 d2                	test   %dl,%dl
+f01052e9:	74 06                	je     f01052f1 <strchr+0x1c>
+		if (*s == c)
+f01052eb:	38 ca                	cmp    %cl,%dl
+f01052ed:	75 f2                	jne    f01052e1 <strchr+0xc>
+f01052ef:	eb 05                	jmp    f01052f6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+f01052f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01052f6:	5d                   	pop    %ebp
+f01052f7:	c3                   	ret
+
+f01052f8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f01052f8:	55                   	push   %ebp
+f01052f9:	89 e5                	mov    %esp,%ebp
+f01052fb:	8b 45 08             	mov    0x8(%ebp),%eax
+f01052fe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0105302:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f0105305:	38 ca                	cmp    %cl,%dl
+f0105307:	74 09                	je     f0105312 <strfind+0x1a>
+f0105309:	84 d2                	test   %dl,%dl
+f010530b:	74 05                	je     f0105312 <strfind+0x1a>
+	for (; *s; s++)
+f010530d:	83 c0 01             	add    $0x1,%eax
+f0105310:	eb f0                	jmp    f0105302 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f0105312:	5d                   	pop    %ebp
+f0105313:	c3                   	ret
+
+f0105314 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f0105314:	55                   	push   %ebp
+f0105315:	89 e5                	mov    %esp,%ebp
+f0105317:	57                   	push   %edi
+f0105318:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010531b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f010531e:	85 c9                	test   %ecx,%ecx
+f0105320:	74 20                	je     f0105342 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f0105322:	89 f8                	mov    %edi,%eax
+f0105324:	09 c8                	or     %ecx,%eax
+f0105326:	a8 03                	test   $0x3,%al
+f0105328:	75 12                	jne    f010533c <memset+0x28>
+		c &= 0xFF;
+f010532a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f010532e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f0105334:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f0105337:	fc                   	cld
+f0105338:	f3 ab                	rep stos %eax,%es:(%edi)
+f010533a:	eb 06                	jmp    f0105342 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f010533c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010533f:	fc                   	cld
+f0105340:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f0105342:	89 f8                	mov    %edi,%eax
+f0105344:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f0105347:	c9                   	leave
+f0105348:	c3                   	ret
+
+f0105349 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f0105349:	55                   	push   %ebp
+f010534a:	89 e5                	mov    %esp,%ebp
+f010534c:	57                   	push   %edi
+f010534d:	56                   	push   %esi
+f010534e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105351:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0105354:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f0105357:	39 c6                	cmp    %eax,%esi
+f0105359:	73 32                	jae    f010538d <memmove+0x44>
+f010535b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f010535e:	39 d0                	cmp    %edx,%eax
+f0105360:	73 2b                	jae    f010538d <memmove+0x44>
+		s += n;
+		d += n;
+f0105362:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0105365:	89 d6                	mov    %edx,%esi
+f0105367:	09 fe                	or     %edi,%esi
+f0105369:	09 ce                	or     %ecx,%esi
+f010536b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0105371:	75 0e                	jne    f0105381 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f0105373:	83 ef 04             	sub    $0x4,%edi
+f0105376:	8d 72 fc             	lea    -0x4(%edx),%esi
+f0105379:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f010537c:	fd                   	std
+f010537d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010537f:	eb 09                	jmp    f010538a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f0105381:	83 ef 01             	sub    $0x1,%edi
+f0105384:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f0105387:	fd                   	std
+f0105388:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f010538a:	fc                   	cld
+f010538b:	eb 1a                	jmp    f01053a7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f010538d:	89 f2                	mov    %esi,%edx
+f010538f:	09 c2                	or     %eax,%edx
+f0105391:	09 ca                	or     %ecx,%edx
+f0105393:	f6 c2 03             	test   $0x3,%dl
+f0105396:	75 0a                	jne    f01053a2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f0105398:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f010539b:	89 c7                	mov    %eax,%edi
+f010539d:	fc                   	cld
+f010539e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01053a0:	eb 05                	jmp    f01053a7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f01053a2:	89 c7                	mov    %eax,%edi
+f01053a4:	fc                   	cld
+f01053a5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f01053a7:	5e                   	pop    %esi
+f01053a8:	5f                   	pop    %edi
+f01053a9:	5d                   	pop    %ebp
+f01053aa:	c3                   	ret
+
+f01053ab <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f01053ab:	55                   	push   %ebp
+f01053ac:	89 e5                	mov    %esp,%ebp
+f01053ae:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f01053b1:	ff 75 10             	push   0x10(%ebp)
+f01053b4:	ff 75 0c             	push   0xc(%ebp)
+f01053b7:	ff 75 08             	push   0x8(%ebp)
+f01053ba:	e8 8a ff ff ff       	call   f0105349 <memmove>
+}
+f01053bf:	c9                   	leave
+f01053c0:	c3                   	ret
+
+f01053c1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f01053c1:	55                   	push   %ebp
+f01053c2:	89 e5                	mov    %esp,%ebp
+f01053c4:	56                   	push   %esi
+f01053c5:	53                   	push   %ebx
+f01053c6:	8b 45 08             	mov    0x8(%ebp),%eax
+f01053c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01053cc:	89 c6                	mov    %eax,%esi
+f01053ce:	03 75 10             	add    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f01053d1:	eb 06                	jmp    f01053d9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f01053d3:	83 c0 01             	add    $0x1,%eax
+f01053d6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f01053d9:	39 f0                	cmp    %esi,%eax
+f01053db:	74 14                	je     f01053f1 <memcmp+0x30>
+		if (*s1 != *s2)
+f01053dd:	0f b6 08             	movzbl (%eax),%ecx
+f01053e0:	0f b6 1a             	movzbl (%edx),%ebx
+f01053e3:	38 d9                	cmp    %bl,%cl
+f01053e5:	74 ec                	je     f01053d3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f01053e7:	0f b6 c1             	movzbl %cl,%eax
+f01053ea:	0f b6 db             	movzbl %bl,%ebx
+f01053ed:	29 d8                	sub    %ebx,%eax
+f01053ef:	eb 05                	jmp    f01053f6 <memcmp+0x35>
+	}
+
+	return 0;
+f01053f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01053f6:	5b                   	pop    %ebx
+f01053f7:	5e                   	pop    %esi
+f01053f8:	5d                   	pop    %ebp
+f01053f9:	c3                   	ret
+
+f01053fa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f01053fa:	55                   	push   %ebp
+f01053fb:	89 e5                	mov    %esp,%ebp
+f01053fd:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f0105403:	89 c2                	mov    %eax,%edx
+f0105405:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f0105408:	eb 03                	jmp    f010540d <memfind+0x13>
+f010540a:	83 c0 01             	add    $0x1,%eax
+f010540d:	39 d0                	cmp    %edx,%eax
+f010540f:	73 04                	jae    f0105415 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f0105411:	38 08                	cmp    %cl,(%eax)
+f0105413:	75 f5                	jne    f010540a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f0105415:	5d                   	pop    %ebp
+f0105416:	c3                   	ret
+
+f0105417 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f0105417:	55                   	push   %ebp
+f0105418:	89 e5                	mov    %esp,%ebp
+f010541a:	57                   	push   %edi
+f010541b:	56                   	push   %esi
+f010541c:	53                   	push   %ebx
+f010541d:	8b 55 08             	mov    0x8(%ebp),%edx
+f0105420:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f0105423:	eb 03                	jmp    f0105428 <strtol+0x11>
+		s++;
+f0105425:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f0105428:	0f b6 02             	movzbl (%edx),%eax
+f010542b:	3c 20                	cmp    $0x20,%al
+f010542d:	74 f6                	je     f0105425 <strtol+0xe>
+f010542f:	3c 09                	cmp    $0x9,%al
+f0105431:	74 f2                	je     f0105425 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f0105433:	3c 2b                	cmp    $0x2b,%al
+f0105435:	74 2a                	je     f0105461 <strtol+0x4a>
+	int neg = 0;
+f0105437:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f010543c:	3c 2d                	cmp    $0x2d,%al
+f010543e:	74 2b                	je     f010546b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0105440:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f0105446:	75 0f                	jne    f0105457 <strtol+0x40>
+f0105448:	80 3a 30             	cmpb   $0x30,(%edx)
+f010544b:	74 28                	je     f0105475 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f010544d:	85 db                	test   %ebx,%ebx
+f010544f:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0105454:	0f 44 d8             	cmove  %eax,%ebx
+f0105457:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010545c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f010545f:	eb 46                	jmp    f01054a7 <strtol+0x90>
+		s++;
+f0105461:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f0105464:	bf 00 00 00 00       	mov    $0x0,%edi
+f0105469:	eb d5                	jmp    f0105440 <strtol+0x29>
+		s++, neg = 1;
+f010546b:	83 c2 01             	add    $0x1,%edx
+f010546e:	bf 01 00 00 00       	mov    $0x1,%edi
+f0105473:	eb cb                	jmp    f0105440 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0105475:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f0105479:	74 0e                	je     f0105489 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f010547b:	85 db                	test   %ebx,%ebx
+f010547d:	75 d8                	jne    f0105457 <strtol+0x40>
+		s++, base = 8;
+f010547f:	83 c2 01             	add    $0x1,%edx
+f0105482:	bb 08 00 00 00       	mov    $0x8,%ebx
+f0105487:	eb ce                	jmp    f0105457 <strtol+0x40>
+		s += 2, base = 16;
+f0105489:	83 c2 02             	add    $0x2,%edx
+f010548c:	bb 10 00 00 00       	mov    $0x10,%ebx
+f0105491:	eb c4                	jmp    f0105457 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f0105493:	0f be c0             	movsbl %al,%eax
+f0105496:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f0105499:	3b 45 10             	cmp    0x10(%ebp),%eax
+f010549c:	7d 3a                	jge    f01054d8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f010549e:	83 c2 01             	add    $0x1,%edx
+f01054a1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f01054a5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f01054a7:	0f b6 02             	movzbl (%edx),%eax
+f01054aa:	8d 70 d0             	lea    -0x30(%eax),%esi
+f01054ad:	89 f3                	mov    %esi,%ebx
+f01054af:	80 fb 09             	cmp    $0x9,%bl
+f01054b2:	76 df                	jbe    f0105493 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f01054b4:	8d 70 9f             	lea    -0x61(%eax),%esi
+f01054b7:	89 f3                	mov    %esi,%ebx
+f01054b9:	80 fb 19             	cmp    $0x19,%bl
+f01054bc:	77 08                	ja     f01054c6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f01054be:	0f be c0             	movsbl %al,%eax
+f01054c1:	83 e8 57             	sub    $0x57,%eax
+f01054c4:	eb d3                	jmp    f0105499 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f01054c6:	8d 70 bf             	lea    -0x41(%eax),%esi
+f01054c9:	89 f3                	mov    %esi,%ebx
+f01054cb:	80 fb 19             	cmp    $0x19,%bl
+f01054ce:	77 08                	ja     f01054d8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f01054d0:	0f be c0             	movsbl %al,%eax
+f01054d3:	83 e8 37             	sub    $0x37,%eax
+f01054d6:	eb c1                	jmp    f0105499 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f01054d8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f01054dc:	74 05                	je     f01054e3 <strtol+0xcc>
+		*endptr = (char *) s;
+f01054de:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01054e1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f01054e3:	89 c8                	mov    %ecx,%eax
+f01054e5:	f7 d8                	neg    %eax
+f01054e7:	85 ff                	test   %edi,%edi
+f01054e9:	0f 45 c8             	cmovne %eax,%ecx
+}
+f01054ec:	89 c8                	mov    %ecx,%eax
+f01054ee:	5b                   	pop    %ebx
+f01054ef:	5e                   	pop    %esi
+f01054f0:	5f                   	pop    %edi
+f01054f1:	5d                   	pop    %ebp
+f01054f2:	c3                   	ret
+
+f01054f3 <__udivdi3>:
+f01054f3:	57                   	push   %edi
+f01054f4:	56                   	push   %esi
+f01054f5:	53                   	push   %ebx
+f01054f6:	83 ec 20             	sub    $0x20,%esp
+f01054f9:	8b 44 24 30          	mov    0x30(%esp),%eax
+f01054fd:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0105501:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0105505:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0105509:	8b 44 24 38          	mov    0x38(%esp),%eax
+f010550d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0105511:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0105515:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0105519:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010551e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105523:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105528:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f010552f:	00 
+f0105530:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0105537:	00 
+f0105538:	eb 08                	jmp    f0105542 <__udivdi3+0x4f>
+f010553a:	83 e9 01             	sub    $0x1,%ecx
+f010553d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f0105540:	74 68                	je     f01055aa <__udivdi3+0xb7>
+f0105542:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0105546:	01 c0                	add    %eax,%eax
+f0105548:	89 c6                	mov    %eax,%esi
+f010554a:	89 d7                	mov    %edx,%edi
+f010554c:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0105550:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0105554:	0f ad d0             	shrd   %cl,%edx,%eax
+f0105557:	d3 ea                	shr    %cl,%edx
+f0105559:	f6 c1 20             	test   $0x20,%cl
+f010555c:	74 04                	je     f0105562 <__udivdi3+0x6f>
+f010555e:	89 d0                	mov    %edx,%eax
+f0105560:	31 d2                	xor    %edx,%edx
+f0105562:	83 e0 01             	and    $0x1,%eax
+f0105565:	89 04 24             	mov    %eax,(%esp)
+f0105568:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010556f:	00 
+f0105570:	8b 04 24             	mov    (%esp),%eax
+f0105573:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0105577:	09 f0                	or     %esi,%eax
+f0105579:	09 fa                	or     %edi,%edx
+f010557b:	8b 74 24 10          	mov    0x10(%esp),%esi
+f010557f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f0105583:	39 f0                	cmp    %esi,%eax
+f0105585:	89 d3                	mov    %edx,%ebx
+f0105587:	19 fb                	sbb    %edi,%ebx
+f0105589:	72 af                	jb     f010553a <__udivdi3+0x47>
+f010558b:	29 f0                	sub    %esi,%eax
+f010558d:	19 fa                	sbb    %edi,%edx
+f010558f:	89 cf                	mov    %ecx,%edi
+f0105591:	c1 ef 05             	shr    $0x5,%edi
+f0105594:	83 e7 01             	and    $0x1,%edi
+f0105597:	89 fe                	mov    %edi,%esi
+f0105599:	83 f6 01             	xor    $0x1,%esi
+f010559c:	d3 e6                	shl    %cl,%esi
+f010559e:	d3 e7                	shl    %cl,%edi
+f01055a0:	09 74 24 18          	or     %esi,0x18(%esp)
+f01055a4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f01055a8:	eb 90                	jmp    f010553a <__udivdi3+0x47>
+f01055aa:	8b 44 24 18          	mov    0x18(%esp),%eax
+f01055ae:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f01055b2:	83 c4 20             	add    $0x20,%esp
+f01055b5:	5b                   	pop    %ebx
+f01055b6:	5e                   	pop    %esi
+f01055b7:	5f                   	pop    %edi
+f01055b8:	c3                   	ret
+
+f01055b9 <__umoddi3>:
+f01055b9:	55                   	push   %ebp
+f01055ba:	57                   	push   %edi
+f01055bb:	56                   	push   %esi
+f01055bc:	53                   	push   %ebx
+f01055bd:	83 ec 1c             	sub    $0x1c,%esp
+f01055c0:	8b 44 24 30          	mov    0x30(%esp),%eax
+f01055c4:	8b 54 24 34          	mov    0x34(%esp),%edx
+f01055c8:	89 44 24 08          	mov    %eax,0x8(%esp)
+f01055cc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f01055d0:	8b 44 24 38          	mov    0x38(%esp),%eax
+f01055d4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f01055d8:	89 44 24 10          	mov    %eax,0x10(%esp)
+f01055dc:	89 54 24 14          	mov    %edx,0x14(%esp)
+f01055e0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f01055e5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01055ea:	ba 00 00 00 00       	mov    $0x0,%edx
+f01055ef:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+f01055f3:	eb 0e                	jmp    f0105603 <__umoddi3+0x4a>
+f01055f5:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+f01055fa:	8b 74 24 04          	mov    0x4(%esp),%esi
+f01055fe:	83 fe ff             	cmp    $0xffffffff,%esi
+f0105601:	74 49                	je     f010564c <__umoddi3+0x93>
+f0105603:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0105607:	01 c0                	add    %eax,%eax
+f0105609:	89 c3                	mov    %eax,%ebx
+f010560b:	89 d6                	mov    %edx,%esi
+f010560d:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0105611:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0105615:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+f010561a:	0f ad d0             	shrd   %cl,%edx,%eax
+f010561d:	d3 ea                	shr    %cl,%edx
+f010561f:	f6 c1 20             	test   $0x20,%cl
+f0105622:	74 04                	je     f0105628 <__umoddi3+0x6f>
+f0105624:	89 d0                	mov    %edx,%eax
+f0105626:	31 d2                	xor    %edx,%edx
+f0105628:	83 e0 01             	and    $0x1,%eax
+f010562b:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0105630:	89 ea                	mov    %ebp,%edx
+f0105632:	09 d8                	or     %ebx,%eax
+f0105634:	09 f2                	or     %esi,%edx
+f0105636:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+f010563a:	8b 74 24 14          	mov    0x14(%esp),%esi
+f010563e:	39 d8                	cmp    %ebx,%eax
+f0105640:	89 d1                	mov    %edx,%ecx
+f0105642:	19 f1                	sbb    %esi,%ecx
+f0105644:	72 af                	jb     f01055f5 <__umoddi3+0x3c>
+f0105646:	29 d8                	sub    %ebx,%eax
+f0105648:	19 f2                	sbb    %esi,%edx
+f010564a:	eb a9                	jmp    f01055f5 <__umoddi3+0x3c>
+f010564c:	83 c4 1c             	add    $0x1c,%esp
+f010564f:	5b                   	pop    %ebx
+f0105650:	5e                   	pop    %esi
+f0105651:	5f                   	pop    %edi
+f0105652:	5d                   	pop    %ebp
+f0105653:	c3                   	ret